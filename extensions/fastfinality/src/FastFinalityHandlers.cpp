@@ -76,15 +76,26 @@ namespace catapult { namespace fastfinality {
 			std::vector<disruptor::BlockConsumer> blockConsumers;
 			blockConsumers.push_back(consumers::CreateBlockHashCalculatorConsumer(
 				state.config().Immutable.GenerationHash,
-				state.pluginManager().transactionRegistry()));
+				state.pluginManager().transactionRegistry(),
+				pValidatorPool));
 			blockConsumers.emplace_back(consumers::CreateBlockChainCheckConsumer(
 				state.config().Node.MaxBlocksPerSyncAttempt,
 				state.pluginManager().configHolder(),
 				state.timeSupplier()));
+			auto requiresValidationPredicate = ToRequiresValidationPredicate(state.hooks().knownHashPredicate(state.utCache()));
+			if (state.config().Node.ShouldBatchVerifySignatures) {
+				blockConsumers.emplace_back(consumers::CreateBlockSignatureVerificationConsumer(
+					state.config().Immutable.GenerationHash,
+					state.pluginManager().createNotificationPublisher(),
+					pValidatorPool,
+					state.pluginManager().verifiedSignatureCache(),
+					requiresValidationPredicate));
+			}
+
 			blockConsumers.emplace_back(consumers::CreateBlockStatelessValidationConsumer(
 				extensions::CreateStatelessValidator(state.pluginManager()),
 				validators::CreateParallelValidationPolicy(pValidatorPool),
-				ToRequiresValidationPredicate(state.hooks().knownHashPredicate(state.utCache()))));
+				requiresValidationPredicate));
 			blockConsumers.push_back(consumers::CreateBlockValidatorConsumer(
 				state.cache(),
 				state.state(),
@@ -62,6 +62,7 @@ namespace catapult { namespace fastfinality {
 				auto pUnlockedAccounts = CreateUnlockedAccounts(m_harvestingConfig);
 				auto dbrbShardingEnabled = nextConfig.EnableDbrbSharding;
 				auto dbrbShardSize = config.Network.DbrbShardSize;
+				auto dbrbAggregateCertificatesEnabled = nextConfig.EnableDbrbAggregateCertificates;
 				auto pFsmShared = pServiceGroup->pushService([
 						&config,
 						&keyPair = locator.keyPair(),
@@ -72,7 +73,8 @@ namespace catapult { namespace fastfinality {
 						pDbrbPool,
 						pFastFinalityFsmPool,
 						dbrbShardingEnabled,
-						dbrbShardSize](const std::shared_ptr<thread::IoThreadPool>&) {
+						dbrbShardSize,
+						dbrbAggregateCertificatesEnabled](const std::shared_ptr<thread::IoThreadPool>&) {
 					pTransactionSender->init(&keyPair, config.Immutable, dbrbConfig, state.hooks().transactionRangeConsumerFactory()(disruptor::InputSource::Local), pUnlockedAccounts);
 					auto pMessageSender = dbrb::CreateMessageSender(config::ToLocalNode(config), state.nodes(), dbrbConfig.IsDbrbProcess, pDbrbPool, dbrbConfig.ResendMessagesInterval);
 					const auto& pluginManager = state.pluginManager();
@@ -80,7 +82,7 @@ namespace catapult { namespace fastfinality {
 						auto pDbrbProcess = std::make_shared<dbrb::ShardedDbrbProcess>(keyPair, pMessageSender, pDbrbPool, pTransactionSender, pluginManager.dbrbViewFetcher(), dbrbShardSize);
 						return std::make_shared<FastFinalityFsm>(pFastFinalityFsmPool, config, pDbrbProcess, pluginManager);
 					} else {
-						auto pDbrbProcess = std::make_shared<dbrb::DbrbProcess>(keyPair, pMessageSender, pDbrbPool, pTransactionSender, pluginManager.dbrbViewFetcher());
+						auto pDbrbProcess = std::make_shared<dbrb::DbrbProcess>(keyPair, pMessageSender, pDbrbPool, pTransactionSender, pluginManager.dbrbViewFetcher(), dbrbAggregateCertificatesEnabled);
 						return std::make_shared<FastFinalityFsm>(pFastFinalityFsmPool, config, pDbrbProcess, pluginManager);
 					}
 				});
@@ -18,6 +18,9 @@ namespace catapult { namespace dbrb {
 		/// Map that maps views and process IDs to signatures received from respective Acknowledged messages.
 		std::map<std::pair<View, ProcessId>, Signature> Signatures;
 
+		/// Map that maps views and process IDs to BLS signatures received from respective Acknowledged messages.
+		std::map<std::pair<View, ProcessId>, BLSSignature> BlsSignatures;
+
 		/// Map that maps process IDs to signatures received from them.
 		/// Filled when Acknowledged quorum is collected.
 		CertificateType Certificate;
@@ -37,6 +40,9 @@ namespace catapult { namespace dbrb {
 		/// Payload signature.
 		Signature PayloadSignature;
 
+		/// Payload BLS signature, set when aggregate certificates are enabled.
+		BLSSignature BlsPayloadSignature;
+
 		/// Whether the payload has been validated.
 		bool PayloadValidated = false;
 
@@ -11,25 +11,46 @@
 #include "catapult/ionet/PacketPayload.h"
 #include "catapult/thread/IoThreadPool.h"
 #include "catapult/utils/NetworkTime.h"
+#include <algorithm>
 #include <utility>
 
 
 namespace catapult { namespace dbrb {
 
+	namespace {
+		Hash256 CalculatePayloadViewHash(const Payload& payload, const View& view) {
+			uint32_t packetPayloadSize = view.packedSize();
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(packetPayloadSize);
+			auto pBuffer = pPacket->Data();
+			Write(pBuffer, view);
+
+			return CalculateHash({ { reinterpret_cast<const uint8_t*>(payload.get()), payload->Size }, { pPacket->Data(), packetPayloadSize } });
+		}
+
+		DbrbTreeView ToOrderedProcesses(const View& view) {
+			return DbrbTreeView(view.Data.cbegin(), view.Data.cend());
+		}
+	}
+
 	DbrbProcess::DbrbProcess(
 		const crypto::KeyPair& keyPair,
 		std::shared_ptr<MessageSender> pMessageSender,
 		std::shared_ptr<thread::IoThreadPool> pPool,
 		std::shared_ptr<TransactionSender> pTransactionSender,
-		const dbrb::DbrbViewFetcher& dbrbViewFetcher)
+		const dbrb::DbrbViewFetcher& dbrbViewFetcher,
+		bool aggregateCertificatesEnabled)
 			: m_keyPair(keyPair)
 			, m_id(keyPair.publicKey())
+			, m_blsKeyPair(DeriveBlsKeyPair(keyPair))
+			, m_blsKeyAnnouncement(CreateBlsKeyAnnouncement(keyPair, m_blsKeyPair))
+			, m_aggregateCertificatesEnabled(aggregateCertificatesEnabled)
 			, m_pMessageSender(std::move(pMessageSender))
 			, m_pPool(std::move(pPool))
 			, m_strand(m_pPool->ioContext())
 			, m_pTransactionSender(std::move(pTransactionSender))
-			, m_dbrbViewFetcher(dbrbViewFetcher)
-	{}
+			, m_dbrbViewFetcher(dbrbViewFetcher) {
+		m_blsKeyRegistry.add(m_id, m_blsKeyAnnouncement);
+	}
 
 	void DbrbProcess::registerPacketHandlers(ionet::ServerPacketHandlers& packetHandlers) {
 		auto handler = [pThisWeak = weak_from_this()](const auto& packet, auto& context) {
@@ -166,9 +187,13 @@ namespace catapult { namespace dbrb {
 			data.BroadcastView = broadcastView;
 			data.BootstrapView = pThis->m_bootstrapView;
 			data.PayloadSignature = pThis->sign(payload, broadcastView);
+			if (pThis->m_aggregateCertificatesEnabled)
+				data.BlsPayloadSignature = pThis->blsSign(payload, broadcastView);
 
 			CATAPULT_LOG(trace) << "[DBRB] BROADCAST: sending payload " << payload->Type;
 			auto pMessage = std::make_shared<PrepareMessage>(pThis->m_id, payload, broadcastView, data.BootstrapView);
+			if (pThis->m_aggregateCertificatesEnabled)
+				pMessage->SenderBlsKey = pThis->m_blsKeyAnnouncement;
 			pThis->disseminate(pMessage, pMessage->View.Data);
 		});
 	}
@@ -236,12 +261,7 @@ namespace catapult { namespace dbrb {
 
 	Signature DbrbProcess::sign(const Payload& payload, const View& view) const {
 		// Forms a hash based on payload and the broadcast view and signs it.
-		uint32_t packetPayloadSize = view.packedSize();
-		auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(packetPayloadSize);
-		auto pBuffer = pPacket->Data();
-		Write(pBuffer, view);
-
-		auto hash = CalculateHash({ { reinterpret_cast<const uint8_t*>(payload.get()), payload->Size }, { pPacket->Data(), packetPayloadSize } });
+		auto hash = CalculatePayloadViewHash(payload, view);
 		Signature signature;
 		crypto::Sign(m_keyPair, hash, signature);
 
@@ -250,17 +270,67 @@ namespace catapult { namespace dbrb {
 
 	bool DbrbProcess::verify(const ProcessId& signer, const Payload& payload, const View& view, const Signature& signature) {
 		// Verifies a hash based on payload and current view and checks whether the signature is valid.
-		uint32_t packetPayloadSize = view.packedSize();
-		auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(packetPayloadSize);
-		auto pBuffer = pPacket->Data();
-		Write(pBuffer, view);
-
-		auto hash = CalculateHash({ { reinterpret_cast<const uint8_t*>(payload.get()), payload->Size }, { pPacket->Data(), packetPayloadSize } });
+		auto hash = CalculatePayloadViewHash(payload, view);
 
 		bool res = crypto::Verify(signer, hash, signature);
 		return res;
 	}
 
+	bool DbrbProcess::verify(const Payload& payload, const View& view, const CertificateType& certificate) {
+		auto hash = CalculatePayloadViewHash(payload, view);
+		return std::all_of(certificate.cbegin(), certificate.cend(), [&hash](const auto& pair) {
+			return crypto::Verify(pair.first, hash, pair.second);
+		});
+	}
+
+	BLSSignature DbrbProcess::blsSign(const Payload& payload, const View& view) const {
+		// Signs the same hash as sign() so that BLS signatures of all processes can be aggregated.
+		auto hash = CalculatePayloadViewHash(payload, view);
+		BLSSignature signature;
+		crypto::Sign(m_blsKeyPair, hash, signature);
+
+		return signature;
+	}
+
+	bool DbrbProcess::verify(const Payload& payload, const View& view, const AggregateCertificate& certificate) const {
+		// Single pairing check instead of verifying signature of every signer.
+		auto processes = ToOrderedProcesses(view);
+		if (GetSigners(certificate, processes).size() < view.quorumSize())
+			return false;
+
+		auto hash = CalculatePayloadViewHash(payload, view);
+		return VerifyAggregateCertificate(certificate, processes, m_blsKeyRegistry, hash);
+	}
+
+	bool DbrbProcess::hasBlsKeys(const View& view, const AggregateCertificate& certificate) const {
+		auto signers = GetSigners(certificate, ToOrderedProcesses(view));
+		return std::all_of(signers.cbegin(), signers.cend(), [this](const auto& signer) {
+			return !!m_blsKeyRegistry.find(signer);
+		});
+	}
+
+	std::optional<AggregateCertificate> DbrbProcess::createAggregateCertificate(const View& view, const BroadcastData& data) const {
+		// Falls back to the regular certificate if any signer did not provide a BLS signature.
+		std::map<ProcessId, BLSSignature> signatures;
+		for (const auto& [processId, signature] : data.Certificate) {
+			auto iter = data.BlsSignatures.find(std::make_pair(view, processId));
+			if (data.BlsSignatures.end() == iter)
+				return std::nullopt;
+
+			signatures.emplace(processId, iter->second);
+		}
+
+		auto certificate = CreateAggregateCertificate(ToOrderedProcesses(view), signatures);
+
+		// BLS signatures are not verified individually, so a single invalid signature is detected here.
+		if (!verify(data.Payload, view, certificate)) {
+			CATAPULT_LOG(debug) << "[DBRB] ACKNOWLEDGED: aggregate certificate is not valid, falling back to regular certificate";
+			return std::nullopt;
+		}
+
+		return certificate;
+	}
+
 
 	// Message callbacks:
 
@@ -287,6 +357,9 @@ namespace catapult { namespace dbrb {
 			return;
 		}
 
+		if (message.SenderBlsKey && !m_blsKeyRegistry.add(message.Sender, *message.SenderBlsKey))
+			CATAPULT_LOG(warning) << "[DBRB] PREPARE: invalid BLS key announcement from " << message.Sender;
+
 		auto payloadHash = CalculatePayloadHash(message.Payload);
 		bool broadcastEnabled = (m_getDbrbModeCallback() == DbrbMode::Running);
 		if (broadcastEnabled) {
@@ -307,12 +380,18 @@ namespace catapult { namespace dbrb {
 			data.BroadcastView = message.View;
 			data.BootstrapView = message.BootstrapView;
 			data.PayloadSignature = sign(message.Payload, message.View);
+			if (m_aggregateCertificatesEnabled)
+				data.BlsPayloadSignature = blsSign(message.Payload, message.View);
+
 			data.PayloadValidated = broadcastEnabled;
 			dataIter = m_broadcastData.find(payloadHash);
 
 			if (broadcastEnabled) {
 				CATAPULT_LOG(trace) << "[DBRB] PREPARE: sending payload " << data.Payload->Type;
 				auto pMessage = std::make_shared<PrepareMessage>(m_id, data.Payload, data.BroadcastView, data.BootstrapView);
+				if (m_aggregateCertificatesEnabled)
+					pMessage->SenderBlsKey = m_blsKeyAnnouncement;
+
 				disseminate(pMessage, pMessage->View.Data);
 			}
 		}
@@ -320,6 +399,9 @@ namespace catapult { namespace dbrb {
 		if (broadcastEnabled) {
 			CATAPULT_LOG(trace) << "[DBRB] PREPARE: Sending Acknowledged message to " << message.Sender;
 			auto pMessage = std::make_shared<AcknowledgedMessage>(m_id, payloadHash, message.View, dataIter->second.PayloadSignature);
+			if (m_aggregateCertificatesEnabled)
+				pMessage->BlsPayloadSignature = dataIter->second.BlsPayloadSignature;
+
 			send(pMessage, message.Sender);
 		}
 	}
@@ -360,6 +442,9 @@ namespace catapult { namespace dbrb {
 		}
 
 		data.Signatures[std::make_pair(message.View, message.Sender)] = message.PayloadSignature;
+		if (message.BlsPayloadSignature)
+			data.BlsSignatures[std::make_pair(message.View, message.Sender)] = *message.BlsPayloadSignature;
+
 		bool quorumCollected = data.QuorumManager.update(message, data.Payload->Type);
 		if (quorumCollected)
 			data.AcknowledgedQuorumCollected = true;
@@ -398,6 +483,9 @@ namespace catapult { namespace dbrb {
 
 			CATAPULT_LOG(trace) << "[DBRB] ACKNOWLEDGED: Disseminating Commit message with payload " << data.Payload->Type;
 			auto pMessage = std::make_shared<CommitMessage>(m_id, message.PayloadHash, data.Certificate, message.View);
+			if (m_aggregateCertificatesEnabled)
+				pMessage->AggregateCertificate = createAggregateCertificate(message.View, data);
+
 			disseminate(pMessage, message.View.Data);
 		}
 	}
@@ -428,11 +516,19 @@ namespace catapult { namespace dbrb {
 
 		CATAPULT_LOG(trace) << "[DBRB] COMMIT: payload " << data.Payload->Type << " from " << message.Sender;
 
-		for (const auto& [signer, signature] : message.Certificate) {
-			if (!verify(signer, data.Payload, message.View, signature)) {
-				CATAPULT_LOG(warning) << "[DBRB] COMMIT: message with payload " << data.Payload->Type << " from " << message.Sender << " is REJECTED: signature is not valid";
+		// Signers announce their BLS keys in Prepare messages, which can arrive after the Commit message,
+		// so the regular certificate is verified instead when a key of any signer is unknown.
+		bool isAggregateCertificateVerified = false;
+		if (message.AggregateCertificate && hasBlsKeys(message.View, *message.AggregateCertificate)) {
+			if (!verify(data.Payload, message.View, *message.AggregateCertificate)) {
+				CATAPULT_LOG(warning) << "[DBRB] COMMIT: message with payload " << data.Payload->Type << " from " << message.Sender << " is REJECTED: aggregate signature is not valid";
 				return;
 			}
+
+			isAggregateCertificateVerified = true;
+		} else if (!verify(data.Payload, message.View, message.Certificate)) {
+			CATAPULT_LOG(warning) << "[DBRB] COMMIT: message with payload " << data.Payload->Type << " from " << message.Sender << " is REJECTED: signature is not valid";
+			return;
 		}
 
 		if (m_getDbrbModeCallback() != DbrbMode::Running) {
@@ -453,8 +549,19 @@ namespace catapult { namespace dbrb {
 		if (!data.CommitMessageDisseminated) {
 			data.CommitMessageDisseminated = true;
 
+			// Only verified certificates are relayed, otherwise a faulty sender could pair a valid certificate with an invalid one
+			// and make the processes that verify the invalid one reject an honest commit. The regular certificate is verified
+			// here once per payload because it is still needed by the processes that don't know BLS keys of all signers.
 			CATAPULT_LOG(trace) << "[DBRB] COMMIT: Disseminating Commit message with payload " << data.Payload->Type;
-			auto pMessage = std::make_shared<CommitMessage>(m_id, message.PayloadHash, message.Certificate, message.View);
+			auto pMessage = std::make_shared<CommitMessage>(m_id, message.PayloadHash, CertificateType(), message.View);
+			if (!isAggregateCertificateVerified || verify(data.Payload, message.View, message.Certificate))
+				pMessage->Certificate = message.Certificate;
+			else
+				CATAPULT_LOG(warning) << "[DBRB] COMMIT: not relaying invalid certificate of message with payload " << data.Payload->Type << " from " << message.Sender;
+
+			if (isAggregateCertificateVerified)
+				pMessage->AggregateCertificate = message.AggregateCertificate;
+
 			disseminate(pMessage, message.View.Data);
 		}
 
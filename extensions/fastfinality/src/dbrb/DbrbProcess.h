@@ -29,7 +29,8 @@ namespace catapult { namespace dbrb {
 			std::shared_ptr<MessageSender> pMessageSender,
 			std::shared_ptr<thread::IoThreadPool> pPool,
 			std::shared_ptr<TransactionSender> pTransactionSender,
-			const dbrb::DbrbViewFetcher& dbrbViewFetcher);
+			const dbrb::DbrbViewFetcher& dbrbViewFetcher,
+			bool aggregateCertificatesEnabled = false);
 
 	public:
 		/// Broadcast arbitrary \c payload into the system.
@@ -57,6 +58,11 @@ namespace catapult { namespace dbrb {
 
 		Signature sign(const Payload& payload, const View& view) const;
 		static bool verify(const ProcessId&, const Payload&, const View&, const Signature&);
+		static bool verify(const Payload&, const View&, const CertificateType&);
+		BLSSignature blsSign(const Payload& payload, const View& view) const;
+		bool verify(const Payload&, const View&, const AggregateCertificate&) const;
+		bool hasBlsKeys(const View&, const AggregateCertificate&) const;
+		std::optional<AggregateCertificate> createAggregateCertificate(const View& view, const BroadcastData& data) const;
 
 		void onPrepareMessageReceived(const PrepareMessage&);
 		static void onAcknowledgedDeclinedMessageReceived(const AcknowledgedDeclinedMessage&);
@@ -70,6 +76,10 @@ namespace catapult { namespace dbrb {
 	protected:
 		const crypto::KeyPair& m_keyPair;
 		ProcessId m_id;
+		crypto::BLSKeyPair m_blsKeyPair;
+		BlsKeyAnnouncement m_blsKeyAnnouncement;
+		BlsKeyRegistry m_blsKeyRegistry;
+		bool m_aggregateCertificatesEnabled;
 		View m_currentView;
 		View m_bootstrapView;
 		std::map<Hash256, BroadcastData> m_broadcastData;
@@ -0,0 +1,353 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "catapult/crypto/Signer.h"
+#include "catapult/dbrb/AggregateCertificate.h"
+#include "catapult/dbrb/DbrbUtils.h"
+#include "tests/test/core/AddressTestUtils.h"
+#include "tests/TestHarness.h"
+#include <numeric>
+
+namespace catapult { namespace dbrb {
+
+#define TEST_CLASS AggregateCertificateTests
+
+	namespace {
+		struct ProcessKeys {
+			crypto::KeyPair KeyPair;
+			crypto::BLSKeyPair BlsKeyPair;
+		};
+
+		std::vector<ProcessKeys> GenerateProcessKeys(size_t count) {
+			std::vector<ProcessKeys> keys;
+			for (auto i = 0u; i < count; ++i) {
+				auto keyPair = test::GenerateKeyPair();
+				auto blsKeyPair = DeriveBlsKeyPair(keyPair);
+				keys.push_back(ProcessKeys{ std::move(keyPair), std::move(blsKeyPair) });
+			}
+
+			return keys;
+		}
+
+		DbrbTreeView GetProcesses(const std::vector<ProcessKeys>& keys) {
+			DbrbTreeView processes;
+			for (const auto& key : keys)
+				processes.push_back(key.KeyPair.publicKey());
+
+			return processes;
+		}
+
+		BlsKeyRegistry CreateRegistry(const std::vector<ProcessKeys>& keys, const std::vector<size_t>& indexes) {
+			BlsKeyRegistry registry;
+			for (auto index : indexes)
+				registry.add(keys[index].KeyPair.publicKey(), CreateBlsKeyAnnouncement(keys[index].KeyPair, keys[index].BlsKeyPair));
+
+			return registry;
+		}
+
+		BlsKeyRegistry CreateRegistry(const std::vector<ProcessKeys>& keys) {
+			std::vector<size_t> indexes(keys.size());
+			std::iota(indexes.begin(), indexes.end(), 0);
+			return CreateRegistry(keys, indexes);
+		}
+
+		std::map<ProcessId, BLSSignature> Sign(const std::vector<ProcessKeys>& keys, const std::vector<size_t>& signerIndexes, const Hash256& hash) {
+			std::map<ProcessId, BLSSignature> signatures;
+			for (auto index : signerIndexes) {
+				BLSSignature signature;
+				crypto::Sign(keys[index].BlsKeyPair, hash, signature);
+				signatures.emplace(keys[index].KeyPair.publicKey(), signature);
+			}
+
+			return signatures;
+		}
+	}
+
+	// region key derivation and announcements
+
+	TEST(TEST_CLASS, DeriveBlsKeyPairIsDeterministic) {
+		// Arrange:
+		auto keyPair = test::GenerateKeyPair();
+
+		// Act:
+		auto blsKeyPair1 = DeriveBlsKeyPair(keyPair);
+		auto blsKeyPair2 = DeriveBlsKeyPair(keyPair);
+
+		// Assert:
+		EXPECT_EQ(blsKeyPair1.publicKey(), blsKeyPair2.publicKey());
+	}
+
+	TEST(TEST_CLASS, DeriveBlsKeyPairDerivesDifferentKeysForDifferentProcesses) {
+		// Act:
+		auto blsKeyPair1 = DeriveBlsKeyPair(test::GenerateKeyPair());
+		auto blsKeyPair2 = DeriveBlsKeyPair(test::GenerateKeyPair());
+
+		// Assert:
+		EXPECT_NE(blsKeyPair1.publicKey(), blsKeyPair2.publicKey());
+	}
+
+	TEST(TEST_CLASS, CanVerifyValidAnnouncement) {
+		// Arrange:
+		auto keys = GenerateProcessKeys(1);
+		auto announcement = CreateBlsKeyAnnouncement(keys[0].KeyPair, keys[0].BlsKeyPair);
+
+		// Act + Assert:
+		EXPECT_EQ(keys[0].BlsKeyPair.publicKey(), announcement.PublicKey);
+		EXPECT_TRUE(VerifyBlsKeyAnnouncement(keys[0].KeyPair.publicKey(), announcement));
+	}
+
+	TEST(TEST_CLASS, CannotVerifyAnnouncementOfOtherProcess) {
+		// Arrange:
+		auto keys = GenerateProcessKeys(2);
+		auto announcement = CreateBlsKeyAnnouncement(keys[0].KeyPair, keys[0].BlsKeyPair);
+
+		// Act + Assert:
+		EXPECT_FALSE(VerifyBlsKeyAnnouncement(keys[1].KeyPair.publicKey(), announcement));
+	}
+
+	TEST(TEST_CLASS, CannotVerifyAnnouncementWithoutProofOfPossession) {
+		// Arrange: bind other process BLS key, which is not possessed by the announcing process
+		auto keys = GenerateProcessKeys(2);
+		auto announcement = CreateBlsKeyAnnouncement(keys[0].KeyPair, keys[0].BlsKeyPair);
+		auto otherAnnouncement = CreateBlsKeyAnnouncement(keys[1].KeyPair, keys[1].BlsKeyPair);
+		announcement.ProofOfPossession = otherAnnouncement.ProofOfPossession;
+
+		// Act + Assert:
+		EXPECT_FALSE(VerifyBlsKeyAnnouncement(keys[0].KeyPair.publicKey(), announcement));
+	}
+
+	TEST(TEST_CLASS, CannotVerifyAnnouncementWithInvalidBinding) {
+		// Arrange:
+		auto keys = GenerateProcessKeys(1);
+		auto announcement = CreateBlsKeyAnnouncement(keys[0].KeyPair, keys[0].BlsKeyPair);
+		announcement.Binding[0] ^= 0xFF;
+
+		// Act + Assert:
+		EXPECT_FALSE(VerifyBlsKeyAnnouncement(keys[0].KeyPair.publicKey(), announcement));
+	}
+
+	// endregion
+
+	// region BlsKeyRegistry
+
+	TEST(TEST_CLASS, RegistryCanAddValidAnnouncement) {
+		// Arrange:
+		auto keys = GenerateProcessKeys(1);
+		BlsKeyRegistry registry;
+
+		// Act:
+		auto result = registry.add(keys[0].KeyPair.publicKey(), CreateBlsKeyAnnouncement(keys[0].KeyPair, keys[0].BlsKeyPair));
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(1u, registry.size());
+		ASSERT_TRUE(registry.find(keys[0].KeyPair.publicKey()));
+		EXPECT_EQ(keys[0].BlsKeyPair.publicKey(), *registry.find(keys[0].KeyPair.publicKey()));
+	}
+
+	TEST(TEST_CLASS, RegistryRejectsInvalidAnnouncement) {
+		// Arrange:
+		auto keys = GenerateProcessKeys(2);
+		BlsKeyRegistry registry;
+
+		// Act:
+		auto result = registry.add(keys[1].KeyPair.publicKey(), CreateBlsKeyAnnouncement(keys[0].KeyPair, keys[0].BlsKeyPair));
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(0u, registry.size());
+		EXPECT_FALSE(registry.find(keys[1].KeyPair.publicKey()));
+	}
+
+	TEST(TEST_CLASS, RegistryKeepsKnownKeyWhenInvalidAnnouncementIsAdded) {
+		// Arrange:
+		auto keys = GenerateProcessKeys(2);
+		auto registry = CreateRegistry(keys, { 0 });
+
+		// Act: try to replace the key of the first process with the key of the second one
+		auto result = registry.add(keys[0].KeyPair.publicKey(), CreateBlsKeyAnnouncement(keys[1].KeyPair, keys[1].BlsKeyPair));
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(keys[0].BlsKeyPair.publicKey(), *registry.find(keys[0].KeyPair.publicKey()));
+	}
+
+	TEST(TEST_CLASS, RegistryRemovesLeastRecentlyAddedKeyWhenFull) {
+		// Arrange:
+		auto keys = GenerateProcessKeys(4);
+		BlsKeyRegistry registry(3);
+		for (auto i = 0u; i < 3; ++i)
+			registry.add(keys[i].KeyPair.publicKey(), CreateBlsKeyAnnouncement(keys[i].KeyPair, keys[i].BlsKeyPair));
+
+		// Act:
+		auto result = registry.add(keys[3].KeyPair.publicKey(), CreateBlsKeyAnnouncement(keys[3].KeyPair, keys[3].BlsKeyPair));
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(3u, registry.size());
+		EXPECT_FALSE(registry.find(keys[0].KeyPair.publicKey()));
+		for (auto i = 1u; i < 4; ++i)
+			EXPECT_TRUE(!!registry.find(keys[i].KeyPair.publicKey())) << "process " << i;
+	}
+
+	TEST(TEST_CLASS, RegistryDoesNotRemoveKeysWhenKnownAnnouncementIsAddedToFullRegistry) {
+		// Arrange:
+		auto keys = GenerateProcessKeys(2);
+		BlsKeyRegistry registry(2);
+		for (auto i = 0u; i < 2; ++i)
+			registry.add(keys[i].KeyPair.publicKey(), CreateBlsKeyAnnouncement(keys[i].KeyPair, keys[i].BlsKeyPair));
+
+		// Act:
+		auto result = registry.add(keys[0].KeyPair.publicKey(), CreateBlsKeyAnnouncement(keys[0].KeyPair, keys[0].BlsKeyPair));
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(2u, registry.size());
+		EXPECT_TRUE(!!registry.find(keys[0].KeyPair.publicKey()));
+		EXPECT_TRUE(!!registry.find(keys[1].KeyPair.publicKey()));
+	}
+
+	// endregion
+
+	// region CreateAggregateCertificate / GetSigners
+
+	TEST(TEST_CLASS, CreateAggregateCertificateSetsBitsOfSigners) {
+		// Arrange:
+		auto keys = GenerateProcessKeys(10);
+		auto processes = GetProcesses(keys);
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+
+		// Act:
+		auto certificate = CreateAggregateCertificate(processes, Sign(keys, { 0, 3, 8, 9 }, hash));
+
+		// Assert:
+		EXPECT_EQ(std::vector<uint8_t>({ 0x09, 0x03 }), certificate.SignerBitmap);
+		EXPECT_EQ(DbrbTreeView({ processes[0], processes[3], processes[8], processes[9] }), GetSigners(certificate, processes));
+	}
+
+	TEST(TEST_CLASS, CreateAggregateCertificateIgnoresSignaturesOfUnknownProcesses) {
+		// Arrange:
+		auto keys = GenerateProcessKeys(4);
+		auto processes = GetProcesses(keys);
+		processes.pop_back();
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+
+		// Act:
+		auto certificate = CreateAggregateCertificate(processes, Sign(keys, { 1, 3 }, hash));
+
+		// Assert:
+		EXPECT_EQ(std::vector<uint8_t>({ 0x02 }), certificate.SignerBitmap);
+		EXPECT_EQ(DbrbTreeView({ processes[1] }), GetSigners(certificate, processes));
+	}
+
+	TEST(TEST_CLASS, GetSignersReturnsEmptyWhenBitmapSizeDoesNotMatchProcesses) {
+		// Arrange:
+		auto processes = GetProcesses(GenerateProcessKeys(3));
+		AggregateCertificate certificate{ BLSSignature(), { 0x01, 0x00 } };
+
+		// Act + Assert:
+		EXPECT_TRUE(GetSigners(certificate, processes).empty());
+	}
+
+	TEST(TEST_CLASS, GetSignersReturnsEmptyWhenPaddingBitIsSet) {
+		// Arrange:
+		auto processes = GetProcesses(GenerateProcessKeys(3));
+		AggregateCertificate certificate{ BLSSignature(), { 0x09 } };
+
+		// Act + Assert:
+		EXPECT_TRUE(GetSigners(certificate, processes).empty());
+	}
+
+	// endregion
+
+	// region VerifyAggregateCertificate
+
+	namespace {
+		struct VerificationContext {
+		public:
+			VerificationContext()
+					: Keys(GenerateProcessKeys(7))
+					, Processes(GetProcesses(Keys))
+					, Registry(CreateRegistry(Keys))
+					, Hash(test::GenerateRandomByteArray<Hash256>())
+					, Certificate(CreateAggregateCertificate(Processes, Sign(Keys, { 0, 1, 2, 4, 6 }, Hash)))
+			{}
+
+		public:
+			std::vector<ProcessKeys> Keys;
+			DbrbTreeView Processes;
+			BlsKeyRegistry Registry;
+			Hash256 Hash;
+			AggregateCertificate Certificate;
+		};
+	}
+
+	TEST(TEST_CLASS, CanVerifyValidAggregateCertificate) {
+		// Arrange:
+		VerificationContext context;
+
+		// Act + Assert:
+		EXPECT_TRUE(VerifyAggregateCertificate(context.Certificate, context.Processes, context.Registry, context.Hash));
+	}
+
+	TEST(TEST_CLASS, CannotVerifyAggregateCertificateOfOtherHash) {
+		// Arrange:
+		VerificationContext context;
+
+		// Act + Assert:
+		EXPECT_FALSE(VerifyAggregateCertificate(context.Certificate, context.Processes, context.Registry, test::GenerateRandomByteArray<Hash256>()));
+	}
+
+	TEST(TEST_CLASS, CannotVerifyAggregateCertificateWithAlteredSigners) {
+		// Arrange: claim signature of a process that did not sign
+		VerificationContext context;
+		context.Certificate.SignerBitmap[0] |= 0x08;
+
+		// Act + Assert:
+		EXPECT_FALSE(VerifyAggregateCertificate(context.Certificate, context.Processes, context.Registry, context.Hash));
+	}
+
+	TEST(TEST_CLASS, CannotVerifyAggregateCertificateWhenSignerKeyIsUnknown) {
+		// Arrange:
+		VerificationContext context;
+		auto registry = CreateRegistry(context.Keys, { 0, 1, 2, 4 });
+
+		// Act + Assert:
+		EXPECT_FALSE(VerifyAggregateCertificate(context.Certificate, context.Processes, registry, context.Hash));
+	}
+
+	TEST(TEST_CLASS, CannotVerifyAggregateCertificateWithoutSigners) {
+		// Arrange:
+		VerificationContext context;
+		context.Certificate.SignerBitmap[0] = 0;
+
+		// Act + Assert:
+		EXPECT_FALSE(VerifyAggregateCertificate(context.Certificate, context.Processes, context.Registry, context.Hash));
+	}
+
+	// endregion
+
+	// region serialization
+
+	TEST(TEST_CLASS, CanRoundtripAggregateCertificate) {
+		// Arrange:
+		AggregateCertificate certificate{ test::GenerateRandomByteArray<BLSSignature>(), { 0x12, 0x34, 0x05 } };
+		std::vector<uint8_t> buffer(certificate.packedSize());
+
+		// Act:
+		auto* pWriteBuffer = buffer.data();
+		Write(pWriteBuffer, certificate);
+		const auto* pReadBuffer = const_cast<const uint8_t*>(buffer.data());
+		auto result = Read<AggregateCertificate>(pReadBuffer);
+
+		// Assert:
+		EXPECT_EQ(buffer.data() + buffer.size(), pWriteBuffer);
+		EXPECT_EQ(buffer.data() + buffer.size(), pReadBuffer);
+		EXPECT_EQ(certificate, result);
+	}
+
+	// endregion
+}}
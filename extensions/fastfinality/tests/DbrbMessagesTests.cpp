@@ -50,6 +50,30 @@ namespace catapult { namespace fastfinality {
 				EXPECT_EQ(originalMessage.BootstrapView, unpackedMessage.BootstrapView);
 				EXPECT_EQ(originalMessage.Payload->Size, unpackedMessage.Payload->Size);
 				EXPECT_EQ_MEMORY(originalMessage.Payload.get(), unpackedMessage.Payload.get(), originalMessage.Payload->Size);
+				EXPECT_FALSE(unpackedMessage.SenderBlsKey);
+			});
+	}
+
+	TEST(TEST_CLASS, ValidatePrepareMessageSerializationWithBlsKey) {
+		RunMessageSerializationTest<dbrb::PrepareMessage>([](const auto& nodes) {
+				dbrb::View view;
+				for (const auto& node : nodes)
+					view.Data.emplace(node);
+				auto payload = ionet::CreateSharedPacket<RemoteNodeStatePacket>();
+				auto message = dbrb::PrepareMessage(nodes[0], payload, view, view);
+				message.SenderBlsKey = dbrb::BlsKeyAnnouncement{
+					test::GenerateRandomByteArray<BLSPublicKey>(),
+					test::GenerateRandomByteArray<BLSSignature>(),
+					test::GenerateRandomByteArray<Signature>()
+				};
+				return message;
+			},
+			[](const dbrb::PrepareMessage& originalMessage, const dbrb::PrepareMessage& unpackedMessage) {
+				EXPECT_EQ(originalMessage.View, unpackedMessage.View);
+				EXPECT_EQ(originalMessage.BootstrapView, unpackedMessage.BootstrapView);
+				EXPECT_EQ_MEMORY(originalMessage.Payload.get(), unpackedMessage.Payload.get(), originalMessage.Payload->Size);
+				ASSERT_TRUE(unpackedMessage.SenderBlsKey);
+				EXPECT_EQ(*originalMessage.SenderBlsKey, *unpackedMessage.SenderBlsKey);
 			});
 	}
 
@@ -76,6 +100,27 @@ namespace catapult { namespace fastfinality {
 			[](const dbrb::AcknowledgedMessage& originalMessage, const dbrb::AcknowledgedMessage& unpackedMessage) {
 				EXPECT_EQ(originalMessage.View, unpackedMessage.View);
 				EXPECT_EQ(originalMessage.PayloadHash, unpackedMessage.PayloadHash);
+				EXPECT_FALSE(unpackedMessage.BlsPayloadSignature);
+			});
+	}
+
+	TEST(TEST_CLASS, ValidateAcknowledgedMessageSerializationWithBlsSignature) {
+		RunMessageSerializationTest<dbrb::AcknowledgedMessage>([](const auto& nodes) {
+				dbrb::View view;
+				for (const auto& node : nodes)
+					view.Data.emplace(node);
+				auto payload = ionet::CreateSharedPacket<RemoteNodeStatePacket>();
+				auto payloadHash = dbrb::CalculatePayloadHash(payload);
+				auto message = dbrb::AcknowledgedMessage(nodes[0], payloadHash, view, test::GenerateRandomByteArray<Signature>());
+				message.BlsPayloadSignature = test::GenerateRandomByteArray<BLSSignature>();
+				return message;
+			},
+			[](const dbrb::AcknowledgedMessage& originalMessage, const dbrb::AcknowledgedMessage& unpackedMessage) {
+				EXPECT_EQ(originalMessage.View, unpackedMessage.View);
+				EXPECT_EQ(originalMessage.PayloadHash, unpackedMessage.PayloadHash);
+				EXPECT_EQ(originalMessage.PayloadSignature, unpackedMessage.PayloadSignature);
+				ASSERT_TRUE(unpackedMessage.BlsPayloadSignature);
+				EXPECT_EQ(*originalMessage.BlsPayloadSignature, *unpackedMessage.BlsPayloadSignature);
 			});
 	}
 
@@ -96,6 +141,26 @@ namespace catapult { namespace fastfinality {
 			[](const dbrb::CommitMessage& originalMessage, const dbrb::CommitMessage& unpackedMessage) {
 			 	EXPECT_EQ(originalMessage.PayloadHash, unpackedMessage.PayloadHash);
 				EXPECT_EQ(originalMessage.View, unpackedMessage.View);
+				EXPECT_FALSE(unpackedMessage.AggregateCertificate);
+			});
+	}
+
+	TEST(TEST_CLASS, ValidateCommitMessageSerializationWithAggregateCertificate) {
+		RunMessageSerializationTest<dbrb::CommitMessage>([](const auto& nodes) {
+				dbrb::View view;
+				view.Data = dbrb::ViewData{ nodes[0], nodes[2], nodes[4] };
+				auto payload = ionet::CreateSharedPacket<RemoteNodeStatePacket>();
+				auto payloadHash = dbrb::CalculatePayloadHash(payload);
+				auto message = dbrb::CommitMessage(nodes[0], payloadHash, {}, view);
+				message.AggregateCertificate = dbrb::AggregateCertificate{ test::GenerateRandomByteArray<BLSSignature>(), { 0x05 } };
+				return message;
+			},
+			[](const dbrb::CommitMessage& originalMessage, const dbrb::CommitMessage& unpackedMessage) {
+				EXPECT_EQ(originalMessage.PayloadHash, unpackedMessage.PayloadHash);
+				EXPECT_EQ(originalMessage.View, unpackedMessage.View);
+				EXPECT_TRUE(unpackedMessage.Certificate.empty());
+				ASSERT_TRUE(unpackedMessage.AggregateCertificate);
+				EXPECT_EQ(*originalMessage.AggregateCertificate, *unpackedMessage.AggregateCertificate);
 			});
 	}
 
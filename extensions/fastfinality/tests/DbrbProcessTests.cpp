@@ -405,6 +405,110 @@ namespace catapult { namespace fastfinality {
 		ASSERT_EQ(pReceiver->disseminationHistory().size(), 1u);
 	}
 
+	namespace {
+		struct CommitCertificates {
+			dbrb::CertificateType Certificate;
+			dbrb::AggregateCertificate AggregateCertificate;
+		};
+
+		CommitCertificates CreateCommitCertificates(
+				const std::vector<std::shared_ptr<MockDbrbProcess>>& dbrbProcessPool,
+				const dbrb::Payload& payload,
+				const dbrb::View& view) {
+			CommitCertificates certificates;
+			std::map<dbrb::ProcessId, BLSSignature> blsSignatures;
+			for (const auto& pProcess : dbrbProcessPool) {
+				certificates.Certificate[pProcess->id()] = pProcess->sign(payload, view);
+				blsSignatures[pProcess->id()] = pProcess->blsSign(payload, view);
+			}
+
+			certificates.AggregateCertificate = dbrb::CreateAggregateCertificate(
+					dbrb::DbrbTreeView(view.Data.cbegin(), view.Data.cend()),
+					blsSignatures);
+			return certificates;
+		}
+
+		std::shared_ptr<dbrb::CommitMessage> ProcessCommitMessageWithCertificates(
+				const std::vector<std::shared_ptr<MockDbrbProcess>>& dbrbProcessPool,
+				const dbrb::Payload& payload,
+				const CommitCertificates& certificates,
+				bool receiverKnowsBlsKeys) {
+			const auto pSender = dbrbProcessPool.front();
+			const auto pReceiver = dbrbProcessPool.back();
+			if (receiverKnowsBlsKeys) {
+				for (const auto& pProcess : dbrbProcessPool)
+					pReceiver->addBlsKey(pProcess->id(), pProcess->blsKeyAnnouncement());
+			}
+
+			const auto payloadHash = dbrb::CalculatePayloadHash(payload);
+			auto& data = pReceiver->broadcastData()[payloadHash];	// Creating correct entry in broadcastData.
+			data.Payload = payload;
+			data.BroadcastView = pSender->currentView();
+
+			auto pMessage = CreateMessage<dbrb::CommitMessage>(pSender->id(), payloadHash, certificates.Certificate, pSender->currentView());
+			pMessage->AggregateCertificate = certificates.AggregateCertificate;
+
+			pReceiver->onCommitMessageReceivedByProcess(*pMessage);
+
+			// Commit message is disseminated to all processes and one Deliver message is sent back to the Sender.
+			const auto& disseminationHistory = pReceiver->disseminationHistory();
+			EXPECT_EQ(2u, disseminationHistory.size());
+			return disseminationHistory.empty() ? nullptr : std::dynamic_pointer_cast<dbrb::CommitMessage>(disseminationHistory.front().first);
+		}
+	}
+
+	TEST(TEST_CLASS, CommitMessageWithVerifiedCertificatesIsRelayedWithBothCertificates) {
+		// Arrange:
+		std::vector<std::shared_ptr<MockDbrbProcess>> DbrbProcessPool;
+		CreateMockDbrbProcesses(DbrbProcessPool, 4, 4, true);
+		const auto payload = CreatePayload();
+		auto certificates = CreateCommitCertificates(DbrbProcessPool, payload, DbrbProcessPool.front()->currentView());
+
+		// Act:
+		auto pRelayedMessage = ProcessCommitMessageWithCertificates(DbrbProcessPool, payload, certificates, true);
+
+		// Assert:
+		ASSERT_TRUE(!!pRelayedMessage);
+		EXPECT_EQ(certificates.Certificate, pRelayedMessage->Certificate);
+		ASSERT_TRUE(!!pRelayedMessage->AggregateCertificate);
+		EXPECT_EQ(certificates.AggregateCertificate, *pRelayedMessage->AggregateCertificate);
+	}
+
+	TEST(TEST_CLASS, CommitMessageWithTamperedCertificateNextToValidAggregateIsNotRelayedWithTamperedCertificate) {
+		// Arrange:
+		std::vector<std::shared_ptr<MockDbrbProcess>> DbrbProcessPool;
+		CreateMockDbrbProcesses(DbrbProcessPool, 4, 4, true);
+		const auto payload = CreatePayload();
+		auto certificates = CreateCommitCertificates(DbrbProcessPool, payload, DbrbProcessPool.front()->currentView());
+		certificates.Certificate.begin()->second[0] ^= 0xFF;
+
+		// Act:
+		auto pRelayedMessage = ProcessCommitMessageWithCertificates(DbrbProcessPool, payload, certificates, true);
+
+		// Assert: the valid aggregate is relayed without the tampered certificate
+		ASSERT_TRUE(!!pRelayedMessage);
+		EXPECT_TRUE(pRelayedMessage->Certificate.empty());
+		ASSERT_TRUE(!!pRelayedMessage->AggregateCertificate);
+		EXPECT_EQ(certificates.AggregateCertificate, *pRelayedMessage->AggregateCertificate);
+	}
+
+	TEST(TEST_CLASS, CommitMessageWithUnverifiableAggregateIsRelayedWithoutAggregate) {
+		// Arrange:
+		std::vector<std::shared_ptr<MockDbrbProcess>> DbrbProcessPool;
+		CreateMockDbrbProcesses(DbrbProcessPool, 4, 4, true);
+		const auto payload = CreatePayload();
+		auto certificates = CreateCommitCertificates(DbrbProcessPool, payload, DbrbProcessPool.front()->currentView());
+		certificates.AggregateCertificate.Signature[0] ^= 0xFF;
+
+		// Act: receiver doesn't know BLS keys of the signers, so it verifies the regular certificate
+		auto pRelayedMessage = ProcessCommitMessageWithCertificates(DbrbProcessPool, payload, certificates, false);
+
+		// Assert:
+		ASSERT_TRUE(!!pRelayedMessage);
+		EXPECT_EQ(certificates.Certificate, pRelayedMessage->Certificate);
+		EXPECT_FALSE(!!pRelayedMessage->AggregateCertificate);
+	}
+
 	// endregion
 
 	// region DeliverMessage
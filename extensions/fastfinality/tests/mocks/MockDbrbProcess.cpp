@@ -15,14 +15,15 @@ namespace catapult { namespace mocks {
 		std::vector<std::shared_ptr<MockDbrbProcess>>& dbrbProcessPool,
 		bool fakeDissemination,
 		const ionet::NodeContainer& nodeContainer,
-		const crypto::KeyPair& keyPair,
+		crypto::KeyPair&& keyPair,
 		const std::shared_ptr<thread::IoThreadPool>& pPool,
 		const dbrb::DbrbViewFetcher& dbrbViewFetcher,
 		const dbrb::DbrbConfiguration& dbrbConfig)
-			: DbrbProcess(
-				keyPair,
+			: KeyPairOwner(std::move(keyPair)),
+			DbrbProcess(
+				OwnedKeyPair,
 				dbrb::CreateMessageSender(ionet::Node{
-					keyPair.publicKey(),
+					OwnedKeyPair.publicKey(),
 					ionet::NodeEndpoint(),
 					ionet::NodeMetadata() },
 					nodeContainer,
@@ -98,6 +99,18 @@ namespace catapult { namespace mocks {
 		return signature;
 	}
 
+	BLSSignature MockDbrbProcess::blsSign(const dbrb::Payload& payload, const dbrb::View& view) const {
+		return DbrbProcess::blsSign(payload, view);
+	}
+
+	const dbrb::BlsKeyAnnouncement& MockDbrbProcess::blsKeyAnnouncement() const {
+		return m_blsKeyAnnouncement;
+	}
+
+	void MockDbrbProcess::addBlsKey(const dbrb::ProcessId& processId, const dbrb::BlsKeyAnnouncement& announcement) {
+		m_blsKeyRegistry.add(processId, announcement);
+	}
+
 	void MockDbrbProcess::disseminate(const std::shared_ptr<dbrb::Message>& pMessage, std::set<dbrb::ProcessId> recipients) {
 		auto pPacket = pMessage->toNetworkPacket();
 		m_disseminationHistory.emplace_back(pMessage, recipients);
@@ -189,6 +202,10 @@ namespace catapult { namespace mocks {
 		send(pMessage, message.Sender);
 	}
 
+	void MockDbrbProcess::onCommitMessageReceivedByProcess(const dbrb::CommitMessage& message) {
+		DbrbProcess::onCommitMessageReceived(message);
+	}
+
 	const std::set<Hash256>& MockDbrbProcess::deliveredPayloads() {
 		return m_deliveredPayloads;
 	}
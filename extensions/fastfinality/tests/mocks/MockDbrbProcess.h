@@ -17,16 +17,28 @@
 
 namespace catapult { namespace mocks {
 
-	class MockDbrbProcess : public dbrb::DbrbProcess {
+	namespace detail {
+		/// Owns the key pair of a mock process, DbrbProcess only keeps a reference to it.
+		struct KeyPairOwner {
+		public:
+			explicit KeyPairOwner(crypto::KeyPair&& keyPair) : OwnedKeyPair(std::move(keyPair))
+			{}
+
+		public:
+			crypto::KeyPair OwnedKeyPair;
+		};
+	}
+
+	class MockDbrbProcess : private detail::KeyPairOwner, public dbrb::DbrbProcess {
 	public:
-		using DisseminationHistory = std::vector<std::pair<const std::shared_ptr<dbrb::Message>&, std::set<dbrb::ProcessId>>>;
+		using DisseminationHistory = std::vector<std::pair<std::shared_ptr<dbrb::Message>, std::set<dbrb::ProcessId>>>;
 
 	public:
 		explicit MockDbrbProcess(
 				std::vector<std::shared_ptr<MockDbrbProcess>>& dbrbProcessPool,
 				bool fakeDissemination = false,
 				const ionet::NodeContainer& nodeContainer = {},
-				const crypto::KeyPair& keyPair = crypto::KeyPair::FromPrivate(test::GenerateRandomPrivateKey()),
+				crypto::KeyPair&& keyPair = crypto::KeyPair::FromPrivate(test::GenerateRandomPrivateKey()),
 				const std::shared_ptr<thread::IoThreadPool>& pPool = test::CreateStartedIoThreadPool(1),
 				const dbrb::DbrbViewFetcher& dbrbViewFetcher = MockDbrbViewFetcher(),
 				const dbrb::DbrbConfiguration& dbrbConfig = dbrb::DbrbConfiguration::Uninitialized());
@@ -39,6 +51,9 @@ namespace catapult { namespace mocks {
 		void broadcast(const dbrb::Payload& payload, std::set<dbrb::ProcessId> recipients) override;
 		void processMessage(const dbrb::Message& message) override;
 		Signature sign(const dbrb::Payload& payload, const dbrb::View& view);
+		BLSSignature blsSign(const dbrb::Payload& payload, const dbrb::View& view) const;
+		const dbrb::BlsKeyAnnouncement& blsKeyAnnouncement() const;
+		void addBlsKey(const dbrb::ProcessId& processId, const dbrb::BlsKeyAnnouncement& announcement);
 
 		void disseminate(const std::shared_ptr<dbrb::Message>& pMessage, std::set<dbrb::ProcessId> recipients) override;
 		void send(const std::shared_ptr<dbrb::Message>& pMessage, const dbrb::ProcessId& recipient) override;
@@ -46,6 +61,7 @@ namespace catapult { namespace mocks {
 		void onAcknowledgedMessageReceived(const dbrb::AcknowledgedMessage& message) override;
 		void onAcknowledgedQuorumCollected(const dbrb::AcknowledgedMessage& message, dbrb::BroadcastData& data);
 		void onCommitMessageReceived(const dbrb::CommitMessage& message) override;
+		void onCommitMessageReceivedByProcess(const dbrb::CommitMessage& message);
 
 		const std::set<Hash256>& deliveredPayloads();
 		std::map<Hash256, dbrb::BroadcastData>& broadcastData();
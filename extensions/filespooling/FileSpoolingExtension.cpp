@@ -29,6 +29,9 @@
 namespace catapult { namespace filespooling {
 
 	namespace {
+		// append messages to large segment files and sync them in batches instead of creating a file per message
+		constexpr io::FileQueueWriterOptions Writer_Options{ 16 * 1024 * 1024, 100 };
+
 		class FileQueueFactory {
 		public:
 			explicit FileQueueFactory(const std::string& dataDirectory)
@@ -37,7 +40,7 @@ namespace catapult { namespace filespooling {
 
 		public:
 			std::unique_ptr<io::FileQueueWriter> create(const std::string& queueName) const {
-				return std::make_unique<io::FileQueueWriter>(m_dataDirectory.spoolDir(queueName).str());
+				return std::make_unique<io::FileQueueWriter>(m_dataDirectory.spoolDir(queueName).str(), "index.dat", Writer_Options);
 			}
 
 		private:
@@ -0,0 +1,95 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "BatchHitEvaluator.h"
+#include "catapult/model/BlockUtils.h"
+#include "catapult/thread/ParallelFor.h"
+#include <atomic>
+
+namespace catapult { namespace harvesting {
+
+	namespace {
+		bool IsHit(
+				const chain::BlockHitPredicate& hitPredicate,
+				chain::BlockHitContext& hitContext,
+				const GenerationHash& parentGenerationHash,
+				const Key& signer) {
+			hitContext.Signer = signer;
+			hitContext.GenerationHash = model::CalculateGenerationHash(parentGenerationHash, signer);
+			return hitPredicate(hitContext);
+		}
+
+		void StoreMin(std::atomic<size_t>& value, size_t candidate) {
+			auto current = value.load();
+			while (candidate < current && !value.compare_exchange_weak(current, candidate))
+			{}
+		}
+	}
+
+	BatchHitEvaluator::BatchHitEvaluator(
+			const std::shared_ptr<config::BlockchainConfigurationHolder>& pConfigHolder,
+			const std::weak_ptr<thread::IoThreadPool>& pPool,
+			size_t minParallelBatchSize)
+			: m_pConfigHolder(pConfigHolder)
+			, m_pPool(pPool)
+			, m_minParallelBatchSize(minParallelBatchSize)
+	{}
+
+	size_t BatchHitEvaluator::findFirstHit(
+			const chain::BlockHitContext& hitContext,
+			const GenerationHash& parentGenerationHash,
+			const std::vector<Key>& signers,
+			const ImportanceMap& importances) const {
+		if (signers.empty())
+			return 0;
+
+		// importances are only read, so the predicate can be shared by all partitions
+		chain::BlockHitPredicate hitPredicate(m_pConfigHolder, [&importances](const auto& key, auto) {
+			auto iter = importances.find(key);
+			return importances.cend() == iter ? Importance() : iter->second;
+		});
+
+		// always evaluate the first signer sequentially because every signer has a hit when hits are not weighted by importance
+		auto signerHitContext = hitContext;
+		if (IsHit(hitPredicate, signerHitContext, parentGenerationHash, signers[0]))
+			return 0;
+
+		auto pPool = m_pPool.lock();
+		if (pPool && signers.size() >= m_minParallelBatchSize)
+			return findFirstHitParallel(*pPool, hitPredicate, hitContext, parentGenerationHash, signers);
+
+		for (auto i = 1u; i < signers.size(); ++i) {
+			if (IsHit(hitPredicate, signerHitContext, parentGenerationHash, signers[i]))
+				return i;
+		}
+
+		return signers.size();
+	}
+
+	size_t BatchHitEvaluator::findFirstHitParallel(
+			thread::IoThreadPool& pool,
+			const chain::BlockHitPredicate& hitPredicate,
+			const chain::BlockHitContext& hitContext,
+			const GenerationHash& parentGenerationHash,
+			const std::vector<Key>& signers) const {
+		// each partition covers a contiguous range of signers, so a partition can stop as soon as a hit is found
+		// in its own range or in any range preceding it; the first signer has already been evaluated
+		std::atomic<size_t> firstHitIndex(signers.size());
+		auto numPartitions = std::max<size_t>(1, pool.numWorkerThreads());
+		thread::ParallelForPartition(pool, signers, numPartitions, [&](auto itBegin, auto itEnd, auto startIndex, auto) {
+			auto partitionHitContext = hitContext;
+			auto index = startIndex;
+			for (auto iter = itBegin; itEnd != iter && index < firstHitIndex; ++iter, ++index) {
+				if (0 != index && IsHit(hitPredicate, partitionHitContext, parentGenerationHash, *iter)) {
+					StoreMin(firstHitIndex, index);
+					return;
+				}
+			}
+		}).get();
+
+		return firstHitIndex;
+	}
+}}
@@ -0,0 +1,60 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#pragma once
+#include "catapult/chain/BlockScorer.h"
+#include "catapult/config_holder/BlockchainConfigurationHolder.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/utils/Hashers.h"
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace catapult { namespace harvesting {
+
+	/// Evaluates block hits of batches of harvesting candidates.
+	class BatchHitEvaluator {
+	public:
+		/// Default minimum number of candidates that are evaluated in parallel.
+		static constexpr size_t Default_Min_Parallel_Batch_Size = 128;
+
+		/// Map of account public keys to prefetched importances.
+		using ImportanceMap = std::unordered_map<Key, Importance, utils::ArrayHasher<Key>>;
+
+	public:
+		/// Creates an evaluator around \a pConfigHolder that uses \a pPool to evaluate batches containing at least
+		/// \a minParallelBatchSize candidates in parallel.
+		/// \note \a pPool is not owned, so all candidates are evaluated sequentially when it is empty or has expired.
+		BatchHitEvaluator(
+				const std::shared_ptr<config::BlockchainConfigurationHolder>& pConfigHolder,
+				const std::weak_ptr<thread::IoThreadPool>& pPool,
+				size_t minParallelBatchSize = Default_Min_Parallel_Batch_Size);
+
+	public:
+		/// Finds the index of the first of \a signers with a hit for the block described by \a hitContext
+		/// on top of a parent block with \a parentGenerationHash given prefetched \a importances.
+		/// Returns the number of signers when no signer has a hit.
+		/// \note Signers without an entry in \a importances are treated as having zero importance.
+		size_t findFirstHit(
+				const chain::BlockHitContext& hitContext,
+				const GenerationHash& parentGenerationHash,
+				const std::vector<Key>& signers,
+				const ImportanceMap& importances) const;
+
+	private:
+		size_t findFirstHitParallel(
+				thread::IoThreadPool& pool,
+				const chain::BlockHitPredicate& hitPredicate,
+				const chain::BlockHitContext& hitContext,
+				const GenerationHash& parentGenerationHash,
+				const std::vector<Key>& signers) const;
+
+	private:
+		std::shared_ptr<config::BlockchainConfigurationHolder> m_pConfigHolder;
+		std::weak_ptr<thread::IoThreadPool> m_pPool;
+		size_t m_minParallelBatchSize;
+	};
+}}
@@ -70,12 +70,14 @@ namespace catapult { namespace harvesting {
 			const std::shared_ptr<config::BlockchainConfigurationHolder>& pConfigHolder,
 			const Key& beneficiary,
 			const UnlockedAccounts& unlockedAccounts,
-			const BlockGenerator& blockGenerator)
+			const BlockGenerator& blockGenerator,
+			const std::weak_ptr<thread::IoThreadPool>& pHitEvaluationPool)
 			: m_cache(cache)
 			, m_pConfigHolder(pConfigHolder)
 			, m_beneficiary(beneficiary)
 			, m_unlockedAccounts(unlockedAccounts)
 			, m_blockGenerator(blockGenerator)
+			, m_hitEvaluator(pConfigHolder, pHitEvaluationPool)
 	{}
 
 	model::UniqueEntityPtr<model::Block> Harvester::harvest(const model::BlockElement& lastBlockElement, Timestamp timestamp) {
@@ -93,26 +95,29 @@ namespace catapult { namespace harvesting {
 		hitContext.FeeInterest = config.Node.FeeInterest;
 		hitContext.FeeInterestDenominator = config.Node.FeeInterestDenominator;
 
-		const auto& accountStateCache = m_cache.sub<cache::AccountStateCache>();
-		chain::BlockHitPredicate hitPredicate(m_pConfigHolder, [&accountStateCache](const auto& key, auto height) {
-			auto lockedCacheView = accountStateCache.createView(height);
-			cache::ReadOnlyAccountStateCache readOnlyCache(*lockedCacheView);
-			cache::ImportanceView view(readOnlyCache);
-			return view.getAccountImportanceOrDefault(key, height);
-		});
-
 		auto unlockedAccountsView = m_unlockedAccounts.view();
-		const crypto::KeyPair* pHarvesterKeyPair = nullptr;
+		std::vector<const crypto::KeyPair*> keyPairs;
+		std::vector<Key> signers;
 		for (const auto& keyPair : unlockedAccountsView) {
-			hitContext.Signer = keyPair.publicKey();
-			hitContext.GenerationHash = model::CalculateGenerationHash(context.ParentContext.GenerationHash, hitContext.Signer);
+			keyPairs.push_back(&keyPair);
+			signers.push_back(keyPair.publicKey());
+		}
 
-			if (hitPredicate(hitContext)) {
-				pHarvesterKeyPair = &keyPair;
-				break;
-			}
+		// prefetch all importances from a single account state view and release it before evaluating hits
+		// (importances are not needed when hits are not weighted by importance)
+		BatchHitEvaluator::ImportanceMap importances;
+		if (!config.Network.EnableWeightedVoting && !config.Network.EnableDbrbFastFinality) {
+			const auto& accountStateCache = m_cache.sub<cache::AccountStateCache>();
+			auto lockedCacheView = accountStateCache.createView(context.Height);
+			cache::ReadOnlyAccountStateCache readOnlyCache(*lockedCacheView);
+			cache::ImportanceView view(readOnlyCache);
+			for (const auto& signer : signers)
+				importances.emplace(signer, view.getAccountImportanceOrDefault(signer, context.Height));
 		}
 
+		auto harvesterIndex = m_hitEvaluator.findFirstHit(hitContext, context.ParentContext.GenerationHash, signers, importances);
+
+		const auto* pHarvesterKeyPair = harvesterIndex < keyPairs.size() ? keyPairs[harvesterIndex] : nullptr;
 		if (!pHarvesterKeyPair)
 			return nullptr;
 
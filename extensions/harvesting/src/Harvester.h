@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "BatchHitEvaluator.h"
 #include "catapult/harvesting_core/HarvesterBlockGenerator.h"
 #include "catapult/harvesting_core/UnlockedAccounts.h"
 #include "catapult/cache/CatapultCache.h"
@@ -35,12 +36,14 @@ namespace catapult { namespace harvesting {
 	public:
 		/// Creates a harvester around a catapult \a cache, \a pConfigHolder, a \a beneficiary,
 		/// an unlocked accounts set (\a unlockedAccounts) and \a blockGenerator used to customize block generation.
+		/// Hits of many unlocked accounts are evaluated in parallel using \a pHitEvaluationPool (optional).
 		explicit Harvester(
 				const cache::CatapultCache& cache,
 				const std::shared_ptr<config::BlockchainConfigurationHolder>& pConfigHolder,
 				const Key& beneficiary,
 				const UnlockedAccounts& unlockedAccounts,
-				const BlockGenerator& blockGenerator);
+				const BlockGenerator& blockGenerator,
+				const std::weak_ptr<thread::IoThreadPool>& pHitEvaluationPool = std::weak_ptr<thread::IoThreadPool>());
 
 	public:
 		/// Creates the best block (if any) harvested by any unlocked account.
@@ -53,5 +56,6 @@ namespace catapult { namespace harvesting {
 		const Key m_beneficiary;
 		const UnlockedAccounts& m_unlockedAccounts;
 		BlockGenerator m_blockGenerator;
+		BatchHitEvaluator m_hitEvaluator;
 	};
 }}
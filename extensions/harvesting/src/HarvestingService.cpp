@@ -27,6 +27,7 @@
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/io/BlockStorageCache.h"
+#include "catapult/thread/MultiServicePool.h"
 
 namespace catapult { namespace harvesting {
 
@@ -71,7 +72,21 @@ namespace catapult { namespace harvesting {
 			});
 		}
 
-		thread::Task CreateHarvestingTask(extensions::ServiceState& state, UnlockedAccounts& unlockedAccounts, const Key& beneficiary) {
+		std::weak_ptr<thread::IoThreadPool> CreateHitEvaluationPool(extensions::ServiceState& state, const HarvestingConfiguration& config) {
+			// only use a pool when there can be many unlocked accounts and it is isolated from the pool running the harvesting task,
+			// which blocks until all hits are evaluated
+			if (config.MaxUnlockedAccounts < BatchHitEvaluator::Default_Min_Parallel_Batch_Size || state.config().Node.ShouldUseSingleThreadPool)
+				return std::weak_ptr<thread::IoThreadPool>();
+
+			// harvesting tasks outlive the pool, so they must not extend its lifetime
+			return state.pool().pushIsolatedPool("hit evaluator");
+		}
+
+		thread::Task CreateHarvestingTask(
+				extensions::ServiceState& state,
+				UnlockedAccounts& unlockedAccounts,
+				const Key& beneficiary,
+				const std::weak_ptr<thread::IoThreadPool>& pHitEvaluationPool) {
 			const auto& cache = state.cache();
 			const auto& pConfigHolder = state.pluginManager().configHolder();
 			const auto& utCache = state.utCache();
@@ -82,7 +97,7 @@ namespace catapult { namespace harvesting {
 			auto blockGenerator = CreateHarvesterBlockGenerator(strategy, utFacadeFactory, utCache);
 			auto pHarvesterTask = std::make_shared<ScheduledHarvesterTask>(
 					CreateHarvesterTaskOptions(state),
-					std::make_unique<Harvester>(cache, pConfigHolder, beneficiary, unlockedAccounts, blockGenerator));
+					std::make_unique<Harvester>(cache, pConfigHolder, beneficiary, unlockedAccounts, blockGenerator, pHitEvaluationPool));
 
 			return thread::CreateNamedTask("harvesting task", [&cache, &unlockedAccounts, pHarvesterTask, pConfigHolder]() {
 				// prune accounts that are not eligible to harvest the next block
@@ -116,7 +131,8 @@ namespace catapult { namespace harvesting {
 
 				// add tasks
 				auto beneficiary = crypto::ParseKey(m_config.Beneficiary);
-				state.tasks().push_back(CreateHarvestingTask(state, *pUnlockedAccounts, beneficiary));
+				auto pHitEvaluationPool = CreateHitEvaluationPool(state, m_config);
+				state.tasks().push_back(CreateHarvestingTask(state, *pUnlockedAccounts, beneficiary, pHitEvaluationPool));
 			}
 
 		private:
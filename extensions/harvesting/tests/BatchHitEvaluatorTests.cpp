@@ -0,0 +1,208 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "harvesting/src/BatchHitEvaluator.h"
+#include "catapult/constants.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/core/mocks/MockBlockchainConfigurationHolder.h"
+#include "tests/test/nodeps/TestConstants.h"
+#include "tests/test/other/MutableBlockchainConfiguration.h"
+#include "tests/TestHarness.h"
+#include <set>
+
+namespace catapult { namespace harvesting {
+
+#define TEST_CLASS BatchHitEvaluatorTests
+
+	namespace {
+		constexpr size_t Num_Signers = 200;
+		constexpr auto Harvesting_Importance = Importance(1'000'000'000);
+
+		auto CreateConfiguration(bool enableWeightedVoting = false) {
+			test::MutableBlockchainConfiguration config;
+			config.Network.TotalChainImportance = test::Default_Total_Chain_Importance;
+			config.Network.GreedDelta = 0.5;
+			config.Network.GreedExponent = 2.0;
+			config.Network.EnableWeightedVoting = enableWeightedVoting;
+			return config.ToConst();
+		}
+
+		chain::BlockHitContext CreateHitContext() {
+			// every account with nonzero importance has a hit because its target exceeds all possible hits
+			chain::BlockHitContext hitContext;
+			hitContext.ElapsedTime = utils::TimeSpan::FromHours(1'000'000);
+			hitContext.Difficulty = Difficulty(NEMESIS_BLOCK_DIFFICULTY);
+			hitContext.Height = Height(123);
+			hitContext.FeeInterest = 1;
+			hitContext.FeeInterestDenominator = 2;
+			return hitContext;
+		}
+
+		class TestContext {
+		public:
+			explicit TestContext(bool enableWeightedVoting = false)
+					: m_pConfigHolder(config::CreateMockConfigurationHolder(CreateConfiguration(enableWeightedVoting)))
+					, m_signers(test::GenerateRandomDataVector<Key>(Num_Signers))
+					, m_parentGenerationHash(test::GenerateRandomByteArray<GenerationHash>())
+			{}
+
+		public:
+			void setHarvesters(const std::set<size_t>& harvesterIndexes) {
+				for (auto index : harvesterIndexes)
+					m_importances[m_signers[index]] = Harvesting_Importance;
+			}
+
+			void setImportance(size_t index, Importance importance) {
+				m_importances[m_signers[index]] = importance;
+			}
+
+		public:
+			size_t findFirstHit(const std::weak_ptr<thread::IoThreadPool>& pPool, size_t minParallelBatchSize) {
+				BatchHitEvaluator evaluator(m_pConfigHolder, pPool, minParallelBatchSize);
+				return evaluator.findFirstHit(CreateHitContext(), m_parentGenerationHash, m_signers, m_importances);
+			}
+
+		private:
+			std::shared_ptr<config::BlockchainConfigurationHolder> m_pConfigHolder;
+			std::vector<Key> m_signers;
+			GenerationHash m_parentGenerationHash;
+			BatchHitEvaluator::ImportanceMap m_importances;
+		};
+
+		struct SequentialTraits {
+			static size_t FindFirstHit(TestContext& context) {
+				return context.findFirstHit(std::weak_ptr<thread::IoThreadPool>(), 1);
+			}
+		};
+
+		struct ParallelTraits {
+			static size_t FindFirstHit(TestContext& context) {
+				std::shared_ptr<thread::IoThreadPool> pPool = test::CreateStartedIoThreadPool(4);
+				return context.findFirstHit(pPool, 1);
+			}
+		};
+	}
+
+#define EVALUATOR_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Sequential) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<SequentialTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Parallel) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ParallelTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	// region findFirstHit
+
+	TEST(TEST_CLASS, FindFirstHitReturnsZeroWhenThereAreNoSigners) {
+		// Arrange:
+		BatchHitEvaluator evaluator(config::CreateMockConfigurationHolder(CreateConfiguration()), std::weak_ptr<thread::IoThreadPool>());
+
+		// Act:
+		auto index = evaluator.findFirstHit(CreateHitContext(), GenerationHash(), {}, BatchHitEvaluator::ImportanceMap());
+
+		// Assert:
+		EXPECT_EQ(0u, index);
+	}
+
+	EVALUATOR_TEST(FindFirstHitReturnsNumSignersWhenNoSignerHasHit) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto index = TTraits::FindFirstHit(context);
+
+		// Assert:
+		EXPECT_EQ(Num_Signers, index);
+	}
+
+	EVALUATOR_TEST(FindFirstHitReturnsFirstSignerWithHit) {
+		for (auto firstHarvesterIndex : std::initializer_list<size_t>{ 0, 1, 49, 50, 51, 137, Num_Signers - 1 }) {
+			// Arrange: add some harvesters following the first one
+			TestContext context;
+			context.setHarvesters({ firstHarvesterIndex, std::min(firstHarvesterIndex + 13, Num_Signers - 1), Num_Signers - 1 });
+
+			// Act:
+			auto index = TTraits::FindFirstHit(context);
+
+			// Assert:
+			EXPECT_EQ(firstHarvesterIndex, index);
+		}
+	}
+
+	EVALUATOR_TEST(FindFirstHitReturnsFirstSignerWhenHitsAreNotWeightedByImportance) {
+		// Arrange: no importances are prefetched
+		TestContext context(true);
+
+		// Act:
+		auto index = TTraits::FindFirstHit(context);
+
+		// Assert: the first signer has a hit without any importance
+		EXPECT_EQ(0u, index);
+	}
+
+	EVALUATOR_TEST(FindFirstHitTreatsSignersWithZeroImportanceAsNonHarvesters) {
+		// Arrange: signers with explicit zero importance precede the first harvester
+		TestContext context;
+		for (auto i = 0u; i < 150; ++i)
+			context.setImportance(i, Importance());
+
+		context.setHarvesters({ 150 });
+
+		// Act:
+		auto index = TTraits::FindFirstHit(context);
+
+		// Assert:
+		EXPECT_EQ(150u, index);
+	}
+
+	// endregion
+
+	// region parallelization
+
+	TEST(TEST_CLASS, FindFirstHitIsSequentialWhenBatchIsTooSmall) {
+		// Arrange:
+		TestContext context;
+		context.setHarvesters({ 150 });
+		std::shared_ptr<thread::IoThreadPool> pPool = test::CreateStartedIoThreadPool(4);
+
+		// Act:
+		auto index = context.findFirstHit(pPool, Num_Signers + 1);
+
+		// Assert:
+		EXPECT_EQ(150u, index);
+	}
+
+	TEST(TEST_CLASS, FindFirstHitIsParallelWhenBatchIsLargeEnough) {
+		// Arrange:
+		TestContext context;
+		context.setHarvesters({ 150 });
+		std::shared_ptr<thread::IoThreadPool> pPool = test::CreateStartedIoThreadPool(4);
+
+		// Act:
+		auto index = context.findFirstHit(pPool, Num_Signers);
+
+		// Assert:
+		EXPECT_EQ(150u, index);
+	}
+
+	TEST(TEST_CLASS, FindFirstHitIsSequentialWhenPoolHasExpired) {
+		// Arrange:
+		TestContext context;
+		context.setHarvesters({ 150 });
+		std::weak_ptr<thread::IoThreadPool> pWeakPool;
+		{
+			std::shared_ptr<thread::IoThreadPool> pPool = test::CreateStartedIoThreadPool(4);
+			pWeakPool = pPool;
+			pPool->join();
+		}
+
+		// Act:
+		auto index = context.findFirstHit(pWeakPool, 1);
+
+		// Assert:
+		EXPECT_EQ(150u, index);
+	}
+
+	// endregion
+}}
@@ -124,7 +124,15 @@ namespace catapult { namespace mongo {
 			auto mongoErrorPolicyMode = extensions::ProcessDisposition::Recovery == bootstrapper.disposition()
 					? MongoErrorPolicy::Mode::Idempotent
 					: MongoErrorPolicy::Mode::Strict;
-			auto pMongoContext = std::make_shared<MongoStorageContext>(dbUri, dbName, pMongoBulkWriter, mongoErrorPolicyMode);
+			auto mongoCacheStorageMode = dbConfig.EnableIncrementalCacheStorage
+					? MongoCacheStorageMode::Incremental
+					: MongoCacheStorageMode::Replace;
+			auto pMongoContext = std::make_shared<MongoStorageContext>(
+					dbUri,
+					dbName,
+					pMongoBulkWriter,
+					mongoErrorPolicyMode,
+					mongoCacheStorageMode);
 			auto pPluginManager = std::make_shared<MongoPluginManager>(*pMongoContext,
 																	   bootstrapper.configHolder(),
 																	   bootstrapper.pluginManager().transactionFeeCalculator());
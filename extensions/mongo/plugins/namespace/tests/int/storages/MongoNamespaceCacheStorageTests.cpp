@@ -151,9 +151,16 @@ namespace catapult { namespace mongo { namespace plugins {
 		}
 	};
 
+	template<typename TTraits>
+	struct IncrementalNamespaceCacheTraits : public TTraits {
+		static constexpr auto Cache_Storage_Mode = MongoCacheStorageMode::Incremental;
+	};
+
 	// modifications that create historical entries (increasing indexes)
 	DEFINE_HISTORICAL_CACHE_STORAGE_TESTS(NamespaceCacheRootModificationTraits, _RootModification)
+	DEFINE_HISTORICAL_CACHE_STORAGE_TESTS(IncrementalNamespaceCacheTraits<NamespaceCacheRootModificationTraits>, _RootModification_Incremental)
 
 	// modifications that create children (path filter is passed path with multiple parts)
 	DEFINE_HISTORICAL_CACHE_STORAGE_TESTS(NamespaceCacheChildModificationTraits, _ChildModification)
+	DEFINE_HISTORICAL_CACHE_STORAGE_TESTS(IncrementalNamespaceCacheTraits<NamespaceCacheChildModificationTraits>, _ChildModification_Incremental)
 }}}
@@ -41,9 +41,21 @@ namespace catapult {
 	}
 
 /// Defines a mongo flat cache storage with \a NAME using \a TRAITS_NAME.
+/// \note Modified elements are updated incrementally when enabled by the storage context.
 #define DEFINE_MONGO_FLAT_CACHE_STORAGE(NAME, TRAITS_NAME) \
-	DEFINE_MONGO_CACHE_STORAGE(NAME, MongoFlatCacheStorage, TRAITS_NAME)
+	DECLARE_MONGO_CACHE_STORAGE(NAME) { \
+		if (mongo::MongoCacheStorageMode::Incremental == storageContext.cacheStorageMode()) \
+			return std::make_unique<storages::MongoIncrementalCacheStorage<TRAITS_NAME>>(storageContext, pConfigHolder); \
+		\
+		return std::make_unique<storages::MongoFlatCacheStorage<TRAITS_NAME>>(storageContext, pConfigHolder); \
+	}
 
 /// Defines a mongo historical cache storage with \a NAME using \a TRAITS_NAME.
+/// \note Only changed documents of modified elements are replaced when enabled by the storage context.
 #define DEFINE_MONGO_HISTORICAL_CACHE_STORAGE(NAME, TRAITS_NAME) \
-	DEFINE_MONGO_CACHE_STORAGE(NAME, MongoHistoricalCacheStorage, TRAITS_NAME)
+	DECLARE_MONGO_CACHE_STORAGE(NAME) { \
+		if (mongo::MongoCacheStorageMode::Incremental == storageContext.cacheStorageMode()) \
+			return std::make_unique<storages::MongoIncrementalHistoricalCacheStorage<TRAITS_NAME>>(storageContext, pConfigHolder); \
+		\
+		return std::make_unique<storages::MongoHistoricalCacheStorage<TRAITS_NAME>>(storageContext, pConfigHolder); \
+	}
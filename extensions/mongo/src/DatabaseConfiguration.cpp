@@ -38,13 +38,14 @@ namespace catapult { namespace mongo {
 		LOAD_DB_PROPERTY(DatabaseUri);
 		LOAD_DB_PROPERTY(DatabaseName);
 		LOAD_DB_PROPERTY(MaxWriterThreads);
+		LOAD_DB_PROPERTY(EnableIncrementalCacheStorage);
 
 #undef LOAD_DB_PROPERTY
 
 		auto pluginsPair = utils::ExtractSectionAsUnorderedSet(bag, "plugins");
 		config.Plugins = pluginsPair.first;
 
-		utils::VerifyBagSizeLte(bag, 3 + pluginsPair.second);
+		utils::VerifyBagSizeLte(bag, 4 + pluginsPair.second);
 		return config;
 	}
 
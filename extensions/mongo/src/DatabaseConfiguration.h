@@ -39,6 +39,9 @@ namespace catapult { namespace mongo {
 		/// Maximum number of database writer threads.
 		uint32_t MaxWriterThreads;
 
+		/// \c true if flat cache storages should only write the fields of modified elements that changed.
+		bool EnableIncrementalCacheStorage;
+
 		/// Named database plugins to enable.
 		std::unordered_set<std::string> Plugins;
 
@@ -39,7 +39,7 @@
 namespace catapult { namespace mongo {
 
 	/// Class for writing bulk data to the mongo database.
-	/// \note The bulk writer supports inserting, upserting and deleting documents.
+	/// \note The bulk writer supports inserting, upserting, updating and deleting documents.
 	class MongoBulkWriter final : public std::enable_shared_from_this<MongoBulkWriter> {
 	private:
 		struct BulkWriteParams {
@@ -146,6 +146,24 @@ namespace catapult { namespace mongo {
 			return bulkWrite<TContainer>(collectionName, entities, appendOperation);
 		}
 
+		/// Updates documents in the collection named \a collectionName matching the specified entity filter (\a createFilter)
+		/// using a one-to-one mapping of \a entities to update documents (\a createUpdate).
+		/// \note Update documents contain update operators (e.g. `$set`) instead of full replacement documents.
+		template<typename TContainer>
+		BulkWriteResultFuture bulkUpdate(
+				const std::string& collectionName,
+				const TContainer& entities,
+				const CreateDocument<typename TContainer::value_type>& createUpdate,
+				const CreateFilter<typename TContainer::value_type>& createFilter) {
+			auto appendOperation = [createUpdate, createFilter](auto& bulk, const auto& entity, auto index) {
+				auto updateDocument = createUpdate(entity, index);
+				auto filter = createFilter(entity);
+				bulk.append(mongocxx::model::update_one(filter.view(), updateDocument.view()));
+			};
+
+			return bulkWrite<TContainer>(collectionName, entities, appendOperation);
+		}
+
 		/// Deletes \a entities from the collection named \a collectionName matching the specified entity filter (\a createFilter).
 		template<typename TContainer>
 		BulkWriteResultFuture bulkDelete(
@@ -77,6 +77,14 @@ namespace catapult { namespace mongo {
 		formatMessageAndThrow("upserting", numExpected, numActual, itemsDescription);
 	}
 
+	void MongoErrorPolicy::checkUpdated(uint64_t numExpected, const BulkWriteResult& result, const std::string& itemsDescription) const {
+		auto numActual = mappers::ToUint32(result.NumMatched);
+		if (CheckExact(numExpected, numActual, m_mode))
+			return;
+
+		formatMessageAndThrow("updating", numExpected, numActual, itemsDescription);
+	}
+
 	void MongoErrorPolicy::formatMessageAndThrow(
 			const char* operation,
 			uint64_t numExpected,
@@ -60,6 +60,9 @@ namespace catapult { namespace mongo {
 		/// Checks that \a result indicates exactly \a numExpected upsertions occurred given \a itemsDescription.
 		void checkUpserted(uint64_t numExpected, const BulkWriteResult& result, const std::string& itemsDescription) const;
 
+		/// Checks that \a result indicates exactly \a numExpected documents were matched by updates given \a itemsDescription.
+		void checkUpdated(uint64_t numExpected, const BulkWriteResult& result, const std::string& itemsDescription) const;
+
 	private:
 		[[noreturn]]
 		void formatMessageAndThrow(
@@ -26,6 +26,15 @@ namespace catapult { namespace mongo { class MongoBulkWriter; } }
 
 namespace catapult { namespace mongo {
 
+	/// Mongo cache storage persistence modes.
+	enum class MongoCacheStorageMode {
+		/// Modified elements are replaced as a whole.
+		Replace,
+
+		/// Modified elements are updated with the fields that changed since they were last saved.
+		Incremental
+	};
+
 	/// Context for creating a mongo storage.
 	class MongoStorageContext {
 	public:
@@ -33,16 +42,19 @@ namespace catapult { namespace mongo {
 		MongoStorageContext() = default;
 
 		/// Creates a storage context for a mongodb-based storage connected to \a uri storing inside database \a databaseName
-		/// with the specified bulk writer (\a pBulkWriter) and error policy mode (\a errorPolicyMode).
+		/// with the specified bulk writer (\a pBulkWriter), error policy mode (\a errorPolicyMode) and
+		/// cache storage mode (\a cacheStorageMode).
 		MongoStorageContext(
 				const mongocxx::uri& uri,
 				const std::string& databaseName,
 				const std::shared_ptr<MongoBulkWriter>& pBulkWriter,
-				MongoErrorPolicy::Mode errorPolicyMode)
+				MongoErrorPolicy::Mode errorPolicyMode,
+				MongoCacheStorageMode cacheStorageMode = MongoCacheStorageMode::Replace)
 				: m_connectionPool(uri)
 				, m_databaseName(databaseName)
 				, m_pBulkWriter(pBulkWriter)
 				, m_errorPolicyMode(errorPolicyMode)
+				, m_cacheStorageMode(cacheStorageMode)
 		{}
 
 	public:
@@ -61,10 +73,16 @@ namespace catapult { namespace mongo {
 			return *m_pBulkWriter;
 		}
 
+		/// Gets the cache storage mode.
+		MongoCacheStorageMode cacheStorageMode() const {
+			return m_cacheStorageMode;
+		}
+
 	private:
 		mongocxx::pool m_connectionPool;
 		std::string m_databaseName;
 		std::shared_ptr<MongoBulkWriter> m_pBulkWriter;
 		MongoErrorPolicy::Mode m_errorPolicyMode;
+		MongoCacheStorageMode m_cacheStorageMode;
 	};
 }}
@@ -0,0 +1,79 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "DocumentDiff.h"
+#include "MapperUtils.h"
+#include <bsoncxx/types.hpp>
+#include <bsoncxx/types/bson_value/view.hpp>
+
+namespace catapult { namespace mongo { namespace mappers {
+
+	namespace {
+		struct UpdateBuilder {
+		public:
+			bson_stream::document SetDocument;
+			size_t NumSetFields = 0;
+
+			bson_stream::document UnsetDocument;
+			size_t NumUnsetFields = 0;
+
+		public:
+			void set(const std::string& path, const bsoncxx::document::element& element) {
+				SetDocument << path << element.get_value();
+				++NumSetFields;
+			}
+
+			void unset(const std::string& path) {
+				UnsetDocument << path << "";
+				++NumUnsetFields;
+			}
+		};
+
+		bool IsDocument(const bsoncxx::document::element& element) {
+			return bsoncxx::type::k_document == element.type();
+		}
+
+		void AppendDifferences(
+				UpdateBuilder& builder,
+				const std::string& prefix,
+				const bsoncxx::document::view& previousDocument,
+				const bsoncxx::document::view& document) {
+			for (const auto& element : document) {
+				auto path = prefix + std::string(element.key());
+				auto previousIter = previousDocument.find(element.key());
+				if (previousDocument.end() == previousIter) {
+					builder.set(path, element);
+					continue;
+				}
+
+				const auto& previousElement = *previousIter;
+				if (IsDocument(element) && IsDocument(previousElement))
+					AppendDifferences(builder, path + ".", previousElement.get_document().view(), element.get_document().view());
+				else if (!(previousElement.get_value() == element.get_value()))
+					builder.set(path, element);
+			}
+
+			for (const auto& previousElement : previousDocument) {
+				if (document.end() == document.find(previousElement.key()))
+					builder.unset(prefix + std::string(previousElement.key()));
+			}
+		}
+	}
+
+	bsoncxx::document::value CreateUpdateDocument(const bsoncxx::document::view& previousDocument, const bsoncxx::document::view& document) {
+		UpdateBuilder builder;
+		AppendDifferences(builder, "", previousDocument, document);
+
+		bson_stream::document updateDocument;
+		if (0 != builder.NumSetFields)
+			updateDocument << "$set" << bsoncxx::types::b_document{ builder.SetDocument.view() };
+
+		if (0 != builder.NumUnsetFields)
+			updateDocument << "$unset" << bsoncxx::types::b_document{ builder.UnsetDocument.view() };
+
+		return updateDocument << bson_stream::finalize;
+	}
+}}}
@@ -0,0 +1,17 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#pragma once
+#include <bsoncxx/document/value.hpp>
+#include <bsoncxx/document/view.hpp>
+
+namespace catapult { namespace mongo { namespace mappers {
+
+	/// Creates an update document that transforms \a previousDocument into \a document.
+	/// \note Embedded documents are compared field by field, all other fields (including arrays) are compared and set as a whole.
+	///       An empty document is returned when both documents are equal.
+	bsoncxx::document::value CreateUpdateDocument(const bsoncxx::document::view& previousDocument, const bsoncxx::document::view& document);
+}}}
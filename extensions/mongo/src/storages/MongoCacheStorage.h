@@ -19,8 +19,10 @@
 **/
 
 #pragma once
+#include "SavedDocumentCache.h"
 #include "mongo/src/MongoBulkWriter.h"
 #include "mongo/src/MongoStorageContext.h"
+#include "mongo/src/mappers/DocumentDiff.h"
 #include "mongo/src/mappers/MapperUtils.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/config_holder/BlockchainConfigurationHolder.h"
@@ -70,6 +72,11 @@ namespace catapult { namespace mongo { namespace storages {
 				}
 			}
 		};
+
+		/// Gets the raw bytes of \a document.
+		inline std::string GetDocumentBytes(const bsoncxx::document::view& document) {
+			return std::string(reinterpret_cast<const char*>(document.data()), document.length());
+		}
 	}
 
 	/// Defines types for mongo cache storage given a cache descriptor.
@@ -271,4 +278,340 @@ namespace catapult { namespace mongo { namespace storages {
 		MongoBulkWriter& m_bulkWriter;
 		std::shared_ptr<config::BlockchainConfigurationHolder> m_pConfigHolder;
 	};
+
+	/// A mongo cache storage that persists flat cache data using delete, upsert and per field updates.
+	/// \note The last saved document of each element is retained so that modified elements can be updated with only
+	///       the fields that changed instead of being replaced as a whole.
+	template<typename TCacheTraits>
+	class MongoIncrementalCacheStorage : public ExternalCacheStorageT<typename TCacheTraits::CacheType> {
+	private:
+		using CacheChangesType = cache::SingleCacheChangesT<typename TCacheTraits::CacheDeltaType, typename TCacheTraits::ModelType>;
+		using KeyType = typename TCacheTraits::KeyType;
+		using ModelType = typename TCacheTraits::ModelType;
+		using ElementContainerType = std::unordered_set<const ModelType*>;
+
+		struct ElementDocument {
+			const ModelType* pModel;
+			bsoncxx::document::value Document;
+		};
+
+		using ElementDocuments = std::vector<ElementDocument>;
+
+	public:
+		/// Maximum total size (in bytes) of saved documents that are retained.
+		static constexpr size_t Max_Saved_Documents_Size = 64 * 1024 * 1024;
+
+	public:
+		/// Creates a cache storage around \a storageContext and \a networkIdentifier.
+		MongoIncrementalCacheStorage(MongoStorageContext& storageContext, const std::shared_ptr<config::BlockchainConfigurationHolder>& pConfigHolder)
+				: m_database(storageContext.createDatabaseConnection())
+				, m_errorPolicy(storageContext.createCollectionErrorPolicy(TCacheTraits::Collection_Name))
+				, m_bulkWriter(storageContext.bulkWriter())
+				, m_pConfigHolder(pConfigHolder)
+				, m_savedDocuments(Max_Saved_Documents_Size)
+		{}
+
+	private:
+		void saveDelta(const CacheChangesType& changes) override {
+			auto addedElements = changes.addedElements();
+			auto modifiedElements = changes.modifiedElements();
+			auto removedElements = changes.removedElements();
+
+			// 1. remove elements common to both added and removed
+			detail::MongoElementFilter<TCacheTraits, ElementContainerType>::RemoveCommonElements(addedElements, removedElements);
+
+			// 2. remove all removed elements from db
+			removeAll(removedElements);
+
+			// 3. upsert new elements and update modified elements in db
+			modifiedElements.insert(addedElements.cbegin(), addedElements.cend());
+			saveAll(modifiedElements, changes.height());
+		}
+
+	private:
+		void removeAll(const ElementContainerType& elements) {
+			if (elements.empty())
+				return;
+
+			for (const auto* pModel : elements)
+				m_savedDocuments.erase(TCacheTraits::GetId(*pModel));
+
+			auto deleteResults = m_bulkWriter.bulkDelete(TCacheTraits::Collection_Name, elements, CreateFilter).get();
+			auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(deleteResults)));
+			m_errorPolicy.checkDeleted(elements.size(), aggregateResult, "removed elements");
+		}
+
+		void saveAll(const ElementContainerType& elements, const Height& height) {
+			if (elements.empty())
+				return;
+
+			auto networkIdentifier = m_pConfigHolder->Config(height).Immutable.NetworkIdentifier;
+			ElementDocuments upserts;
+			ElementDocuments updates;
+			ElementDocuments documents;
+			for (const auto* pModel : elements) {
+				auto document = TCacheTraits::MapToMongoDocument(*pModel, networkIdentifier);
+				const auto* pSavedDocument = m_savedDocuments.find(TCacheTraits::GetId(*pModel));
+				if (!pSavedDocument) {
+					upserts.push_back({ pModel, document });
+				} else {
+					auto updateDocument = mappers::CreateUpdateDocument(pSavedDocument->view(), document.view());
+					if (!mappers::IsEmptyDocument(updateDocument))
+						updates.push_back({ pModel, std::move(updateDocument) });
+				}
+
+				documents.push_back({ pModel, std::move(document) });
+			}
+
+			upsertAll(upserts);
+			updateAll(updates);
+
+			// only remember documents after they have been written successfully
+			// (documents of elements that were not saved recently are forgotten first when the size bound is exceeded)
+			for (auto& elementDocument : documents) {
+				auto documentSize = elementDocument.Document.view().length();
+				m_savedDocuments.insert(TCacheTraits::GetId(*elementDocument.pModel), std::move(elementDocument.Document), documentSize);
+			}
+		}
+
+		void upsertAll(const ElementDocuments& upserts) {
+			if (upserts.empty())
+				return;
+
+			auto upsertResults = m_bulkWriter.bulkUpsert(TCacheTraits::Collection_Name, upserts, GetDocument, CreateElementFilter).get();
+			auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(upsertResults)));
+			m_errorPolicy.checkUpserted(upserts.size(), aggregateResult, "added and unsaved modified elements");
+		}
+
+		void updateAll(const ElementDocuments& updates) {
+			if (updates.empty())
+				return;
+
+			auto updateResults = m_bulkWriter.bulkUpdate(TCacheTraits::Collection_Name, updates, GetDocument, CreateElementFilter).get();
+			auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(updateResults)));
+			m_errorPolicy.checkUpdated(updates.size(), aggregateResult, "modified elements");
+		}
+
+	private:
+		static bsoncxx::document::value GetDocument(const ElementDocument& elementDocument, uint32_t) {
+			return elementDocument.Document;
+		}
+
+		static bsoncxx::document::value CreateElementFilter(const ElementDocument& elementDocument) {
+			return CreateFilter(elementDocument.pModel);
+		}
+
+		static bsoncxx::document::value CreateFilter(const ModelType* pModel) {
+			using namespace bsoncxx::builder::stream;
+
+			return document() << std::string(TCacheTraits::Id_Property_Name) << TCacheTraits::MapToMongoId(TCacheTraits::GetId(*pModel)) << finalize;
+		}
+
+	private:
+		MongoDatabase m_database;
+		MongoErrorPolicy m_errorPolicy;
+		MongoBulkWriter& m_bulkWriter;
+		std::shared_ptr<config::BlockchainConfigurationHolder> m_pConfigHolder;
+		SavedDocumentCache<KeyType, bsoncxx::document::value> m_savedDocuments;
+	};
+
+	/// A mongo cache storage that persists historical cache data using delete and insert of changed documents only.
+	/// \note The last saved documents of each element are retained so that only the documents of a modified element
+	///       that changed are deleted and inserted instead of all of its documents.
+	template<typename TCacheTraits>
+	class MongoIncrementalHistoricalCacheStorage : public ExternalCacheStorageT<typename TCacheTraits::CacheType> {
+	private:
+		using CacheChangesType = cache::SingleCacheChangesT<
+			typename TCacheTraits::CacheDeltaType,
+			typename TCacheTraits::CacheType::CacheValueType>;
+		using KeyType = typename TCacheTraits::KeyType;
+		using ElementContainerType = typename TCacheTraits::ElementContainerType;
+		using IdContainerType = typename TCacheTraits::IdContainerType;
+		using Documents = std::vector<bsoncxx::document::value>;
+
+		struct ElementDocuments {
+			KeyType Id;
+			Documents AllDocuments;
+		};
+
+		struct DocumentChanges {
+			IdContainerType ReplacedIds;
+			Documents StaleDocuments;
+			Documents NewDocuments;
+		};
+
+	public:
+		/// Maximum total size (in bytes) of saved documents that are retained.
+		static constexpr size_t Max_Saved_Documents_Size = 64 * 1024 * 1024;
+
+	public:
+		/// Creates a cache storage around \a storageContext and \a networkIdentifier.
+		MongoIncrementalHistoricalCacheStorage(
+				MongoStorageContext& storageContext,
+				const std::shared_ptr<config::BlockchainConfigurationHolder>& pConfigHolder)
+				: m_database(storageContext.createDatabaseConnection())
+				, m_errorPolicy(storageContext.createCollectionErrorPolicy(TCacheTraits::Collection_Name))
+				, m_bulkWriter(storageContext.bulkWriter())
+				, m_pConfigHolder(pConfigHolder)
+				, m_savedDocuments(Max_Saved_Documents_Size)
+		{}
+
+	private:
+		void saveDelta(const CacheChangesType& changes) override {
+			auto addedElements = changes.addedElements();
+			auto modifiedElements = changes.modifiedElements();
+			auto removedElements = changes.removedElements();
+
+			// 1. remove elements common to both added and removed
+			detail::MongoElementFilter<TCacheTraits, ElementContainerType>::RemoveCommonElements(addedElements, removedElements);
+
+			// 2. collect the documents that changed since the elements were last saved
+			DocumentChanges documentChanges;
+			for (const auto* pElement : removedElements) {
+				auto id = TCacheTraits::GetId(*pElement);
+				documentChanges.ReplacedIds.insert(id);
+				m_savedDocuments.erase(id);
+			}
+
+			auto networkIdentifier = m_pConfigHolder->Config(changes.height()).Immutable.NetworkIdentifier;
+			std::vector<ElementDocuments> allElementDocuments;
+			for (const auto* pElement : modifiedElements)
+				allElementDocuments.push_back(prepareSave(*pElement, networkIdentifier, true, documentChanges));
+
+			for (const auto* pElement : addedElements)
+				allElementDocuments.push_back(prepareSave(*pElement, networkIdentifier, false, documentChanges));
+
+			// 3. remove all removed and replaced elements and all stale documents from db
+			removeAll(documentChanges.ReplacedIds);
+			removeDocuments(documentChanges.StaleDocuments);
+
+			// 4. insert all new documents into db
+			insertDocuments(documentChanges.NewDocuments);
+
+			// only remember documents after they have been written successfully
+			for (auto& elementDocuments : allElementDocuments) {
+				auto documentsSize = GetSize(elementDocuments.AllDocuments);
+				m_savedDocuments.insert(elementDocuments.Id, std::move(elementDocuments.AllDocuments), documentsSize);
+			}
+		}
+
+	private:
+		ElementDocuments prepareSave(
+				const typename TCacheTraits::CacheType::CacheValueType& element,
+				model::NetworkIdentifier networkIdentifier,
+				bool isModified,
+				DocumentChanges& documentChanges) {
+			ElementDocuments elementDocuments{ TCacheTraits::GetId(element), Documents() };
+			for (const auto& model : TCacheTraits::MapToMongoModels(element, networkIdentifier))
+				elementDocuments.AllDocuments.push_back(TCacheTraits::MapToMongoDocument(model));
+
+			const auto* pSavedDocuments = m_savedDocuments.find(elementDocuments.Id);
+			if (!pSavedDocuments || !TryDiff(*pSavedDocuments, elementDocuments.AllDocuments, documentChanges)) {
+				// added elements that were not saved before have no documents in db
+				if (isModified || pSavedDocuments)
+					documentChanges.ReplacedIds.insert(elementDocuments.Id);
+
+				for (const auto& document : elementDocuments.AllDocuments)
+					documentChanges.NewDocuments.push_back(document);
+			}
+
+			return elementDocuments;
+		}
+
+		static bool TryDiff(const Documents& savedDocuments, const Documents& documents, DocumentChanges& documentChanges) {
+			// documents are matched by content, so they can only be diffed when all of them are distinct
+			std::unordered_set<std::string> unmatchedDocuments;
+			for (const auto& document : documents) {
+				if (!unmatchedDocuments.insert(detail::GetDocumentBytes(document.view())).second)
+					return false;
+			}
+
+			Documents staleDocuments;
+			std::unordered_set<std::string> savedDocumentBytes;
+			for (const auto& savedDocument : savedDocuments) {
+				auto bytes = detail::GetDocumentBytes(savedDocument.view());
+				if (!savedDocumentBytes.insert(bytes).second)
+					return false;
+
+				if (0 == unmatchedDocuments.erase(bytes))
+					staleDocuments.push_back(savedDocument);
+			}
+
+			std::move(staleDocuments.begin(), staleDocuments.end(), std::back_inserter(documentChanges.StaleDocuments));
+			for (const auto& document : documents) {
+				if (unmatchedDocuments.cend() != unmatchedDocuments.find(detail::GetDocumentBytes(document.view())))
+					documentChanges.NewDocuments.push_back(document);
+			}
+
+			return true;
+		}
+
+		void removeAll(const IdContainerType& ids) {
+			if (ids.empty())
+				return;
+
+			auto collection = m_database[TCacheTraits::Collection_Name];
+
+			auto filter = CreateDeleteFilter(ids);
+			auto deleteResult = collection.delete_many(filter.view());
+			m_errorPolicy.checkDeletedAtLeast(ids.size(), BulkWriteResult(deleteResult.value().result()), "removed and modified elements");
+		}
+
+		void removeDocuments(const Documents& documents) {
+			if (documents.empty())
+				return;
+
+			// a saved document matches exactly the document in db apart from its generated id
+			auto deleteResults = m_bulkWriter.bulkDelete(TCacheTraits::Collection_Name, documents, [](const auto& document) {
+				return document;
+			}).get();
+			auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(deleteResults)));
+			m_errorPolicy.checkDeleted(documents.size(), aggregateResult, "stale documents of modified elements");
+		}
+
+		void insertDocuments(const Documents& documents) {
+			if (documents.empty())
+				return;
+
+			auto insertResults = m_bulkWriter.bulkInsert(TCacheTraits::Collection_Name, documents, [](const auto& document, auto) {
+				return document;
+			}).get();
+			auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(insertResults)));
+			m_errorPolicy.checkInserted(documents.size(), aggregateResult, "modified and added elements");
+		}
+
+	private:
+		static size_t GetSize(const Documents& documents) {
+			size_t size = 0;
+			for (const auto& document : documents)
+				size += document.view().length();
+
+			return size;
+		}
+
+		static bsoncxx::document::value CreateDeleteFilter(const IdContainerType& ids) {
+			using namespace bsoncxx::builder::stream;
+
+			document doc;
+			auto array = doc
+					<< std::string(TCacheTraits::Id_Property_Name)
+					<< open_document
+						<< "$in"
+						<< open_array;
+
+			for (auto id : ids)
+				array << TCacheTraits::MapToMongoId(id);
+
+			array << close_array;
+			doc << close_document;
+			return doc << finalize;
+		}
+
+	private:
+		MongoDatabase m_database;
+		MongoErrorPolicy m_errorPolicy;
+		MongoBulkWriter& m_bulkWriter;
+		std::shared_ptr<config::BlockchainConfigurationHolder> m_pConfigHolder;
+		SavedDocumentCache<KeyType, Documents> m_savedDocuments;
+	};
 }}}
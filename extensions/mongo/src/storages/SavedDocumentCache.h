@@ -0,0 +1,84 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#pragma once
+#include <cstddef>
+#include <list>
+#include <map>
+
+namespace catapult { namespace mongo { namespace storages {
+
+	/// Cache of the last saved documents of cache elements that is bounded by the total size of the documents.
+	/// \note When the bound is exceeded, the documents that were saved least recently are removed.
+	template<typename TKey, typename TDocument>
+	class SavedDocumentCache {
+	private:
+		struct Entry {
+			TKey Key;
+			TDocument Document;
+			size_t Size;
+		};
+
+		using EntryList = std::list<Entry>;
+
+	public:
+		/// Creates a cache that holds documents with a total size of at most \a maxSize bytes.
+		explicit SavedDocumentCache(size_t maxSize) : m_maxSize(maxSize), m_totalSize(0)
+		{}
+
+	public:
+		/// Gets the number of documents in the cache.
+		size_t size() const {
+			return m_index.size();
+		}
+
+		/// Gets the total size of all documents in the cache.
+		size_t totalSize() const {
+			return m_totalSize;
+		}
+
+	public:
+		/// Finds the document saved for \a key or returns \c nullptr if there is none.
+		const TDocument* find(const TKey& key) const {
+			auto iter = m_index.find(key);
+			return m_index.cend() == iter ? nullptr : &iter->second->Document;
+		}
+
+		/// Sets the document saved for \a key to \a document with \a size bytes.
+		/// \note A document larger than the maximum size of the cache is not retained.
+		void insert(const TKey& key, TDocument&& document, size_t size) {
+			erase(key);
+			if (size > m_maxSize)
+				return;
+
+			while (m_totalSize + size > m_maxSize) {
+				auto leastRecentKey = m_entries.front().Key;
+				erase(leastRecentKey);
+			}
+
+			m_entries.push_back(Entry{ key, std::move(document), size });
+			m_index.emplace(key, std::prev(m_entries.end()));
+			m_totalSize += size;
+		}
+
+		/// Removes the document saved for \a key.
+		void erase(const TKey& key) {
+			auto iter = m_index.find(key);
+			if (m_index.end() == iter)
+				return;
+
+			m_totalSize -= iter->second->Size;
+			m_entries.erase(iter->second);
+			m_index.erase(iter);
+		}
+
+	private:
+		size_t m_maxSize;
+		size_t m_totalSize;
+		EntryList m_entries;
+		std::map<TKey, typename EntryList::iterator> m_index;
+	};
+}}}
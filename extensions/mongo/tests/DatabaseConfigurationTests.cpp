@@ -36,7 +36,8 @@ namespace catapult { namespace mongo {
 						{
 							{ "databaseUri", "mongodb://hostname:port" },
 							{ "databaseName", "foo" },
-							{ "maxWriterThreads", "3" }
+							{ "maxWriterThreads", "3" },
+							{ "enableIncrementalCacheStorage", "true" }
 						}
 					},
 					{
@@ -67,6 +68,7 @@ namespace catapult { namespace mongo {
 				EXPECT_EQ("", config.DatabaseUri);
 				EXPECT_EQ("", config.DatabaseName);
 				EXPECT_EQ(0u, config.MaxWriterThreads);
+				EXPECT_FALSE(config.EnableIncrementalCacheStorage);
 				EXPECT_EQ(std::unordered_set<std::string>(), config.Plugins);
 			}
 
@@ -75,6 +77,7 @@ namespace catapult { namespace mongo {
 				EXPECT_EQ("mongodb://hostname:port", config.DatabaseUri);
 				EXPECT_EQ("foo", config.DatabaseName);
 				EXPECT_EQ(3u, config.MaxWriterThreads);
+				EXPECT_TRUE(config.EnableIncrementalCacheStorage);
 				EXPECT_EQ(std::unordered_set<std::string>({ "Alpha", "gamma" }), config.Plugins);
 			}
 		};
@@ -97,6 +100,7 @@ namespace catapult { namespace mongo {
 		EXPECT_EQ("mongodb://127.0.0.1:27017", config.DatabaseUri);
 		EXPECT_EQ("catapult", config.DatabaseName);
 		EXPECT_EQ(8u, config.MaxWriterThreads);
+		EXPECT_FALSE(config.EnableIncrementalCacheStorage);
 		EXPECT_FALSE(config.Plugins.empty());
 	}
 
@@ -73,6 +73,14 @@ namespace catapult { namespace mongo {
 				result.NumModified = value - result.NumUpserted;
 			}
 		};
+
+		struct UpdatedTraits {
+			static constexpr auto CheckerFunc = &MongoErrorPolicy::checkUpdated;
+
+			static void SetValue(BulkWriteResult& result, int32_t value) {
+				result.NumMatched = value;
+			}
+		};
 	}
 
 #define EQUAL_CONSTRAINT_TEST(TEST_NAME) \
@@ -80,6 +88,7 @@ namespace catapult { namespace mongo {
 	TEST(TEST_CLASS, TEST_NAME##_Deleted) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<DeletedTraits>(); } \
 	TEST(TEST_CLASS, TEST_NAME##_Inserted) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<InsertedTraits>(); } \
 	TEST(TEST_CLASS, TEST_NAME##_Upserted) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<UpsertedTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Updated) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<UpdatedTraits>(); } \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
 	// endregion
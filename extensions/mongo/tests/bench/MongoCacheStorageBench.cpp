@@ -0,0 +1,161 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "mongo/src/storages/MongoAccountStateCacheStorage.h"
+#include "mongo/src/MongoStorageContext.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "mongo/tests/test/MongoTestUtils.h"
+#include "tests/bench/nodeps/Random.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/core/mocks/MockBlockchainConfigurationHolder.h"
+#include "tests/test/other/MutableBlockchainConfiguration.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace mongo {
+
+	namespace {
+		constexpr auto Currency_Mosaic_Id = MosaicId(1234);
+		constexpr auto Harvesting_Mosaic_Id = MosaicId(5678);
+		constexpr size_t Num_Accounts = 20'000;
+		constexpr size_t Num_Recorded_Blocks = 100;
+		constexpr size_t Num_Added_Accounts_Per_Block = 10;
+
+		// region recorded changes
+
+		struct RecordedBlockChanges {
+			std::vector<size_t> ModifiedAccountIndexes;
+			std::vector<Key> AddedAccountKeys;
+		};
+
+		Key GenerateRandomKey() {
+			Key key;
+			bench::FillWithRandomData(key);
+			return key;
+		}
+
+		std::vector<RecordedBlockChanges> RecordChanges(size_t numModifiedAccountsPerBlock) {
+			std::vector<RecordedBlockChanges> recordedChanges(Num_Recorded_Blocks);
+			for (auto& blockChanges : recordedChanges) {
+				for (auto i = 0u; i < numModifiedAccountsPerBlock; ++i)
+					blockChanges.ModifiedAccountIndexes.push_back(bench::Random() % Num_Accounts);
+
+				for (auto i = 0u; i < Num_Added_Accounts_Per_Block; ++i)
+					blockChanges.AddedAccountKeys.push_back(GenerateRandomKey());
+			}
+
+			return recordedChanges;
+		}
+
+		// endregion
+
+		// region ReplayContext
+
+		cache::CatapultCache CreateCache() {
+			test::MutableBlockchainConfiguration config;
+			config.Immutable.NetworkIdentifier = model::NetworkIdentifier::Mijin_Test;
+			return test::CreateEmptyCatapultCache(config.ToConst());
+		}
+
+		auto CreateConfigHolder() {
+			test::MutableBlockchainConfiguration config;
+			config.Immutable.NetworkIdentifier = model::NetworkIdentifier::Mijin_Test;
+			return config::CreateMockConfigurationHolder(config.ToConst());
+		}
+
+		// replays recorded account changes against a mongo account storage
+		class ReplayContext {
+		public:
+			explicit ReplayContext(MongoCacheStorageMode cacheStorageMode)
+					: m_cache(CreateCache())
+					, m_delta(m_cache.createDelta())
+					, m_height(1) {
+				test::ResetDatabase(test::DatabaseName());
+				test::PrepareDatabase(test::DatabaseName());
+				m_pMongoContext = test::CreateDefaultMongoStorageContext(test::DatabaseName(), cacheStorageMode);
+				m_pStorage = CreateMongoAccountStateCacheStorage(*m_pMongoContext, CreateConfigHolder());
+
+				// all accounts are created in the first block
+				auto& accountStateCacheDelta = m_delta.sub<cache::AccountStateCache>();
+				for (auto i = 0u; i < Num_Accounts; ++i) {
+					m_accountKeys.push_back(GenerateRandomKey());
+					accountStateCacheDelta.addAccount(m_accountKeys.back(), m_height);
+
+					auto& accountState = accountStateCacheDelta.find(m_accountKeys.back()).get();
+					accountState.Balances.credit(Currency_Mosaic_Id, Amount(1'000'000), m_height);
+					accountState.Balances.credit(Harvesting_Mosaic_Id, Amount(1'000), m_height);
+				}
+
+				commit();
+			}
+
+		public:
+			void replay(const RecordedBlockChanges& blockChanges) {
+				m_height = m_height + Height(1);
+
+				auto& accountStateCacheDelta = m_delta.sub<cache::AccountStateCache>();
+				for (auto index : blockChanges.ModifiedAccountIndexes) {
+					auto& accountState = accountStateCacheDelta.find(m_accountKeys[index]).get();
+					accountState.Balances.credit(Currency_Mosaic_Id, Amount(1), m_height);
+				}
+
+				for (const auto& key : blockChanges.AddedAccountKeys)
+					accountStateCacheDelta.addAccount(key, m_height);
+
+				commit();
+			}
+
+		private:
+			void commit() {
+				m_pStorage->saveDelta(cache::CacheChanges(m_delta));
+				m_cache.commit(m_height);
+			}
+
+		private:
+			cache::CatapultCache m_cache;
+			cache::CatapultCacheDelta m_delta;
+			Height m_height;
+			std::vector<Key> m_accountKeys;
+			std::unique_ptr<MongoStorageContext> m_pMongoContext;
+			std::unique_ptr<ExternalCacheStorage> m_pStorage;
+		};
+
+		// endregion
+
+		// region benchmarks
+
+		void BenchmarkReplayAccountChanges(benchmark::State& state) {
+			auto cacheStorageMode = static_cast<MongoCacheStorageMode>(state.range(0));
+			auto numModifiedAccountsPerBlock = static_cast<size_t>(state.range(1));
+			auto recordedChanges = RecordChanges(numModifiedAccountsPerBlock);
+
+			ReplayContext context(cacheStorageMode);
+
+			size_t numBlocks = 0;
+			for (auto _ : state)
+				context.replay(recordedChanges[numBlocks++ % recordedChanges.size()]);
+
+			state.counters["elements/block"] = static_cast<double>(numModifiedAccountsPerBlock + Num_Added_Accounts_Per_Block);
+			state.SetItemsProcessed(static_cast<int64_t>(numBlocks * (numModifiedAccountsPerBlock + Num_Added_Accounts_Per_Block)));
+		}
+
+		void AddReplayArguments(benchmark::internal::Benchmark& benchmark) {
+			benchmark.ArgNames({ "mode", "modified" });
+			for (auto mode : { MongoCacheStorageMode::Replace, MongoCacheStorageMode::Incremental }) {
+				for (auto numModifiedAccountsPerBlock : { 10, 100, 1'000 })
+					benchmark.Args({ static_cast<int64_t>(mode), numModifiedAccountsPerBlock });
+			}
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	catapult::mongo::AddReplayArguments(
+			*benchmark::RegisterBenchmark("BenchmarkReplayAccountChanges", catapult::mongo::BenchmarkReplayAccountChanges)
+					->Unit(benchmark::kMillisecond));
+}
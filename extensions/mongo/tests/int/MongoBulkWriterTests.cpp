@@ -483,6 +483,67 @@ namespace catapult { namespace mongo {
 			}
 		};
 
+		struct UpdateTraits {
+			struct Capture {
+				size_t NumCreateUpdateCalls = 0;
+				const state::AccountState* pCreateUpdateAccountState = nullptr;
+
+				size_t NumCreateFilterCalls = 0;
+				const state::AccountState* pCreateFilterAccountState = nullptr;
+			};
+
+			static const auto& GetElements(const PerformanceContext& context) {
+				return context.accountStates();
+			}
+
+			static auto Execute(
+					MongoBulkWriter& writer,
+					const AccountStates& accountStates,
+					const std::atomic_bool& blockFlag,
+					Capture& capture) {
+				auto createUpdate = [&blockFlag, &capture](const auto& pAccountState, auto) {
+					WAIT_FOR_EXPR(!blockFlag);
+					++capture.NumCreateUpdateCalls;
+					capture.pCreateUpdateAccountState = pAccountState.get();
+					return document() << "$set" << open_document << "account.importanceHeight" << 123 << close_document << finalize;
+				};
+
+				auto createFilter = [&blockFlag, &capture](const auto& pAccountState) {
+					WAIT_FOR_EXPR(!blockFlag);
+					++capture.NumCreateFilterCalls;
+					capture.pCreateFilterAccountState = pAccountState.get();
+					return test::CreateFilter(pAccountState);
+				};
+
+				// Act:
+				return writer.bulkUpdate<AccountStates>(Accounts_Collection_Name, accountStates, createUpdate, createFilter);
+			}
+
+			static auto ExecuteZero(MongoBulkWriter& writer) {
+				// Act:
+				return writer.bulkUpdate<AccountStates>(
+						Accounts_Collection_Name,
+						{},
+						CreateDocumentThrow<AccountStates::value_type>,
+						CreateFilterThrow<AccountStates::value_type>);
+			}
+
+			static void AssertDelegation(
+					const AccountStates& accountStates,
+					const Capture& capture,
+					const BulkWriteResult& aggregateResult) {
+				// Assert:
+				EXPECT_EQ(1u, capture.NumCreateUpdateCalls);
+				EXPECT_EQ((*accountStates.cbegin()).get(), capture.pCreateUpdateAccountState);
+
+				EXPECT_EQ(1u, capture.NumCreateFilterCalls);
+				EXPECT_EQ((*accountStates.cbegin()).get(), capture.pCreateFilterAccountState);
+
+				// - note that nothing was updated (or inserted) because the db is empty
+				AssertResult(0, 0, 0, 0, 0, aggregateResult);
+			}
+		};
+
 		struct DeleteTraits {
 			struct Capture {
 				size_t NumCreateFilterCalls = 0;
@@ -533,6 +594,7 @@ namespace catapult { namespace mongo {
 	TEST(TEST_CLASS, TEST_NAME##_InsertOneToOne) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<InsertOneToOneTraits>(); } \
 	TEST(TEST_CLASS, TEST_NAME##_InsertOneToMany) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<InsertOneToManyTraits>(); } \
 	TEST(TEST_CLASS, TEST_NAME##_Upsert) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<UpsertTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Update) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<UpdateTraits>(); } \
 	TEST(TEST_CLASS, TEST_NAME##_Delete) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<DeleteTraits>(); } \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
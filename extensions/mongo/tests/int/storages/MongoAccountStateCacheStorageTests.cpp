@@ -94,7 +94,12 @@ namespace catapult { namespace mongo { namespace storages {
 				test::AssertEqualAccountState(accountState, view["account"].get_document().view());
 			}
 		};
+
+		struct IncrementalAccountStateCacheTraits : public AccountStateCacheTraits {
+			static constexpr auto Cache_Storage_Mode = MongoCacheStorageMode::Incremental;
+		};
 	}
 
 	DEFINE_FLAT_CACHE_STORAGE_TESTS(AccountStateCacheTraits,)
+	DEFINE_FLAT_CACHE_STORAGE_TESTS(IncrementalAccountStateCacheTraits, _Incremental)
 }}}
@@ -0,0 +1,118 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "mongo/src/mappers/DocumentDiff.h"
+#include "mongo/src/mappers/MapperUtils.h"
+#include "tests/TestHarness.h"
+#include <bsoncxx/json.hpp>
+
+using namespace bsoncxx::builder::stream;
+
+namespace catapult { namespace mongo { namespace mappers {
+
+#define TEST_CLASS DocumentDiffTests
+
+	namespace {
+		auto CreateAccountDocument(int64_t balance, int64_t height) {
+			return document()
+					<< "account" << open_document
+						<< "address" << "alpha"
+						<< "balance" << balance
+						<< "meta" << open_document
+							<< "height" << height
+						<< close_document
+						<< "mosaics" << open_array << 1 << 2 << close_array
+					<< close_document
+					<< finalize;
+		}
+
+		void AssertUpdateDocument(const bsoncxx::document::value& expected, const bsoncxx::document::value& actual) {
+			EXPECT_EQ(bsoncxx::to_json(expected.view()), bsoncxx::to_json(actual.view()));
+		}
+	}
+
+	TEST(TEST_CLASS, UpdateDocumentIsEmptyWhenDocumentsAreEqual) {
+		// Arrange:
+		auto previousDocument = CreateAccountDocument(100, 10);
+		auto document = CreateAccountDocument(100, 10);
+
+		// Act:
+		auto updateDocument = CreateUpdateDocument(previousDocument.view(), document.view());
+
+		// Assert:
+		EXPECT_TRUE(IsEmptyDocument(updateDocument));
+	}
+
+	TEST(TEST_CLASS, UpdateDocumentSetsChangedFieldsOnly) {
+		// Arrange:
+		auto previousDocument = CreateAccountDocument(100, 10);
+		auto document = CreateAccountDocument(250, 11);
+
+		// Act:
+		auto updateDocument = CreateUpdateDocument(previousDocument.view(), document.view());
+
+		// Assert: embedded documents are compared field by field
+		auto expected = bsoncxx::builder::stream::document()
+				<< "$set" << open_document
+					<< "account.balance" << static_cast<int64_t>(250)
+					<< "account.meta.height" << static_cast<int64_t>(11)
+				<< close_document
+				<< finalize;
+		AssertUpdateDocument(expected, updateDocument);
+	}
+
+	TEST(TEST_CLASS, UpdateDocumentSetsChangedArraysAsWhole) {
+		// Arrange:
+		auto previousDocument = bsoncxx::builder::stream::document() << "values" << open_array << 1 << 2 << close_array << finalize;
+		auto document = bsoncxx::builder::stream::document() << "values" << open_array << 1 << 3 << close_array << finalize;
+
+		// Act:
+		auto updateDocument = CreateUpdateDocument(previousDocument.view(), document.view());
+
+		// Assert:
+		auto expected = bsoncxx::builder::stream::document()
+				<< "$set" << open_document
+					<< "values" << open_array << 1 << 3 << close_array
+				<< close_document
+				<< finalize;
+		AssertUpdateDocument(expected, updateDocument);
+	}
+
+	TEST(TEST_CLASS, UpdateDocumentSetsAddedAndUnsetsRemovedFields) {
+		// Arrange:
+		auto previousDocument = bsoncxx::builder::stream::document()
+				<< "account" << open_document << "alpha" << 1 << "beta" << 2 << close_document
+				<< finalize;
+		auto document = bsoncxx::builder::stream::document()
+				<< "account" << open_document << "alpha" << 1 << "gamma" << 3 << close_document
+				<< finalize;
+
+		// Act:
+		auto updateDocument = CreateUpdateDocument(previousDocument.view(), document.view());
+
+		// Assert:
+		auto expected = bsoncxx::builder::stream::document()
+				<< "$set" << open_document << "account.gamma" << 3 << close_document
+				<< "$unset" << open_document << "account.beta" << "" << close_document
+				<< finalize;
+		AssertUpdateDocument(expected, updateDocument);
+	}
+
+	TEST(TEST_CLASS, UpdateDocumentSetsFieldsWithChangedType) {
+		// Arrange:
+		auto previousDocument = bsoncxx::builder::stream::document()
+				<< "value" << open_document << "alpha" << 1 << close_document
+				<< finalize;
+		auto document = bsoncxx::builder::stream::document() << "value" << 1 << finalize;
+
+		// Act:
+		auto updateDocument = CreateUpdateDocument(previousDocument.view(), document.view());
+
+		// Assert:
+		auto expected = bsoncxx::builder::stream::document() << "$set" << open_document << "value" << 1 << close_document << finalize;
+		AssertUpdateDocument(expected, updateDocument);
+	}
+}}}
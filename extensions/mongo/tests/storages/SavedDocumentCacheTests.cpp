@@ -0,0 +1,123 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "mongo/src/storages/SavedDocumentCache.h"
+#include "tests/TestHarness.h"
+#include <string>
+
+namespace catapult { namespace mongo { namespace storages {
+
+#define TEST_CLASS SavedDocumentCacheTests
+
+	namespace {
+		using CacheType = SavedDocumentCache<uint32_t, std::string>;
+
+		void Insert(CacheType& cache, uint32_t key, const std::string& document) {
+			auto documentCopy = document;
+			cache.insert(key, std::move(documentCopy), document.size());
+		}
+
+		void AssertDocument(const CacheType& cache, uint32_t key, const std::string& expectedDocument) {
+			const auto* pDocument = cache.find(key);
+			ASSERT_TRUE(!!pDocument) << "key " << key;
+			EXPECT_EQ(expectedDocument, *pDocument) << "key " << key;
+		}
+	}
+
+	TEST(TEST_CLASS, CacheIsInitiallyEmpty) {
+		// Act:
+		CacheType cache(100);
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_EQ(0u, cache.totalSize());
+		EXPECT_FALSE(!!cache.find(1));
+	}
+
+	TEST(TEST_CLASS, CanInsertDocuments) {
+		// Arrange:
+		CacheType cache(100);
+
+		// Act:
+		Insert(cache, 1, "alpha");
+		Insert(cache, 2, "beta");
+
+		// Assert:
+		EXPECT_EQ(2u, cache.size());
+		EXPECT_EQ(9u, cache.totalSize());
+		AssertDocument(cache, 1, "alpha");
+		AssertDocument(cache, 2, "beta");
+	}
+
+	TEST(TEST_CLASS, InsertReplacesDocumentWithSameKey) {
+		// Arrange:
+		CacheType cache(100);
+		Insert(cache, 1, "alpha");
+
+		// Act:
+		Insert(cache, 1, "gamma ray");
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_EQ(9u, cache.totalSize());
+		AssertDocument(cache, 1, "gamma ray");
+	}
+
+	TEST(TEST_CLASS, CanEraseDocument) {
+		// Arrange:
+		CacheType cache(100);
+		Insert(cache, 1, "alpha");
+		Insert(cache, 2, "beta");
+
+		// Act:
+		cache.erase(1);
+		cache.erase(3);
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_EQ(4u, cache.totalSize());
+		EXPECT_FALSE(!!cache.find(1));
+		AssertDocument(cache, 2, "beta");
+	}
+
+	TEST(TEST_CLASS, InsertRemovesLeastRecentlySavedDocumentsWhenMaxSizeIsExceeded) {
+		// Arrange:
+		CacheType cache(12);
+		Insert(cache, 1, "aaaa");
+		Insert(cache, 2, "bbbb");
+		Insert(cache, 3, "cccc");
+
+		// - saving the first document again makes it the most recently saved one
+		Insert(cache, 1, "dddd");
+
+		// Act:
+		Insert(cache, 4, "eeeeee");
+
+		// Assert: only as many of the least recently saved documents as needed were removed
+		EXPECT_EQ(2u, cache.size());
+		EXPECT_EQ(10u, cache.totalSize());
+		EXPECT_FALSE(!!cache.find(2));
+		EXPECT_FALSE(!!cache.find(3));
+		AssertDocument(cache, 1, "dddd");
+		AssertDocument(cache, 4, "eeeeee");
+	}
+
+	TEST(TEST_CLASS, InsertDoesNotRetainDocumentLargerThanMaxSize) {
+		// Arrange:
+		CacheType cache(8);
+		Insert(cache, 1, "aaaa");
+		Insert(cache, 2, "bbbb");
+
+		// Act:
+		Insert(cache, 2, "too large");
+
+		// Assert: the previous document saved for the key was removed and other documents were kept
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_EQ(4u, cache.totalSize());
+		AssertDocument(cache, 1, "aaaa");
+		EXPECT_FALSE(!!cache.find(2));
+	}
+}}}
@@ -22,11 +22,25 @@
 #include "MongoTestUtils.h"
 #include "mongo/src/MongoStorageContext.h"
 #include "mongo/src/ExternalCacheStorage.h"
+#include "catapult/utils/traits/Traits.h"
 #include "tests/test/core/mocks/MockBlockchainConfigurationHolder.h"
 #include "tests/test/other/MutableBlockchainConfiguration.h"
 
 namespace catapult { namespace test {
 
+	namespace detail {
+		/// Gets the cache storage mode of a traits type, which defaults to replace when \a TTraits does not define one.
+		template<typename TTraits, typename = void>
+		struct CacheStorageModeAccessor {
+			static constexpr auto Value = mongo::MongoCacheStorageMode::Replace;
+		};
+
+		template<typename TTraits>
+		struct CacheStorageModeAccessor<TTraits, utils::traits::is_type_expression_t<decltype(TTraits::Cache_Storage_Mode)>> {
+			static constexpr auto Value = TTraits::Cache_Storage_Mode;
+		};
+	}
+
 	/// Base class that provides shared utils for mongo cache storage test suites.
 	template<typename TTraits>
 	class MongoCacheStorageTestUtils {
@@ -38,7 +52,7 @@ namespace catapult { namespace test {
 		class CacheStorageWrapper : public PrepareDatabaseMixin {
 		public:
 			CacheStorageWrapper()
-					: m_pMongoContext(CreateDefaultMongoStorageContext(DatabaseName()))
+					: m_pMongoContext(CreateDefaultMongoStorageContext(DatabaseName(), detail::CacheStorageModeAccessor<TTraits>::Value))
 					, m_pCacheStorage(TTraits::CreateCacheStorage(*m_pMongoContext, CreateConfigHolder(TTraits::Network_Id)))
 			{}
 
@@ -90,9 +90,16 @@ namespace catapult { namespace test {
 		return filter;
 	}
 
-	std::unique_ptr<mongo::MongoStorageContext> CreateDefaultMongoStorageContext(const std::string& dbName) {
+	std::unique_ptr<mongo::MongoStorageContext> CreateDefaultMongoStorageContext(
+			const std::string& dbName,
+			mongo::MongoCacheStorageMode cacheStorageMode) {
 		auto pWriter = mongo::MongoBulkWriter::Create(DefaultDbUri(), dbName, CreateStartedIoThreadPool(8));
-		return std::make_unique<mongo::MongoStorageContext>(DefaultDbUri(), dbName, pWriter, mongo::MongoErrorPolicy::Mode::Strict);
+		return std::make_unique<mongo::MongoStorageContext>(
+				DefaultDbUri(),
+				dbName,
+				pWriter,
+				mongo::MongoErrorPolicy::Mode::Strict,
+				cacheStorageMode);
 	}
 
 	mongo::MongoTransactionRegistry CreateDefaultMongoTransactionRegistry() {
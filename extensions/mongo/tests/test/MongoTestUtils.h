@@ -53,8 +53,10 @@ namespace catapult { namespace test {
 	/// Creates a filter for the given \a pAccountState.
 	bsoncxx::document::value CreateFilter(const std::shared_ptr<state::AccountState>& pAccountState);
 
-	/// Creates a default mongo storage context for database \a dbName.
-	std::unique_ptr<mongo::MongoStorageContext> CreateDefaultMongoStorageContext(const std::string& dbName);
+	/// Creates a default mongo storage context for database \a dbName using \a cacheStorageMode.
+	std::unique_ptr<mongo::MongoStorageContext> CreateDefaultMongoStorageContext(
+			const std::string& dbName,
+			mongo::MongoCacheStorageMode cacheStorageMode = mongo::MongoCacheStorageMode::Replace);
 
 	/// Creates a default mongo transaction registry that supports mock transactions.
 	mongo::MongoTransactionRegistry CreateDefaultMongoTransactionRegistry();
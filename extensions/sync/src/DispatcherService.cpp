@@ -209,10 +209,11 @@ namespace catapult { namespace sync {
 			{}
 
 		public:
-			void addHashConsumers() {
+			void addHashConsumers(const std::shared_ptr<thread::IoThreadPool>& pValidatorPool) {
 				m_consumers.push_back(CreateBlockHashCalculatorConsumer(
 						m_state.config().Immutable.GenerationHash,
-						m_state.pluginManager().transactionRegistry()));
+						m_state.pluginManager().transactionRegistry(),
+						pValidatorPool));
 				m_consumers.push_back(CreateBlockHashCheckConsumer(
 						m_state.timeSupplier(),
 						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheBlockDuration, m_nodeConfig)));
@@ -226,10 +227,20 @@ namespace catapult { namespace sync {
 						m_nodeConfig.MaxBlocksPerSyncAttempt,
 						pluginManager.configHolder(),
 						m_state.timeSupplier()));
+				auto requiresValidationPredicate = ToRequiresValidationPredicate(m_state.hooks().knownHashPredicate(m_state.utCache()));
+				if (m_nodeConfig.ShouldBatchVerifySignatures) {
+					m_consumers.push_back(CreateBlockSignatureVerificationConsumer(
+							m_state.config().Immutable.GenerationHash,
+							pluginManager.createNotificationPublisher(),
+							pValidatorPool,
+							pluginManager.verifiedSignatureCache(),
+							requiresValidationPredicate));
+				}
+
 				m_consumers.push_back(CreateBlockStatelessValidationConsumer(
 						extensions::CreateStatelessValidator(pluginManager),
 						validators::CreateParallelValidationPolicy(pValidatorPool),
-						ToRequiresValidationPredicate(m_state.hooks().knownHashPredicate(m_state.utCache()))));
+						requiresValidationPredicate));
 
 				auto disruptorConsumers = DisruptorConsumersFromBlockConsumers(m_consumers);
 				disruptorConsumers.push_back(CreateBlockChainSyncConsumer(
@@ -288,10 +299,11 @@ namespace catapult { namespace sync {
 			{}
 
 		public:
-			void addHashConsumers() {
+			void addHashConsumers(const std::shared_ptr<thread::IoThreadPool>& pValidatorPool) {
 				m_consumers.push_back(CreateTransactionHashCalculatorConsumer(
 						m_state.config().Immutable.GenerationHash,
-						m_state.pluginManager().transactionRegistry()));
+						m_state.pluginManager().transactionRegistry(),
+						pValidatorPool));
 				m_consumers.push_back(CreateTransactionHashCheckConsumer(
 						m_state.timeSupplier(),
 						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheTransactionDuration, m_nodeConfig),
@@ -301,6 +313,14 @@ namespace catapult { namespace sync {
 			std::shared_ptr<ConsumerDispatcher> build(
 					const std::shared_ptr<thread::IoThreadPool>& pValidatorPool,
 					chain::UtUpdater& utUpdater) {
+				if (m_nodeConfig.ShouldBatchVerifySignatures) {
+					m_consumers.push_back(CreateTransactionSignatureVerificationConsumer(
+							m_state.config().Immutable.GenerationHash,
+							m_state.pluginManager().createNotificationPublisher(),
+							pValidatorPool,
+							m_state.pluginManager().verifiedSignatureCache()));
+				}
+
 				m_consumers.push_back(CreateTransactionStatelessValidationConsumer(
 						extensions::CreateStatelessValidator(m_state.pluginManager()),
 						validators::CreateParallelValidationPolicy(pValidatorPool),
@@ -415,10 +435,10 @@ namespace catapult { namespace sync {
 				auto pServiceGroup = state.pool().pushServiceGroup("dispatcher service");
 
 				BlockDispatcherBuilder blockDispatcherBuilder(state);
-				blockDispatcherBuilder.addHashConsumers();
+				blockDispatcherBuilder.addHashConsumers(pValidatorPool);
 
 				TransactionDispatcherBuilder transactionDispatcherBuilder(state);
-				transactionDispatcherBuilder.addHashConsumers();
+				transactionDispatcherBuilder.addHashConsumers(pValidatorPool);
 
 				auto pRollbackInfo = CreateAndRegisterRollbackService(locator, state.timeSupplier(), state);
 				auto pBlockDispatcher = blockDispatcherBuilder.build(pValidatorPool, *pRollbackInfo);
@@ -87,7 +87,8 @@ namespace catapult { namespace sync {
 					},
 					[&cache = state.utCache()]() { return cache.view().shortHashes(); },
 					state.hooks().transactionRangeConsumerFactory()(Sync_Source),
-					state.config().Node.TransactionBatchSize);
+					state.config().Node.TransactionBatchSize,
+					state.config().Node.UnconfirmedTransactionsSketchCells);
 
 			thread::Task task;
 			task.Name = "pull unconfirmed transactions task";
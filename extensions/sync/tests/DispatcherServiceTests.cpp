@@ -389,6 +389,24 @@ namespace catapult { namespace sync {
 		EXPECT_EQ(4u, GetTransactionDispatcherStatus(context.locator()).Size);
 	}
 
+	TEST(TEST_CLASS, CanBootServiceWithBatchSignatureVerificationEnabled) {
+		// Arrange: enable batch signature verification
+		TestContext context;
+		const_cast<bool&>(context.testState().config().Node.ShouldBatchVerifySignatures) = true;
+
+		// Act:
+		context.boot();
+
+		// Assert:
+		EXPECT_EQ(Num_Expected_Services, context.locator().numServices());
+		EXPECT_EQ(Num_Expected_Counters, context.locator().counters().size());
+		EXPECT_EQ(Num_Expected_Tasks, context.testState().state().tasks().size());
+
+		// - both dispatchers have an additional signature verification consumer
+		EXPECT_EQ(7u, GetBlockDispatcherStatus(context.locator()).Size);
+		EXPECT_EQ(5u, GetTransactionDispatcherStatus(context.locator()).Size);
+	}
+
 	TEST(TEST_CLASS, CanShutdownService) {
 		// Arrange:
 		TestContext context;
@@ -37,6 +37,7 @@ namespace catapult { namespace syncsource {
 			handlers::BlockRangeHandler PushBlockCallback;
 			model::ChainScoreSupplier ChainScoreSupplier;
 			handlers::PullBlocksHandlerConfiguration BlocksHandlerConfig;
+			handlers::UtShortHashesSupplier UtShortHashesSupplier;
 			handlers::UtRetriever UtRetriever;
 		};
 
@@ -45,6 +46,7 @@ namespace catapult { namespace syncsource {
 			config.PushBlockCallback = extensions::CreateBlockPushEntityCallback(state.hooks());
 
 			config.ChainScoreSupplier = [&chainScore = state.score()]() { return chainScore.get(); };
+			config.UtShortHashesSupplier = [&cache = state.utCache()]() { return cache.view().shortHashes(); };
 			config.UtRetriever = [&cache = state.utCache(), nodeConfig = state.config().Node](auto minFeeMultiplier, const auto& shortHashes) {
 				return cache.view().unknownTransactions(minFeeMultiplier, shortHashes, nodeConfig.FeeInterest, nodeConfig.FeeInterestDenominator);
 			};
@@ -66,6 +68,7 @@ namespace catapult { namespace syncsource {
 			handlers::RegisterPullBlocksHandler(handlers, storage, config.BlocksHandlerConfig);
 
 			handlers::RegisterPullTransactionsHandler(handlers, config.UtRetriever);
+			handlers::RegisterPullTransactionsSketchHandler(handlers, config.UtShortHashesSupplier, config.UtRetriever);
 		}
 
 		class SyncSourceServiceRegistrar : public extensions::ServiceRegistrar {
@@ -74,7 +74,7 @@ namespace catapult { namespace syncsource {
 		const auto& handlers = context.testState().state().packetHandlers();
 
 		// Assert:
-		EXPECT_EQ(6u, handlers.size());
+		EXPECT_EQ(7u, handlers.size());
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Push_Block));
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Block));
 
@@ -83,6 +83,7 @@ namespace catapult { namespace syncsource {
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Blocks));
 
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Transactions));
+		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Transactions_Sketch));
 	}
 
 	// endregion
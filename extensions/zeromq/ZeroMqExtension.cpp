@@ -37,6 +37,11 @@ namespace catapult { namespace zeromq {
 					bootstrapper.pluginManager().createNotificationPublisher(),
 					[&bootstrapper]() {
 						return bootstrapper.pluginManager().createExtractorContext(bootstrapper.cacheHolder().cache());
+					},
+					ZeroMqEntityPublisherOptions{
+						config.EnableZeroCopy,
+						config.MaxTopicQueueSize,
+						config.ShouldDropMessagesWhenTopicQueueIsFull ? TopicQueuePolicy::Drop : TopicQueuePolicy::Block
 					});
 
 			// add a dummy service for extending service lifetimes
@@ -34,8 +34,11 @@ namespace catapult { namespace zeromq {
 		MessagingConfiguration config;
 
 		LOAD_PROPERTY(SubscriberPort);
+		LOAD_PROPERTY(EnableZeroCopy);
+		LOAD_PROPERTY(MaxTopicQueueSize);
+		LOAD_PROPERTY(ShouldDropMessagesWhenTopicQueueIsFull);
 
-		utils::VerifyBagSizeLte(bag, 1);
+		utils::VerifyBagSizeLte(bag, 4);
 		return config;
 	}
 
@@ -31,6 +31,16 @@ namespace catapult { namespace zeromq {
 		/// Subscriber port.
 		unsigned short SubscriberPort;
 
+		/// \c true if entity data should be shared with zeromq instead of being copied into every message.
+		bool EnableZeroCopy;
+
+		/// Maximum number of message groups queued for unconfirmed transactions and for partial transactions.
+		uint32_t MaxTopicQueueSize;
+
+		/// \c true if unconfirmed or partial transaction messages should be dropped when their queue is full,
+		/// \c false if publishing should block.
+		bool ShouldDropMessagesWhenTopicQueueIsFull;
+
 	private:
 		MessagingConfiguration() = default;
 
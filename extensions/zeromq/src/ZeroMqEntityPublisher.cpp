@@ -23,11 +23,33 @@
 #include "catapult/model/NotificationSubscriber.h"
 #include "catapult/model/TransactionStatus.h"
 #include "catapult/model/TransactionUtils.h"
-#include "catapult/thread/IoThreadPool.h"
-#include <boost/asio.hpp>
+#include "catapult/utils/MemoryUtils.h"
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <thread>
 
 namespace catapult { namespace zeromq {
 
+	namespace {
+		/// Flows of bounded messages; all messages of a flow are queued together.
+		enum class BoundedFlow {
+			/// Added and removed unconfirmed transactions.
+			Unconfirmed_Transactions,
+
+			/// Added and removed partial transactions and their cosignatures.
+			Partial_Transactions
+		};
+
+		constexpr const char* GetFlowName(BoundedFlow flow) {
+			return BoundedFlow::Unconfirmed_Transactions == flow ? "unconfirmed transactions" : "partial transactions";
+		}
+	}
+
 	class MessageGroup {
 	public:
 		explicit MessageGroup(const supplier<std::string>& errorMessageGenerator) : m_errorMessageGenerator(errorMessageGenerator)
@@ -53,43 +75,137 @@ namespace catapult { namespace zeromq {
 	};
 
 	class ZeroMqEntityPublisher::SynchronizedPublisher {
+	private:
+		// maximum number of message groups taken from a single flow queue before moving to the next one
+		static constexpr size_t Max_Flow_Batch_Size = 64;
+
 	public:
-		explicit SynchronizedPublisher(unsigned short port)
-				: m_zmqSocket(m_zmqContext, ZMQ_PUB)
-				, m_pPool(thread::CreateIoThreadPool(1, "ZeroMqEntityPublisher")) {
+		SynchronizedPublisher(unsigned short port, const ZeroMqEntityPublisherOptions& options)
+				: m_options(options)
+				, m_zmqSocket(m_zmqContext, ZMQ_PUB)
+				, m_numQueuedMessageGroups(0)
+				, m_numDroppedMessageGroups(0)
+				, m_isStopped(false) {
 			// note that we want closing the socket to be synchronous
 			// setting linger to 0 means that all pending messages are discarded and the socket is closed immediately
 			m_zmqSocket.setsockopt(ZMQ_LINGER, 0);
 			m_zmqSocket.bind("tcp://*:" + std::to_string(port));
 
-			m_pPool->start();
+			m_thread = std::thread([this]() { run(); });
 		}
 
 		~SynchronizedPublisher() {
-			// stop the pool first to prevent any work from being written to (closed) socket
-			m_pPool->join();
+			// stop the sender thread first to prevent any work from being written to (closed) socket
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_isStopped = true;
+			}
+
+			m_workCondition.notify_all();
+			m_spaceCondition.notify_all();
+			m_thread.join();
 			m_zmqSocket.close();
 		}
 
 	public:
-		void queue(std::unique_ptr<MessageGroup>&& pMessageGroup) {
-			// dispatch function needs to be copyable
-			auto pMessageGroupShared = std::shared_ptr<MessageGroup>(std::move(pMessageGroup));
-			boost::asio::dispatch(m_pPool->ioContext(), [&zmqSocket = m_zmqSocket, pMessageGroup{std::move(pMessageGroupShared)}]() {
-				pMessageGroup->flush(zmqSocket);
-			});
+		uint64_t numDroppedMessageGroups() const {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_numDroppedMessageGroups;
+		}
+
+	public:
+		void queueOrdered(std::unique_ptr<MessageGroup>&& pMessageGroup) {
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_orderedQueue.push_back(std::move(pMessageGroup));
+				++m_numQueuedMessageGroups;
+			}
+
+			m_workCondition.notify_one();
+		}
+
+		void queueBounded(BoundedFlow flow, std::unique_ptr<MessageGroup>&& pMessageGroup) {
+			std::unique_lock<std::mutex> lock(m_mutex);
+			auto& flowQueue = m_flowQueues[flow];
+			if (flowQueue.size() >= m_options.MaxTopicQueueSize) {
+				if (TopicQueuePolicy::Drop == m_options.QueuePolicy) {
+					if (0 == m_numDroppedMessageGroups++ % 1000)
+						CATAPULT_LOG(warning) << "dropping message group for full " << GetFlowName(flow) << " queue";
+
+					return;
+				}
+
+				m_spaceCondition.wait(lock, [this, &flowQueue]() {
+					return m_isStopped || flowQueue.size() < m_options.MaxTopicQueueSize;
+				});
+
+				if (m_isStopped)
+					return;
+			}
+
+			flowQueue.push_back(std::move(pMessageGroup));
+			++m_numQueuedMessageGroups;
+			lock.unlock();
+			m_workCondition.notify_one();
+		}
+
+	private:
+		void run() {
+			std::vector<std::unique_ptr<MessageGroup>> messageGroups;
+			for (;;) {
+				{
+					// all queued messages are sent before the thread exits
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_workCondition.wait(lock, [this]() { return m_isStopped || 0 != m_numQueuedMessageGroups; });
+					if (0 == m_numQueuedMessageGroups)
+						return;
+
+					// send all ordered messages first and then take a batch from every bounded flow queue
+					// so that a busy flow cannot starve the other one
+					std::move(m_orderedQueue.begin(), m_orderedQueue.end(), std::back_inserter(messageGroups));
+					m_orderedQueue.clear();
+					for (auto& pair : m_flowQueues) {
+						auto& flowQueue = pair.second;
+						auto batchSize = std::min(flowQueue.size(), Max_Flow_Batch_Size);
+						for (auto i = 0u; i < batchSize; ++i) {
+							messageGroups.push_back(std::move(flowQueue.front()));
+							flowQueue.pop_front();
+						}
+					}
+
+					m_numQueuedMessageGroups -= messageGroups.size();
+				}
+
+				m_spaceCondition.notify_all();
+
+				for (const auto& pMessageGroup : messageGroups)
+					pMessageGroup->flush(m_zmqSocket);
+
+				messageGroups.clear();
+			}
 		}
 
 	private:
+		ZeroMqEntityPublisherOptions m_options;
 		zmq::context_t m_zmqContext;
 		zmq::socket_t m_zmqSocket;
-		std::unique_ptr<thread::IoThreadPool> m_pPool;
+
+		mutable std::mutex m_mutex;
+		std::condition_variable m_workCondition;
+		std::condition_variable m_spaceCondition;
+		std::deque<std::unique_ptr<MessageGroup>> m_orderedQueue;
+		std::map<BoundedFlow, std::deque<std::unique_ptr<MessageGroup>>> m_flowQueues;
+		size_t m_numQueuedMessageGroups;
+		uint64_t m_numDroppedMessageGroups;
+		bool m_isStopped;
+		std::thread m_thread;
 	};
 
 	struct ZeroMqEntityPublisher::WeakTransactionInfo {
 	public:
 		explicit WeakTransactionInfo(const model::TransactionInfo& transactionInfo)
 				: Transaction(*transactionInfo.pEntity)
+				, pTransaction(transactionInfo.pEntity)
 				, EntityHash(transactionInfo.EntityHash)
 				, MerkleComponentHash(transactionInfo.MerkleComponentHash)
 				, OptionalAddresses(transactionInfo.OptionalExtractedAddresses.get())
@@ -114,6 +230,7 @@ namespace catapult { namespace zeromq {
 
 	public:
 		const model::Transaction& Transaction;
+		std::shared_ptr<const model::Transaction> pTransaction;
 		const Hash256& EntityHash;
 		const Hash256& MerkleComponentHash;
 		const model::UnresolvedAddressSet* OptionalAddresses;
@@ -124,13 +241,30 @@ namespace catapult { namespace zeromq {
 			unsigned short port,
 			std::unique_ptr<model::NotificationPublisher>&& pNotificationPublisher,
 			const model::ExtractorContextFactoryFunc & contextFactory)
+			: ZeroMqEntityPublisher(
+					port,
+					std::move(pNotificationPublisher),
+					contextFactory,
+					{ true, std::numeric_limits<uint32_t>::max(), TopicQueuePolicy::Block })
+	{}
+
+	ZeroMqEntityPublisher::ZeroMqEntityPublisher(
+			unsigned short port,
+			std::unique_ptr<model::NotificationPublisher>&& pNotificationPublisher,
+			const model::ExtractorContextFactoryFunc& contextFactory,
+			const ZeroMqEntityPublisherOptions& options)
 			: m_pNotificationPublisher(std::move(pNotificationPublisher))
-			, m_pSynchronizedPublisher(std::make_unique<SynchronizedPublisher>(port))
+			, m_options(options)
+			, m_pSynchronizedPublisher(std::make_unique<SynchronizedPublisher>(port, options))
 			, m_extractorContextFactory(contextFactory)
 	{}
 
 	ZeroMqEntityPublisher::~ZeroMqEntityPublisher() = default;
 
+	uint64_t ZeroMqEntityPublisher::numDroppedMessageGroups() const {
+		return m_pSynchronizedPublisher->numDroppedMessageGroups();
+	}
+
 	namespace {
 		auto CreateHeightMessageGenerator(const std::string& topicName, Height height) {
 			return [topicName, height]() {
@@ -152,7 +286,7 @@ namespace catapult { namespace zeromq {
 		multipart.addmem(static_cast<const void*>(&blockElement.GenerationHash), Hash256_Size);
 
 		pMessageGroup->add(std::move(multipart));
-		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+		m_pSynchronizedPublisher->queueOrdered(std::move(pMessageGroup));
 
 		if (blockElement.OptionalStatement) {
 			const auto& statements = blockElement.OptionalStatement->PublicKeyStatements;
@@ -170,10 +304,26 @@ namespace catapult { namespace zeromq {
 		multipart.addmem(&marker, sizeof(marker));
 		multipart.addmem(static_cast<const void*>(&height), sizeof(Height));
 		pMessageGroup->add(std::move(multipart));
-		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+		m_pSynchronizedPublisher->queueOrdered(std::move(pMessageGroup));
 	}
 
 	namespace {
+		bool TryGetBoundedFlow(TransactionMarker topicMarker, BoundedFlow& flow) {
+			switch (topicMarker) {
+			case TransactionMarker::Unconfirmed_Transaction_Add_Marker:
+			case TransactionMarker::Unconfirmed_Transaction_Remove_Marker:
+				flow = BoundedFlow::Unconfirmed_Transactions;
+				return true;
+			case TransactionMarker::Partial_Transaction_Add_Marker:
+			case TransactionMarker::Partial_Transaction_Remove_Marker:
+			case TransactionMarker::Cosignature_Marker:
+				flow = BoundedFlow::Partial_Transactions;
+				return true;
+			default:
+				return false;
+			}
+		}
+
 		auto CreateHashMessageGenerator(const std::string& topicName, const Hash256& hash) {
 			return [topicName, hash]() {
 				std::ostringstream out;
@@ -203,12 +353,44 @@ namespace catapult { namespace zeromq {
 		});
 	}
 
+	namespace {
+		void AddSharedFrame(zmq::multipart_t& multipart, const std::shared_ptr<const model::Transaction>& pTransaction) {
+			// zeromq keeps the transaction alive (via hint) until the frame has been sent
+			auto pHint = std::make_unique<std::shared_ptr<const void>>(pTransaction);
+			zmq::message_t message(
+					const_cast<model::Transaction*>(pTransaction.get()),
+					pTransaction->Size,
+					[](void*, void* pHintRaw) { delete static_cast<std::shared_ptr<const void>*>(pHintRaw); },
+					pHint.get());
+			pHint.release();
+			multipart.add(std::move(message));
+		}
+	}
+
 	void ZeroMqEntityPublisher::publishTransaction(
 			TransactionMarker topicMarker,
 			const WeakTransactionInfo& transactionInfo) {
-		publish("transaction", topicMarker, transactionInfo, [&transactionInfo](auto& multipart) {
-			const auto& transaction = transactionInfo.Transaction;
-			multipart.addmem(static_cast<const void*>(&transaction), transaction.Size);
+		// when zero copy is enabled, all messages share the transaction data, which only needs to be copied
+		// when it is not already owned by a shared pointer
+		std::shared_ptr<const model::Transaction> pSharedTransaction;
+		if (m_options.EnableZeroCopy) {
+			pSharedTransaction = transactionInfo.pTransaction;
+			if (!pSharedTransaction) {
+				const auto& transaction = transactionInfo.Transaction;
+				auto pTransactionCopy = utils::MakeSharedWithSize<model::Transaction>(transaction.Size);
+				std::memcpy(static_cast<void*>(pTransactionCopy.get()), &transaction, transaction.Size);
+				pSharedTransaction = std::move(pTransactionCopy);
+			}
+		}
+
+		publish("transaction", topicMarker, transactionInfo, [&transactionInfo, &pSharedTransaction](auto& multipart) {
+			if (pSharedTransaction) {
+				AddSharedFrame(multipart, pSharedTransaction);
+			} else {
+				const auto& transaction = transactionInfo.Transaction;
+				multipart.addmem(static_cast<const void*>(&transaction), transaction.Size);
+			}
+
 			multipart.addmem(static_cast<const void*>(&transactionInfo.EntityHash), Hash256_Size);
 			multipart.addmem(static_cast<const void*>(&transactionInfo.MerkleComponentHash), Hash256_Size);
 			multipart.addtyp(transactionInfo.AssociatedHeight);
@@ -243,7 +425,7 @@ namespace catapult { namespace zeromq {
 			multipart.addmem(&topic, sizeof(TransactionMarker));
 			multipart.addmem(&receipt, receipt.Size);
 			pMessageGroup->add(std::move(multipart));
-			m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+			m_pSynchronizedPublisher->queueOrdered(std::move(pMessageGroup));
 		}
 	}
 
@@ -269,6 +451,10 @@ namespace catapult { namespace zeromq {
 			pMessageGroup->add(std::move(multipart));
 		}
 
-		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+		BoundedFlow flow;
+		if (TryGetBoundedFlow(topicMarker, flow))
+			m_pSynchronizedPublisher->queueBounded(flow, std::move(pMessageGroup));
+		else
+			m_pSynchronizedPublisher->queueOrdered(std::move(pMessageGroup));
 	}
 }}
@@ -74,15 +74,53 @@ namespace catapult { namespace zeromq {
 		Cosignature_Marker = 0x63 // 'c'
 	};
 
+	/// Policies for handling messages published to a full topic queue.
+	enum class TopicQueuePolicy {
+		/// Messages are dropped.
+		Drop,
+
+		/// Publishing blocks until the queue has space.
+		Block
+	};
+
+	/// Zeromq entity publisher options.
+	struct ZeroMqEntityPublisherOptions {
+		/// \c true if entity data should be shared with zeromq instead of being copied into every message.
+		bool EnableZeroCopy;
+
+		/// Maximum number of message groups queued for unconfirmed transactions and for partial transactions.
+		uint32_t MaxTopicQueueSize;
+
+		/// Policy for handling messages published to a full unconfirmed or partial transaction queue.
+		TopicQueuePolicy QueuePolicy;
+	};
+
 	/// A zeromq entity publisher.
+	/// \note Messages are sent by a dedicated thread. Block, receipt and confirmed transaction messages share a single
+	///       ordered queue that is never bounded. Unconfirmed and partial transaction messages (including cosignatures)
+	///       are queued per flow in bounded queues, so a burst of them cannot delay or displace block messages.
+	///       All messages of a flow (e.g. added and removed unconfirmed transactions) share a queue, so they are sent
+	///       in the order they were published and are subject to the same drop decisions.
 	class ZeroMqEntityPublisher {
 	public:
 		/// Creates a zeromq entity publisher around \a port, \a pNotificationPublisher and \a contextFactory.
 		explicit ZeroMqEntityPublisher(unsigned short port,
 				std::unique_ptr<model::NotificationPublisher>&& pNotificationPublisher, const model::ExtractorContextFactoryFunc& contextFactory);
 
+		/// Creates a zeromq entity publisher around \a port, \a pNotificationPublisher and \a contextFactory
+		/// using \a options.
+		ZeroMqEntityPublisher(
+				unsigned short port,
+				std::unique_ptr<model::NotificationPublisher>&& pNotificationPublisher,
+				const model::ExtractorContextFactoryFunc& contextFactory,
+				const ZeroMqEntityPublisherOptions& options);
+
 		~ZeroMqEntityPublisher();
 
+	public:
+		/// Gets the number of unconfirmed or partial transaction message groups that were dropped because their topic queue was full.
+		uint64_t numDroppedMessageGroups() const;
+
 	public:
 		/// Publishes the block header in \a blockElement.
 		void publishBlockHeader(const model::BlockElement& blockElement);
@@ -120,6 +158,7 @@ namespace catapult { namespace zeromq {
 	private:
 		class SynchronizedPublisher;
 		std::unique_ptr<model::NotificationPublisher> m_pNotificationPublisher;
+		ZeroMqEntityPublisherOptions m_options;
 		std::unique_ptr<SynchronizedPublisher> m_pSynchronizedPublisher;
 		model::ExtractorContextFactoryFunc m_extractorContextFactory;
 	};
@@ -34,7 +34,10 @@ namespace catapult { namespace zeromq {
 					{
 						"messaging",
 						{
-							{ "subscriberPort", "9753" }
+							{ "subscriberPort", "9753" },
+							{ "enableZeroCopy", "true" },
+							{ "maxTopicQueueSize", "1234" },
+							{ "shouldDropMessagesWhenTopicQueueIsFull", "true" }
 						}
 					}
 				};
@@ -55,11 +58,17 @@ namespace catapult { namespace zeromq {
 			static void AssertZero(const MessagingConfiguration& config) {
 				// Assert:
 				EXPECT_EQ(0u, config.SubscriberPort);
+				EXPECT_FALSE(config.EnableZeroCopy);
+				EXPECT_EQ(0u, config.MaxTopicQueueSize);
+				EXPECT_FALSE(config.ShouldDropMessagesWhenTopicQueueIsFull);
 			}
 
 			static void AssertCustom(const MessagingConfiguration& config) {
 				// Assert:
 				EXPECT_EQ(9753u, config.SubscriberPort);
+				EXPECT_TRUE(config.EnableZeroCopy);
+				EXPECT_EQ(1234u, config.MaxTopicQueueSize);
+				EXPECT_TRUE(config.ShouldDropMessagesWhenTopicQueueIsFull);
 			}
 		};
 	}
@@ -79,6 +88,9 @@ namespace catapult { namespace zeromq {
 
 		// Assert:
 		EXPECT_EQ(7902u, config.SubscriberPort);
+		EXPECT_TRUE(config.EnableZeroCopy);
+		EXPECT_EQ(100'000u, config.MaxTopicQueueSize);
+		EXPECT_FALSE(config.ShouldDropMessagesWhenTopicQueueIsFull);
 	}
 
 	// endregion
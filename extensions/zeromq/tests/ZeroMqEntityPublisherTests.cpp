@@ -46,6 +46,9 @@ namespace catapult { namespace zeromq {
 		}
 
 		class EntityPublisherContext : public test::MqContext {
+		public:
+			using test::MqContext::MqContext;
+
 		public:
 			void publishBlockHeader(const model::BlockElement& blockElement) {
 				publisher().publishBlockHeader(blockElement);
@@ -95,6 +98,97 @@ namespace catapult { namespace zeromq {
 		context.destroyPublisher();
 	}
 
+	TEST(TEST_CLASS, PublisherDropsMessagesWhenTopicQueueIsFull) {
+		// Arrange: no message fits into the topic queue
+		EntityPublisherContext context({ true, 0, TopicQueuePolicy::Drop });
+		auto marker = TransactionMarker::Unconfirmed_Transaction_Add_Marker;
+		auto transactionInfo = ToTransactionInfo(mocks::CreateMockTransaction(0), Height(123));
+		transactionInfo.OptionalExtractedAddresses = GenerateRandomExtractedAddresses();
+		context.subscribeAll(marker, *transactionInfo.OptionalExtractedAddresses);
+
+		// Act:
+		for (auto i = 0u; i < 3; ++i)
+			context.publishTransaction(marker, transactionInfo);
+
+		// Assert:
+		EXPECT_EQ(3u, context.publisher().numDroppedMessageGroups());
+		test::AssertNoPendingMessages(context.zmqSocket());
+	}
+
+	TEST(TEST_CLASS, PublisherDoesNotDropMessagesWhenTopicQueueIsNotFull) {
+		// Arrange:
+		EntityPublisherContext context({ true, 1000, TopicQueuePolicy::Drop });
+		auto marker = TransactionMarker::Unconfirmed_Transaction_Add_Marker;
+		auto transactionInfo = ToTransactionInfo(mocks::CreateMockTransaction(0), Height(123));
+		transactionInfo.OptionalExtractedAddresses = GenerateRandomExtractedAddresses();
+		const auto& addresses = *transactionInfo.OptionalExtractedAddresses;
+		context.subscribeAll(marker, addresses);
+
+		// Act:
+		context.publishTransaction(marker, transactionInfo);
+
+		// Assert:
+		test::AssertMessages(context.zmqSocket(), marker, addresses, [&transactionInfo](const auto& message, const auto& topic) {
+			test::AssertTransactionInfoMessage(message, topic, transactionInfo, Height(123));
+		});
+		EXPECT_EQ(0u, context.publisher().numDroppedMessageGroups());
+	}
+
+	TEST(TEST_CLASS, PublisherNeverDropsBlockMessages) {
+		// Arrange: no message fits into a topic queue
+		EntityPublisherContext context({ true, 0, TopicQueuePolicy::Drop });
+		context.subscribe(BlockMarker::Drop_Blocks_Marker);
+
+		// Act:
+		for (auto i = 1u; i <= 3; ++i)
+			context.publishDropBlocks(Height(i));
+
+		// Assert: all messages were sent in order
+		for (auto i = 1u; i <= 3; ++i) {
+			zmq::multipart_t message;
+			test::ZmqReceive(message, context.zmqSocket());
+
+			test::AssertDropBlocksMessage(message, Height(i));
+		}
+
+		EXPECT_EQ(0u, context.publisher().numDroppedMessageGroups());
+	}
+
+	TEST(TEST_CLASS, PublisherPreservesOrderOfAddedAndRemovedTransactions) {
+		// Arrange:
+		EntityPublisherContext context({ true, 1000, TopicQueuePolicy::Block });
+		auto addMarker = TransactionMarker::Unconfirmed_Transaction_Add_Marker;
+		auto removeMarker = TransactionMarker::Unconfirmed_Transaction_Remove_Marker;
+		auto pAddresses = test::GenerateRandomUnresolvedAddressSetPointer(1);
+		const auto& address = *pAddresses->cbegin();
+		context.subscribeAll(addMarker, *pAddresses);
+		context.subscribeAll(removeMarker, *pAddresses);
+
+		std::vector<model::TransactionInfo> transactionInfos;
+		for (auto i = 0u; i < 100; ++i) {
+			transactionInfos.push_back(ToTransactionInfo(mocks::CreateMockTransaction(0), Height(123)));
+			transactionInfos.back().OptionalExtractedAddresses = pAddresses;
+		}
+
+		// Act: remove every transaction right after adding it
+		for (const auto& transactionInfo : transactionInfos) {
+			context.publishTransactionHash(addMarker, transactionInfo);
+			context.publishTransactionHash(removeMarker, transactionInfo);
+		}
+
+		// Assert: no remove message overtook its add message
+		for (const auto& transactionInfo : transactionInfos) {
+			for (auto marker : { addMarker, removeMarker }) {
+				zmq::multipart_t message;
+				test::ZmqReceive(message, context.zmqSocket());
+
+				test::AssertTransactionHashMessage(message, CreateTopic(marker, address), transactionInfo.EntityHash);
+			}
+		}
+
+		test::AssertNoPendingMessages(context.zmqSocket());
+	}
+
 	// endregion
 
 	// region publishBlockHeader
@@ -144,9 +238,9 @@ namespace catapult { namespace zeromq {
 		constexpr TransactionMarker Marker = TransactionMarker(12);
 
 		template<typename TAddressesGenerator>
-		void AssertCanPublishTransactionInfo(TAddressesGenerator generateAddresses) {
+		void AssertCanPublishTransactionInfo(TAddressesGenerator generateAddresses, bool enableZeroCopy = true) {
 			// Arrange:
-			EntityPublisherContext context;
+			EntityPublisherContext context({ enableZeroCopy, 1000, TopicQueuePolicy::Block });
 			Height height(123);
 			auto transactionInfo = ToTransactionInfo(mocks::CreateMockTransaction(0), height);
 			auto addresses = generateAddresses(transactionInfo);
@@ -163,9 +257,9 @@ namespace catapult { namespace zeromq {
 		}
 
 		template<typename TAddressesGenerator>
-		void AssertCanPublishTransactionElement(TAddressesGenerator generateAddresses) {
+		void AssertCanPublishTransactionElement(TAddressesGenerator generateAddresses, bool enableZeroCopy = true) {
 			// Arrange:
-			EntityPublisherContext context;
+			EntityPublisherContext context({ enableZeroCopy, 1000, TopicQueuePolicy::Block });
 			auto pTransaction = mocks::CreateMockTransaction(0);
 			auto transactionElement = ToTransactionElement(*pTransaction);
 			Height height(123);
@@ -205,6 +299,22 @@ namespace catapult { namespace zeromq {
 		});
 	}
 
+	TEST(TEST_CLASS, CanPublishTransactionWithoutZeroCopy_TransactionInfo) {
+		// Assert:
+		AssertCanPublishTransactionInfo([](auto& transactionInfo) {
+			transactionInfo.OptionalExtractedAddresses = GenerateRandomExtractedAddresses();
+			return *transactionInfo.OptionalExtractedAddresses;
+		}, false);
+	}
+
+	TEST(TEST_CLASS, CanPublishTransactionWithoutZeroCopy_TransactionElement) {
+		// Assert:
+		AssertCanPublishTransactionElement([](auto& transactionElement) {
+			transactionElement.OptionalExtractedAddresses = GenerateRandomExtractedAddresses();
+			return *transactionElement.OptionalExtractedAddresses;
+		}, false);
+	}
+
 	TEST(TEST_CLASS, CanPublishTransactionToCustomAddresses_TransactionElement) {
 		// Assert:
 		AssertCanPublishTransactionElement([](auto& transactionElement) {
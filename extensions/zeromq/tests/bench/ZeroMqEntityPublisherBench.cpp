@@ -0,0 +1,164 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "zeromq/src/ZeroMqEntityPublisher.h"
+#include "catapult/model/EntityInfo.h"
+#include "catapult/utils/MemoryUtils.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <thread>
+
+namespace catapult { namespace zeromq {
+
+	namespace {
+		constexpr unsigned short Port = 17902;
+		constexpr size_t Num_Transactions_Per_Iteration = 1000;
+		constexpr auto Marker = TransactionMarker::Unconfirmed_Transaction_Add_Marker;
+
+		// region LocalSubscriber
+
+		// counts all messages published on the local port
+		class LocalSubscriber {
+		public:
+			LocalSubscriber()
+					: m_zmqSocket(m_zmqContext, ZMQ_SUB)
+					, m_numMessages(0)
+					, m_isStopped(false) {
+				m_zmqSocket.setsockopt(ZMQ_RCVHWM, 0);
+				m_zmqSocket.setsockopt(ZMQ_RCVTIMEO, 10);
+				m_zmqSocket.setsockopt(ZMQ_SUBSCRIBE, "", 0);
+				m_zmqSocket.connect("tcp://localhost:" + std::to_string(Port));
+				m_thread = std::thread([this]() { run(); });
+			}
+
+			~LocalSubscriber() {
+				m_isStopped = true;
+				m_thread.join();
+			}
+
+		public:
+			size_t numMessages() const {
+				return m_numMessages;
+			}
+
+			// waits until \a numMessages have been received or no message has been received for a while
+			void waitFor(size_t numMessages) {
+				auto lastNumMessages = m_numMessages.load();
+				auto lastProgressTime = std::chrono::steady_clock::now();
+				while (m_numMessages < numMessages) {
+					std::this_thread::sleep_for(std::chrono::microseconds(100));
+					if (lastNumMessages != m_numMessages) {
+						lastNumMessages = m_numMessages;
+						lastProgressTime = std::chrono::steady_clock::now();
+					} else if (std::chrono::steady_clock::now() - lastProgressTime > std::chrono::milliseconds(200)) {
+						return;
+					}
+				}
+			}
+
+		private:
+			void run() {
+				zmq::multipart_t message;
+				while (!m_isStopped) {
+					if (message.recv(m_zmqSocket))
+						++m_numMessages;
+				}
+			}
+
+		private:
+			zmq::context_t m_zmqContext;
+			zmq::socket_t m_zmqSocket;
+			std::atomic<size_t> m_numMessages;
+			std::atomic_bool m_isStopped;
+			std::thread m_thread;
+		};
+
+		// endregion
+
+		// region transactions
+
+		std::vector<model::TransactionInfo> GenerateTransactionInfos(uint32_t transactionSize, size_t numAddresses) {
+			std::vector<model::TransactionInfo> transactionInfos;
+			for (auto i = 0u; i < Num_Transactions_Per_Iteration; ++i) {
+				auto pTransaction = utils::MakeSharedWithSize<model::Transaction>(transactionSize);
+				bench::FillWithRandomData({ reinterpret_cast<uint8_t*>(pTransaction.get()), transactionSize });
+				pTransaction->Size = transactionSize;
+
+				// addresses are supplied, so notification publisher is never used
+				auto pAddresses = std::make_shared<model::UnresolvedAddressSet>();
+				for (auto j = 0u; j < numAddresses; ++j) {
+					UnresolvedAddress address;
+					bench::FillWithRandomData({ reinterpret_cast<uint8_t*>(address.data()), address.size() });
+					pAddresses->insert(address);
+				}
+
+				model::TransactionInfo transactionInfo(pTransaction, Height(1));
+				transactionInfo.OptionalExtractedAddresses = std::move(pAddresses);
+				transactionInfos.push_back(std::move(transactionInfo));
+			}
+
+			return transactionInfos;
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		void BenchmarkPublishTransactions(benchmark::State& state) {
+			auto transactionSize = static_cast<uint32_t>(state.range(0));
+			auto numAddresses = static_cast<size_t>(state.range(1));
+			auto enableZeroCopy = 0 != state.range(2);
+
+			ZeroMqEntityPublisherOptions options{ enableZeroCopy, 100'000, TopicQueuePolicy::Block };
+			ZeroMqEntityPublisher publisher(Port, nullptr, []() { return model::ExtractorContext(); }, options);
+			LocalSubscriber subscriber;
+
+			// wait for subscription to be established
+			auto transactionInfos = GenerateTransactionInfos(transactionSize, numAddresses);
+			while (0 == subscriber.numMessages()) {
+				publisher.publishTransaction(Marker, transactionInfos[0]);
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
+
+			subscriber.waitFor(std::numeric_limits<size_t>::max());
+
+			size_t numExpectedMessages = 0;
+			auto numInitialMessages = subscriber.numMessages();
+			for (auto _ : state) {
+				for (const auto& transactionInfo : transactionInfos)
+					publisher.publishTransaction(Marker, transactionInfo);
+
+				numExpectedMessages += transactionInfos.size() * numAddresses;
+				subscriber.waitFor(numInitialMessages + numExpectedMessages);
+			}
+
+			auto numReceivedMessages = subscriber.numMessages() - numInitialMessages;
+			state.counters["received ratio"] = static_cast<double>(numReceivedMessages) / static_cast<double>(numExpectedMessages);
+			state.SetItemsProcessed(static_cast<int64_t>(numReceivedMessages));
+			state.SetBytesProcessed(static_cast<int64_t>(numReceivedMessages * transactionSize));
+		}
+
+		void AddPublishArguments(benchmark::internal::Benchmark& benchmark) {
+			benchmark.ArgNames({ "size", "addresses", "zero copy" });
+			for (auto enableZeroCopy : { 0, 1 }) {
+				for (auto transactionSize : { 256, 4096, 65536 }) {
+					for (auto numAddresses : { 1, 8 })
+						benchmark.Args({ transactionSize, numAddresses, enableZeroCopy });
+				}
+			}
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	catapult::zeromq::AddPublishArguments(*benchmark::RegisterBenchmark(
+			"BenchmarkPublishTransactions",
+			catapult::zeromq::BenchmarkPublishTransactions)->Unit(benchmark::kMillisecond)->UseRealTime());
+}
@@ -29,6 +29,7 @@
 #include "catapult/types.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/TestHarness.h"
+#include <limits>
 #include <unordered_set>
 #include <vector>
 #include <zmq_addon.hpp>
@@ -119,12 +120,17 @@ namespace catapult { namespace test {
 	class MqContext {
 	public:
 		/// Creates a message queue context.
-		MqContext()
+		MqContext() : MqContext({ true, std::numeric_limits<uint32_t>::max(), zeromq::TopicQueuePolicy::Block })
+		{}
+
+		/// Creates a message queue context around publisher \a options.
+		explicit MqContext(const zeromq::ZeroMqEntityPublisherOptions& options)
 				: m_registry(mocks::CreateDefaultTransactionRegistry())
 				, m_pZeroMqEntityPublisher(std::make_shared<zeromq::ZeroMqEntityPublisher>(
 						GetDefaultLocalHostZmqPort(),
 						model::CreateNotificationPublisher(m_registry, UnresolvedMosaicId(), m_transactionFeeCalculator),
-						[](){ return model::ExtractorContext(); }))
+						[](){ return model::ExtractorContext(); },
+						options))
 				, m_zmqSocket(m_zmqContext, ZMQ_SUB) {
 			m_zmqSocket.setsockopt(ZMQ_RCVTIMEO, 10);
 			m_zmqSocket.connect("tcp://localhost:" + std::to_string(GetDefaultLocalHostZmqPort()));
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "TimeBucketedHashSet.h"
 #include "catapult/cache/CacheDescriptorAdapters.h"
 #include "catapult/cache/SingleSetCacheTypesAdapter.h"
 #include "catapult/state/TimestampedHash.h"
@@ -65,7 +66,11 @@ namespace catapult { namespace cache {
 	};
 
 	/// Hash cache types.
-	struct HashCacheTypes : public SingleSetCacheTypesAdapter<ImmutableOrderedSetAdapter<HashCacheDescriptor>, std::true_type> {
+	/// \note Committed in memory hashes are grouped into time buckets, so pruning drops whole buckets.
+	///       Delta hashes are kept in std::set because they are inserted one at a time.
+	struct HashCacheTypes : public SingleSetCacheTypesAdapter<
+			ImmutableOrderedSetAdapter<HashCacheDescriptor, TimeBucketedHashSet>,
+			std::true_type> {
 		using CacheReadOnlyType = ReadOnlySimpleCache<BasicHashCacheView, BasicHashCacheDelta, state::TimestampedHash>;
 
 		/// Custom sub view options.
@@ -0,0 +1,172 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "TimeBucketedHashSet.h"
+#include <algorithm>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		uint64_t GetBucketId(const state::TimestampedHash& timestampedHash) {
+			return timestampedHash.Time.unwrap() / TimeBucketedHashSet::Bucket_Duration_Millis;
+		}
+	}
+
+	TimeBucketedHashSet::TimeBucketedHashSet() : m_size(0)
+	{}
+
+	size_t TimeBucketedHashSet::size() const {
+		return m_size;
+	}
+
+	bool TimeBucketedHashSet::empty() const {
+		return 0 == m_size;
+	}
+
+	size_t TimeBucketedHashSet::bucketCount() const {
+		return m_buckets.size();
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::begin() const {
+		return cbegin();
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::end() const {
+		return cend();
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::cbegin() const {
+		return const_iterator(m_buckets.cbegin(), 0);
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::cend() const {
+		return const_iterator(m_buckets.cend(), 0);
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::find(const state::TimestampedHash& timestampedHash) const {
+		auto bucketIter = m_buckets.find(GetBucketId(timestampedHash));
+		if (m_buckets.cend() == bucketIter)
+			return cend();
+
+		const auto& bucket = bucketIter->second;
+		auto iter = std::lower_bound(bucket.cbegin(), bucket.cend(), timestampedHash);
+		return bucket.cend() != iter && timestampedHash == *iter
+				? const_iterator(bucketIter, static_cast<size_t>(iter - bucket.cbegin()))
+				: cend();
+	}
+
+	size_t TimeBucketedHashSet::count(const state::TimestampedHash& timestampedHash) const {
+		return cend() == find(timestampedHash) ? 0 : 1;
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::lower_bound(const state::TimestampedHash& timestampedHash) const {
+		auto bucketIter = m_buckets.lower_bound(GetBucketId(timestampedHash));
+		if (m_buckets.cend() == bucketIter || GetBucketId(timestampedHash) != bucketIter->first)
+			return const_iterator(bucketIter, 0);
+
+		const auto& bucket = bucketIter->second;
+		auto iter = std::lower_bound(bucket.cbegin(), bucket.cend(), timestampedHash);
+		return makeIterator(bucketIter, static_cast<size_t>(iter - bucket.cbegin()));
+	}
+
+	std::pair<TimeBucketedHashSet::const_iterator, bool> TimeBucketedHashSet::insert(const state::TimestampedHash& timestampedHash) {
+		auto bucketIter = m_buckets.emplace(GetBucketId(timestampedHash), BucketType()).first;
+		auto& bucket = bucketIter->second;
+		auto iter = std::lower_bound(bucket.begin(), bucket.end(), timestampedHash);
+		auto index = static_cast<size_t>(iter - bucket.begin());
+		if (bucket.end() != iter && timestampedHash == *iter)
+			return std::make_pair(const_iterator(bucketIter, index), false);
+
+		bucket.insert(iter, timestampedHash);
+		++m_size;
+		return std::make_pair(const_iterator(bucketIter, index), true);
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::insert(const_iterator, const state::TimestampedHash& timestampedHash) {
+		return insert(timestampedHash).first;
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::erase(const_iterator iter) {
+		auto next = iter;
+		return erase(iter, ++next);
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::erase(const_iterator first, const_iterator last) {
+		// convert const iterators into mutable iterators
+		auto bucketIter = m_buckets.erase(first.m_bucketIter, first.m_bucketIter);
+		auto startIndex = first.m_index;
+		while (m_buckets.end() != bucketIter && last.m_bucketIter != bucketIter) {
+			// erase the remainder of the bucket, dropping it completely when erasing from its start
+			auto& bucket = bucketIter->second;
+			m_size -= bucket.size() - startIndex;
+			if (0 == startIndex) {
+				bucketIter = m_buckets.erase(bucketIter);
+			} else {
+				bucket.erase(bucket.begin() + static_cast<std::ptrdiff_t>(startIndex), bucket.end());
+				++bucketIter;
+			}
+
+			startIndex = 0;
+		}
+
+		if (m_buckets.end() == bucketIter)
+			return cend();
+
+		// erase the part of the last bucket preceding last
+		auto& bucket = bucketIter->second;
+		auto endIndex = last.m_index;
+		m_size -= endIndex - startIndex;
+		bucket.erase(bucket.begin() + static_cast<std::ptrdiff_t>(startIndex), bucket.begin() + static_cast<std::ptrdiff_t>(endIndex));
+		if (bucket.empty())
+			return const_iterator(m_buckets.erase(bucketIter), 0);
+
+		return makeIterator(bucketIter, startIndex);
+	}
+
+	size_t TimeBucketedHashSet::erase(const state::TimestampedHash& timestampedHash) {
+		auto iter = find(timestampedHash);
+		if (cend() == iter)
+			return 0;
+
+		erase(iter);
+		return 1;
+	}
+
+	void TimeBucketedHashSet::clear() {
+		m_buckets.clear();
+		m_size = 0;
+	}
+
+	void TimeBucketedHashSet::insertAll(std::vector<state::TimestampedHash>&& timestampedHashes) {
+		std::sort(timestampedHashes.begin(), timestampedHashes.end());
+		timestampedHashes.erase(std::unique(timestampedHashes.begin(), timestampedHashes.end()), timestampedHashes.end());
+
+		// merge each group of hashes sharing a bucket into that bucket at once
+		auto groupStart = timestampedHashes.cbegin();
+		while (timestampedHashes.cend() != groupStart) {
+			auto bucketId = GetBucketId(*groupStart);
+			auto groupEnd = std::find_if(groupStart, timestampedHashes.cend(), [bucketId](const auto& timestampedHash) {
+				return bucketId != GetBucketId(timestampedHash);
+			});
+
+			auto& bucket = m_buckets[bucketId];
+			auto originalSize = bucket.size();
+			bucket.insert(bucket.end(), groupStart, groupEnd);
+
+			auto middle = bucket.begin() + static_cast<std::ptrdiff_t>(originalSize);
+			std::inplace_merge(bucket.begin(), middle, bucket.end());
+			bucket.erase(std::unique(bucket.begin(), bucket.end()), bucket.end());
+
+			m_size += bucket.size() - originalSize;
+			groupStart = groupEnd;
+		}
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::makeIterator(BucketMap::const_iterator bucketIter, size_t index) const {
+		// iterators never point past the end of a bucket
+		return bucketIter->second.size() == index ? const_iterator(++bucketIter, 0) : const_iterator(bucketIter, index);
+	}
+}}
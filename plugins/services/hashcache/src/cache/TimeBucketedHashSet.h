@@ -0,0 +1,199 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#pragma once
+#include "catapult/state/TimestampedHash.h"
+#include <map>
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	/// Ordered set of timestamped hashes that groups hashes into sorted arrays of fixed time buckets.
+	/// \note This is a drop in replacement for std::set<state::TimestampedHash> that avoids per element node overhead
+	///       and drops whole buckets when a prefix of the set is erased (e.g. during pruning).
+	/// \note Inserting or erasing elements invalidates iterators into the affected bucket.
+	class TimeBucketedHashSet {
+	private:
+		using BucketType = std::vector<state::TimestampedHash>;
+		using BucketMap = std::map<uint64_t, BucketType>;
+
+	public:
+		using key_type = state::TimestampedHash;
+		using value_type = state::TimestampedHash;
+		using key_compare = std::less<state::TimestampedHash>;
+		using size_type = size_t;
+
+		/// Duration of a single time bucket in milliseconds.
+		static constexpr uint64_t Bucket_Duration_Millis = 60'000;
+
+	public:
+		/// Bidirectional const iterator.
+		class const_iterator {
+		public:
+			using difference_type = std::ptrdiff_t;
+			using value_type = const state::TimestampedHash;
+			using pointer = value_type*;
+			using reference = value_type&;
+			using iterator_category = std::bidirectional_iterator_tag;
+
+		public:
+			/// Creates an uninitialized iterator.
+			const_iterator() : m_index(0)
+			{}
+
+			/// Creates an iterator pointing to the element at \a index in the bucket pointed to by \a bucketIter.
+			const_iterator(BucketMap::const_iterator bucketIter, size_t index)
+					: m_bucketIter(bucketIter)
+					, m_index(index)
+			{}
+
+		public:
+			/// Returns \c true if this iterator is equal to \a rhs.
+			bool operator==(const const_iterator& rhs) const {
+				return m_bucketIter == rhs.m_bucketIter && m_index == rhs.m_index;
+			}
+
+			/// Returns \c true if this iterator is not equal to \a rhs.
+			bool operator!=(const const_iterator& rhs) const {
+				return !(*this == rhs);
+			}
+
+		public:
+			/// Advances the iterator to the next position.
+			const_iterator& operator++() {
+				if (++m_index == m_bucketIter->second.size()) {
+					++m_bucketIter;
+					m_index = 0;
+				}
+
+				return *this;
+			}
+
+			/// Advances the iterator to the next position.
+			const_iterator operator++(int) {
+				auto copy = *this;
+				++*this;
+				return copy;
+			}
+
+			/// Moves the iterator to the previous position.
+			const_iterator& operator--() {
+				if (0 == m_index) {
+					--m_bucketIter;
+					m_index = m_bucketIter->second.size();
+				}
+
+				--m_index;
+				return *this;
+			}
+
+			/// Moves the iterator to the previous position.
+			const_iterator operator--(int) {
+				auto copy = *this;
+				--*this;
+				return copy;
+			}
+
+		public:
+			/// Returns a reference to the current element.
+			reference operator*() const {
+				return m_bucketIter->second[m_index];
+			}
+
+			/// Returns a pointer to the current element.
+			pointer operator->() const {
+				return &m_bucketIter->second[m_index];
+			}
+
+		private:
+			BucketMap::const_iterator m_bucketIter;
+			size_t m_index;
+
+			friend class TimeBucketedHashSet;
+		};
+
+		using iterator = const_iterator;
+
+	public:
+		/// Creates an empty set.
+		TimeBucketedHashSet();
+
+	public:
+		/// Gets the number of elements in the set.
+		size_t size() const;
+
+		/// Returns \c true if the set is empty.
+		bool empty() const;
+
+		/// Gets the number of time buckets in the set.
+		size_t bucketCount() const;
+
+	public:
+		/// Returns a const iterator to the first element.
+		const_iterator begin() const;
+
+		/// Returns a const iterator to the element following the last element.
+		const_iterator end() const;
+
+		/// Returns a const iterator to the first element.
+		const_iterator cbegin() const;
+
+		/// Returns a const iterator to the element following the last element.
+		const_iterator cend() const;
+
+	public:
+		/// Searches for \a timestampedHash in the set.
+		const_iterator find(const state::TimestampedHash& timestampedHash) const;
+
+		/// Returns the number of elements equal to \a timestampedHash (either 0 or 1).
+		size_t count(const state::TimestampedHash& timestampedHash) const;
+
+		/// Returns an iterator to the first element not less than \a timestampedHash.
+		const_iterator lower_bound(const state::TimestampedHash& timestampedHash) const;
+
+	public:
+		/// Inserts \a timestampedHash into the set.
+		std::pair<const_iterator, bool> insert(const state::TimestampedHash& timestampedHash);
+
+		/// Inserts \a timestampedHash into the set ignoring \a hint.
+		const_iterator insert(const_iterator hint, const state::TimestampedHash& timestampedHash);
+
+		/// Inserts all elements in the range [\a first, \a last) into the set.
+		/// \note Elements are merged into each bucket at once instead of being inserted one at a time.
+		template<typename TInputIterator>
+		void insert(TInputIterator first, TInputIterator last) {
+			insertAll(std::vector<state::TimestampedHash>(first, last));
+		}
+
+		/// Constructs an element around \a args and inserts it into the set.
+		template<typename... TArgs>
+		std::pair<const_iterator, bool> emplace(TArgs&&... args) {
+			return insert(state::TimestampedHash(std::forward<TArgs>(args)...));
+		}
+
+		/// Erases the element pointed to by \a iter and returns an iterator to the following element.
+		const_iterator erase(const_iterator iter);
+
+		/// Erases all elements in the range [\a first, \a last) and returns an iterator to the following element.
+		/// \note Buckets that are completely contained in the range are dropped without touching their elements.
+		const_iterator erase(const_iterator first, const_iterator last);
+
+		/// Erases \a timestampedHash from the set and returns the number of erased elements.
+		size_t erase(const state::TimestampedHash& timestampedHash);
+
+		/// Erases all elements.
+		void clear();
+
+	private:
+		void insertAll(std::vector<state::TimestampedHash>&& timestampedHashes);
+
+		const_iterator makeIterator(BucketMap::const_iterator bucketIter, size_t index) const;
+
+	private:
+		BucketMap m_buckets;
+		size_t m_size;
+	};
+}}
@@ -0,0 +1,295 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "src/cache/TimeBucketedHashSet.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+#include <set>
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS TimeBucketedHashSetTests
+
+	namespace {
+		constexpr auto Bucket_Duration = TimeBucketedHashSet::Bucket_Duration_Millis;
+
+		state::TimestampedHash CreateTimestampedHash(uint64_t time, uint8_t tag = 0) {
+			auto timestampedHash = state::TimestampedHash(Timestamp(time));
+			timestampedHash.Hash[0] = tag;
+			return timestampedHash;
+		}
+
+		std::vector<state::TimestampedHash> GenerateRandomTimestampedHashes(size_t count, uint64_t maxTime) {
+			std::vector<state::TimestampedHash> timestampedHashes;
+			for (auto i = 0u; i < count; ++i) {
+				state::TimestampedHash timestampedHash(Timestamp(test::Random() % maxTime));
+				test::FillWithRandomData({ timestampedHash.Hash.data(), timestampedHash.Hash.size() });
+				timestampedHashes.push_back(timestampedHash);
+			}
+
+			return timestampedHashes;
+		}
+
+		template<typename TInputIterator>
+		std::vector<state::TimestampedHash> ToVector(TInputIterator begin, TInputIterator end) {
+			return std::vector<state::TimestampedHash>(begin, end);
+		}
+
+		void AssertEquivalent(const std::set<state::TimestampedHash>& expected, const TimeBucketedHashSet& set) {
+			EXPECT_EQ(expected.size(), set.size());
+			EXPECT_EQ(expected.empty(), set.empty());
+			EXPECT_EQ(ToVector(expected.cbegin(), expected.cend()), ToVector(set.cbegin(), set.cend()));
+		}
+
+		TimeBucketedHashSet CreateSet(const std::vector<state::TimestampedHash>& timestampedHashes) {
+			TimeBucketedHashSet set;
+			for (const auto& timestampedHash : timestampedHashes)
+				set.insert(timestampedHash);
+
+			return set;
+		}
+	}
+
+	// region basic
+
+	TEST(TEST_CLASS, SetIsInitiallyEmpty) {
+		// Act:
+		TimeBucketedHashSet set;
+
+		// Assert:
+		EXPECT_EQ(0u, set.size());
+		EXPECT_TRUE(set.empty());
+		EXPECT_EQ(0u, set.bucketCount());
+		EXPECT_EQ(set.cend(), set.cbegin());
+	}
+
+	TEST(TEST_CLASS, HashesAreGroupedIntoTimeBuckets) {
+		// Act:
+		auto set = CreateSet({
+			CreateTimestampedHash(0), CreateTimestampedHash(Bucket_Duration - 1),
+			CreateTimestampedHash(Bucket_Duration), CreateTimestampedHash(Bucket_Duration, 1),
+			CreateTimestampedHash(5 * Bucket_Duration + 7)
+		});
+
+		// Assert:
+		EXPECT_EQ(5u, set.size());
+		EXPECT_EQ(3u, set.bucketCount());
+	}
+
+	// endregion
+
+	// region insert
+
+	TEST(TEST_CLASS, InsertOrdersHashesLikeOrderedSet) {
+		// Arrange:
+		auto timestampedHashes = GenerateRandomTimestampedHashes(500, 20 * Bucket_Duration);
+
+		// Act:
+		auto set = CreateSet(timestampedHashes);
+
+		// Assert:
+		AssertEquivalent(std::set<state::TimestampedHash>(timestampedHashes.cbegin(), timestampedHashes.cend()), set);
+	}
+
+	TEST(TEST_CLASS, InsertReturnsIteratorToInsertedHash) {
+		// Arrange:
+		auto set = CreateSet({ CreateTimestampedHash(1), CreateTimestampedHash(3) });
+
+		// Act:
+		auto result = set.insert(CreateTimestampedHash(2));
+
+		// Assert:
+		EXPECT_TRUE(result.second);
+		EXPECT_EQ(CreateTimestampedHash(2), *result.first);
+		EXPECT_EQ(3u, set.size());
+	}
+
+	TEST(TEST_CLASS, InsertDoesNotAddDuplicateHash) {
+		// Arrange:
+		auto set = CreateSet({ CreateTimestampedHash(1), CreateTimestampedHash(3) });
+
+		// Act:
+		auto result = set.insert(CreateTimestampedHash(3));
+
+		// Assert:
+		EXPECT_FALSE(result.second);
+		EXPECT_EQ(CreateTimestampedHash(3), *result.first);
+		EXPECT_EQ(2u, set.size());
+	}
+
+	TEST(TEST_CLASS, RangeInsertMergesHashesLikeOrderedSet) {
+		// Arrange: add some duplicates to the range
+		auto timestampedHashes = GenerateRandomTimestampedHashes(300, 20 * Bucket_Duration);
+		auto set = CreateSet(ToVector(timestampedHashes.cbegin(), timestampedHashes.cbegin() + 100));
+		auto rangeHashes = ToVector(timestampedHashes.cbegin() + 50, timestampedHashes.cend());
+		rangeHashes.push_back(timestampedHashes[200]);
+
+		// Act:
+		set.insert(rangeHashes.cbegin(), rangeHashes.cend());
+
+		// Assert:
+		AssertEquivalent(std::set<state::TimestampedHash>(timestampedHashes.cbegin(), timestampedHashes.cend()), set);
+	}
+
+	// endregion
+
+	// region find / lower_bound
+
+	TEST(TEST_CLASS, FindReturnsIteratorToKnownHash) {
+		// Arrange:
+		auto timestampedHashes = GenerateRandomTimestampedHashes(100, 20 * Bucket_Duration);
+		auto set = CreateSet(timestampedHashes);
+
+		// Act + Assert:
+		for (const auto& timestampedHash : timestampedHashes) {
+			auto iter = set.find(timestampedHash);
+			ASSERT_NE(set.cend(), iter);
+			EXPECT_EQ(timestampedHash, *iter);
+			EXPECT_EQ(1u, set.count(timestampedHash));
+		}
+	}
+
+	TEST(TEST_CLASS, FindReturnsEndForUnknownHash) {
+		// Arrange:
+		auto set = CreateSet({ CreateTimestampedHash(1), CreateTimestampedHash(Bucket_Duration + 1) });
+
+		// Act + Assert:
+		EXPECT_EQ(set.cend(), set.find(CreateTimestampedHash(1, 1)));
+		EXPECT_EQ(set.cend(), set.find(CreateTimestampedHash(3 * Bucket_Duration)));
+		EXPECT_EQ(0u, set.count(CreateTimestampedHash(1, 1)));
+	}
+
+	TEST(TEST_CLASS, LowerBoundBehavesLikeOrderedSet) {
+		// Arrange:
+		auto timestampedHashes = GenerateRandomTimestampedHashes(300, 20 * Bucket_Duration);
+		auto set = CreateSet(timestampedHashes);
+		std::set<state::TimestampedHash> expected(timestampedHashes.cbegin(), timestampedHashes.cend());
+
+		// Act + Assert: check boundaries between, at and beyond the stored hashes
+		for (auto time = 0u; time <= 22 * Bucket_Duration; time += Bucket_Duration / 4) {
+			auto key = CreateTimestampedHash(time);
+			auto expectedIter = expected.lower_bound(key);
+			auto iter = set.lower_bound(key);
+			if (expected.cend() == expectedIter)
+				EXPECT_EQ(set.cend(), iter) << time;
+			else
+				EXPECT_EQ(*expectedIter, *iter) << time;
+		}
+	}
+
+	// endregion
+
+	// region iteration
+
+	TEST(TEST_CLASS, CanIterateBackwards) {
+		// Arrange:
+		auto timestampedHashes = GenerateRandomTimestampedHashes(100, 20 * Bucket_Duration);
+		auto set = CreateSet(timestampedHashes);
+		std::set<state::TimestampedHash> expected(timestampedHashes.cbegin(), timestampedHashes.cend());
+
+		// Act:
+		std::vector<state::TimestampedHash> reversed;
+		for (auto iter = set.cend(); set.cbegin() != iter;)
+			reversed.push_back(*--iter);
+
+		// Assert:
+		EXPECT_EQ(ToVector(expected.crbegin(), expected.crend()), reversed);
+	}
+
+	// endregion
+
+	// region erase
+
+	TEST(TEST_CLASS, CanEraseByKey) {
+		// Arrange:
+		auto set = CreateSet({ CreateTimestampedHash(1), CreateTimestampedHash(2), CreateTimestampedHash(Bucket_Duration) });
+
+		// Act:
+		auto numErased1 = set.erase(CreateTimestampedHash(2));
+		auto numErased2 = set.erase(CreateTimestampedHash(Bucket_Duration));
+		auto numErased3 = set.erase(CreateTimestampedHash(3));
+
+		// Assert: the empty bucket was dropped
+		EXPECT_EQ(1u, numErased1);
+		EXPECT_EQ(1u, numErased2);
+		EXPECT_EQ(0u, numErased3);
+		AssertEquivalent({ CreateTimestampedHash(1) }, set);
+		EXPECT_EQ(1u, set.bucketCount());
+	}
+
+	TEST(TEST_CLASS, EraseByIteratorReturnsIteratorToNextHash) {
+		// Arrange:
+		auto set = CreateSet({ CreateTimestampedHash(1), CreateTimestampedHash(Bucket_Duration), CreateTimestampedHash(Bucket_Duration + 1) });
+
+		// Act:
+		auto iter = set.erase(set.find(CreateTimestampedHash(1)));
+
+		// Assert:
+		ASSERT_NE(set.cend(), iter);
+		EXPECT_EQ(CreateTimestampedHash(Bucket_Duration), *iter);
+		EXPECT_EQ(2u, set.size());
+		EXPECT_EQ(1u, set.bucketCount());
+	}
+
+	TEST(TEST_CLASS, EraseRangeBehavesLikeOrderedSet) {
+		// Arrange:
+		auto timestampedHashes = GenerateRandomTimestampedHashes(300, 20 * Bucket_Duration);
+		std::set<state::TimestampedHash> expected(timestampedHashes.cbegin(), timestampedHashes.cend());
+
+		for (auto startTime : std::vector<uint64_t>{ 0, Bucket_Duration / 2, 3 * Bucket_Duration }) {
+			for (auto endTime : std::vector<uint64_t>{ 3 * Bucket_Duration, 7 * Bucket_Duration + Bucket_Duration / 3, 25 * Bucket_Duration }) {
+				auto set = CreateSet(timestampedHashes);
+				auto expectedCopy = expected;
+
+				// Act:
+				auto iter = set.erase(set.lower_bound(CreateTimestampedHash(startTime)), set.lower_bound(CreateTimestampedHash(endTime)));
+				auto expectedIter = expectedCopy.erase(
+						expectedCopy.lower_bound(CreateTimestampedHash(startTime)),
+						expectedCopy.lower_bound(CreateTimestampedHash(endTime)));
+
+				// Assert:
+				AssertEquivalent(expectedCopy, set);
+				if (expectedCopy.cend() == expectedIter)
+					EXPECT_EQ(set.cend(), iter);
+				else
+					EXPECT_EQ(*expectedIter, *iter);
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, ErasePrefixDropsWholeBuckets) {
+		// Arrange: 4 buckets with 2 hashes each
+		std::vector<state::TimestampedHash> timestampedHashes;
+		for (auto i = 0u; i < 4; ++i) {
+			timestampedHashes.push_back(CreateTimestampedHash(i * Bucket_Duration + 10));
+			timestampedHashes.push_back(CreateTimestampedHash(i * Bucket_Duration + 20));
+		}
+
+		auto set = CreateSet(timestampedHashes);
+
+		// Act: erase everything before the second hash of the third bucket
+		set.erase(set.cbegin(), set.lower_bound(CreateTimestampedHash(2 * Bucket_Duration + 15)));
+
+		// Assert:
+		AssertEquivalent({ timestampedHashes.cbegin() + 5, timestampedHashes.cend() }, set);
+		EXPECT_EQ(2u, set.bucketCount());
+	}
+
+	TEST(TEST_CLASS, CanClear) {
+		// Arrange:
+		auto set = CreateSet(GenerateRandomTimestampedHashes(100, 20 * Bucket_Duration));
+
+		// Act:
+		set.clear();
+
+		// Assert:
+		EXPECT_TRUE(set.empty());
+		EXPECT_EQ(0u, set.bucketCount());
+		EXPECT_EQ(set.cend(), set.cbegin());
+	}
+
+	// endregion
+}}
@@ -25,8 +25,10 @@
 namespace catapult { namespace plugins {
 
 	void RegisterSignatureSystem(PluginManager& manager) {
-		manager.addStatelessValidatorHook([generationHash = manager.immutableConfig().GenerationHash](auto& builder) {
-			builder.add(validators::CreateSignatureValidator(generationHash));
+		manager.addStatelessValidatorHook([
+				generationHash = manager.immutableConfig().GenerationHash,
+				pVerifiedSignatureCache = manager.verifiedSignatureCache()](auto& builder) {
+			builder.add(validators::CreateSignatureValidator(generationHash, pVerifiedSignatureCache));
 		});
 	}
 }}
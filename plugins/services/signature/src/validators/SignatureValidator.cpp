@@ -20,13 +20,33 @@
 
 #include "Validators.h"
 #include "catapult/crypto/Signer.h"
+#include "catapult/crypto/VerifiedSignatureCache.h"
 
 namespace catapult { namespace validators {
 
 	using Notification = model::SignatureNotification<1>;
 
-	DECLARE_STATELESS_VALIDATOR(Signature, Notification)(const GenerationHash& generationHash) {
-		return MAKE_STATELESS_VALIDATOR(Signature, [generationHash](const auto& notification) {
+	namespace {
+		bool IsVerified(crypto::VerifiedSignatureCache& verifiedSignatureCache, const RawBuffer& generationHash, const Notification& notification) {
+			std::vector<RawBuffer> buffers;
+			if (Notification::ReplayProtectionMode::Enabled == notification.DataReplayProtectionMode)
+				buffers.push_back(generationHash);
+
+			buffers.push_back(notification.Data);
+			return verifiedSignatureCache.remove({ notification.Signer, buffers, notification.Signature });
+		}
+	}
+
+	DECLARE_STATELESS_VALIDATOR(Signature, Notification)(
+			const GenerationHash& generationHash,
+			const std::shared_ptr<crypto::VerifiedSignatureCache>& pVerifiedSignatureCache) {
+		using ValidatorType = stateless::FunctionalNotificationValidatorT<Notification>;
+		auto name = "SignatureValidator";
+
+		return std::make_unique<ValidatorType>(name, [generationHash, pVerifiedSignatureCache](const auto& notification) {
+			// signatures verified ahead of stateless validation are only looked up
+			if (pVerifiedSignatureCache && IsVerified(*pVerifiedSignatureCache, generationHash, notification))
+				return ValidationResult::Success;
 
 			auto isVerified = Notification::ReplayProtectionMode::Enabled == notification.DataReplayProtectionMode
 					? crypto::Verify(notification.Signer, { generationHash, notification.Data }, notification.Signature)
@@ -22,9 +22,14 @@
 #include "Results.h"
 #include "catapult/validators/ValidatorTypes.h"
 
+namespace catapult { namespace crypto { class VerifiedSignatureCache; } }
+
 namespace catapult { namespace validators {
 
 	/// A validator implementation that applies to all signature notifications and validates that:
 	/// - signatures are valid given \a generationHash
-	DECLARE_STATELESS_VALIDATOR(Signature, model::SignatureNotification<1>)(const GenerationHash& generationHash);
+	/// \note Signatures found in \a pVerifiedSignatureCache (when set) have already been verified and are not verified again.
+	DECLARE_STATELESS_VALIDATOR(Signature, model::SignatureNotification<1>)(
+			const GenerationHash& generationHash,
+			const std::shared_ptr<crypto::VerifiedSignatureCache>& pVerifiedSignatureCache);
 }}
@@ -20,13 +20,14 @@
 
 #include "src/validators/Validators.h"
 #include "catapult/crypto/Signer.h"
+#include "catapult/crypto/VerifiedSignatureCache.h"
 #include "tests/test/core/AddressTestUtils.h"
 #include "tests/test/plugins/ValidatorTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace validators {
 
-	DEFINE_COMMON_VALIDATOR_TESTS(Signature, GenerationHash())
+	DEFINE_COMMON_VALIDATOR_TESTS(Signature, GenerationHash(), nullptr)
 
 #define TEST_CLASS SignatureValidatorTests
 
@@ -38,7 +39,7 @@ namespace catapult { namespace validators {
 				const GenerationHash& generationHash,
 				const model::SignatureNotification<1>& notification) {
 			// Arrange:
-			auto pValidator = CreateSignatureValidator(generationHash);
+			auto pValidator = CreateSignatureValidator(generationHash, nullptr);
 
 			// Act:
 			auto result = test::ValidateNotification(*pValidator, notification);
@@ -128,4 +129,66 @@ namespace catapult { namespace validators {
 		// Assert:
 		AssertValidationResult(ValidationResult::Success, context.GenerationHash, notification);
 	}
+	// region verified signature cache
+
+	namespace {
+		crypto::SignatureInput ToSignatureInput(const TestContext& context, ReplayProtectionMode mode) {
+			return ReplayProtectionMode::Enabled == mode
+					? crypto::SignatureInput{ context.SignerKeyPair.publicKey(), { context.GenerationHash, context.DataBuffer }, context.Signature }
+					: crypto::SignatureInput{ context.SignerKeyPair.publicKey(), { context.DataBuffer }, context.Signature };
+		}
+	}
+
+	ALL_REPLAY_PROTECTION_MODES_TEST(SuccessWhenValidatingValidSignatureNotInVerifiedSignatureCache) {
+		// Arrange:
+		TestContext context(Mode);
+		model::SignatureNotification<1> notification(context.SignerKeyPair.publicKey(), context.Signature, context.DataBuffer, Mode);
+		auto pVerifiedSignatureCache = std::make_shared<crypto::VerifiedSignatureCache>(10);
+		auto pValidator = CreateSignatureValidator(context.GenerationHash, pVerifiedSignatureCache);
+
+		// Act:
+		auto result = test::ValidateNotification(*pValidator, notification);
+
+		// Assert:
+		EXPECT_EQ(ValidationResult::Success, result);
+	}
+
+	ALL_REPLAY_PROTECTION_MODES_TEST(FailureWhenValidatingInvalidSignatureNotInVerifiedSignatureCache) {
+		// Arrange: add the original signature to the cache and then alter the data
+		TestContext context(Mode);
+		model::SignatureNotification<1> notification(context.SignerKeyPair.publicKey(), context.Signature, context.DataBuffer, Mode);
+		auto pVerifiedSignatureCache = std::make_shared<crypto::VerifiedSignatureCache>(10);
+		pVerifiedSignatureCache->add(ToSignatureInput(context, Mode));
+		auto pValidator = CreateSignatureValidator(context.GenerationHash, pVerifiedSignatureCache);
+
+		context.DataBuffer[10] ^= 0xFF;
+
+		// Act:
+		auto result = test::ValidateNotification(*pValidator, notification);
+
+		// Assert:
+		EXPECT_EQ(Failure_Signature_Not_Verifiable, result);
+		EXPECT_EQ(1u, pVerifiedSignatureCache->size());
+	}
+
+	ALL_REPLAY_PROTECTION_MODES_TEST(SuccessWhenSignatureIsInVerifiedSignatureCache) {
+		// Arrange: alter the signature after adding it to the cache to prove that it is not verified again
+		TestContext context(Mode);
+		context.Signature[0] ^= 0xFF;
+		model::SignatureNotification<1> notification(context.SignerKeyPair.publicKey(), context.Signature, context.DataBuffer, Mode);
+		auto pVerifiedSignatureCache = std::make_shared<crypto::VerifiedSignatureCache>(10);
+		pVerifiedSignatureCache->add(ToSignatureInput(context, Mode));
+		auto pValidator = CreateSignatureValidator(context.GenerationHash, pVerifiedSignatureCache);
+
+		// Act:
+		auto result1 = test::ValidateNotification(*pValidator, notification);
+		auto result2 = test::ValidateNotification(*pValidator, notification);
+
+		// Assert: the cache entry is consumed by the first validation
+		EXPECT_EQ(ValidationResult::Success, result1);
+		EXPECT_EQ(Failure_Signature_Not_Verifiable, result2);
+		EXPECT_EQ(0u, pVerifiedSignatureCache->size());
+	}
+
+	// endregion
 }}
@@ -70,4 +70,8 @@ namespace catapult { namespace cache {
 
 		MosaicCacheDeltaMixins::BasicInsertRemove::remove(mosaicId);
 	}
+
+	void BasicMosaicCacheDelta::prefetch(const CachePrefetchKeys& keys) {
+		m_pEntryById->prefetch(keys.MosaicIds);
+	}
 }}
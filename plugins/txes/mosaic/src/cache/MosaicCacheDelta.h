@@ -22,6 +22,7 @@
 #include "MosaicBaseSets.h"
 #include "MosaicCacheSerializers.h"
 #include "catapult/cache/CacheMixinAliases.h"
+#include "catapult/cache/CachePrefetchKeys.h"
 #include "catapult/cache/ReadOnlyArtifactCache.h"
 #include "catapult/cache/ReadOnlyViewSupplier.h"
 #include "catapult/deltaset/BaseSetDelta.h"
@@ -68,6 +69,9 @@ namespace catapult { namespace cache {
 		/// Removes the value identified by \a mosaicId from the cache.
 		void remove(MosaicId mosaicId);
 
+		/// Loads the mosaics identified by mosaic ids in \a keys into the delta.
+		void prefetch(const CachePrefetchKeys& keys);
+
 	private:
 		MosaicCacheTypes::PrimaryTypes::BaseSetDeltaPointerType m_pEntryById;
 		MosaicCacheTypes::HeightGroupingTypes::BaseSetDeltaPointerType m_pMosaicIdsByExpiryHeight;
@@ -220,4 +220,5 @@ namespace catapult { namespace cache {
 
 		return collectedIds;
 	}
+
 }}
@@ -7,6 +7,7 @@
 #pragma once
 #include "BcDriveBaseSets.h"
 #include "catapult/cache/CacheMixinAliases.h"
+#include "catapult/cache/CachePrefetchKeys.h"
 #include "catapult/cache/ReadOnlyArtifactCache.h"
 #include "catapult/cache/ReadOnlyViewSupplier.h"
 #include "catapult/config_holder/BlockchainConfigurationHolder.h"
@@ -66,6 +67,12 @@ namespace catapult { namespace cache {
 		using BcDriveCacheDeltaMixins::ConstAccessor::find;
 		using BcDriveCacheDeltaMixins::MutableAccessor::find;
 
+	public:
+		/// Loads the drives identified by public keys in \a keys into the delta.
+		void prefetch(const CachePrefetchKeys& keys) {
+			m_pBcDriveEntries->prefetch(keys.PublicKeys);
+		}
+
 	private:
 		BcDriveCacheTypes::PrimaryTypes::BaseSetDeltaPointerType m_pBcDriveEntries;
 	};
@@ -54,6 +54,8 @@ namespace catapult { namespace config {
 		TRY_LOAD_CHAIN_PROPERTY(EnableReplicatorBootKeyBinding);
 		config.EnableCacheImprovement = false;
 		TRY_LOAD_CHAIN_PROPERTY(EnableCacheImprovement);
+		config.MaxDrivePaymentsPerBlock = 0;
+		TRY_LOAD_CHAIN_PROPERTY(MaxDrivePaymentsPerBlock);
 
 #undef TRY_LOAD_CHAIN_PROPERTY
 
@@ -70,6 +70,10 @@ namespace catapult { namespace config {
 		/// Enables cache bug fixes.
 		bool EnableCacheImprovement;
 
+		/// Maximum number of drive payments processed per block (\c 0 means unlimited).
+		/// Drives that are due but not processed are paid in the following blocks and are charged for the billing periods they missed.
+		uint32_t MaxDrivePaymentsPerBlock;
+
 	private:
 		StorageConfiguration() = default;
 
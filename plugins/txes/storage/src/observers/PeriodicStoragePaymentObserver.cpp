@@ -42,12 +42,25 @@ namespace catapult { namespace observers {
 			}
 
 			auto paymentIntervalSeconds = pluginConfig.StorageBillingPeriod.seconds();
+			auto paymentInterval = Timestamp(paymentIntervalSeconds * 1000);
+			auto lastDeferral = queueAdapter.lastDeferral();
 
 			// Creating unique eventHash for the observer
 			auto eventHash = getStoragePaymentEventHash(notification.Timestamp, context.Config.Immutable.GenerationHash);
 
+			// The queue is ordered by the last payment time, so it doubles as the due time index:
+			// only the drives at the front whose billing period has elapsed are visited.
 			auto maxIterations = queueAdapter.size();
-			for (int i = 0; i < maxIterations; i++) {
+			if (pluginConfig.MaxDrivePaymentsPerBlock)
+				maxIterations = std::min(maxIterations, pluginConfig.MaxDrivePaymentsPerBlock);
+
+			const auto& currencyMosaicId = context.Config.Immutable.CurrencyMosaicId;
+			const auto& streamingMosaicId = context.Config.Immutable.StreamingMosaicId;
+			const auto& storageMosaicId = context.Config.Immutable.StorageMosaicId;
+			auto& statementBuilder = context.StatementBuilder();
+			auto& accountStateCache = context.Cache.sub<cache::AccountStateCache>();
+
+			for (auto i = 0u; i < maxIterations; i++) {
 				auto driveIter = driveCache.find(queueAdapter.front());
 				auto& driveEntry = driveIter.get();
 
@@ -56,27 +69,42 @@ namespace catapult { namespace observers {
 					break;
 				}
 
-				queueAdapter.popFront();
-
-				const auto& currencyMosaicId = context.Config.Immutable.CurrencyMosaicId;
-				const auto& streamingMosaicId = context.Config.Immutable.StreamingMosaicId;
-				const auto& storageMosaicId = context.Config.Immutable.StorageMosaicId;
-				auto& statementBuilder = context.StatementBuilder();
-
-				auto& accountStateCache = context.Cache.sub<cache::AccountStateCache>();
 				auto driveStateIter = accountStateCache.find(driveEntry.key());
 				auto& driveState = driveStateIter.get();
 
+				// A drive that was already due when the payment limit deferred it is charged for every billing period
+				// it missed, so deferring a drive never makes its storage cheaper. A drive that is late for any other reason
+				// (e.g. no blocks were produced) is charged for a single billing period.
+				uint64_t numBillingPeriods = 1;
+				if (paymentIntervalSeconds && Timestamp() != lastDeferral && driveEntry.getLastPayment() + paymentInterval <= lastDeferral) {
+					auto deferredUntil = std::min(notification.Timestamp, lastDeferral + paymentInterval);
+					numBillingPeriods = (deferredUntil - driveEntry.getLastPayment()).unwrap() / 1000 / paymentIntervalSeconds;
+				}
+
+				const BigUint driveSize = driveEntry.size();
+				std::vector<std::pair<Key, BigUint>> payments;
+				BigUint totalPayment = 0;
 				for (auto& [replicatorKey, info]: driveEntry.confirmedStorageInfos()) {
 					if (info.ConfirmedStorageSince) {
 						info.TimeInConfirmedStorage = info.TimeInConfirmedStorage + notification.Timestamp - *info.ConfirmedStorageSince;
 						info.ConfirmedStorageSince = notification.Timestamp;
 					}
-					BigUint driveSize = driveEntry.size();
 
 					auto timeInConfirmedStorageSeconds = info.TimeInConfirmedStorage.unwrap() / 1000;
+					payments.emplace_back(replicatorKey, (driveSize * timeInConfirmedStorageSeconds * numBillingPeriods) / timeSinceLastPaymentSeconds);
+					totalPayment += payments.back().second;
+
+					info.TimeInConfirmedStorage = Timestamp(0);
+				}
+
+				// A catch-up charge can exceed the drive balance, in which case the balance is split pro rata between the replicators.
+				const BigUint driveBalance = driveState.Balances.get(storageMosaicId).unwrap();
+				for (const auto& [replicatorKey, replicatorPayment] : payments) {
+					auto cappedPayment = numBillingPeriods > 1 && totalPayment > driveBalance
+							? replicatorPayment * driveBalance / totalPayment
+							: replicatorPayment;
+					auto payment = Amount(cappedPayment.template convert_to<uint64_t>());
 
-					auto payment = Amount(((driveSize * timeInConfirmedStorageSeconds) / timeSinceLastPaymentSeconds).template convert_to<uint64_t>());
 					liquidityProvider->debitMosaics(context, driveEntry.key(), replicatorKey,
 													config::GetUnresolvedStorageMosaicId(context.Config.Immutable),
 													payment);
@@ -86,18 +114,17 @@ namespace catapult { namespace observers {
 					const model::StorageReceipt receipt(receiptType, driveEntry.key(), replicatorKey,
 														{ storageMosaicId, currencyMosaicId }, payment);
 					statementBuilder.addTransactionReceipt(receipt);
-
-					info.TimeInConfirmedStorage = Timestamp(0);
 				}
 
 				if (driveState.Balances.get(storageMosaicId).unwrap() >= driveEntry.size() * driveEntry.replicatorCount()) {
 
 					// Drive Continues To Work
 					driveEntry.setLastPayment(notification.Timestamp);
-					queueAdapter.pushBack(driveEntry.entryKey());
+					queueAdapter.moveFrontToBack();
 				}
 				else {
 					// Drive is Closed
+					queueAdapter.popFront();
 
 					// The value will be used after removing drive entry. That's why the copy is needed
 					const auto replicators = driveEntry.replicators();
@@ -251,6 +278,14 @@ namespace catapult { namespace observers {
 					context.Notifications.push_back(std::make_unique<model::DrivesUpdateServiceNotification<1>>(std::move(updatedDrives), std::vector<Key>{ driveEntry.key() }, context.Timestamp));
 				}
 			}
+
+			// Remember when the payment limit left due drives in the queue, so that they are charged for the missed billing periods.
+			if (pluginConfig.MaxDrivePaymentsPerBlock && !queueAdapter.isEmpty()) {
+				auto frontIter = driveCache.find(queueAdapter.front());
+				const auto& frontEntry = frontIter.get();
+				if ((notification.Timestamp - frontEntry.getLastPayment()).unwrap() / 1000 >= paymentIntervalSeconds)
+					queueAdapter.setLastDeferral(notification.Timestamp);
+			}
         }))
 	};
 }}
\ No newline at end of file
@@ -45,11 +45,20 @@ namespace catapult { namespace state {
 		void setSize(uint32_t size) {
 			m_size = size;
 		}
+		const Timestamp& getLastDeferral() const {
+			return m_lastDeferral;
+		}
+		void setLastDeferral(const Timestamp& lastDeferral) {
+			m_lastDeferral = lastDeferral;
+		}
 
 	private:
 		Key m_first;
 		Key m_last;
 		uint32_t m_size;
+
+		// Timestamp of the last block that left due entries in the queue (version 2 only).
+		Timestamp m_lastDeferral;
 	};
 
 	// Drive entry.
@@ -16,18 +16,22 @@ namespace catapult { namespace state {
 		io::Write(output, entry.getFirst());
 		io::Write(output, entry.getLast());
 		io::Write32(output, entry.getSize());
+
+		if (entry.version() > 1)
+			io::Write(output, entry.getLastDeferral());
 	}
 
 	QueueEntry QueueEntrySerializer::Load(io::InputStream& input) {
 
 		// read version
 		VersionType version = io::Read32(input);
-		if (version > 1)
+		if (version > 2)
 			CATAPULT_THROW_RUNTIME_ERROR_1("invalid version of QueueEntry", version);
 
 		Key key;
 		input.read(key);
 		state::QueueEntry entry(key);
+		entry.setVersion(version);
 
 		Key first;
 		input.read(first);
@@ -39,6 +43,12 @@ namespace catapult { namespace state {
 
 		entry.setSize(io::Read32(input));
 
+		if (version > 1) {
+			Timestamp lastDeferral;
+			io::Read(input, lastDeferral);
+			entry.setLastDeferral(lastDeferral);
+		}
+
 		return entry;
 	}
 }}
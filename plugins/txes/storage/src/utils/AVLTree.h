@@ -7,6 +7,9 @@
 #pragma once
 #include "src/state/QueueEntry.h"
 #include "src/state/CommonEntities.h"
+#include "catapult/utils/Hashers.h"
+#include <functional>
+#include <unordered_map>
 #include <utility>
 
 namespace catapult::utils {
@@ -19,6 +22,9 @@ enum class Rotation {
 	RL_ROTATION
 };
 
+/// Order-statistics AVL tree whose nodes are stored in cache entries.
+/// Nodes, keys and the root touched by an operation are kept in memory for the duration of that operation,
+/// so every entry is read at most once and only modified entries are written back when the operation completes.
 template <class TKey>
 class AVLTreeAdapter {
 public:
@@ -36,56 +42,158 @@ public:
 	{}
 
 	void insert(const Key& pValue) {
+		CachedStateGuard guard(*this);
 		setRoot(insert(getRoot(), pValue));
+		flush();
 	}
 
 	void remove(const TKey& key) {
+		CachedStateGuard guard(*this);
 		setRoot(remove(getRoot(), key));
+		flush();
 	}
 
 	Key lowerBound(const TKey& key) {
-		return lowerBound(getRoot(), key);
+		CachedStateGuard guard(*this);
+		auto result = lowerBound(getRoot(), key);
+		flush();
+		return result;
 	};
 
 	uint32_t numberOfLess(const TKey& key) {
-		return numberOfLess(getRoot(), key);
+		CachedStateGuard guard(*this);
+		auto result = numberOfLess(getRoot(), key);
+		flush();
+		return result;
 	}
 
 	Key extractOrderStatistics(uint32_t index) {
+		CachedStateGuard guard(*this);
 		Key extractedPointer;
 		setRoot(extractOrderStatistics(getRoot(), index, extractedPointer));
+		flush();
 		return extractedPointer;
 	}
 
 	Key orderStatistics(uint32_t index) {
-		return orderStatistics(getRoot(), index);
+		CachedStateGuard guard(*this);
+		auto result = orderStatistics(getRoot(), index);
+		flush();
+		return result;
 	}
 
 	uint32_t size() {
-		return getSize(getRoot());
+		CachedStateGuard guard(*this);
+		auto result = getSize(getRoot());
+		flush();
+		return result;
 	}
 
 	bool checkTreeValidity() {
+		CachedStateGuard guard(*this);
 		bool valid = true;
-		int totalHeight = checkTreeValidity(getRoot(), valid);
+		checkTreeValidity(getRoot(), valid);
+		flush();
 		return valid;
 	}
 
 private:
+	/// Drops the cached state of an adapter when an operation completes, even if it throws,
+	/// so that a failed operation never affects subsequent operations.
+	class CachedStateGuard {
+	public:
+		explicit CachedStateGuard(AVLTreeAdapter& adapter) : m_adapter(adapter)
+		{}
+
+		~CachedStateGuard() {
+			m_adapter.reset();
+		}
+
+	private:
+		AVLTreeAdapter& m_adapter;
+	};
 
 	Key getRoot() {
-		if (!m_queueCache.contains(m_queueKey)) {
-			state::QueueEntry entry(m_queueKey);
-			m_queueCache.insert(entry);
+		if (!m_isRootLoaded) {
+			if (!m_queueCache.contains(m_queueKey)) {
+				state::QueueEntry entry(m_queueKey);
+				m_queueCache.insert(entry);
+			}
+
+			m_root = m_queueCache.find(m_queueKey).get().getFirst();
+			m_isRootLoaded = true;
+		}
+
+		return m_root;
+	}
+
+	void setRoot(const Key& root) {
+		getRoot();
+		if (m_root != root) {
+			m_root = root;
+			m_isRootDirty = true;
+		}
+	}
+
+	state::AVLTreeNode loadNode(const Key& nodePointer) const {
+		auto iter = m_nodes.find(nodePointer);
+		if (m_nodes.end() == iter)
+			iter = m_nodes.emplace(nodePointer, CachedNode{ m_nodeExtractor(nodePointer), false }).first;
+
+		return iter->second.Node;
+	}
+
+	void saveNode(const Key& nodePointer, const state::AVLTreeNode& node) {
+		auto iter = m_nodes.find(nodePointer);
+		if (m_nodes.end() == iter) {
+			m_nodes.emplace(nodePointer, CachedNode{ node, true });
+			return;
+		}
+
+		auto& cachedNode = iter->second;
+		if (IsEqual(cachedNode.Node, node))
+			return;
+
+		cachedNode.Node = node;
+		cachedNode.IsDirty = true;
+	}
+
+	TKey extractKey(const Key& nodePointer) {
+		auto iter = m_keys.find(nodePointer);
+		if (m_keys.end() == iter)
+			iter = m_keys.emplace(nodePointer, m_keyExtractor(nodePointer)).first;
+
+		return iter->second;
+	}
+
+	/// Writes all modified nodes and the root back to the caches.
+	void flush() {
+		for (const auto& [nodePointer, cachedNode] : m_nodes) {
+			if (cachedNode.IsDirty)
+				m_nodeSaver(nodePointer, cachedNode.Node);
 		}
-		return m_queueCache.find(m_queueKey).get().getFirst();
+
+		if (m_isRootDirty)
+			m_queueCache.find(m_queueKey).get().setFirst(m_root);
+	}
+
+	/// Drops the cached state.
+	void reset() {
+		m_nodes.clear();
+		m_keys.clear();
+		m_isRootLoaded = false;
+		m_isRootDirty = false;
+	}
+
+	static bool IsEqual(const state::AVLTreeNode& lhs, const state::AVLTreeNode& rhs) {
+		return lhs.Left == rhs.Left && lhs.Right == rhs.Right && lhs.Height == rhs.Height && lhs.Size == rhs.Size;
 	}
 
 	int checkTreeValidity(const Key& nodePointer, bool& valid) {
 		if (isNull(nodePointer))
 			return 0;
 
-		auto node = m_nodeExtractor(nodePointer);
+		auto node = loadNode(nodePointer);
 		auto leftHeight = checkTreeValidity(node.Left, valid);
 		auto rightHeight = checkTreeValidity(node.Right, valid);
 		if (abs(leftHeight - rightHeight) > 1) {
@@ -94,14 +202,6 @@ private:
 		return std::max(leftHeight, rightHeight) + 1;
 	}
 
-	void setRoot(const Key& root) {
-		if (!m_queueCache.contains(m_queueKey)) {
-			state::QueueEntry entry(m_queueKey);
-			m_queueCache.insert(entry);
-		}
-		m_queueCache.find(m_queueKey).get().setFirst(root);
-	}
-
 	bool isNull(const Key& nodeKey) const {
 		return nodeKey == Key();
 	}
@@ -115,10 +215,10 @@ private:
 			return nodePointer;
 		}
 
-		state::AVLTreeNode node = m_nodeExtractor(nodePointer);
+		state::AVLTreeNode node = loadNode(nodePointer);
 
-		auto nodeKey = m_keyExtractor(nodePointer);
-		auto insertedKey = m_keyExtractor(insertedNodePointer);
+		auto nodeKey = extractKey(nodePointer);
+		auto insertedKey = extractKey(insertedNodePointer);
 
 		if (insertedKey < nodeKey) {
 			node.Left = insert(node.Left, insertedNodePointer);
@@ -127,7 +227,7 @@ private:
 			node.Right = insert(node.Right, insertedNodePointer);
 		}
 
-		m_nodeSaver(nodePointer, node);
+		saveNode(nodePointer, node);
 
 		updateStatistics(nodePointer);
 		return maybeRotate(nodePointer);
@@ -138,16 +238,16 @@ private:
 			return nodePointer;
 		}
 
-		auto node = m_nodeExtractor(nodePointer);
+		auto node = loadNode(nodePointer);
 		auto resultPointer = nodePointer;
 
-		auto nodeKey = m_keyExtractor(nodePointer);
+		auto nodeKey = extractKey(nodePointer);
 
 		auto leftSize = getSize(node.Left);
 
 		if (index < leftSize) {
 			node.Left = extractOrderStatistics(node.Left, index, extractedPointer);
-			m_nodeSaver(nodePointer, node);
+			saveNode(nodePointer, node);
 			updateStatistics(nodePointer);
 		}
 		if (index == leftSize) {
@@ -161,17 +261,17 @@ private:
 				auto [leftChild, replacer] = findReplacer(node.Left);
 				auto rightChild = node.Right;
 				resultPointer = replacer;
-				auto newNode = m_nodeExtractor(resultPointer);
+				auto newNode = loadNode(resultPointer);
 				newNode.Left = leftChild;
 				newNode.Right = rightChild;
-				m_nodeSaver(resultPointer, newNode);
+				saveNode(resultPointer, newNode);
 			}
-			m_nodeSaver(nodePointer, state::AVLTreeNode());
+			saveNode(nodePointer, state::AVLTreeNode());
 			extractedPointer = nodePointer;
 		}
 		else {
 			node.Right = extractOrderStatistics(node.Right, index - leftSize - 1, extractedPointer);
-			m_nodeSaver(nodePointer, node);
+			saveNode(nodePointer, node);
 			updateStatistics(nodePointer);
 		}
 
@@ -184,7 +284,7 @@ private:
 			return nodePointer;
 		}
 
-		auto node = m_nodeExtractor(nodePointer);
+		auto node = loadNode(nodePointer);
 
 		auto leftSize = getSize(node.Left);
 
@@ -201,10 +301,10 @@ private:
 		if (isNull(nodePointer))
 			return nodePointer;
 
-		auto node = m_nodeExtractor(nodePointer);
+		auto node = loadNode(nodePointer);
 		auto resultPointer = nodePointer;
 
-		auto nodeKey = m_keyExtractor(nodePointer);
+		auto nodeKey = extractKey(nodePointer);
 		if (nodeKey == removedKey) {
 			if (isNull(node.Left) && isNull(node.Right)) {
 				resultPointer = {};
@@ -216,21 +316,21 @@ private:
 				auto [leftChild, replacer] = findReplacer(node.Left);
 				auto rightChild = node.Right;
 				resultPointer = replacer;
-				auto newNode = m_nodeExtractor(resultPointer);
+				auto newNode = loadNode(resultPointer);
 				newNode.Left = leftChild;
 				newNode.Right = rightChild;
-				m_nodeSaver(resultPointer, newNode);
+				saveNode(resultPointer, newNode);
 			}
-			m_nodeSaver(nodePointer, {});
+			saveNode(nodePointer, {});
 		}
 		else if (removedKey < nodeKey) {
 			node.Left = remove(node.Left, removedKey);
-			m_nodeSaver(nodePointer, node);
+			saveNode(nodePointer, node);
 			updateStatistics(nodePointer);
 		}
 		else {
 			node.Right = remove(node.Right, removedKey);
-			m_nodeSaver(nodePointer, node);
+			saveNode(nodePointer, node);
 			updateStatistics(nodePointer);
 		}
 
@@ -242,7 +342,7 @@ private:
 	// Second element of the pair is the element that replaces the removed one
 	std::pair<Key, Key> findReplacer(const Key& nodePointer) {
 		// nodeKey is always not null
-		auto node = m_nodeExtractor(nodePointer);
+		auto node = loadNode(nodePointer);
 
 		if (isNull(node.Right)) {
 			Key replacer = nodePointer;
@@ -253,7 +353,7 @@ private:
 		else {
 			auto replacer = findReplacer(node.Right);
 			node.Right = replacer.first;
-			m_nodeSaver(nodePointer, node);
+			saveNode(nodePointer, node);
 			updateStatistics(nodePointer);
 			return {maybeRotate(nodePointer), replacer.second};
 		}
@@ -263,8 +363,8 @@ private:
 		if (isNull(nodePointer))
 			return nodePointer;
 
-		auto node = m_nodeExtractor(nodePointer);
-		auto nodeKey = m_keyExtractor(nodePointer);
+		auto node = loadNode(nodePointer);
+		auto nodeKey = extractKey(nodePointer);
 
 		if (nodeKey < key) {
 			return lowerBound(node.Right, key);
@@ -285,8 +385,8 @@ private:
 			return 0;
 		}
 
-		auto node = m_nodeExtractor(nodePointer);
-		auto nodeKey = m_keyExtractor(nodePointer);
+		auto node = loadNode(nodePointer);
+		auto nodeKey = extractKey(nodePointer);
 
 		if (nodeKey < key) {
 			return numberOfLess(node.Right, key) + getSize(node.Left) + 1;
@@ -299,14 +399,14 @@ private:
 		if (isNull(nodePointer))
 			return 0;
 
-		return m_nodeExtractor(nodePointer).Height;
+		return loadNode(nodePointer).Height;
 	}
 
 	uint32_t getSize(const Key& nodePointer) const {
 		if (isNull(nodePointer))
 			return 0;
 
-		return m_nodeExtractor(nodePointer).Size;
+		return loadNode(nodePointer).Size;
 	}
 
 	std::pair<uint16_t, uint32_t> getStatistics(const Key& nodePointer) {
@@ -314,7 +414,7 @@ private:
 			return {0, 0};
 		}
 
-		auto node = m_nodeExtractor(nodePointer);
+		auto node = loadNode(nodePointer);
 		return {node.Height, node.Size};
 	}
 
@@ -322,21 +422,21 @@ private:
 		if (isNull(nodePointer))
 			return;
 
-		auto node = m_nodeExtractor(nodePointer);
+		auto node = loadNode(nodePointer);
 
 		auto [leftHeight, leftSize] = getStatistics(node.Left);
 		auto [rightHeight, rightSize] = getStatistics(node.Right);
 
 		node.Height = std::max(leftHeight, rightHeight) + 1;
 		node.Size = leftSize + rightSize + 1;
-		m_nodeSaver(nodePointer, node);
+		saveNode(nodePointer, node);
 	}
 
 	Rotation getRotationType(const Key& nodePointer) {
 		if (isNull(nodePointer))
 			return Rotation::NO_ROTATION;
 
-		auto node = m_nodeExtractor(nodePointer);
+		auto node = loadNode(nodePointer);
 
 		auto leftHeight = getHeight(node.Left);
 		auto rightHeight = getHeight(node.Right);
@@ -347,7 +447,7 @@ private:
 
 		if (leftHeight > rightHeight) {
 			// Left rotation is needed
-			const auto& left = m_nodeExtractor(node.Left);
+			const auto& left = loadNode(node.Left);
 			if (getHeight(left.Left) >= getHeight(left.Right)) {
 				return Rotation::LL_ROTATION;
 			}
@@ -357,7 +457,7 @@ private:
 		}
 		else {
 			// Right rotation is needed
-			const auto& right = m_nodeExtractor(node.Right);
+			const auto& right = loadNode(node.Right);
 			if (getHeight(right.Right) >= getHeight(right.Left)) {
 				return Rotation::RR_ROTATION;
 			}
@@ -391,79 +491,79 @@ private:
 	}
 
 	Key llRotation(const Key& nodePointer) {
-		auto node = m_nodeExtractor(nodePointer);
+		auto node = loadNode(nodePointer);
 
 		Key parentPointer = node.Left;
-		auto parent = m_nodeExtractor(parentPointer);
+		auto parent = loadNode(parentPointer);
 
 		node.Left = parent.Right;
-		m_nodeSaver(nodePointer, node);
+		saveNode(nodePointer, node);
 		updateStatistics(nodePointer);
 
 		parent.Right = nodePointer;
-		m_nodeSaver(parentPointer, parent);
+		saveNode(parentPointer, parent);
 		updateStatistics(parentPointer);
 
 		return parentPointer;
 	}
 
 	Key lrRotation(const Key& nodePointer) {
-		auto node = m_nodeExtractor(nodePointer);
-		auto left = m_nodeExtractor(node.Left);
+		auto node = loadNode(nodePointer);
+		auto left = loadNode(node.Left);
 		Key parentPointer = left.Right;
-		auto parent = m_nodeExtractor(parentPointer);
+		auto parent = loadNode(parentPointer);
 
 		left.Right = parent.Left;
-		m_nodeSaver(node.Left, left);
+		saveNode(node.Left, left);
 		updateStatistics(node.Left);
 
 		parent.Left = node.Left;
 
 		node.Left = parent.Right;
-		m_nodeSaver(nodePointer, node);
+		saveNode(nodePointer, node);
 		updateStatistics(nodePointer);
 
 		parent.Right = nodePointer;
-		m_nodeSaver(parentPointer, parent);
+		saveNode(parentPointer, parent);
 		updateStatistics(parentPointer);
 
 		return parentPointer;
 	}
 
 	Key rlRotation(const Key& nodePointer) {
-		auto node = m_nodeExtractor(nodePointer);
-		auto right = m_nodeExtractor(node.Right);
+		auto node = loadNode(nodePointer);
+		auto right = loadNode(node.Right);
 		Key parentPointer = right.Left;
-		auto parent = m_nodeExtractor(parentPointer);
+		auto parent = loadNode(parentPointer);
 
 		right.Left = parent.Right;
-		m_nodeSaver(node.Right, right);
+		saveNode(node.Right, right);
 		updateStatistics(node.Right);
 
 		parent.Right = node.Right;
 
 		node.Right = parent.Left;
-		m_nodeSaver(nodePointer, node);
+		saveNode(nodePointer, node);
 		updateStatistics(nodePointer);
 
 		parent.Left = nodePointer;
-		m_nodeSaver(parentPointer, parent);
+		saveNode(parentPointer, parent);
 		updateStatistics(parentPointer);
 
 		return parentPointer;
 	}
 
 	Key rrRotation(const Key& nodePointer) {
-		auto node = m_nodeExtractor(nodePointer);
+		auto node = loadNode(nodePointer);
 		Key parentPointer = node.Right;
-		auto parent = m_nodeExtractor(parentPointer);
+		auto parent = loadNode(parentPointer);
 
 		node.Right = parent.Left;
-		m_nodeSaver(nodePointer, node);
+		saveNode(nodePointer, node);
 		updateStatistics(nodePointer);
 
 		parent.Left = nodePointer;
-		m_nodeSaver(parentPointer, parent);
+		saveNode(parentPointer, parent);
 		updateStatistics(parentPointer);
 
 		return parentPointer;
@@ -475,5 +575,17 @@ private:
 	std::function<TKey (const Key&)> m_keyExtractor;
 	std::function<state::AVLTreeNode (const Key&)> m_nodeExtractor;
 	std::function<void (const Key&, const state::AVLTreeNode&)> m_nodeSaver;
+
+	// nodes, keys and root read or modified during the current operation
+	struct CachedNode {
+		state::AVLTreeNode Node;
+		bool IsDirty;
+	};
+
+	mutable std::unordered_map<Key, CachedNode, utils::ArrayHasher<Key>> m_nodes;
+	std::unordered_map<Key, TKey, utils::ArrayHasher<Key>> m_keys;
+	Key m_root;
+	bool m_isRootLoaded = false;
+	bool m_isRootDirty = false;
 };
 }
\ No newline at end of file
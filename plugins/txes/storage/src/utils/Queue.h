@@ -44,6 +44,20 @@ public:
 		return queueEntry.getSize();
 	}
 
+	// Returns the timestamp of the last block that left due entries in the queue (zero if there is none)
+	Timestamp lastDeferral() const {
+		auto queueIter = m_queueCache.find(m_queueKey);
+		const auto& queueEntry = queueIter.get();
+		return queueEntry.getLastDeferral();
+	}
+
+	void setLastDeferral(const Timestamp& lastDeferral) {
+		auto queueIter = m_queueCache.find(m_queueKey);
+		auto& queueEntry = queueIter.get();
+		queueEntry.setVersion(2);
+		queueEntry.setLastDeferral(lastDeferral);
+	}
+
 	void popFront() {
 		auto queueIter = m_queueCache.find(m_queueKey);
 		auto& queueEntry = queueIter.get();
@@ -67,6 +81,29 @@ public:
 		queueEntry.setSize(queueEntry.getSize() - 1);
 	}
 
+	// Equivalent to popFront() followed by pushBack() of the same key, but relinks only the affected entries
+	void moveFrontToBack() {
+		auto queueIter = m_queueCache.find(m_queueKey);
+		auto& queueEntry = queueIter.get();
+
+		const auto frontKey = queueEntry.getFirst();
+		const auto lastKey = queueEntry.getLast();
+		if (frontKey == lastKey)
+			return;
+
+		auto iter = m_cache.find(frontKey.array());
+		auto& entry = iter.get();
+		const auto nextKey = entry.getQueueNext();
+
+		m_cache.find(nextKey.array()).get().setQueuePrevious(Key());
+		m_cache.find(lastKey.array()).get().setQueueNext(frontKey);
+
+		entry.setQueuePrevious(lastKey);
+		entry.setQueueNext(Key());
+		queueEntry.setFirst(nextKey);
+		queueEntry.setLast(frontKey);
+	}
+
 	void pushBack(const Key& key) {
 		auto queueIter = m_queueCache.find(m_queueKey);
 		auto& queueEntry = queueIter.get();
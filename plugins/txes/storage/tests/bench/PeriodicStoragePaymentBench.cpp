@@ -0,0 +1,160 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "src/cache/BcDriveCache.h"
+#include "src/cache/QueueCache.h"
+#include "src/config/StorageConfiguration.h"
+#include "src/utils/Queue.h"
+#include "tests/bench/nodeps/Random.h"
+#include "tests/test/core/mocks/MockBlockchainConfigurationHolder.h"
+#include "tests/test/other/MutableBlockchainConfiguration.h"
+#include <benchmark/benchmark.h>
+#include <chrono>
+
+namespace catapult { namespace observers {
+
+	namespace {
+		constexpr size_t Num_Drives = 100'000;
+		constexpr uint64_t Billing_Period_Milliseconds = 4 * 7 * 24 * 60 * 60 * 1000ull;
+		constexpr uint64_t Block_Time_Milliseconds = 15'000;
+
+		// region PaymentQueueContext
+
+		enum class DueDistribution { Spread, Clustered };
+
+		enum class RotationMode { Pop_Push, Move_Front_To_Back };
+
+		// models the drive payment queue of PeriodicStoragePaymentObserver
+		class PaymentQueueContext {
+		public:
+			explicit PaymentQueueContext(DueDistribution distribution)
+					: m_pConfigHolder(config::CreateMockConfigurationHolder(CreateConfig()))
+					, m_driveCache(cache::CacheConfiguration(), m_pConfigHolder)
+					, m_queueCache(cache::CacheConfiguration(), m_pConfigHolder)
+					, m_driveDelta(m_driveCache.createDelta(Height(1)))
+					, m_queueDelta(m_queueCache.createDelta(Height(1)))
+					, m_queueAdapter(*m_queueDelta, state::DrivePaymentQueueKey, *m_driveDelta)
+					, m_timestamp(Billing_Period_Milliseconds) {
+				// spread drives are created one per block, clustered drives are all created in the same block
+				for (auto i = 0u; i < Num_Drives; ++i) {
+					Key driveKey;
+					bench::FillWithRandomData(driveKey);
+
+					state::BcDriveEntry driveEntry(driveKey);
+					auto lastPayment = DueDistribution::Spread == distribution
+							? Billing_Period_Milliseconds * i / Num_Drives
+							: 0;
+					driveEntry.setLastPayment(Timestamp(lastPayment));
+					m_driveDelta->insert(driveEntry);
+					m_queueAdapter.pushBack(driveKey);
+				}
+			}
+
+		public:
+			/// Pays for at most \a maxPayments (\c 0 means unlimited) due drives using \a mode and advances to the next block.
+			size_t processBlock(uint32_t maxPayments, RotationMode mode) {
+				auto maxIterations = m_queueAdapter.size();
+				if (maxPayments)
+					maxIterations = std::min(maxIterations, maxPayments);
+
+				size_t numPayments = 0;
+				for (auto i = 0u; i < maxIterations; ++i) {
+					auto driveIter = m_driveDelta->find(m_queueAdapter.front());
+					auto& driveEntry = driveIter.get();
+					if ((m_timestamp - driveEntry.getLastPayment()).unwrap() < Billing_Period_Milliseconds)
+						break;
+
+					driveEntry.setLastPayment(m_timestamp);
+					if (RotationMode::Pop_Push == mode) {
+						m_queueAdapter.popFront();
+						m_queueAdapter.pushBack(driveEntry.entryKey());
+					} else {
+						m_queueAdapter.moveFrontToBack();
+					}
+
+					++numPayments;
+				}
+
+				m_timestamp = m_timestamp + Timestamp(Block_Time_Milliseconds);
+				return numPayments;
+			}
+
+		private:
+			static config::BlockchainConfiguration CreateConfig() {
+				test::MutableBlockchainConfiguration config;
+				auto storageConfig = config::StorageConfiguration::Uninitialized();
+				storageConfig.Enabled = true;
+				config.Network.SetPluginConfiguration(storageConfig);
+				return config.ToConst();
+			}
+
+		private:
+			std::shared_ptr<config::BlockchainConfigurationHolder> m_pConfigHolder;
+			cache::BcDriveCache m_driveCache;
+			cache::QueueCache m_queueCache;
+			cache::LockedCacheDelta<cache::BcDriveCacheDelta> m_driveDelta;
+			cache::LockedCacheDelta<cache::QueueCacheDelta> m_queueDelta;
+			utils::QueueAdapter<cache::BcDriveCache> m_queueAdapter;
+			Timestamp m_timestamp;
+		};
+
+		// endregion
+
+		// region benchmarks
+
+		void BenchmarkPaymentBlocks(benchmark::State& state, RotationMode mode) {
+			auto distribution = static_cast<DueDistribution>(state.range(0));
+			auto maxPayments = static_cast<uint32_t>(state.range(1));
+			PaymentQueueContext context(distribution);
+
+			// the mean block time hides payment spikes, so the slowest block is reported separately
+			size_t numPayments = 0;
+			size_t numBlocks = 0;
+			size_t maxBlockPayments = 0;
+			std::chrono::duration<double, std::micro> maxBlockTime(0);
+			for (auto _ : state) {
+				auto start = std::chrono::steady_clock::now();
+				auto numBlockPayments = context.processBlock(maxPayments, mode);
+				maxBlockTime = std::max<decltype(maxBlockTime)>(maxBlockTime, std::chrono::steady_clock::now() - start);
+
+				numPayments += numBlockPayments;
+				maxBlockPayments = std::max(maxBlockPayments, numBlockPayments);
+				++numBlocks;
+			}
+
+			state.counters["payments/block"] = static_cast<double>(numPayments) / static_cast<double>(numBlocks);
+			state.counters["max payments/block"] = static_cast<double>(maxBlockPayments);
+			state.counters["max block us"] = maxBlockTime.count();
+			state.SetItemsProcessed(static_cast<int64_t>(numPayments));
+		}
+
+		void BenchmarkPopPush(benchmark::State& state) {
+			BenchmarkPaymentBlocks(state, RotationMode::Pop_Push);
+		}
+
+		void BenchmarkMoveFrontToBack(benchmark::State& state) {
+			BenchmarkPaymentBlocks(state, RotationMode::Move_Front_To_Back);
+		}
+
+		void AddPaymentArguments(benchmark::internal::Benchmark& benchmark) {
+			benchmark.ArgNames({ "distribution", "maxPayments" });
+			for (auto distribution : { DueDistribution::Spread, DueDistribution::Clustered }) {
+				for (auto maxPayments : { 0, 100, 1000 })
+					benchmark.Args({ static_cast<int64_t>(distribution), maxPayments });
+			}
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	catapult::observers::AddPaymentArguments(
+			*benchmark::RegisterBenchmark("BenchmarkPopPush", catapult::observers::BenchmarkPopPush));
+	catapult::observers::AddPaymentArguments(
+			*benchmark::RegisterBenchmark("BenchmarkMoveFrontToBack", catapult::observers::BenchmarkMoveFrontToBack));
+}
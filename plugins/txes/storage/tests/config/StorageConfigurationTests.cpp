@@ -33,6 +33,7 @@ namespace catapult { namespace config {
 							{ "shardSize", "20" },
 							{ "verificationExpirationCoefficient", "0.24" },
 							{ "verificationExpirationConstant", "10" },
+							{ "maxDrivePaymentsPerBlock", "500" },
 						}
 					}
 				};
@@ -57,7 +58,8 @@ namespace catapult { namespace config {
 					"verificationInterval",
 					"shardSize",
 					"verificationExpirationCoefficient",
-					"verificationExpirationConstant"}.count(name);
+					"verificationExpirationConstant",
+					"maxDrivePaymentsPerBlock"}.count(name);
 			}
 
 			static bool IsSectionOptional(const std::string&) {
@@ -79,6 +81,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(utils::TimeSpan::FromHours(0), config.DownloadBillingPeriod);
 				EXPECT_EQ(utils::TimeSpan::FromHours(0), config.VerificationInterval);
 				EXPECT_EQ(0, config.ShardSize);
+				EXPECT_EQ(0u, config.MaxDrivePaymentsPerBlock);
 			}
 
 			static void AssertCustom(const StorageConfiguration& config) {
@@ -96,6 +99,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(utils::TimeSpan::FromHours(24), config.DownloadBillingPeriod);
 				EXPECT_EQ(utils::TimeSpan::FromHours(4), config.VerificationInterval);
 				EXPECT_EQ(20, config.ShardSize);
+				EXPECT_EQ(500u, config.MaxDrivePaymentsPerBlock);
 			}
 		};
 	}
@@ -203,5 +203,152 @@ namespace catapult { namespace observers {
 		ASSERT_EQ(treeAdapter.size(), 1);
 		ASSERT_TRUE(treeAdapter.checkTreeValidity());
 	}
+
+	namespace {
+		struct AccessCounters {
+			std::map<Key, uint32_t> NumKeyExtractions;
+			std::map<Key, uint32_t> NumNodeExtractions;
+			std::map<Key, uint32_t> NumNodeSaves;
+		};
+
+		template<typename TAction>
+		void AssertEachEntryIsAccessedAtMostOnce(TAction action) {
+			// Arrange:
+			ObserverTestContext context(NotifyMode::Commit, Current_Height, CreateConfig());
+			auto& queueCache = context.cache().sub<cache::QueueCache>();
+
+			std::map<Key, CacheValue> cache;
+			AccessCounters counters;
+
+			auto treeAdapter = utils::AVLTreeAdapter<Hash256>(
+					queueCache,
+					state::DriveVerificationsTree,
+					[&cache, &counters](const Key& key) { ++counters.NumKeyExtractions[key]; return cache[key].key; },
+					[&cache, &counters](const Key& key) -> state::AVLTreeNode { ++counters.NumNodeExtractions[key]; return cache[key].node; },
+					[&cache, &counters](const Key& key, const state::AVLTreeNode& node) { ++counters.NumNodeSaves[key]; cache[key].node = node; });
+
+			std::vector<Key> keys;
+			for (int i = 0; i < 1000; i++) {
+				auto key = test::GenerateRandomByteArray<Key>();
+				cache[key].key = test::GenerateRandomByteArray<Hash256>();
+				treeAdapter.insert(key);
+				keys.push_back(key);
+			}
+
+			counters = AccessCounters();
+
+			// Act:
+			action(treeAdapter, cache, keys);
+
+			// Assert:
+			EXPECT_FALSE(counters.NumNodeExtractions.empty());
+			for (const auto* pCounts : { &counters.NumKeyExtractions, &counters.NumNodeExtractions, &counters.NumNodeSaves }) {
+				for (const auto& [key, count] : *pCounts)
+					EXPECT_EQ(1u, count) << key;
+			}
+
+			EXPECT_TRUE(treeAdapter.checkTreeValidity());
+		}
+	} // namespace
+
+	TEST(TEST_CLASS, AVLTreeInsertAccessesEachEntryAtMostOnce) {
+		AssertEachEntryIsAccessedAtMostOnce([](auto& treeAdapter, auto& cache, const auto&) {
+			auto key = test::GenerateRandomByteArray<Key>();
+			cache[key].key = test::GenerateRandomByteArray<Hash256>();
+			treeAdapter.insert(key);
+		});
+	}
+
+	TEST(TEST_CLASS, AVLTreeRemoveAccessesEachEntryAtMostOnce) {
+		AssertEachEntryIsAccessedAtMostOnce([](auto& treeAdapter, auto& cache, const auto& keys) {
+			treeAdapter.remove(cache[keys[keys.size() / 2]].key);
+		});
+	}
+
+	TEST(TEST_CLASS, AVLTreeExtractAccessesEachEntryAtMostOnce) {
+		AssertEachEntryIsAccessedAtMostOnce([](auto& treeAdapter, auto&, const auto& keys) {
+			treeAdapter.extractOrderStatistics(static_cast<uint32_t>(keys.size() / 3));
+		});
+	}
+
+	TEST(TEST_CLASS, AVLTreeQueriesDoNotSaveNodes) {
+		// Arrange:
+		ObserverTestContext context(NotifyMode::Commit, Current_Height, CreateConfig());
+		auto& queueCache = context.cache().sub<cache::QueueCache>();
+
+		std::map<Key, CacheValue> cache;
+		uint32_t numNodeSaves = 0;
+
+		auto treeAdapter = utils::AVLTreeAdapter<Hash256>(
+				queueCache,
+				state::DriveVerificationsTree,
+				[&cache](const Key& key) { return cache[key].key; },
+				[&cache](const Key& key) -> state::AVLTreeNode { return cache[key].node; },
+				[&cache, &numNodeSaves](const Key& key, const state::AVLTreeNode& node) { ++numNodeSaves; cache[key].node = node; });
+
+		for (int i = 0; i < 1000; i++) {
+			auto key = test::GenerateRandomByteArray<Key>();
+			cache[key].key = test::GenerateRandomByteArray<Hash256>();
+			treeAdapter.insert(key);
+		}
+
+		numNodeSaves = 0;
+
+		// Act:
+		auto size = treeAdapter.size();
+		auto numLess = treeAdapter.numberOfLess(test::GenerateRandomByteArray<Hash256>());
+		auto median = treeAdapter.orderStatistics(size / 2);
+		treeAdapter.lowerBound(cache[median].key);
+
+		// Assert:
+		EXPECT_EQ(1000u, size);
+		EXPECT_GE(size, numLess);
+		EXPECT_EQ(0u, numNodeSaves);
+	}
+
+	TEST(TEST_CLASS, AVLTreeFailedOperationDoesNotAffectSubsequentOperations) {
+		// Arrange:
+		ObserverTestContext context(NotifyMode::Commit, Current_Height, CreateConfig());
+		auto& queueCache = context.cache().sub<cache::QueueCache>();
+
+		std::map<Key, CacheValue> cache;
+		auto failingKey = test::GenerateRandomByteArray<Key>();
+		uint32_t numNodeExtractions = 0;
+		uint32_t numNodeSaves = 0;
+
+		auto treeAdapter = utils::AVLTreeAdapter<Hash256>(
+				queueCache,
+				state::DriveVerificationsTree,
+				[&cache, &failingKey](const Key& key) {
+					if (failingKey == key)
+						CATAPULT_THROW_RUNTIME_ERROR("key extraction failed");
+
+					return cache[key].key;
+				},
+				[&cache, &numNodeExtractions](const Key& key) -> state::AVLTreeNode { ++numNodeExtractions; return cache[key].node; },
+				[&cache, &numNodeSaves](const Key& key, const state::AVLTreeNode& node) { ++numNodeSaves; cache[key].node = node; });
+
+		for (int i = 0; i < 100; i++) {
+			auto key = test::GenerateRandomByteArray<Key>();
+			cache[key].key = test::GenerateRandomByteArray<Hash256>();
+			treeAdapter.insert(key);
+		}
+
+		numNodeSaves = 0;
+		EXPECT_THROW(treeAdapter.insert(failingKey), catapult_runtime_error);
+
+		// Sanity: nothing was written by the failed operation
+		EXPECT_EQ(0u, numNodeSaves);
+
+		numNodeExtractions = 0;
+
+		// Act:
+		auto size = treeAdapter.size();
+
+		// Assert: nodes cached by the failed operation were dropped, so the root node was loaded again
+		EXPECT_EQ(100u, size);
+		EXPECT_EQ(1u, numNodeExtractions);
+		EXPECT_TRUE(treeAdapter.checkTreeValidity());
+	}
 }
 }
\ No newline at end of file
@@ -40,7 +40,7 @@ namespace catapult { namespace observers {
 		constexpr Amount Expected_Owner_Balance = Drive_Balance - Amount(Num_Replicators * Expected_Replicator_Balance.unwrap());
 
 
-		auto CreateConfig() {
+		auto CreateConfig(uint32_t maxDrivePaymentsPerBlock = 0) {
 			test::MutableBlockchainConfiguration config;
 			config.Immutable.CurrencyMosaicId = Currency_Mosaic_Id;
 			config.Immutable.StorageMosaicId = Storage_Mosaic_Id;
@@ -50,6 +50,7 @@ namespace catapult { namespace observers {
 			storageConfig.StorageBillingPeriod = utils::TimeSpan::FromMilliseconds(billingPeriodMilliseconds);
 			storageConfig.Enabled = true;
 			storageConfig.EnableCacheImprovement = true;
+			storageConfig.MaxDrivePaymentsPerBlock = maxDrivePaymentsPerBlock;
 
 			config.Network.SetPluginConfiguration(storageConfig);
 
@@ -103,11 +104,12 @@ namespace catapult { namespace observers {
 			std::vector<state::ReplicatorEntry> InitialReplicatorEntries;
 			std::vector<state::ReplicatorEntry> ExpectedReplicatorEntries;
 			Timestamp NotificationTime;
+			Timestamp ExpectedLastDeferral;
 		};
 
-        void RunTest(NotifyMode mode, const CacheValues& values, const Height& currentHeight) {
+        void RunTest(NotifyMode mode, const CacheValues& values, const Height& currentHeight, uint32_t maxDrivePaymentsPerBlock = 0) {
             // Arrange:
-            ObserverTestContext context(mode, Current_Height, CreateConfig());
+            ObserverTestContext context(mode, Current_Height, CreateConfig(maxDrivePaymentsPerBlock));
             Notification notification({ { 1 } }, { { 1 } }, values.NotificationTime, Difficulty(0), 0, 0);
 			auto pStorageState = std::make_shared<mocks::MockStorageState>();
             auto pObserver = CreatePeriodicStoragePaymentObserver(Liquidity_Provider, {}, pStorageState);
@@ -145,6 +147,7 @@ namespace catapult { namespace observers {
             auto& queueCacheEntry = queueCache.find(state::DrivePaymentQueueKey).get();
             auto driveKey = queueCacheEntry.getFirst();
 			auto previousKey = Key();
+			EXPECT_EQ(values.ExpectedLastDeferral, queueCacheEntry.getLastDeferral());
 
 			if (values.ExpectedBcDriveKeys.empty()) {
 				EXPECT_EQ(queueCacheEntry.getFirst(), Key());
@@ -301,6 +304,193 @@ namespace catapult { namespace observers {
     	RunTest(NotifyMode::Commit, values, Current_Height);
     }
 
+    namespace {
+		CacheValues CreateDueDrivesValues(const std::vector<Key>& expectedKeys) {
+			Timestamp lastPaymentTimestamp(10000);
+			auto notificationTimestamp = Timestamp(lastPaymentTimestamp.unwrap() + billingPeriodMilliseconds);
+
+			std::vector<Key> keys = { { { 1 } }, { { 2 } }, { { 3 } } };
+			std::vector<state::BcDriveEntry> initialEntries;
+			for (auto i = 0u; i < keys.size(); ++i) {
+				state::BcDriveEntry entry(keys[i]);
+				entry.setSize(0);
+				entry.setLastPayment(lastPaymentTimestamp);
+				if (i > 0)
+					entry.setQueuePrevious(keys[i - 1]);
+
+				if (i < keys.size() - 1)
+					entry.setQueueNext(keys[i + 1]);
+
+				initialEntries.push_back(entry);
+			}
+
+			return CacheValues(initialEntries, expectedKeys, {}, {}, notificationTimestamp);
+		}
+	}
+
+    TEST(TEST_CLASS, PeriodicStoragePayment_AllDueDrivesArePaidWhenPaymentsAreNotLimited) {
+		// Arrange: all drives are due
+		auto values = CreateDueDrivesValues({ { { 1 } }, { { 2 } }, { { 3 } } });
+
+		// Assert: all drives are moved to the back of the queue
+		RunTest(NotifyMode::Commit, values, Current_Height, 0);
+    }
+
+    TEST(TEST_CLASS, PeriodicStoragePayment_DueDrivesArePaidUpToLimit) {
+		// Arrange: all drives are due
+		auto values = CreateDueDrivesValues({ { { 3 } }, { { 1 } }, { { 2 } } });
+
+		values.ExpectedLastDeferral = values.NotificationTime;
+
+		// Assert: only the first two drives are paid and moved to the back of the queue, the deferral of the third one is recorded
+		RunTest(NotifyMode::Commit, values, Current_Height, 2);
+    }
+
+    TEST(TEST_CLASS, PeriodicStoragePayment_DeferralIsNotRecordedWhenRemainingDrivesAreNotDue) {
+		// Arrange: only the first two drives are due
+		auto values = CreateDueDrivesValues({ { { 3 } }, { { 1 } }, { { 2 } } });
+		values.InitialBcDriveEntries[2].setLastPayment(values.NotificationTime);
+
+		// Assert: the first two drives are paid and no deferral is recorded
+		RunTest(NotifyMode::Commit, values, Current_Height, 2);
+    }
+
+    namespace {
+		Amount RunDeferredDrivePaymentTest(uint32_t numElapsedBillingPeriods, uint32_t numDeferredBillingPeriods) {
+			// Arrange: the replicator stored the drive for the whole time since the last payment
+			ObserverTestContext context(NotifyMode::Commit, Current_Height, CreateConfig(1));
+			Timestamp lastPaymentTimestamp(10000);
+			auto notificationTimestamp = Timestamp(lastPaymentTimestamp.unwrap() + numElapsedBillingPeriods * billingPeriodMilliseconds + 1000);
+			Notification notification({ { 1 } }, { { 1 } }, notificationTimestamp, Difficulty(0), 0, 0);
+			auto pObserver = CreatePeriodicStoragePaymentObserver(Liquidity_Provider, {}, std::make_shared<mocks::MockStorageState>());
+			auto& bcDriveCache = context.cache().sub<cache::BcDriveCache>();
+			auto& accountStateCache = context.cache().sub<cache::AccountStateCache>();
+			auto& queueCache = context.cache().sub<cache::QueueCache>();
+
+			auto driveKey = test::GenerateRandomByteArray<Key>();
+			auto replicatorKey = test::GenerateRandomByteArray<Key>();
+			state::BcDriveEntry driveEntry(driveKey);
+			driveEntry.setSize(Drive_Size);
+			driveEntry.setReplicatorCount(1);
+			driveEntry.replicators() = { replicatorKey };
+			driveEntry.setLastPayment(lastPaymentTimestamp);
+			driveEntry.confirmedStorageInfos()[replicatorKey].ConfirmedStorageSince = lastPaymentTimestamp;
+			bcDriveCache.insert(driveEntry);
+
+			auto driveBalance = Amount(10 * Drive_Size);
+			test::AddAccountState(accountStateCache, driveKey, Current_Height, { { Storage_Mosaic_Id, driveBalance } });
+			test::AddAccountState(accountStateCache, replicatorKey, Current_Height);
+
+			// - the payment limit last left the drive in the queue numDeferredBillingPeriods after its last payment
+			state::QueueEntry queueEntry(state::DrivePaymentQueueKey);
+			queueEntry.setFirst(driveKey);
+			queueEntry.setLast(driveKey);
+			queueEntry.setSize(1);
+			if (numDeferredBillingPeriods) {
+				queueEntry.setVersion(2);
+				queueEntry.setLastDeferral(Timestamp(lastPaymentTimestamp.unwrap() + numDeferredBillingPeriods * billingPeriodMilliseconds));
+			}
+
+			queueCache.insert(queueEntry);
+
+			// Act:
+			test::ObserveNotification(*pObserver, notification, context);
+
+			// Assert: the drive continues to work and is paid up to the notification time
+			EXPECT_TRUE(bcDriveCache.contains(driveKey));
+			EXPECT_EQ(notificationTimestamp, bcDriveCache.find(driveKey).get().getLastPayment());
+
+			auto replicatorBalance = accountStateCache.find(replicatorKey).get().Balances.get(Currency_Mosaic_Id);
+			EXPECT_EQ(driveBalance - replicatorBalance, accountStateCache.find(driveKey).get().Balances.get(Storage_Mosaic_Id));
+			return replicatorBalance;
+		}
+	}
+
+    TEST(TEST_CLASS, PeriodicStoragePayment_DriveIsChargedForSingleBillingPeriodWhenPaidOnTime) {
+		// Act:
+		auto payment = RunDeferredDrivePaymentTest(1, 0);
+
+		// Assert:
+		EXPECT_EQ(Amount(Drive_Size), payment);
+    }
+
+    TEST(TEST_CLASS, PeriodicStoragePayment_DriveDeferredPastBillingPeriodIsChargedForAllElapsedBillingPeriods) {
+		// Act: the drive was deferred by the payment limit until the previous block
+		auto payment = RunDeferredDrivePaymentTest(3, 3);
+
+		// Assert:
+		EXPECT_EQ(Amount(3 * Drive_Size), payment);
+    }
+
+    TEST(TEST_CLASS, PeriodicStoragePayment_DriveIsNotChargedForBillingPeriodsElapsedAfterDeferral) {
+		// Act: the drive was deferred by the payment limit when it became due, then no blocks were produced for a while
+		auto payment = RunDeferredDrivePaymentTest(3, 1);
+
+		// Assert: the drive is charged for the deferred billing period only
+		EXPECT_EQ(Amount(2 * Drive_Size), payment);
+    }
+
+    TEST(TEST_CLASS, PeriodicStoragePayment_DriveLateWithoutDeferralIsChargedForSingleBillingPeriod) {
+		// Act: the drive is late because no blocks were produced, not because of the payment limit
+		auto payment = RunDeferredDrivePaymentTest(3, 0);
+
+		// Assert:
+		EXPECT_EQ(Amount(Drive_Size), payment);
+    }
+
+    TEST(TEST_CLASS, PeriodicStoragePayment_DeferredPaymentExceedingDriveBalanceIsSplitProRata) {
+		// Arrange: both replicators stored the drive for the whole time since the last payment
+		ObserverTestContext context(NotifyMode::Commit, Current_Height, CreateConfig(1));
+		Timestamp lastPaymentTimestamp(10000);
+		auto notificationTimestamp = Timestamp(lastPaymentTimestamp.unwrap() + 3 * billingPeriodMilliseconds + 1000);
+		Notification notification({ { 1 } }, { { 1 } }, notificationTimestamp, Difficulty(0), 0, 0);
+		auto pObserver = CreatePeriodicStoragePaymentObserver(Liquidity_Provider, {}, std::make_shared<mocks::MockStorageState>());
+		auto& bcDriveCache = context.cache().sub<cache::BcDriveCache>();
+		auto& replicatorCache = context.cache().sub<cache::ReplicatorCache>();
+		auto& accountStateCache = context.cache().sub<cache::AccountStateCache>();
+		auto& queueCache = context.cache().sub<cache::QueueCache>();
+
+		auto driveKey = test::GenerateRandomByteArray<Key>();
+		auto replicatorKeys = test::GenerateRandomDataVector<Key>(Num_Replicators);
+		state::BcDriveEntry driveEntry(driveKey);
+		driveEntry.setOwner(Owner_Key);
+		driveEntry.setSize(Drive_Size);
+		driveEntry.setReplicatorCount(Num_Replicators);
+		for (const auto& replicatorKey : replicatorKeys) {
+			driveEntry.replicators().insert(replicatorKey);
+			driveEntry.confirmedStorageInfos()[replicatorKey].ConfirmedStorageSince = lastPaymentTimestamp;
+			replicatorCache.insert(CreateInitialReplicatorEntry(driveKey, replicatorKey));
+			test::AddAccountState(accountStateCache, replicatorKey, Current_Height);
+		}
+
+		driveEntry.setLastPayment(lastPaymentTimestamp);
+		bcDriveCache.insert(driveEntry);
+
+		// - the drive balance covers a single billing period only
+		auto driveBalance = Amount(Num_Replicators * Drive_Size);
+		auto streamingDeposit = Amount(2 * Num_Replicators * Drive_Size);
+		test::AddAccountState(accountStateCache, driveKey, Current_Height, { { Storage_Mosaic_Id, driveBalance }, { Streaming_Mosaic_Id, streamingDeposit } });
+		test::AddAccountState(accountStateCache, Owner_Key, Current_Height);
+		test::AddAccountState(accountStateCache, Zero_Key, Current_Height, { { Storage_Mosaic_Id, Storage_Lock_Amount } });
+
+		state::QueueEntry queueEntry(state::DrivePaymentQueueKey);
+		queueEntry.setFirst(driveKey);
+		queueEntry.setLast(driveKey);
+		queueEntry.setSize(1);
+		queueEntry.setVersion(2);
+		queueEntry.setLastDeferral(Timestamp(notificationTimestamp.unwrap() - 1000));
+		queueCache.insert(queueEntry);
+
+		// Act:
+		test::ObserveNotification(*pObserver, notification, context);
+
+		// Assert: the drive balance is split equally instead of being taken by the first replicator
+		for (const auto& replicatorKey : replicatorKeys)
+			EXPECT_EQ(Amount(Drive_Size), accountStateCache.find(replicatorKey).get().Balances.get(Currency_Mosaic_Id));
+
+		EXPECT_FALSE(bcDriveCache.contains(driveKey));
+    }
+
     TEST(TEST_CLASS, PeriodicStoragePayment_NoDrives) {
     	// Arrange:
     	auto notificationTimestamp = Timestamp(billingPeriodMilliseconds);
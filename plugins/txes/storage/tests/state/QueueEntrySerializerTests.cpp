@@ -0,0 +1,131 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "src/state/QueueEntrySerializer.h"
+#include "tests/test/core/SerializerTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace state {
+
+#define TEST_CLASS QueueEntrySerializerTests
+
+	namespace {
+		constexpr auto Entry_Size_v1 =
+			sizeof(VersionType) + // version
+			Key_Size + // queue key
+			Key_Size + // first key
+			Key_Size + // last key
+			sizeof(uint32_t); // size
+		constexpr auto Entry_Size_v2 = Entry_Size_v1 + sizeof(Timestamp); // last deferral
+
+		size_t GetEntrySize(VersionType version) {
+			return 1 == version ? Entry_Size_v1 : Entry_Size_v2;
+		}
+
+		QueueEntry CreateQueueEntry(VersionType version) {
+			QueueEntry entry(test::GenerateRandomByteArray<Key>());
+			entry.setVersion(version);
+			entry.setFirst(test::GenerateRandomByteArray<Key>());
+			entry.setLast(test::GenerateRandomByteArray<Key>());
+			entry.setSize(test::Random32());
+			if (version > 1)
+				entry.setLastDeferral(test::GenerateRandomValue<Timestamp>());
+
+			return entry;
+		}
+
+		std::vector<uint8_t> CreateEntryBuffer(const QueueEntry& entry, VersionType version) {
+			std::vector<uint8_t> buffer(GetEntrySize(version));
+
+			auto* pData = buffer.data();
+			memcpy(pData, &version, sizeof(VersionType));
+			pData += sizeof(VersionType);
+			memcpy(pData, entry.key().data(), Key_Size);
+			pData += Key_Size;
+			memcpy(pData, entry.getFirst().data(), Key_Size);
+			pData += Key_Size;
+			memcpy(pData, entry.getLast().data(), Key_Size);
+			pData += Key_Size;
+			auto size = entry.getSize();
+			memcpy(pData, &size, sizeof(uint32_t));
+			pData += sizeof(uint32_t);
+			if (version > 1) {
+				auto lastDeferral = entry.getLastDeferral();
+				memcpy(pData, &lastDeferral, sizeof(Timestamp));
+			}
+
+			return buffer;
+		}
+
+		void AssertEqual(const QueueEntry& expected, const QueueEntry& actual) {
+			EXPECT_EQ(expected.version(), actual.version());
+			EXPECT_EQ(expected.key(), actual.key());
+			EXPECT_EQ(expected.getFirst(), actual.getFirst());
+			EXPECT_EQ(expected.getLast(), actual.getLast());
+			EXPECT_EQ(expected.getSize(), actual.getSize());
+			EXPECT_EQ(expected.getLastDeferral(), actual.getLastDeferral());
+		}
+
+		void AssertCanSaveEntry(VersionType version) {
+			// Arrange:
+			std::vector<uint8_t> buffer;
+			mocks::MockMemoryStream stream(buffer);
+			auto entry = CreateQueueEntry(version);
+
+			// Act:
+			QueueEntrySerializer::Save(entry, stream);
+
+			// Assert:
+			EXPECT_EQ(CreateEntryBuffer(entry, version), buffer);
+		}
+
+		void AssertCanLoadEntry(VersionType version) {
+			// Arrange:
+			auto originalEntry = CreateQueueEntry(version);
+			auto buffer = CreateEntryBuffer(originalEntry, version);
+
+			// Act:
+			QueueEntry result(test::GenerateRandomByteArray<Key>());
+			test::RunLoadValueTest<QueueEntrySerializer>(buffer, result);
+
+			// Assert:
+			AssertEqual(originalEntry, result);
+		}
+	}
+
+	// region Save
+
+	TEST(TEST_CLASS, CanSaveEntry_v1) {
+		AssertCanSaveEntry(1);
+	}
+
+	TEST(TEST_CLASS, CanSaveEntry_v2) {
+		AssertCanSaveEntry(2);
+	}
+
+	// endregion
+
+	// region Load
+
+	TEST(TEST_CLASS, CanLoadEntry_v1) {
+		AssertCanLoadEntry(1);
+	}
+
+	TEST(TEST_CLASS, CanLoadEntry_v2) {
+		AssertCanLoadEntry(2);
+	}
+
+	TEST(TEST_CLASS, CannotLoadEntryWithUnsupportedVersion) {
+		// Arrange:
+		auto buffer = CreateEntryBuffer(CreateQueueEntry(2), 3);
+		mocks::MockMemoryStream stream(buffer);
+
+		// Act + Assert:
+		EXPECT_THROW(QueueEntrySerializer::Load(stream), catapult_runtime_error);
+	}
+
+	// endregion
+}}
@@ -23,6 +23,7 @@
 #include "RemoteRequestDispatcher.h"
 #include "catapult/ionet/PacketEntityUtils.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
+#include "catapult/utils/ShortHashSketch.h"
 
 namespace catapult { namespace api {
 
@@ -59,6 +60,49 @@ namespace catapult { namespace api {
 			size_t m_batchSize;
 		};
 
+		struct UtSketchTraits : public RegistryDependentTraits<model::Transaction> {
+		public:
+			using ResultType = SketchedUnconfirmedTransactions;
+			static constexpr auto Packet_Type = ionet::PacketType::Pull_Transactions_Sketch;
+			static constexpr auto Friendly_Name = "pull unconfirmed transactions sketch";
+
+			UtSketchTraits(const model::TransactionRegistry& registry, size_t batchSize)
+				: RegistryDependentTraits<model::Transaction>(registry)
+				, m_batchSize(batchSize)
+			{}
+
+			static auto CreateRequestPacketPayload(BlockFeeMultiplier minFeeMultiplier, const utils::ShortHashSketch& knownShortHashesSketch) {
+				ionet::PacketPayloadBuilder builder(Packet_Type);
+				builder.appendValue(minFeeMultiplier);
+				builder.appendValues(knownShortHashesSketch.cells());
+				return builder.build();
+			}
+
+		public:
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				auto dataSize = ionet::CalculatePacketDataSize(packet);
+				if (dataSize < sizeof(utils::ShortHashSketchDecodeResult))
+					return false;
+
+				// data is prepended with decode result
+				auto decodeResult = reinterpret_cast<const utils::ShortHashSketchDecodeResult&>(*packet.Data());
+				dataSize -= sizeof(utils::ShortHashSketchDecodeResult);
+				if (utils::ShortHashSketchDecodeResult::Success != decodeResult)
+					return utils::ShortHashSketchDecodeResult::Failure == decodeResult && 0 == dataSize;
+
+				// followed by transactions
+				result.IsDecoded = true;
+				result.Transactions = ionet::ExtractEntityBatchesFromBuffer<model::Transaction>(
+						{ packet.Data() + sizeof(utils::ShortHashSketchDecodeResult), dataSize },
+						m_batchSize,
+						*this);
+				return !result.Transactions.empty() || 0 == dataSize;
+			}
+
+		private:
+			size_t m_batchSize;
+		};
+
 		// endregion
 
 		class DefaultRemoteTransactionApi : public RemoteTransactionApi {
@@ -81,6 +125,13 @@ namespace catapult { namespace api {
 				return m_impl.dispatch(UtTraits(m_registry, batchSize), minFeeMultiplier, std::move(knownShortHashes));
 			}
 
+			FutureType<UtSketchTraits> unconfirmedTransactions(
+					BlockFeeMultiplier minFeeMultiplier,
+					const utils::ShortHashSketch& knownShortHashesSketch,
+					size_t batchSize) const override {
+				return m_impl.dispatch(UtSketchTraits(m_registry, batchSize), minFeeMultiplier, knownShortHashesSketch);
+			}
+
 		private:
 			const model::TransactionRegistry& m_registry;
 			mutable RemoteRequestDispatcher m_impl;
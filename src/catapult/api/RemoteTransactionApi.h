@@ -23,10 +23,22 @@
 #include "catapult/model/RangeTypes.h"
 #include "catapult/thread/Future.h"
 
-namespace catapult { namespace ionet { class PacketIo; } }
+namespace catapult {
+	namespace ionet { class PacketIo; }
+	namespace utils { class ShortHashSketch; }
+}
 
 namespace catapult { namespace api {
 
+	/// Unconfirmed transactions retrieved from a remote node using a short hash sketch.
+	struct SketchedUnconfirmedTransactions {
+		/// \c true if the remote node was able to decode the sketch.
+		bool IsDecoded = false;
+
+		/// Unconfirmed transactions unknown to the local node.
+		std::vector<model::TransactionRange> Transactions;
+	};
+
 	/// An api for retrieving transaction information from a remote node.
 	class RemoteTransactionApi : public RemoteApi {
 	protected:
@@ -41,6 +53,15 @@ namespace catapult { namespace api {
 			BlockFeeMultiplier minFeeMultiplier,
 			model::ShortHashRange&& knownShortHashes,
 			size_t batchSize) const = 0;
+
+		/// Gets all unconfirmed transactions from the remote that have a fee multiplier at least \a minFeeMultiplier
+		/// and do not have a short hash in the set represented by \a knownShortHashesSketch.
+		/// \note Transactions are only returned when the remote is able to decode the difference between its own short hashes
+		///       and \a knownShortHashesSketch.
+		virtual thread::future<SketchedUnconfirmedTransactions> unconfirmedTransactions(
+			BlockFeeMultiplier minFeeMultiplier,
+			const utils::ShortHashSketch& knownShortHashesSketch,
+			size_t batchSize) const = 0;
 	};
 
 	/// Creates a transaction api for interacting with a remote node with the specified \a io with public key (\a remotePublicKey)
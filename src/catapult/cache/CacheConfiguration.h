@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/cache_db/CacheDatabase.h"
 #include "catapult/utils/FileSize.h"
 #include <string>
 
@@ -54,6 +55,17 @@ namespace catapult { namespace cache {
 				, ShouldStorePatriciaTrees(PatriciaTreeStorageMode::Enabled == mode)
 		{}
 
+		/// Creates a cache configuration around \a databaseDirectory, \a maxCacheDatabaseWriteBatchSize,
+		/// specified patricia tree storage \a mode and database engine \a tuning.
+		CacheConfiguration(
+				const std::string& databaseDirectory,
+				utils::FileSize maxCacheDatabaseWriteBatchSize,
+				PatriciaTreeStorageMode mode,
+				const cache::CacheDatabaseTuning& tuning)
+				: CacheConfiguration(databaseDirectory, maxCacheDatabaseWriteBatchSize, mode) {
+			CacheDatabaseTuning = tuning;
+		}
+
 	public:
 		/// \c true if a cache database should be used, \c false otherwise.
 		bool ShouldUseCacheDatabase;
@@ -64,6 +76,9 @@ namespace catapult { namespace cache {
 		/// Maximum size of database write batch.
 		utils::FileSize MaxCacheDatabaseWriteBatchSize;
 
+		/// Database engine tuning.
+		cache::CacheDatabaseTuning CacheDatabaseTuning;
+
 		/// \c true if patricia trees should be stored, \c false otherwise.
 		bool ShouldStorePatriciaTrees;
 	};
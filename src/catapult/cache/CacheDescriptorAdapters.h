@@ -219,8 +219,8 @@ namespace catapult { namespace cache {
 		deltaset::ImmutableTypeTraits<typename TDescriptor::ValueType>, TValueHasher>;
 
 	namespace detail {
-		/// Defines cache types for an ordered set based cache.
-		template<typename TElementTraits, typename TDescriptor>
+		/// Defines cache types for an ordered set based cache with in memory base set type \a TBaseMemorySet.
+		template<typename TElementTraits, typename TDescriptor, typename TBaseMemorySet>
 		struct OrderedSetAdapter {
 		private:
 			struct DescriptorAdapter {
@@ -254,7 +254,7 @@ namespace catapult { namespace cache {
 				deltaset::ConditionalContainer<
 					deltaset::SetKeyTraits<MemorySetType>,
 					StorageSetType,
-					MemorySetType
+					TBaseMemorySet
 				>,
 				MemorySetType
 			>;
@@ -274,16 +274,22 @@ namespace catapult { namespace cache {
 	}
 
 	/// Defines cache types for an ordered mutable set based cache.
-	template<typename TDescriptor>
+	/// \note \a TBaseMemorySet is only used for the in memory base set, deltas always use std::set.
+	///       It can be any container providing the same interface and ordering as std::set.
+	template<typename TDescriptor, typename TBaseMemorySet = std::set<typename TDescriptor::ValueType>>
 	using MutableOrderedSetAdapter = detail::OrderedSetAdapter<
 		deltaset::MutableTypeTraits<typename TDescriptor::ValueType>,
-		TDescriptor>;
+		TDescriptor,
+		TBaseMemorySet>;
 
 	/// Defines cache types for an ordered immutable set based cache.
-	template<typename TDescriptor>
+	/// \note \a TBaseMemorySet is only used for the in memory base set, deltas always use std::set.
+	///       It can be any container providing the same interface and ordering as std::set.
+	template<typename TDescriptor, typename TBaseMemorySet = std::set<typename TDescriptor::ValueType>>
 	using ImmutableOrderedSetAdapter = detail::OrderedSetAdapter<
 		deltaset::ImmutableTypeTraits<typename TDescriptor::ValueType>,
-		TDescriptor>;
+		TDescriptor,
+		TBaseMemorySet>;
 
 	namespace detail {
 		/// Defines cache types for an ordered map based cache.
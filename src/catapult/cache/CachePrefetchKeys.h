@@ -0,0 +1,31 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#pragma once
+#include "catapult/types.h"
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	/// Keys of cache entries that are loaded into a cache delta before they are accessed.
+	struct CachePrefetchKeys {
+	public:
+		/// Public keys of accounts and of other entries identified by public keys (e.g. drives).
+		std::vector<Key> PublicKeys;
+
+		/// Account addresses.
+		std::vector<Address> Addresses;
+
+		/// Mosaic ids.
+		std::vector<MosaicId> MosaicIds;
+
+	public:
+		/// Returns \c true if there are no keys.
+		bool empty() const {
+			return PublicKeys.empty() && Addresses.empty() && MosaicIds.empty();
+		}
+	};
+}}
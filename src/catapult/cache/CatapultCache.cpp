@@ -20,9 +20,13 @@
 
 #include "CatapultCache.h"
 #include "CacheHeight.h"
+#include "CachePrefetchKeys.h"
+#include "MerkleRootCalculationContext.h"
 #include "ReadOnlyCatapultCache.h"
 #include "SubCachePluginAdapter.h"
 #include "catapult/crypto/Hashes.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
 
 namespace catapult { namespace cache {
@@ -44,18 +48,61 @@ namespace catapult { namespace cache {
 		}
 
 		template<typename TSubCacheViews, typename TUpdateMerkleRoot>
-		std::vector<Hash256> CollectSubCacheMerkleRoots(TSubCacheViews& subViews, TUpdateMerkleRoot updateMerkleRoot) {
-			std::vector<Hash256> merkleRoots;
+		void UpdateSubCacheMerkleRoots(
+				TSubCacheViews& subViews,
+				TUpdateMerkleRoot updateMerkleRoot,
+				MerkleRootCalculationContext* pMerkleRootContext) {
+			auto updateAndTimeMerkleRoot = [updateMerkleRoot, pMerkleRootContext](auto& subView) {
+				utils::StackTimer stopwatch;
+				updateMerkleRoot(subView);
+				if (pMerkleRootContext)
+					pMerkleRootContext->setLastDuration(subView.id().CacheId, stopwatch.millis());
+			};
+
+			auto pPool = pMerkleRootContext ? pMerkleRootContext->pool() : nullptr;
+			if (!pPool || subViews.size() < 2) {
+				for (auto* pSubView : subViews)
+					updateAndTimeMerkleRoot(*pSubView);
+
+				return;
+			}
+
+			// sub cache patricia trees are independent, so they can be updated concurrently
+			thread::ParallelForDynamic(*pPool, subViews, pPool->numWorkerThreads(), [updateAndTimeMerkleRoot](
+					auto* pSubView,
+					auto) {
+				updateAndTimeMerkleRoot(*pSubView);
+				return true;
+			}).get();
+		}
+
+		template<typename TSubCacheViews, typename TUpdateMerkleRoot>
+		std::vector<Hash256> CollectSubCacheMerkleRoots(
+				TSubCacheViews& subViews,
+				TUpdateMerkleRoot updateMerkleRoot,
+				MerkleRootCalculationContext* pMerkleRootContext) {
+			utils::StackTimer stopwatch;
+
+			using SubCacheViewPointer = decltype(subViews.front().get());
+			std::vector<SubCacheViewPointer> enabledSubViews;
 			for (const auto& pSubView : subViews) {
-				Hash256 merkleRoot;
-				if (!pSubView || !pSubView->enabled())
-					continue;
+				if (!!pSubView && pSubView->enabled())
+					enabledSubViews.push_back(pSubView.get());
+			}
+
+			UpdateSubCacheMerkleRoots(enabledSubViews, updateMerkleRoot, pMerkleRootContext);
 
-				updateMerkleRoot(*pSubView);
+			// collect merkle roots in sub cache order so that the state hash is deterministic
+			std::vector<Hash256> merkleRoots;
+			for (const auto* pSubView : enabledSubViews) {
+				Hash256 merkleRoot;
 				if (pSubView->tryGetMerkleRoot(merkleRoot))
 					merkleRoots.push_back(merkleRoot);
 			}
 
+			if (pMerkleRootContext)
+				pMerkleRootContext->setLastTotalDuration(stopwatch.millis());
+
 			return merkleRoots;
 		}
 
@@ -75,11 +122,14 @@ namespace catapult { namespace cache {
 		}
 
 		template<typename TSubCacheViews, typename TUpdateMerkleRoot>
-		StateHashInfo CalculateStateHashInfo(const TSubCacheViews& subViews, TUpdateMerkleRoot updateMerkleRoot) {
+		StateHashInfo CalculateStateHashInfo(
+				const TSubCacheViews& subViews,
+				TUpdateMerkleRoot updateMerkleRoot,
+				MerkleRootCalculationContext* pMerkleRootContext = nullptr) {
 			utils::SlowOperationLogger logger("CalculateStateHashInfo", utils::LogLevel::Warning);
 
 			StateHashInfo stateHashInfo;
-			stateHashInfo.SubCacheMerkleRoots = CollectSubCacheMerkleRoots(subViews, updateMerkleRoot);
+			stateHashInfo.SubCacheMerkleRoots = CollectSubCacheMerkleRoots(subViews, updateMerkleRoot, pMerkleRootContext);
 			stateHashInfo.StateHash = CalculateStateHash(stateHashInfo.SubCacheMerkleRoots);
 			return stateHashInfo;
 		}
@@ -126,8 +176,11 @@ namespace catapult { namespace cache {
 
 	// region CatapultCacheDelta
 
-	CatapultCacheDelta::CatapultCacheDelta(std::vector<std::unique_ptr<SubCacheView>>&& subViews)
+	CatapultCacheDelta::CatapultCacheDelta(
+			std::vector<std::unique_ptr<SubCacheView>>&& subViews,
+			const std::shared_ptr<MerkleRootCalculationContext>& pMerkleRootContext)
 			: m_subViews(std::move(subViews))
+			, m_pMerkleRootContext(pMerkleRootContext)
 	{}
 
 	CatapultCacheDelta::~CatapultCacheDelta() = default;
@@ -137,7 +190,10 @@ namespace catapult { namespace cache {
 	CatapultCacheDelta& CatapultCacheDelta::operator=(CatapultCacheDelta&&) = default;
 
 	StateHashInfo CatapultCacheDelta::calculateStateHash(const Height& height) const {
-		return CalculateStateHashInfo(m_subViews, [height](auto& subView) { subView.updateMerkleRoot(height); });
+		return CalculateStateHashInfo(
+				m_subViews,
+				[height](auto& subView) { subView.updateMerkleRoot(height); },
+				m_pMerkleRootContext.get());
 	}
 
 	void CatapultCacheDelta::setSubCacheMerkleRoots(const std::vector<Hash256>& subCacheMerkleRoots) {
@@ -187,6 +243,16 @@ namespace catapult { namespace cache {
 		}
 	}
 
+	void CatapultCacheDelta::prefetch(const CachePrefetchKeys& keys) {
+		if (keys.empty())
+			return;
+
+		for (auto& pSubView : m_subViews) {
+			if (!!pSubView && pSubView->enabled())
+				pSubView->prefetch(keys);
+		}
+	}
+
 	ReadOnlyCatapultCache CatapultCacheDelta::toReadOnly() const {
 		return ReadOnlyCatapultCache(ExtractReadOnlyViews(m_subViews));
 	}
@@ -198,10 +264,11 @@ namespace catapult { namespace cache {
 	CatapultCacheDetachableDelta::CatapultCacheDetachableDelta(
 			CacheHeightView&& cacheHeightView,
 			std::vector<std::unique_ptr<DetachedSubCacheView>>&& detachedSubViews,
-			const Height& heightDelta)
+			const Height& heightDelta,
+			const std::shared_ptr<MerkleRootCalculationContext>& pMerkleRootContext)
 			// note that CacheHeightView is a unique_ptr to allow CatapultCacheDetachableDelta to be declared without it defined
 			: m_pCacheHeightView(std::make_unique<CacheHeightView>(std::move(cacheHeightView)))
-			, m_detachedDelta(std::move(detachedSubViews))
+			, m_detachedDelta(std::move(detachedSubViews), pMerkleRootContext)
 			, m_heightDelta(heightDelta)
 	{}
 
@@ -221,8 +288,11 @@ namespace catapult { namespace cache {
 
 	// region CatapultCacheDetachedDelta
 
-	CatapultCacheDetachedDelta::CatapultCacheDetachedDelta(std::vector<std::unique_ptr<DetachedSubCacheView>>&& detachedSubViews)
+	CatapultCacheDetachedDelta::CatapultCacheDetachedDelta(
+			std::vector<std::unique_ptr<DetachedSubCacheView>>&& detachedSubViews,
+			const std::shared_ptr<MerkleRootCalculationContext>& pMerkleRootContext)
 			: m_detachedSubViews(std::move(detachedSubViews))
+			, m_pMerkleRootContext(pMerkleRootContext)
 	{}
 
 	CatapultCacheDetachedDelta::~CatapultCacheDetachedDelta() = default;
@@ -246,7 +316,7 @@ namespace catapult { namespace cache {
 			subViews.push_back(std::move(pSubView));
 		}
 
-		return std::make_unique<CatapultCacheDelta>(std::move(subViews));
+		return std::make_unique<CatapultCacheDelta>(std::move(subViews), m_pMerkleRootContext);
 	}
 
 	// endregion
@@ -267,12 +337,24 @@ namespace catapult { namespace cache {
 
 			return resultViews;
 		}
+
+		std::shared_ptr<MerkleRootCalculationContext> CreateMerkleRootContext(
+				const std::vector<std::unique_ptr<SubCachePlugin>>& subCaches,
+				const std::shared_ptr<thread::IoThreadPool>& pPool) {
+			std::vector<std::string> subCacheNames;
+			subCacheNames.reserve(subCaches.size());
+			for (const auto& pSubCache : subCaches)
+				subCacheNames.push_back(pSubCache ? pSubCache->name() : std::string());
+
+			return std::make_shared<MerkleRootCalculationContext>(std::move(subCacheNames), pPool);
+		}
 	}
 
 	CatapultCache::CatapultCache(std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches)
 			: m_pConfigHeight(std::make_unique<CacheHeight>())
 			, m_pCacheHeight(std::make_unique<CacheHeight>())
 			, m_subCaches(std::move(subCaches))
+			, m_pMerkleRootContext(CreateMerkleRootContext(m_subCaches, nullptr))
 	{}
 
 	CatapultCache::~CatapultCache() = default;
@@ -293,7 +375,7 @@ namespace catapult { namespace cache {
 		// subcache deltas will always be consistent
 		auto pCacheHeightView = m_pCacheHeight->view();
 		auto subViews = MapSubCaches<SubCacheView>(m_subCaches, [&pCacheHeightView](const auto& pSubCache) { return pSubCache->createDelta(pCacheHeightView.get()); });
-		return CatapultCacheDelta(std::move(subViews));
+		return CatapultCacheDelta(std::move(subViews), std::atomic_load(&m_pMerkleRootContext));
 	}
 
 	CatapultCacheDetachableDelta CatapultCache::createDetachableDelta(const Height& heightDelta) const {
@@ -302,7 +384,11 @@ namespace catapult { namespace cache {
 		auto detachedSubViews = MapSubCaches<DetachedSubCacheView>(m_subCaches, [&pCacheHeightView, heightDelta](const auto& pSubCache) {
 			return pSubCache->createDetachedDelta(pCacheHeightView.get() + heightDelta);
 		});
-		return CatapultCacheDetachableDelta(std::move(pCacheHeightView), std::move(detachedSubViews), heightDelta);
+		return CatapultCacheDetachableDelta(
+				std::move(pCacheHeightView),
+				std::move(detachedSubViews),
+				heightDelta,
+				std::atomic_load(&m_pMerkleRootContext));
 	}
 
 	void CatapultCache::commit(Height height) {
@@ -359,6 +445,17 @@ namespace catapult { namespace cache {
 			CATAPULT_THROW_INVALID_ARGUMENT_1("subcache has already been registered with id", id);
 
 		m_subCaches[id] = std::move(pSubCache);
+
+		// recreate the context so that the new sub cache is tracked
+		std::atomic_store(&m_pMerkleRootContext, CreateMerkleRootContext(m_subCaches, std::atomic_load(&m_pMerkleRootContext)->pool()));
+	}
+
+	void CatapultCache::setMerkleRootPool(const std::shared_ptr<thread::IoThreadPool>& pPool) {
+		std::atomic_store(&m_pMerkleRootContext, CreateMerkleRootContext(m_subCaches, pPool));
+	}
+
+	std::shared_ptr<const MerkleRootCalculationContext> CatapultCache::merkleRootContext() const {
+		return std::atomic_load(&m_pMerkleRootContext);
 	}
 
 	// endregion
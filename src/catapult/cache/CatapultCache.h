@@ -29,9 +29,11 @@ namespace catapult {
 		class CacheChangesStorage;
 		class CacheHeight;
 		class CacheStorage;
+		class MerkleRootCalculationContext;
 		class SubCachePlugin;
 	}
 	namespace model { struct NetworkConfiguration; }
+	namespace thread { class IoThreadPool; }
 }
 
 namespace catapult { namespace cache {
@@ -91,9 +93,19 @@ namespace catapult { namespace cache {
 		/// Adds a subcache.
 		void addSubCache(std::unique_ptr<SubCachePlugin>);
 
+	public:
+		/// Calculates sub cache merkle roots of all subsequently created deltas in parallel using \a pPool.
+		void setMerkleRootPool(const std::shared_ptr<thread::IoThreadPool>& pPool);
+
+		/// Gets the merkle root calculation context used by deltas of this cache.
+		/// \note The context is replaced atomically by setMerkleRootPool and addSubCache, so the returned context
+		///       remains valid but is not updated by subsequent calls to either.
+		std::shared_ptr<const MerkleRootCalculationContext> merkleRootContext() const;
+
 	private:
 		std::unique_ptr<CacheHeight> m_pConfigHeight; // use a unique_ptr to allow fwd declare
 		std::unique_ptr<CacheHeight> m_pCacheHeight; // use a unique_ptr to allow fwd declare
 		std::vector<std::unique_ptr<SubCachePlugin>> m_subCaches;
+		std::shared_ptr<MerkleRootCalculationContext> m_pMerkleRootContext; // only accessed via atomic_load and atomic_store
 	};
 }}
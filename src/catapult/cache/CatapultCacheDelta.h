@@ -23,7 +23,13 @@
 #include "SubCachePlugin.h"
 #include <memory>
 
-namespace catapult { namespace cache { class ReadOnlyCatapultCache; } }
+namespace catapult {
+	namespace cache {
+		struct CachePrefetchKeys;
+		class MerkleRootCalculationContext;
+		class ReadOnlyCatapultCache;
+	}
+}
 
 namespace catapult { namespace cache {
 
@@ -31,7 +37,10 @@ namespace catapult { namespace cache {
 	class CatapultCacheDelta {
 	public:
 		/// Creates a locked catapult cache delta from \a subViews.
-		explicit CatapultCacheDelta(std::vector<std::unique_ptr<SubCacheView>>&& subViews);
+		/// Sub cache merkle roots are calculated using \a pMerkleRootContext when it is provided.
+		explicit CatapultCacheDelta(
+				std::vector<std::unique_ptr<SubCacheView>>&& subViews,
+				const std::shared_ptr<MerkleRootCalculationContext>& pMerkleRootContext = nullptr);
 
 		/// Destroys the delta.
 		~CatapultCacheDelta();
@@ -70,11 +79,15 @@ namespace catapult { namespace cache {
 		/// Restores the last backed up changes in the cache delta.
 		void restoreChanges();
 
+		/// Loads the entries identified by \a keys into all sub cache deltas that support prefetching.
+		void prefetch(const CachePrefetchKeys& keys);
+
 	public:
 		/// Creates a read-only view of this delta.
 		ReadOnlyCatapultCache toReadOnly() const;
 
 	private:
 		std::vector<std::unique_ptr<SubCacheView>> m_subViews;
+		std::shared_ptr<MerkleRootCalculationContext> m_pMerkleRootContext;
 	};
 }}
@@ -31,11 +31,13 @@ namespace catapult { namespace cache {
 	///       when the delta is destroyed.
 	class CatapultCacheDetachableDelta {
 	public:
-		/// Creates a detachable cache delta from a cache height view (\a cacheHeightView) and \a detachedSubViews.
+		/// Creates a detachable cache delta from a cache height view (\a cacheHeightView) and \a detachedSubViews
+		/// with \a heightDelta and an optional merkle root calculation context (\a pMerkleRootContext).
 		CatapultCacheDetachableDelta(
 				CacheHeightView&& cacheHeightView,
 				std::vector<std::unique_ptr<DetachedSubCacheView>>&& detachedSubViews,
-				const Height& heightDelta = Height(0));
+				const Height& heightDelta = Height(0),
+				const std::shared_ptr<MerkleRootCalculationContext>& pMerkleRootContext = nullptr);
 
 		/// Destroys the detachable cache delta.
 		~CatapultCacheDetachableDelta();
@@ -30,7 +30,10 @@ namespace catapult { namespace cache {
 	class CatapultCacheDetachedDelta {
 	public:
 		/// Creates a detached cache delta from \a detachedSubViews.
-		explicit CatapultCacheDetachedDelta(std::vector<std::unique_ptr<DetachedSubCacheView>>&& detachedSubViews);
+		/// Sub cache merkle roots of locked deltas are calculated using \a pMerkleRootContext when it is provided.
+		explicit CatapultCacheDetachedDelta(
+				std::vector<std::unique_ptr<DetachedSubCacheView>>&& detachedSubViews,
+				const std::shared_ptr<MerkleRootCalculationContext>& pMerkleRootContext = nullptr);
 
 		/// Destroys the delta.
 		~CatapultCacheDetachedDelta();
@@ -47,5 +50,6 @@ namespace catapult { namespace cache {
 
 	private:
 		std::vector<std::unique_ptr<DetachedSubCacheView>> m_detachedSubViews;
+		std::shared_ptr<MerkleRootCalculationContext> m_pMerkleRootContext;
 	};
 }}
@@ -0,0 +1,51 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "MerkleRootCalculationContext.h"
+#include "catapult/thread/IoThreadPool.h"
+
+namespace catapult { namespace cache {
+
+	MerkleRootCalculationContext::MerkleRootCalculationContext(
+			std::vector<std::string>&& subCacheNames,
+			const std::shared_ptr<thread::IoThreadPool>& pPool)
+			: m_subCacheNames(std::move(subCacheNames))
+			, m_pPool(pPool)
+			, m_durations(m_subCacheNames.size())
+			, m_totalDuration(0)
+	{}
+
+	size_t MerkleRootCalculationContext::numSubCaches() const {
+		return m_subCacheNames.size();
+	}
+
+	const std::string& MerkleRootCalculationContext::subCacheName(size_t id) const {
+		static const std::string Empty_Name;
+		return id < m_subCacheNames.size() ? m_subCacheNames[id] : Empty_Name;
+	}
+
+	std::shared_ptr<thread::IoThreadPool> MerkleRootCalculationContext::pool() const {
+		return m_pPool.lock();
+	}
+
+	uint64_t MerkleRootCalculationContext::lastDuration(size_t id) const {
+		return id < m_durations.size() ? m_durations[id].load() : 0;
+	}
+
+	uint64_t MerkleRootCalculationContext::lastTotalDuration() const {
+		return m_totalDuration;
+	}
+
+	void MerkleRootCalculationContext::setLastDuration(size_t id, uint64_t millis) {
+		// sub caches added after the context was created are not tracked
+		if (id < m_durations.size())
+			m_durations[id] = millis;
+	}
+
+	void MerkleRootCalculationContext::setLastTotalDuration(uint64_t millis) {
+		m_totalDuration = millis;
+	}
+}}
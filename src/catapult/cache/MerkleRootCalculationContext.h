@@ -0,0 +1,55 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#pragma once
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace catapult { namespace thread { class IoThreadPool; } }
+
+namespace catapult { namespace cache {
+
+	/// Context shared by all deltas of a catapult cache for calculating sub cache merkle roots.
+	class MerkleRootCalculationContext {
+	public:
+		/// Creates a context for sub caches with \a subCacheNames (indexed by id) that calculates merkle roots
+		/// in parallel using \a pPool.
+		/// \note When \a pPool is \c nullptr or destroyed, merkle roots are calculated sequentially.
+		///       The context does not extend the lifetime of \a pPool so that it does not block pool shutdown.
+		MerkleRootCalculationContext(std::vector<std::string>&& subCacheNames, const std::shared_ptr<thread::IoThreadPool>& pPool);
+
+	public:
+		/// Gets the number of tracked sub caches.
+		size_t numSubCaches() const;
+
+		/// Gets the name of the sub cache with \a id or an empty string if no such sub cache is registered.
+		const std::string& subCacheName(size_t id) const;
+
+		/// Gets the pool used for calculating merkle roots in parallel (if any).
+		std::shared_ptr<thread::IoThreadPool> pool() const;
+
+		/// Gets the number of milliseconds spent updating the merkle root of the sub cache with \a id during the last calculation.
+		uint64_t lastDuration(size_t id) const;
+
+		/// Gets the number of milliseconds spent updating all sub cache merkle roots during the last calculation.
+		uint64_t lastTotalDuration() const;
+
+	public:
+		/// Sets the number of milliseconds (\a millis) spent updating the merkle root of the sub cache with \a id.
+		void setLastDuration(size_t id, uint64_t millis);
+
+		/// Sets the number of milliseconds (\a millis) spent updating all sub cache merkle roots.
+		void setLastTotalDuration(uint64_t millis);
+
+	private:
+		std::vector<std::string> m_subCacheNames;
+		std::weak_ptr<thread::IoThreadPool> m_pPool;
+		std::vector<std::atomic<uint64_t>> m_durations;
+		std::atomic<uint64_t> m_totalDuration;
+	};
+}}
@@ -28,6 +28,7 @@ namespace catapult {
 		class CacheChangesStorage;
 		class CacheStorage;
 		class CatapultCache;
+		struct CachePrefetchKeys;
 	}
 }
 
@@ -105,6 +106,9 @@ namespace catapult { namespace cache {
 
 		/// Restores the last backed up changes in the cache delta.
 		virtual void restoreChanges() = 0;
+
+		/// Loads the entries identified by \a keys into the cache delta if supported.
+		virtual void prefetch(const CachePrefetchKeys& keys) = 0;
 	};
 
 	/// Detached sub cache view.
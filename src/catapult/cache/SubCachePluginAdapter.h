@@ -20,6 +20,7 @@
 
 #pragma once
 #include "CacheChangesStorageAdapter.h"
+#include "CachePrefetchKeys.h"
 #include "CacheStorageAdapter.h"
 #include "SubCachePlugin.h"
 #include <memory>
@@ -136,6 +137,12 @@ namespace catapult { namespace cache {
 				return ChangesKeeper<UnderlyingViewType>();
 			}
 
+			auto prefetcher() {
+				// need to dereference to get underlying view type from LockedCacheView
+				using UnderlyingViewType = std::remove_reference_t<decltype(*m_view)>;
+				return Prefetcher<UnderlyingViewType>();
+			}
+
 		public:
 			const SubCacheViewIdentifier& id() const override {
 				return m_id;
@@ -185,6 +192,10 @@ namespace catapult { namespace cache {
 				RestoreChanges(m_view, changesKeeper());
 			}
 
+			void prefetch(const CachePrefetchKeys& keys) override {
+				Prefetch(m_view, keys, prefetcher());
+			}
+
 		private:
 			enum class Feature { Unsupported, Supported };
 			using UnsupportedFeatureFlag = std::integral_constant<Feature, Feature::Unsupported>;
@@ -273,6 +284,24 @@ namespace catapult { namespace cache {
 				view->restoreChanges();
 			}
 
+		private:
+			template<typename T, typename = void>
+			struct Prefetcher : public UnsupportedFeatureFlag {};
+
+			template<typename T>
+			struct Prefetcher<
+					T,
+					utils::traits::is_type_expression_t<decltype(reinterpret_cast<T*>(0)->prefetch(CachePrefetchKeys()))>>
+					: public SupportedFeatureFlag
+			{};
+
+			static void Prefetch(TView&, const CachePrefetchKeys&, UnsupportedFeatureFlag)
+			{}
+
+			static void Prefetch(TView& view, const CachePrefetchKeys& keys, SupportedFeatureFlag) {
+				view->prefetch(keys);
+			}
+
 		private:
 			TView m_view;
 			SubCacheViewIdentifier m_id;
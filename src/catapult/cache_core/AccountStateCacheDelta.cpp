@@ -239,4 +239,15 @@ namespace catapult { namespace cache {
 	const model::AddressSet& BasicAccountStateCacheDelta::updatedAddresses() const {
 		return m_addressesToUpdate;
 	}
+
+	void BasicAccountStateCacheDelta::prefetch(const CachePrefetchKeys& keys) {
+		m_pKeyToAddress->prefetch(keys.PublicKeys);
+
+		// accounts are stored by address, which can be derived from public key without looking up key to address mapping
+		auto addresses = keys.Addresses;
+		for (const auto& publicKey : keys.PublicKeys)
+			addresses.push_back(model::PublicKeyToAddress(publicKey, m_options.NetworkIdentifier));
+
+		m_pStateByAddress->prefetch(addresses);
+	}
 }}
@@ -23,6 +23,7 @@
 #include "AccountStateCacheSerializers.h"
 #include "ReadOnlyAccountStateCache.h"
 #include "catapult/cache/CacheMixinAliases.h"
+#include "catapult/cache/CachePrefetchKeys.h"
 #include "catapult/cache/ReadOnlyViewSupplier.h"
 #include "catapult/model/ContainerTypes.h"
 
@@ -144,6 +145,10 @@ namespace catapult { namespace cache {
 		/// Adds new and modified elements to set
 		void addUpdatedAddresses(model::AddressSet& set) const;
 
+	public:
+		/// Loads the accounts identified by public keys and addresses in \a keys into the delta.
+		void prefetch(const CachePrefetchKeys& keys);
+
 	private:
 		Address getAddress(const Key& publicKey);
 
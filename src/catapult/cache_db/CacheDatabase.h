@@ -30,6 +30,9 @@ namespace catapult { namespace cache {
 	/// RocksDb-backed cache database settings.
 	using CacheDatabaseSettings = RocksDatabaseSettings;
 
+	/// RocksDb-backed cache database engine tuning.
+	using CacheDatabaseTuning = RocksTuningSettings;
+
 	/// RocksDb-backed cache database container view.
 	template<typename TDescriptor>
 	using CacheContainerView = RdbTypedColumnContainer<TDescriptor>;
@@ -47,6 +47,23 @@ namespace catapult { namespace cache {
 			return std::make_unique<const tree::TreeNode>(pair.second.copy());
 		}
 
+		/// Gets the tree nodes associated with \a hashes using a single batched lookup.
+		/// \note Nodes that are not found are returned as \c nullptr.
+		std::vector<std::unique_ptr<const tree::TreeNode>> get(const std::vector<Hash256>& hashes) const {
+			std::vector<std::unique_ptr<const tree::TreeNode>> nodes;
+			nodes.reserve(hashes.size());
+			for (const auto& iter : m_container.find(hashes)) {
+				if (m_container.cend() == iter) {
+					nodes.push_back(nullptr);
+					continue;
+				}
+
+				nodes.push_back(std::make_unique<const tree::TreeNode>(iter->second.copy()));
+			}
+
+			return nodes;
+		}
+
 	public:
 		/// Saves a leaf tree \a node.
 		void set(const tree::LeafTreeNode& node) {
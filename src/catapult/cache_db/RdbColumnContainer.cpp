@@ -74,6 +74,15 @@ namespace catapult { namespace cache {
 		m_database.get(m_columnId, ToSlice(key), iterator);
 	}
 
+	void RdbColumnContainer::find(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const {
+		std::vector<rocksdb::Slice> slices;
+		slices.reserve(keys.size());
+		for (const auto& key : keys)
+			slices.push_back(ToSlice(key));
+
+		m_database.multiGet(m_columnId, slices, iterators);
+	}
+
 	void RdbColumnContainer::findLowerOrEqual(const RawBuffer& key, RdbDataIterator& iterator) const {
 		m_database.getLowerOrEqual(m_columnId, ToSlice(key), iterator);
 	}
@@ -78,6 +78,9 @@ namespace catapult { namespace cache {
 		/// Finds element with \a key, storing result in \a iterator.
 		void find(const RawBuffer& key, RdbDataIterator& iterator) const;
 
+		/// Finds elements with \a keys in a single batch, storing results in \a iterators.
+		void find(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const;
+
 		/// Finds first element with <= \a key, storing result in \a iterator.
 		void findLowerOrEqual(const RawBuffer& key, RdbDataIterator& iterator) const;
 
@@ -126,6 +126,24 @@ namespace catapult { namespace cache {
 			return iter;
 		}
 
+		/// Finds elements with \a keys using a single batched lookup.
+		/// Returns one iterator per key, which is cend() if the corresponding key has not been found.
+		std::vector<const_iterator> find(const std::vector<KeyType>& keys) const {
+			std::vector<RawBuffer> serializedKeys;
+			serializedKeys.reserve(keys.size());
+			for (const auto& key : keys)
+				serializedKeys.push_back(SerializeKey(key));
+
+			std::vector<RdbDataIterator> dbIterators;
+			TContainer::find(serializedKeys, dbIterators);
+
+			std::vector<const_iterator> iters(dbIterators.size());
+			for (auto i = 0u; i < dbIterators.size(); ++i)
+				iters[i].dbIterator() = std::move(dbIterators[i]);
+
+			return iters;
+		}
+
 		/// Finds the first element with <= \a key. Returns cend() if any <= \a key has not been found.
 		const_iterator findLowerOrEqual(const KeyType& key) const {
 			const_iterator iter;
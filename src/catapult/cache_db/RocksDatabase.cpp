@@ -21,7 +21,12 @@
 #include "RocksDatabase.h"
 #include "RocksInclude.h"
 #include "catapult/utils/StackLogger.h"
+#include <rocksdb/cache.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/table.h>
 #include <boost/filesystem.hpp>
+#include <map>
+#include <mutex>
 
 namespace catapult { namespace cache {
 
@@ -87,8 +92,85 @@ namespace catapult { namespace cache {
 			, PruningMode(pruningMode)
 	{}
 
+	RocksDatabaseSettings::RocksDatabaseSettings(
+			const std::string& databaseDirectory,
+			const std::vector<std::string>& columnFamilyNames,
+			utils::FileSize maxDatabaseWriteBatchSize,
+			FilterPruningMode pruningMode,
+			const RocksTuningSettings& tuning)
+			: DatabaseDirectory(databaseDirectory)
+			, ColumnFamilyNames(columnFamilyNames)
+			, MaxDatabaseWriteBatchSize(maxDatabaseWriteBatchSize)
+			, PruningMode(pruningMode)
+			, Tuning(tuning)
+	{}
+
 	// endregion
 
+	// region RocksDatabase
+
+	namespace {
+		std::shared_ptr<rocksdb::Cache> GetSharedBlockCache(utils::FileSize blockCacheSize) {
+			// all databases (one per sub cache) configured with the same size share a single block cache
+			static std::mutex mutex;
+			static std::map<uint64_t, std::weak_ptr<rocksdb::Cache>> blockCaches;
+
+			std::lock_guard<std::mutex> guard(mutex);
+			auto& pWeakBlockCache = blockCaches[blockCacheSize.bytes()];
+			auto pBlockCache = pWeakBlockCache.lock();
+			if (!pBlockCache) {
+				pBlockCache = rocksdb::NewLRUCache(blockCacheSize.bytes());
+				pWeakBlockCache = pBlockCache;
+			}
+
+			return pBlockCache;
+		}
+
+		void ApplyCompression(utils::CompressionMode compressionMode, rocksdb::ColumnFamilyOptions& columnOptions) {
+			switch (compressionMode) {
+			case utils::CompressionMode::None:
+				columnOptions.compression = rocksdb::kNoCompression;
+				break;
+
+			case utils::CompressionMode::Snappy:
+				columnOptions.compression = rocksdb::kSnappyCompression;
+				break;
+
+			case utils::CompressionMode::Lz4:
+				columnOptions.compression = rocksdb::kLZ4Compression;
+				break;
+
+			case utils::CompressionMode::Zstd:
+				columnOptions.compression = rocksdb::kZSTD;
+				break;
+
+			default:
+				break;
+			}
+		}
+
+		rocksdb::ColumnFamilyOptions CreateColumnOptions(const RocksTuningSettings& tuning, rocksdb::CompactionFilter* pCompactionFilter) {
+			rocksdb::ColumnFamilyOptions columnOptions;
+			columnOptions.compaction_filter = pCompactionFilter;
+			ApplyCompression(tuning.CompressionMode, columnOptions);
+
+			if (0 == tuning.BlockCacheSize.bytes() && 0 == tuning.BloomFilterBitsPerKey)
+				return columnOptions;
+
+			rocksdb::BlockBasedTableOptions tableOptions;
+			if (0 != tuning.BlockCacheSize.bytes())
+				tableOptions.block_cache = GetSharedBlockCache(tuning.BlockCacheSize);
+
+			if (0 != tuning.BloomFilterBitsPerKey) {
+				// full (not block based) filters are cheaper to probe for point lookups
+				tableOptions.filter_policy.reset(rocksdb::NewBloomFilterPolicy(static_cast<int>(tuning.BloomFilterBitsPerKey), false));
+			}
+
+			columnOptions.table_factory.reset(rocksdb::NewBlockBasedTableFactory(tableOptions));
+			return columnOptions;
+		}
+	}
+
 	RocksDatabase::RocksDatabase() = default;
 
 	RocksDatabase::RocksDatabase(const RocksDatabaseSettings& settings)
@@ -111,8 +193,7 @@ namespace catapult { namespace cache {
 		dbOptions.create_if_missing = true;
 		dbOptions.create_missing_column_families = true;
 
-		rocksdb::ColumnFamilyOptions defaultColumnOptions;
-		defaultColumnOptions.compaction_filter = m_pruningFilter.compactionFilter();
+		auto defaultColumnOptions = CreateColumnOptions(m_settings.Tuning, m_pruningFilter.compactionFilter());
 
 		std::vector<rocksdb::ColumnFamilyDescriptor> columnFamilies;
 		for (const auto& columnFamilyName : settings.ColumnFamilyNames)
@@ -161,6 +242,35 @@ namespace catapult { namespace cache {
 			CATAPULT_THROW_DB_KEY_ERROR("could not retrieve value for get");
 	}
 
+	void RocksDatabase::multiGet(size_t columnId, const std::vector<rocksdb::Slice>& keys, std::vector<RdbDataIterator>& results) {
+		if (!m_pDb)
+			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
+
+		results.clear();
+		results.resize(keys.size());
+		if (keys.empty())
+			return;
+
+		std::vector<rocksdb::PinnableSlice> values(keys.size());
+		std::vector<rocksdb::Status> statuses(keys.size());
+		m_pDb->MultiGet(rocksdb::ReadOptions(), m_handles[columnId], keys.size(), keys.data(), values.data(), statuses.data());
+
+		for (auto i = 0u; i < keys.size(); ++i) {
+			const auto& status = statuses[i];
+			results[i].setFound(status.ok());
+
+			if (status.ok()) {
+				results[i].storage().PinSelf(values[i]);
+				continue;
+			}
+
+			if (!status.IsNotFound()) {
+				auto message = std::string("could not retrieve value for multiGet ") + status.ToString() + " (column, key)";
+				ThrowError(message, m_settings.ColumnFamilyNames[columnId], keys[i]);
+			}
+		}
+	}
+
 	void RocksDatabase::getLowerOrEqual(size_t columnId, const rocksdb::Slice& key, RdbDataIterator& result) {
 		if (!m_pDb)
 			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
@@ -245,7 +355,7 @@ namespace catapult { namespace cache {
 			return;
 
 		rocksdb::WriteOptions writeOptions;
-		writeOptions.sync = true;
+		writeOptions.sync = m_settings.Tuning.ShouldSyncWrites;
 
 		auto directory = m_settings.DatabaseDirectory + "/";
 		utils::SlowOperationLogger logger(utils::ExtractDirectoryName(directory.c_str()).pData, utils::LogLevel::Warning);
@@ -262,4 +372,6 @@ namespace catapult { namespace cache {
 
 		flush();
 	}
+
+	// endregion
 }}
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "RocksPruningFilter.h"
+#include "catapult/utils/CompressionMode.h"
 #include "catapult/utils/FileSize.h"
 #include "catapult/types.h"
 #include <memory>
@@ -84,6 +85,23 @@ namespace catapult { namespace cache {
 		bool m_isFound;
 	};
 
+	/// RocksDb engine tuning settings.
+	struct RocksTuningSettings {
+		/// Size of the block cache shared by all databases configured with the same size.
+		/// \note \c 0 will use a default block cache per column.
+		utils::FileSize BlockCacheSize;
+
+		/// Number of bloom filter bits per key.
+		/// \note \c 0 will disable bloom filters.
+		uint32_t BloomFilterBitsPerKey = 0;
+
+		/// Compression mode of all columns.
+		utils::CompressionMode CompressionMode = utils::CompressionMode::Default;
+
+		/// \c true if batch writes should be synced to disk.
+		bool ShouldSyncWrites = true;
+	};
+
 	/// RocksDb settings.
 	struct RocksDatabaseSettings {
 	public:
@@ -98,6 +116,15 @@ namespace catapult { namespace cache {
 				utils::FileSize maxDatabaseWriteBatchSize,
 				FilterPruningMode pruningMode);
 
+		/// Creates database settings around \a databaseDirectory, column names (\a columnFamilyNames),
+		/// maximum size of saved batch (\a maxDatabaseWriteBatchSize), \a pruningMode and engine \a tuning.
+		RocksDatabaseSettings(
+				const std::string& databaseDirectory,
+				const std::vector<std::string>& columnFamilyNames,
+				utils::FileSize maxDatabaseWriteBatchSize,
+				FilterPruningMode pruningMode,
+				const RocksTuningSettings& tuning);
+
 	public:
 		/// Database directory.
 		const std::string DatabaseDirectory;
@@ -110,6 +137,9 @@ namespace catapult { namespace cache {
 
 		/// Database pruning mode.
 		const FilterPruningMode PruningMode;
+
+		/// Database engine tuning.
+		const RocksTuningSettings Tuning;
 	};
 
 	/// RocksDb-backed database.
@@ -135,6 +165,10 @@ namespace catapult { namespace cache {
 		/// Gets \a key from \a columnId returning data in \a result.
 		void get(size_t columnId, const rocksdb::Slice& key, RdbDataIterator& result);
 
+		/// Gets all \a keys from \a columnId in a single batch returning data in \a results.
+		/// \note \a results are replaced with one iterator per key.
+		void multiGet(size_t columnId, const std::vector<rocksdb::Slice>& keys, std::vector<RdbDataIterator>& results);
+
 		/// Gets the first data \a result by <= \a key from \a columnId.
 		void getLowerOrEqual(size_t columnId, const rocksdb::Slice& key, RdbDataIterator& result);
 
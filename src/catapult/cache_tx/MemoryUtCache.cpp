@@ -22,6 +22,7 @@
 #include "AccountCounters.h"
 #include "CacheSizeLogger.h"
 #include "catapult/model/FeeUtils.h"
+#include <tuple>
 
 namespace catapult { namespace cache {
 
@@ -46,16 +47,50 @@ namespace catapult { namespace cache {
 		size_t Id;
 	};
 
+	struct MaxFeeMultiplierIndexEntry {
+	public:
+		/// \c true if the transaction fee is limited.
+		/// \note Such transactions are ordered before all others and their max fee multipliers are ignored.
+		bool IsFeeLimited;
+
+		/// Max fee multiplier of the transaction.
+		BlockFeeMultiplier MaxFeeMultiplier;
+
+		/// Id of the transaction data.
+		size_t Id;
+
+		/// Transaction data.
+		const TransactionData* pData;
+
+	public:
+		bool operator<(const MaxFeeMultiplierIndexEntry& rhs) const {
+			return std::make_tuple(!IsFeeLimited, MaxFeeMultiplier, Id) < std::make_tuple(!rhs.IsFeeLimited, rhs.MaxFeeMultiplier, rhs.Id);
+		}
+	};
+
+	namespace {
+		MaxFeeMultiplierIndexEntry CreateMaxFeeMultiplierIndexEntry(
+				const TransactionData& data,
+				const model::TransactionFeeCalculator& transactionFeeCalculator) {
+			const auto& transaction = *data.pEntity;
+			auto isFeeLimited = transactionFeeCalculator.isTransactionFeeLimited(transaction.Type, transaction.EntityVersion());
+			auto maxFeeMultiplier = isFeeLimited ? BlockFeeMultiplier() : model::CalculateTransactionMaxFeeMultiplier(transaction);
+			return MaxFeeMultiplierIndexEntry{ isFeeLimited, maxFeeMultiplier, data.Id, &data };
+		}
+	}
+
 	// region MemoryUtCacheView
 
 	MemoryUtCacheView::MemoryUtCacheView(
 			uint64_t maxResponseSize,
 			const TransactionDataContainer& transactionDataContainer,
+			const MaxFeeMultiplierIndex& maxFeeMultiplierIndex,
 			const IdLookup& idLookup,
 			std::shared_ptr<model::TransactionFeeCalculator> pTransactionFeeCalculator,
 			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_maxResponseSize(maxResponseSize)
 			, m_transactionDataContainer(transactionDataContainer)
+			, m_maxFeeMultiplierIndex(maxFeeMultiplierIndex)
 			, m_idLookup(idLookup)
 			, m_pTransactionFeeCalculator(std::move(pTransactionFeeCalculator))
 			, m_readLock(std::move(readLock))
@@ -76,6 +111,37 @@ namespace catapult { namespace cache {
 		}
 	}
 
+	void MemoryUtCacheView::forEach(MaxFeeMultiplierOrder order, const TransactionInfoConsumer& consumer) const {
+		auto iter = m_maxFeeMultiplierIndex.cbegin();
+		if (MaxFeeMultiplierOrder::Ascending == order) {
+			for (; m_maxFeeMultiplierIndex.cend() != iter; ++iter) {
+				if (!consumer(*iter->pData))
+					return;
+			}
+
+			return;
+		}
+
+		for (; m_maxFeeMultiplierIndex.cend() != iter && iter->IsFeeLimited; ++iter) {
+			if (!consumer(*iter->pData))
+				return;
+		}
+
+		// walk groups of equal multipliers from the highest one so that older transactions are still preferred within a group
+		auto limitedFeeEnd = iter;
+		auto groupEnd = m_maxFeeMultiplierIndex.cend();
+		while (limitedFeeEnd != groupEnd) {
+			auto groupBegin = m_maxFeeMultiplierIndex.lower_bound(
+					MaxFeeMultiplierIndexEntry{ false, std::prev(groupEnd)->MaxFeeMultiplier, 0, nullptr });
+			for (auto groupIter = groupBegin; groupEnd != groupIter; ++groupIter) {
+				if (!consumer(*groupIter->pData))
+					return;
+			}
+
+			groupEnd = groupBegin;
+		}
+	}
+
 	model::ShortHashRange MemoryUtCacheView::shortHashes() const {
 		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(m_transactionDataContainer.size());
 		auto shortHashesIter = shortHashes.begin();
@@ -129,14 +195,18 @@ namespace catapult { namespace cache {
 					uint64_t maxCacheSize,
 					size_t& idSequence,
 					TransactionDataContainer& transactionDataContainer,
+					MaxFeeMultiplierIndex& maxFeeMultiplierIndex,
 					IdLookup& idLookup,
 					AccountCounters& counters,
+					const model::TransactionFeeCalculator& transactionFeeCalculator,
 					utils::SpinReaderWriterLock::WriterLockGuard&& writeLock)
 					: m_maxCacheSize(maxCacheSize)
 					, m_idSequence(idSequence)
 					, m_transactionDataContainer(transactionDataContainer)
+					, m_maxFeeMultiplierIndex(maxFeeMultiplierIndex)
 					, m_idLookup(idLookup)
 					, m_counters(counters)
+					, m_transactionFeeCalculator(transactionFeeCalculator)
 					, m_writeLock(std::move(writeLock))
 			{}
 
@@ -153,7 +223,8 @@ namespace catapult { namespace cache {
 					return false;
 
 				m_idLookup.emplace(transactionInfo.EntityHash, ++m_idSequence);
-				m_transactionDataContainer.emplace(transactionInfo, m_idSequence);
+				auto dataIter = m_transactionDataContainer.emplace(transactionInfo, m_idSequence).first;
+				m_maxFeeMultiplierIndex.insert(CreateMaxFeeMultiplierIndexEntry(*dataIter, m_transactionFeeCalculator));
 
 				m_counters.increment(transactionInfo.pEntity->Signer);
 
@@ -171,6 +242,7 @@ namespace catapult { namespace cache {
 
 				m_counters.decrement(dataIter->pEntity->Signer);
 
+				m_maxFeeMultiplierIndex.erase(CreateMaxFeeMultiplierIndexEntry(*dataIter, m_transactionFeeCalculator));
 				m_transactionDataContainer.erase(dataIter);
 				m_idLookup.erase(iter);
 				return erasedInfo;
@@ -191,6 +263,7 @@ namespace catapult { namespace cache {
 				for (const auto& data : m_transactionDataContainer)
 					transactionInfosCopy.emplace_back(data.copy());
 
+				m_maxFeeMultiplierIndex.clear();
 				m_transactionDataContainer.clear();
 				m_idLookup.clear();
 				m_counters.reset();
@@ -201,8 +274,10 @@ namespace catapult { namespace cache {
 			uint64_t m_maxCacheSize;
 			size_t& m_idSequence;
 			TransactionDataContainer& m_transactionDataContainer;
+			MaxFeeMultiplierIndex& m_maxFeeMultiplierIndex;
 			IdLookup& m_idLookup;
 			AccountCounters& m_counters;
+			const model::TransactionFeeCalculator& m_transactionFeeCalculator;
 			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
 		};
 	}
@@ -213,6 +288,7 @@ namespace catapult { namespace cache {
 
 	struct MemoryUtCache::Impl {
 		cache::TransactionDataContainer TransactionDataContainer;
+		cache::MaxFeeMultiplierIndex MaxFeeMultiplierIndex;
 		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
 		AccountCounters Counters;
 	};
@@ -231,6 +307,7 @@ namespace catapult { namespace cache {
 		auto readLock = m_lock.acquireReader();
 		return MemoryUtCacheView(m_options.MaxResponseSize,
 								 m_pImpl->TransactionDataContainer,
+								 m_pImpl->MaxFeeMultiplierIndex,
 								 m_pImpl->IdLookup,
 								 m_pTransactionFeeCalculator,
 								 std::move(readLock));
@@ -242,8 +319,10 @@ namespace catapult { namespace cache {
 				m_options.MaxCacheSize,
 				m_idSequence,
 				m_pImpl->TransactionDataContainer,
+				m_pImpl->MaxFeeMultiplierIndex,
 				m_pImpl->IdLookup,
 				m_pImpl->Counters,
+				*m_pTransactionFeeCalculator,
 				std::move(writeLock)));
 	}
 
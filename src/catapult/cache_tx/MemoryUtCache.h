@@ -29,7 +29,12 @@
 #include <set>
 #include <unordered_map>
 
-namespace catapult { namespace cache { struct TransactionData; } }
+namespace catapult {
+	namespace cache {
+		struct MaxFeeMultiplierIndexEntry;
+		struct TransactionData;
+	}
+}
 
 namespace catapult { namespace cache {
 
@@ -37,6 +42,19 @@ namespace catapult { namespace cache {
 	/// \note std::set is used to allow incomplete type.
 	using TransactionDataContainer = std::set<TransactionData>;
 
+	/// Index of transactions ordered by max fee multiplier that is maintained alongside TransactionDataContainer.
+	/// \note std::set is used to allow incomplete type.
+	using MaxFeeMultiplierIndex = std::set<MaxFeeMultiplierIndexEntry>;
+
+	/// Order of transactions by max fee multiplier.
+	enum class MaxFeeMultiplierOrder {
+		/// Lowest max fee multiplier first.
+		Ascending,
+
+		/// Highest max fee multiplier first.
+		Descending
+	};
+
 	/// A read only view on top of unconfirmed transactions cache.
 	class MemoryUtCacheView {
 	private:
@@ -46,10 +64,12 @@ namespace catapult { namespace cache {
 
 	public:
 		/// Creates a view around a maximum response size (\a maxResponseSize), a transaction data container
-		/// (\a transactionDataContainer) and an id lookup (\a idLookup) with lock context \a readLock.
+		/// (\a transactionDataContainer), a max fee multiplier index (\a maxFeeMultiplierIndex) and an id lookup (\a idLookup)
+		/// with lock context \a readLock.
 		explicit MemoryUtCacheView(
 				uint64_t maxResponseSize,
 				const TransactionDataContainer& transactionDataContainer,
+				const MaxFeeMultiplierIndex& maxFeeMultiplierIndex,
 				const IdLookup& idLookup,
 				std::shared_ptr<model::TransactionFeeCalculator> pTransactionFeeCalculator,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
@@ -64,6 +84,11 @@ namespace catapult { namespace cache {
 		/// Calls \a consumer with all transaction infos until all are consumed or \c false is returned by consumer.
 		void forEach(const TransactionInfoConsumer& consumer) const;
 
+		/// Calls \a consumer with all transaction infos in \a order of max fee multipliers until all are consumed
+		/// or \c false is returned by consumer.
+		/// \note Transactions with limited fees are consumed first, transactions with equal multipliers are consumed oldest first.
+		void forEach(MaxFeeMultiplierOrder order, const TransactionInfoConsumer& consumer) const;
+
 		/// Gets a range of short hashes of all transactions in the cache.
 		/// A short hash consists of the first 4 bytes of the complete hash.
 		model::ShortHashRange shortHashes() const;
@@ -83,6 +108,7 @@ namespace catapult { namespace cache {
 	private:
 		uint64_t m_maxResponseSize;
 		const TransactionDataContainer& m_transactionDataContainer;
+		const MaxFeeMultiplierIndex& m_maxFeeMultiplierIndex;
 		const IdLookup& m_idLookup;
 		std::shared_ptr<model::TransactionFeeCalculator> m_pTransactionFeeCalculator;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
@@ -59,6 +59,27 @@ namespace catapult { namespace cache {
 		return transactionInfoPointers;
 	}
 
+	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
+			const MemoryUtCacheView& utCacheView,
+			uint32_t count,
+			MaxFeeMultiplierOrder order,
+			const predicate<const model::TransactionInfo&>& filter,
+			const StopTransactionFetchingFunc& stopCallback) {
+		std::vector<const model::TransactionInfo*> transactionInfoPointers;
+		transactionInfoPointers.reserve(std::min<size_t>(utCacheView.size(), count));
+
+		if (0 != count) {
+			utCacheView.forEach(order, [count, filter, &transactionInfoPointers, stopCallback](const auto& transactionInfo) {
+				if (filter(transactionInfo))
+					transactionInfoPointers.push_back(&transactionInfo);
+
+				return transactionInfoPointers.size() != count && !stopCallback();
+			});
+		}
+
+		return transactionInfoPointers;
+	}
+
 	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
 			const MemoryUtCacheView& utCacheView,
 			uint32_t count,
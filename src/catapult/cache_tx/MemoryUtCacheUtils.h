@@ -40,6 +40,16 @@ namespace catapult { namespace cache {
 		const predicate<const model::TransactionInfo&>& filter,
 		const StopTransactionFetchingFunc& stopCallback);
 
+	/// Gets pointers to the first \a count transaction infos in \a utCacheView that pass \a filter
+	/// when iterating in \a order of max fee multipliers.
+	/// \note Pointers are only safe to access during the lifetime of \a utCacheView.
+	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
+		const MemoryUtCacheView& utCacheView,
+		uint32_t count,
+		MaxFeeMultiplierOrder order,
+		const predicate<const model::TransactionInfo&>& filter,
+		const StopTransactionFetchingFunc& stopCallback);
+
 	/// Gets pointers to the first \a count transaction infos in \a utCacheView that pass \a filter after sorting by \a sortComparer.
 	/// \note Pointers are only safe to access during the lifetime of \a utCacheView.
 	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
@@ -19,6 +19,7 @@
 **/
 
 #include "BatchEntityProcessor.h"
+#include "CachePrefetcher.h"
 #include "ProcessingNotificationSubscriber.h"
 
 using namespace catapult::validators;
@@ -46,6 +47,9 @@ namespace catapult { namespace chain {
 				auto validatorContext = ValidatorContext(config, height, timestamp, resolverContext, readOnlyCache);
 				auto observerContext = observers::ObserverContext(state, config, height, timestamp, observers::NotifyMode::Commit, resolverContext);
 
+				if (m_config.pPrefetchPublisher)
+					PrefetchCacheEntries(*m_config.pPrefetchPublisher, resolverContext, entityInfos, state.Cache);
+
 				ProcessingNotificationSubscriber sub(*m_config.pValidator, validatorContext, *m_config.pObserver, observerContext);
 				for (const auto& entityInfo : entityInfos) {
 					m_config.pNotificationPublisher->publish(entityInfo, sub);
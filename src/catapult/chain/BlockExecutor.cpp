@@ -19,6 +19,7 @@
 **/
 
 #include "BlockExecutor.h"
+#include "CachePrefetcher.h"
 #include "catapult/cache_core/AccountStateCache.h"
 
 namespace catapult { namespace chain {
@@ -46,6 +47,13 @@ namespace catapult { namespace chain {
 			for (const auto& entityInfo : entityInfos)
 				observer.notify(entityInfo, context);
 		}
+
+		void PrefetchAll(const BlockExecutionContext& executionContext, const model::WeakEntityInfos& entityInfos) {
+			if (!executionContext.pPrefetchPublisher)
+				return;
+
+			PrefetchCacheEntries(*executionContext.pPrefetchPublisher, executionContext.Resolvers, entityInfos, executionContext.State.Cache);
+		}
 	}
 
 	void ExecuteBlock(const model::BlockElement& blockElement, const BlockExecutionContext& executionContext) {
@@ -53,6 +61,8 @@ namespace catapult { namespace chain {
 		model::ExtractEntityInfos(blockElement, entityInfos);
 
 		executionContext.State.Cache.setHeight(blockElement.Block.Height);
+		PrefetchAll(executionContext, entityInfos);
+
 		auto context = CreateObserverContext(executionContext, blockElement.Block.Height, blockElement.Block.Timestamp, observers::NotifyMode::Commit);
 		ObserveAll(executionContext.Observer, context, entityInfos);
 	}
@@ -63,6 +73,8 @@ namespace catapult { namespace chain {
 		std::reverse(entityInfos.begin(), entityInfos.end());
 
 		executionContext.State.Cache.setHeight(blockElement.Block.Height);
+		PrefetchAll(executionContext, entityInfos);
+
 		auto context = CreateObserverContext(executionContext, blockElement.Block.Height, blockElement.Block.Timestamp, observers::NotifyMode::Rollback);
 		ObserveAll(executionContext.Observer, context, entityInfos);
 
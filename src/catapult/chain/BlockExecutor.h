@@ -23,7 +23,12 @@
 #include "catapult/observers/ObserverTypes.h"
 #include <memory>
 
-namespace catapult { namespace model { struct Block; } }
+namespace catapult {
+	namespace model {
+		struct Block;
+		class NotificationPublisher;
+	}
+}
 
 namespace catapult { namespace chain {
 	/// Block execution context.
@@ -35,10 +40,22 @@ namespace catapult { namespace chain {
 				const model::ResolverContext& resolvers,
 				const std::shared_ptr<config::BlockchainConfigurationHolder>& configHolder,
 				observers::ObserverState& state)
+				: BlockExecutionContext(observer, resolvers, configHolder, state, nullptr)
+		{}
+
+		/// Creates a block execution context around \a observer, \a resolvers, \a configHolder and \a state
+		/// that prefetches cache entries accessed by notifications published by \a pPrefetchPublisher before execution.
+		BlockExecutionContext(
+				const observers::EntityObserver& observer,
+				const model::ResolverContext& resolvers,
+				const std::shared_ptr<config::BlockchainConfigurationHolder>& configHolder,
+				observers::ObserverState& state,
+				const model::NotificationPublisher* pPrefetchPublisher)
 				: Observer(observer)
 				, Resolvers(resolvers)
 				, ConfigHolder(configHolder)
 				, State(state)
+				, pPrefetchPublisher(pPrefetchPublisher)
 		{}
 
 	public:
@@ -53,6 +70,9 @@ namespace catapult { namespace chain {
 
 		/// State to update during observation.
 		observers::ObserverState& State;
+
+		/// Optional publisher used for prefetching cache entries.
+		const model::NotificationPublisher* pPrefetchPublisher;
 	};
 
 	/// Executes \a blockElement using the specified execution context (\a executionContext).
@@ -0,0 +1,131 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "CachePrefetcher.h"
+#include "catapult/cache/CatapultCacheDelta.h"
+#include "catapult/model/ContainerTypes.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/model/ResolverContext.h"
+#include "catapult/utils/Hashers.h"
+
+namespace catapult { namespace chain {
+
+	namespace {
+		class PrefetchKeysCollector : public model::NotificationSubscriber {
+		public:
+			explicit PrefetchKeysCollector(const model::ResolverContext& resolvers) : m_resolvers(resolvers)
+			{}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				switch (notification.Type) {
+				case model::Core_Register_Account_Address_v1_Notification:
+					addAddress(static_cast<const model::AccountAddressNotification<1>&>(notification).Address);
+					break;
+
+				case model::Core_Register_Account_Public_Key_v1_Notification:
+					addPublicKey(static_cast<const model::AccountPublicKeyNotification<1>&>(notification).PublicKey);
+					break;
+
+				case model::Core_Balance_Transfer_v1_Notification: {
+					const auto& transfer = static_cast<const model::BalanceTransferNotification<1>&>(notification);
+					addBalanceChange(transfer);
+					addAddress(transfer.Recipient);
+					break;
+				}
+
+				case model::Core_Balance_Debit_v1_Notification:
+					addBalanceChange(static_cast<const model::BalanceDebitNotification<1>&>(notification));
+					break;
+
+				case model::Core_Balance_Credit_v1_Notification:
+					addBalanceChange(static_cast<const model::BalanceCreditNotification<1>&>(notification));
+					break;
+
+				case model::Core_Mosaic_Required_v1_Notification: {
+					const auto& mosaicRequired = static_cast<const model::MosaicRequiredNotification<1>&>(notification);
+					addPublicKey(mosaicRequired.Signer);
+					if (model::MosaicRequiredNotification<1>::MosaicType::Resolved == mosaicRequired.ProvidedMosaicType)
+						m_mosaicIds.insert(mosaicRequired.MosaicId);
+					else
+						addMosaicId(mosaicRequired.UnresolvedMosaicId);
+					break;
+				}
+
+				case model::Core_Block_v1_Notification: {
+					const auto& block = static_cast<const model::BlockNotification<1>&>(notification);
+					addPublicKey(block.Signer);
+					addPublicKey(block.Beneficiary);
+					break;
+				}
+
+				case model::Core_Transaction_v1_Notification:
+					addPublicKey(static_cast<const model::TransactionNotification<1>&>(notification).Signer);
+					break;
+
+				default:
+					break;
+				}
+			}
+
+		public:
+			cache::CachePrefetchKeys keys() const {
+				cache::CachePrefetchKeys keys;
+				keys.PublicKeys.assign(m_publicKeys.cbegin(), m_publicKeys.cend());
+				keys.Addresses.assign(m_addresses.cbegin(), m_addresses.cend());
+				keys.MosaicIds.assign(m_mosaicIds.cbegin(), m_mosaicIds.cend());
+				return keys;
+			}
+
+		private:
+			template<typename TNotification>
+			void addBalanceChange(const model::BasicBalanceNotification<TNotification>& notification) {
+				addPublicKey(notification.Sender);
+				addMosaicId(notification.MosaicId);
+			}
+
+			void addPublicKey(const Key& publicKey) {
+				m_publicKeys.insert(publicKey);
+			}
+
+			// aliases are resolved against the state preceding the entities, so a stale resolution only results in a
+			// superfluous or missing prefetch and never affects execution
+			void addAddress(const UnresolvedAddress& address) {
+				m_addresses.insert(m_resolvers.resolve(address));
+			}
+
+			void addMosaicId(UnresolvedMosaicId mosaicId) {
+				m_mosaicIds.insert(m_resolvers.resolve(mosaicId));
+			}
+
+		private:
+			const model::ResolverContext& m_resolvers;
+			model::PublicKeySet m_publicKeys;
+			model::AddressSet m_addresses;
+			std::unordered_set<MosaicId, utils::BaseValueHasher<MosaicId>> m_mosaicIds;
+		};
+	}
+
+	cache::CachePrefetchKeys CollectCachePrefetchKeys(
+			const model::NotificationPublisher& publisher,
+			const model::ResolverContext& resolvers,
+			const model::WeakEntityInfos& entityInfos) {
+		PrefetchKeysCollector collector(resolvers);
+		for (const auto& entityInfo : entityInfos)
+			publisher.publish(entityInfo, collector);
+
+		return collector.keys();
+	}
+
+	void PrefetchCacheEntries(
+			const model::NotificationPublisher& publisher,
+			const model::ResolverContext& resolvers,
+			const model::WeakEntityInfos& entityInfos,
+			cache::CatapultCacheDelta& cache) {
+		cache.prefetch(CollectCachePrefetchKeys(publisher, resolvers, entityInfos));
+	}
+}}
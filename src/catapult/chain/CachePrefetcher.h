@@ -0,0 +1,35 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#pragma once
+#include "catapult/cache/CachePrefetchKeys.h"
+#include "catapult/model/WeakEntityInfo.h"
+
+namespace catapult {
+	namespace cache { class CatapultCacheDelta; }
+	namespace model {
+		class NotificationPublisher;
+		class ResolverContext;
+	}
+}
+
+namespace catapult { namespace chain {
+
+	/// Collects the keys of all cache entries that are accessed by the notifications
+	/// published by \a publisher for \a entityInfos using \a resolvers to resolve aliases.
+	cache::CachePrefetchKeys CollectCachePrefetchKeys(
+			const model::NotificationPublisher& publisher,
+			const model::ResolverContext& resolvers,
+			const model::WeakEntityInfos& entityInfos);
+
+	/// Loads all cache entries that are accessed by the notifications published by \a publisher for \a entityInfos
+	/// into \a cache before \a entityInfos are executed using \a resolvers to resolve aliases.
+	void PrefetchCacheEntries(
+			const model::NotificationPublisher& publisher,
+			const model::ResolverContext& resolvers,
+			const model::WeakEntityInfos& entityInfos,
+			cache::CatapultCacheDelta& cache);
+}}
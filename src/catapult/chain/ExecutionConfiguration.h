@@ -59,6 +59,9 @@ namespace catapult { namespace chain {
 		/// Notification publisher.
 		PublisherPointer pNotificationPublisher;
 
+		/// Optional notification publisher used for prefetching cache entries before entities are processed.
+		PublisherPointer pPrefetchPublisher;
+
 		/// Resolver context factory.
 		ResolverContextFactoryFunc ResolverContextFactory;
 
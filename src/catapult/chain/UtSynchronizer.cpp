@@ -21,6 +21,7 @@
 #include "UtSynchronizer.h"
 #include "EntitiesSynchronizer.h"
 #include "catapult/api/RemoteTransactionApi.h"
+#include "catapult/utils/ShortHashSketch.h"
 
 namespace catapult { namespace chain {
 
@@ -35,16 +36,35 @@ namespace catapult { namespace chain {
 					const MinFeeMultiplierSupplier& minFeeMultiplierSupplier,
 					const ShortHashesSupplier& shortHashesSupplier,
 					const handlers::TransactionRangeHandler& transactionRangeConsumer,
-					size_t batchSize)
+					size_t batchSize,
+					size_t numSketchCells)
 					: m_minFeeMultiplierSupplier(minFeeMultiplierSupplier)
 					, m_shortHashesSupplier(shortHashesSupplier)
 					, m_transactionRangeConsumer(transactionRangeConsumer)
 					, m_batchSize(batchSize)
+					, m_numSketchCells(numSketchCells)
 			{}
 
 		public:
 			thread::future<std::vector<model::TransactionRange>> apiCall(const RemoteApiType& api) const {
-				return api.unconfirmedTransactions(m_minFeeMultiplierSupplier(), m_shortHashesSupplier(), m_batchSize);
+				auto minFeeMultiplier = m_minFeeMultiplierSupplier();
+				if (0 == m_numSketchCells)
+					return api.unconfirmedTransactions(minFeeMultiplier, m_shortHashesSupplier(), m_batchSize);
+
+				utils::ShortHashSketch sketch(m_numSketchCells);
+				for (auto shortHash : m_shortHashesSupplier())
+					sketch.insert(shortHash);
+
+				auto sketchFuture = api.unconfirmedTransactions(minFeeMultiplier, sketch, m_batchSize);
+				return thread::compose(std::move(sketchFuture), [this, &api, minFeeMultiplier](auto&& resultFuture) {
+					auto result = resultFuture.get();
+					if (result.IsDecoded)
+						return thread::make_ready_future(std::move(result.Transactions));
+
+					// fall back to sending all short hashes when the difference is too large to be decoded
+					CATAPULT_LOG(debug) << "peer was unable to decode " << Name << " sketch, requesting with all short hashes";
+					return api.unconfirmedTransactions(minFeeMultiplier, m_shortHashesSupplier(), m_batchSize);
+				});
 			}
 
 			void consume(std::vector<model::TransactionRange>&& ranges, const Key& sourcePublicKey) const {
@@ -65,6 +85,7 @@ namespace catapult { namespace chain {
 			ShortHashesSupplier m_shortHashesSupplier;
 			handlers::TransactionRangeHandler m_transactionRangeConsumer;
 			size_t m_batchSize;
+			size_t m_numSketchCells;
 		};
 	}
 
@@ -72,8 +93,9 @@ namespace catapult { namespace chain {
 			const MinFeeMultiplierSupplier& minFeeMultiplierSupplier,
 			const ShortHashesSupplier& shortHashesSupplier,
 			const handlers::TransactionRangeHandler& transactionRangeConsumer,
-			size_t batchSize) {
-		auto traits = UtTraits(minFeeMultiplierSupplier, shortHashesSupplier, transactionRangeConsumer, batchSize);
+			size_t batchSize,
+			size_t numSketchCells) {
+		auto traits = UtTraits(minFeeMultiplierSupplier, shortHashesSupplier, transactionRangeConsumer, batchSize, numSketchCells);
 		auto pSynchronizer = std::make_shared<EntitiesSynchronizer<UtTraits>>(std::move(traits));
 		return CreateRemoteNodeSynchronizer(pSynchronizer);
 	}
@@ -35,9 +35,12 @@ namespace catapult { namespace chain {
 
 	/// Creates an unconfirmed transactions synchronizer around the specified short hashes supplier (\a shortHashesSupplier)
 	/// and transaction range consumer (\a transactionRangeConsumer) for transactions with fee multipliers at least provided by \a minFeeMultiplierSupplier.
+	/// \note When \a numSketchCells is nonzero, known short hashes are sent as a sketch with (at least) \a numSketchCells cells
+	///       and the full short hashes are only sent when the remote is unable to decode the sketch.
 	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtSynchronizer(
 		const MinFeeMultiplierSupplier& minFeeMultiplierSupplier,
 		const ShortHashesSupplier& shortHashesSupplier,
 		const handlers::TransactionRangeHandler& transactionRangeConsumer,
-		size_t batchSize);
+		size_t batchSize,
+		size_t numSketchCells = 0);
 }}
@@ -39,14 +39,19 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(DbrbPort);
 		LOAD_NODE_PROPERTY(ShouldAllowAddressReuse);
 		LOAD_NODE_PROPERTY(ShouldUseSingleThreadPool);
+		LOAD_NODE_PROPERTY(ShouldUseShardedThreadPool);
+		LOAD_NODE_PROPERTY(ShouldPinThreadPoolThreads);
 		LOAD_NODE_PROPERTY(ShouldUseCacheDatabaseStorage);
 		LOAD_NODE_PROPERTY(ShouldEnableAutoSyncCleanup);
+		LOAD_NODE_PROPERTY(ShouldCompressStateChanges);
+		LOAD_NODE_PROPERTY(MaxStateFileThreads);
 
 		LOAD_NODE_PROPERTY(ShouldEnableTransactionSpamThrottling);
 		LOAD_NODE_PROPERTY(TransactionSpamThrottlingMaxBoostFee);
 
 		LOAD_NODE_PROPERTY(MaxBlocksPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxChainBytesPerSyncAttempt);
+		LOAD_NODE_PROPERTY(BlockStorageCacheMaxSize);
 
 		LOAD_NODE_PROPERTY(ShortLivedCacheTransactionDuration);
 		LOAD_NODE_PROPERTY(ShortLivedCacheBlockDuration);
@@ -75,14 +80,20 @@ namespace catapult { namespace config {
 
 		LOAD_NODE_PROPERTY(ShouldAbortWhenDispatcherIsFull);
 		LOAD_NODE_PROPERTY(ShouldAuditDispatcherInputs);
+		LOAD_NODE_PROPERTY(ShouldBatchVerifySignatures);
 
 		LOAD_NODE_PROPERTY(OutgoingSecurityMode);
 		LOAD_NODE_PROPERTY(IncomingSecurityModes);
 
 		LOAD_NODE_PROPERTY(MaxCacheDatabaseWriteBatchSize);
+		LOAD_NODE_PROPERTY(CacheDatabaseBlockCacheSize);
+		LOAD_NODE_PROPERTY(CacheDatabaseBloomFilterBitsPerKey);
+		LOAD_NODE_PROPERTY(CacheDatabaseCompressionMode);
+		LOAD_NODE_PROPERTY(ShouldSyncCacheDatabaseWrites);
 		LOAD_NODE_PROPERTY(MaxTrackedNodes);
 
 		LOAD_NODE_PROPERTY(TransactionBatchSize);
+		LOAD_NODE_PROPERTY(UnconfirmedTransactionsSketchCells);
 
 #undef LOAD_NODE_PROPERTY
 
@@ -114,7 +125,7 @@ namespace catapult { namespace config {
 
 #undef LOAD_IN_CONNECTIONS_PROPERTY
 
-		utils::VerifyBagSizeLte(bag, 38 + 4 + 4 + 5);
+		utils::VerifyBagSizeLte(bag, 49 + 4 + 4 + 5);
 		return config;
 	}
 
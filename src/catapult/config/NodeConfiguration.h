@@ -22,6 +22,7 @@
 #include "catapult/ionet/ConnectionSecurityMode.h"
 #include "catapult/ionet/NodeRoles.h"
 #include "catapult/model/TransactionSelectionStrategy.h"
+#include "catapult/utils/CompressionMode.h"
 #include "catapult/utils/FileSize.h"
 #include "catapult/utils/TimeSpan.h"
 
@@ -47,6 +48,12 @@ namespace catapult { namespace config {
 		/// \c true if a single thread pool should be used, \c false if multiple thread pools should be used.
 		bool ShouldUseSingleThreadPool;
 
+		/// \c true if each thread pool worker thread should run its own io context instead of sharing one.
+		bool ShouldUseShardedThreadPool;
+
+		/// \c true if thread pool worker threads should be pinned to cpu cores.
+		bool ShouldPinThreadPoolThreads;
+
 		/// \c true if cache data should be saved in a database.
 		bool ShouldUseCacheDatabaseStorage;
 
@@ -54,6 +61,12 @@ namespace catapult { namespace config {
 		/// \note This should be \c false if broker process is running.
 		bool ShouldEnableAutoSyncCleanup;
 
+		/// \c true if state changes spooled to the broker should be compressed.
+		bool ShouldCompressStateChanges;
+
+		/// Maximum number of threads used for loading and saving sub cache state files.
+		uint32_t MaxStateFileThreads;
+
 		/// \c true if transaction spam throttling should be enabled.
 		bool ShouldEnableTransactionSpamThrottling;
 
@@ -66,6 +79,10 @@ namespace catapult { namespace config {
 		/// Maximum chain bytes per sync attempt.
 		utils::FileSize MaxChainBytesPerSyncAttempt{};
 
+		/// Maximum size of recently loaded block elements and statements cached in memory.
+		/// \note \c 0 will only cache the most recent block element.
+		utils::FileSize BlockStorageCacheMaxSize{};
+
 		/// Duration of a transaction in the short lived cache.
 		utils::TimeSpan ShortLivedCacheTransactionDuration{};
 
@@ -135,6 +152,11 @@ namespace catapult { namespace config {
 		/// \c true if all dispatcher inputs should be audited.
 		bool ShouldAuditDispatcherInputs;
 
+		/// \c true if signatures should be batch verified by the dispatchers ahead of stateless validation.
+		/// \note Batch verification uses the cofactored equation of crypto::VerifyMulti, which also accepts signatures
+		///       with small order components that are rejected by crypto::Verify.
+		bool ShouldBatchVerifySignatures;
+
 		/// Security mode of outgoing connections initiated by this node.
 		ionet::ConnectionSecurityMode OutgoingSecurityMode{};
 
@@ -144,12 +166,29 @@ namespace catapult { namespace config {
 		/// Maximum cache database write batch size.
 		utils::FileSize MaxCacheDatabaseWriteBatchSize{};
 
+		/// Size of the block cache shared by all cache databases.
+		/// \note \c 0 will use a default block cache per column.
+		utils::FileSize CacheDatabaseBlockCacheSize{};
+
+		/// Number of cache database bloom filter bits per key.
+		/// \note \c 0 will disable bloom filters.
+		uint32_t CacheDatabaseBloomFilterBitsPerKey;
+
+		/// Cache database compression mode.
+		utils::CompressionMode CacheDatabaseCompressionMode{};
+
+		/// \c true if cache database writes should be synced to disk.
+		bool ShouldSyncCacheDatabaseWrites;
+
 		/// Maximum number of nodes to track in memory.
 		uint32_t MaxTrackedNodes;
 
 		/// Maximum number of transactions put into transaction range consumer at a time.
 		uint16_t TransactionBatchSize;
 
+		/// Number of cells in the short hash sketch sent when pulling unconfirmed transactions (\c 0 to always send all short hashes).
+		uint32_t UnconfirmedTransactionsSketchCells;
+
 	public:
 		/// Local node configuration.
 		struct LocalSubConfiguration {
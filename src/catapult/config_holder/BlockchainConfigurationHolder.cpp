@@ -6,12 +6,90 @@
 
 #include "BlockchainConfigurationHolder.h"
 #include "catapult/cache/CatapultCache.h"
+#include <algorithm>
 
 namespace catapult { namespace config {
 
+	namespace {
+		uint64_t NextHolderId() {
+			// ids are never reused, so thread local caches can't mix up holders that share an address
+			static std::atomic<uint64_t> nextId(1);
+			return nextId++;
+		}
+	}
+
+	// region ConfigMap
+
+	BlockchainConfigurationHolder::ConfigMap::ConfigMap() : m_snapshotVersion(0) {
+		publish();
+	}
+
+	bool BlockchainConfigurationHolder::ConfigMap::empty() const {
+		return m_configs.empty();
+	}
+
+	size_t BlockchainConfigurationHolder::ConfigMap::size() const {
+		return m_configs.size();
+	}
+
+	BlockchainConfigurationHolder::ConfigMap::MapType::const_iterator BlockchainConfigurationHolder::ConfigMap::begin() const {
+		return m_configs.cbegin();
+	}
+
+	BlockchainConfigurationHolder::ConfigMap::MapType::const_iterator BlockchainConfigurationHolder::ConfigMap::end() const {
+		return m_configs.cend();
+	}
+
+	BlockchainConfigurationHolder::ConfigMap::MapType::const_iterator BlockchainConfigurationHolder::ConfigMap::find(
+			const Height& height) const {
+		return m_configs.find(height);
+	}
+
+	BlockchainConfigurationHolder::ConfigMap::MapType::const_iterator BlockchainConfigurationHolder::ConfigMap::lower_bound(
+			const Height& height) const {
+		return m_configs.lower_bound(height);
+	}
+
+	const BlockchainConfiguration& BlockchainConfigurationHolder::ConfigMap::at(const Height& height) const {
+		return *m_configs.at(height);
+	}
+
+	void BlockchainConfigurationHolder::ConfigMap::set(const Height& height, const BlockchainConfiguration& config) {
+		// a replaced config is kept alive by the snapshots that still reference it
+		m_configs[height] = std::make_shared<const BlockchainConfiguration>(config);
+		publish();
+	}
+
+	size_t BlockchainConfigurationHolder::ConfigMap::erase(const Height& height) {
+		auto numErased = m_configs.erase(height);
+		publish();
+		return numErased;
+	}
+
+	uint64_t BlockchainConfigurationHolder::ConfigMap::snapshotVersion() const {
+		return m_snapshotVersion.load(std::memory_order_acquire);
+	}
+
+	std::shared_ptr<const BlockchainConfigurationHolder::ConfigMap::Snapshot> BlockchainConfigurationHolder::ConfigMap::snapshot() const {
+		return std::atomic_load(&m_pSnapshot);
+	}
+
+	void BlockchainConfigurationHolder::ConfigMap::publish() {
+		auto pSnapshot = std::make_shared<Snapshot>();
+		pSnapshot->Configs.reserve(m_configs.size());
+		for (const auto& [height, pConfig] : m_configs)
+			pSnapshot->Configs.emplace_back(height, pConfig);
+
+		std::atomic_store(&m_pSnapshot, std::shared_ptr<const Snapshot>(std::move(pSnapshot)));
+		m_snapshotVersion.fetch_add(1, std::memory_order_release);
+	}
+
+	// endregion
+
 	BlockchainConfigurationHolder::BlockchainConfigurationHolder(cache::CatapultCache* pCache)
 			: m_pCache(pCache)
-			, m_pluginInitializer([](auto&) {}) {
+			, m_pluginInitializer([](auto&) {})
+			, m_id(NextHolderId()) {
 		auto config = BlockchainConfiguration{
 			ImmutableConfiguration::Uninitialized(),
 			model::NetworkConfiguration::Uninitialized(),
@@ -23,23 +101,25 @@ namespace catapult { namespace config {
 			SupportedEntityVersions()
 		};
 		m_InflationCalculator = model::InflationCalculator();
-		m_configs.insert({ Height(0), config });
+		m_configs.set(Height(0), config);
 	}
 
 	BlockchainConfigurationHolder::BlockchainConfigurationHolder(const BlockchainConfiguration& config)
 			:  m_pCache(nullptr)
-			, m_pluginInitializer([](auto&) {}){
+			, m_pluginInitializer([](auto&) {})
+			, m_id(NextHolderId()) {
 
-		m_configs.insert({ Height(0), config });
+		m_configs.set(Height(0), config);
 		m_InflationCalculator = model::InflationCalculator();
 	}
 
 	BlockchainConfigurationHolder::BlockchainConfigurationHolder(const BlockchainConfiguration& config, cache::CatapultCache* pCache, const Height& height)
 			:  m_pCache(pCache)
-			, m_pluginInitializer([](auto&) {}){
+			, m_pluginInitializer([](auto&) {})
+			, m_id(NextHolderId()) {
 
 
-		m_configs.insert({ height, config });
+		m_configs.set(height, config);
 		m_InflationCalculator = model::InflationCalculator();
 		if(height != Height())
 			m_InflationCalculator.add(height, config.Network.Inflation);
@@ -50,22 +130,41 @@ namespace catapult { namespace config {
 	}
 
 	const BlockchainConfiguration& BlockchainConfigurationHolder::Config(const Height& height) const {
-		std::shared_lock lock(m_mutex);
+		// the snapshot is only reloaded after it has been replaced, so most lookups don't touch shared state
+		// other than the version and consecutive lookups at the same height don't search at all
+		struct ThreadCache {
+			uint64_t HolderId = 0;
+			uint64_t SnapshotVersion = 0;
+			std::shared_ptr<const ConfigMap::Snapshot> pSnapshot;
+			catapult::Height Height;
+			const BlockchainConfiguration* pConfig = nullptr;
+		};
 
-		auto iter = m_configs.lower_bound(height);
+		thread_local ThreadCache cache;
 
-		if (iter != m_configs.end() && iter->first != height) {
-			iter = (iter == m_configs.begin()) ? m_configs.end() : --iter;
-		} else if (iter == m_configs.end()) {
-			if (!m_configs.empty()) {
-				--iter;
-			}
+		auto snapshotVersion = m_configs.snapshotVersion();
+		if (m_id != cache.HolderId || snapshotVersion != cache.SnapshotVersion) {
+			cache.pSnapshot = m_configs.snapshot();
+			cache.HolderId = m_id;
+			cache.SnapshotVersion = snapshotVersion;
+			cache.pConfig = nullptr;
 		}
 
-		if (iter == m_configs.end())
+		if (cache.pConfig && height == cache.Height)
+			return *cache.pConfig;
+
+		// find the last config at or below height
+		const auto& configs = cache.pSnapshot->Configs;
+		auto iter = std::upper_bound(configs.cbegin(), configs.cend(), height, [](const auto& lookupHeight, const auto& pair) {
+			return lookupHeight < pair.first;
+		});
+
+		if (configs.cbegin() == iter)
 			CATAPULT_THROW_INVALID_ARGUMENT_1("config not found at height", height);
 
-		return iter->second;
+		cache.Height = height;
+		cache.pConfig = (--iter)->second.get();
+		return *cache.pConfig;
 	}
 
 	const BlockchainConfiguration& BlockchainConfigurationHolder::Config() const {
@@ -92,7 +191,7 @@ namespace catapult { namespace config {
 		if (iter == m_configs.end())
 			return nullptr;
 
-		return &iter->second;
+		return iter->second.get();
 
 	}
 
@@ -113,8 +212,8 @@ namespace catapult { namespace config {
 			Height(0),
 			nullptr
 		);
-		m_configs.erase(Height(0));
-		m_configs.insert({ Height(0), config });
+
+		m_configs.set(Height(0), config);
 	}
 
 	void BlockchainConfigurationHolder::InsertConfig(const Height& height, const std::string& strConfig, const std::string& supportedVersion) {
@@ -151,8 +250,8 @@ namespace catapult { namespace config {
 				LastConfigOrNull(height-Height(1))
 		);
 
-		m_configs.erase(height);
-		m_configs.insert({ height, config });
+		m_configs.set(height, config);
+
 		if(height != Height() && config.Network.Inflation != m_InflationCalculator.getSpotAmount(height-Height(1)))
 			m_InflationCalculator.add(height, config.Network.Inflation);
 	}
@@ -167,8 +266,8 @@ namespace catapult { namespace config {
 	}
 
 	void BlockchainConfigurationHolder::ClearPluginConfigurations() const {
-		for (const auto& [_, config] : m_configs)
-			config.Network.ClearPluginConfigurations();
+		for (const auto& [_, pConfig] : m_configs)
+			pConfig->Network.ClearPluginConfigurations();
 	}
 
 	void BlockchainConfigurationHolder::InsertBlockchainVersion(const Height& height, const BlockchainVersion& version) {
@@ -6,8 +6,12 @@
 
 #pragma once
 #include "catapult/config/BlockchainConfiguration.h"
+#include <atomic>
+#include <map>
+#include <memory>
 #include <mutex>  // For std::unique_lock
 #include <shared_mutex>
+#include <vector>
 
 namespace catapult { namespace cache { class CatapultCache; } }
 
@@ -30,6 +34,7 @@ namespace catapult { namespace config {
 		static boost::filesystem::path GetResourcesPath(int argc, const char** argv);
 
 		/// Get \a config at \a height
+		/// \note Lookups do not lock, they use an immutable snapshot of the configs that is cached per thread.
 		virtual const BlockchainConfiguration& Config(const Height& height) const;
 
 		/// Get latest available config
@@ -62,18 +67,87 @@ namespace catapult { namespace config {
 		/// Must be used with a locked m_mutex
 		const BlockchainConfiguration* LastConfigOrNull(const Height& height) const;
 
+	protected:
+		/// Height ordered configs that publish an immutable snapshot to readers after every modification.
+		/// \note Modifications must be used with a locked m_mutex (or before the holder is shared).
+		class ConfigMap {
+		private:
+			using ConfigPointer = std::shared_ptr<const BlockchainConfiguration>;
+			using MapType = std::map<Height, ConfigPointer>;
+
+		public:
+			/// Height ordered configs, a snapshot is never modified after it has been published.
+			/// \note A snapshot shares ownership of its configs, so they outlive their removal from the map.
+			struct Snapshot {
+				std::vector<std::pair<Height, ConfigPointer>> Configs;
+			};
+
+		public:
+			/// Creates an empty map.
+			ConfigMap();
+
+		public:
+			/// Returns \c true if there are no configs.
+			bool empty() const;
+
+			/// Gets the number of configs.
+			size_t size() const;
+
+			/// Returns a const iterator to the first config.
+			MapType::const_iterator begin() const;
+
+			/// Returns a const iterator one past the last config.
+			MapType::const_iterator end() const;
+
+			/// Finds the config at \a height.
+			MapType::const_iterator find(const Height& height) const;
+
+			/// Finds the first config at or above \a height.
+			MapType::const_iterator lower_bound(const Height& height) const;
+
+			/// Gets the config at \a height or throws when there is none.
+			const BlockchainConfiguration& at(const Height& height) const;
+
+		public:
+			/// Sets the config at \a height to \a config and publishes a new snapshot.
+			void set(const Height& height, const BlockchainConfiguration& config);
+
+			/// Removes the config at \a height and publishes a new snapshot.
+			/// Returns the number of removed configs.
+			size_t erase(const Height& height);
+
+		public:
+			/// Gets the version of the current snapshot, which is changed whenever a new snapshot is published.
+			uint64_t snapshotVersion() const;
+
+			/// Gets the current snapshot.
+			std::shared_ptr<const Snapshot> snapshot() const;
+
+		private:
+			void publish();
+
+		private:
+			MapType m_configs;
+			std::shared_ptr<const Snapshot> m_pSnapshot; // must be accessed atomically
+			std::atomic<uint64_t> m_snapshotVersion;
+		};
+
 	public:
 		void InsertBlockchainVersion(const Height& height, const BlockchainVersion& version);
 		void RemoveBlockchainVersion(const Height& height);
 		BlockchainVersion Version(const Height& height);
 
 	protected:
-		std::map<Height, BlockchainConfiguration> m_configs;
+		ConfigMap m_configs;
 		cache::CatapultCache* m_pCache;
 		PluginInitializer m_pluginInitializer;
 		model::InflationCalculator m_InflationCalculator;
 		mutable std::shared_mutex m_mutex;
 
+	private:
+		uint64_t m_id;
+
+	protected:
 		std::map<Height, BlockchainVersion> m_versions;
 		mutable std::shared_mutex m_versionMutex;
 	};
@@ -29,8 +29,13 @@
 
 namespace catapult {
 	namespace chain { struct CatapultState; }
+	namespace crypto { class VerifiedSignatureCache; }
 	namespace io { class BlockStorageCache; }
-	namespace model { class TransactionRegistry; }
+	namespace model {
+		class NotificationPublisher;
+		class TransactionRegistry;
+	}
+	namespace thread { class IoThreadPool; }
 	namespace utils { class TimeSpan; }
 	namespace config { class BlockchainConfigurationHolder; }
 }
@@ -43,6 +48,13 @@ namespace catapult { namespace consumers {
 			const GenerationHash& generationHash,
 			const model::TransactionRegistry& transactionRegistry);
 
+	/// Creates a consumer that calculates hashes of all entities using \a transactionRegistry for the network with the specified
+	/// generation hash (\a generationHash). Transaction hashes are calculated in parallel using \a pPool.
+	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
+			const GenerationHash& generationHash,
+			const model::TransactionRegistry& transactionRegistry,
+			const std::shared_ptr<thread::IoThreadPool>& pPool);
+
 	/// Creates a consumer that checks entities for previous processing based on their hash.
 	/// \a timeSupplier is used for generating timestamps and \a options specifies additional cache options.
 	disruptor::ConstBlockConsumer CreateBlockHashCheckConsumer(const chain::TimeSupplier& timeSupplier, const HashCheckOptions& options);
@@ -58,6 +70,17 @@ namespace catapult { namespace consumers {
 	/// Predicate for checking whether or not an entity requires validation.
 	using RequiresValidationPredicate = model::MatchingEntityPredicate;
 
+	/// Creates a consumer that batch verifies, using \a pPool, all signatures published by \a pPublisher for entities for which
+	/// \a requiresValidationPredicate returns \c true. All valid signatures are added to \a pVerifiedSignatureCache.
+	/// Replay protected signatures are verified for the network with the specified generation hash (\a generationHash).
+	/// \note This consumer never aborts on invalid signatures, they are rejected by stateless validation.
+	disruptor::ConstBlockConsumer CreateBlockSignatureVerificationConsumer(
+			const GenerationHash& generationHash,
+			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
+			const std::shared_ptr<thread::IoThreadPool>& pPool,
+			const std::shared_ptr<crypto::VerifiedSignatureCache>& pVerifiedSignatureCache,
+			const RequiresValidationPredicate& requiresValidationPredicate);
+
 	/// Creates a consumer that runs stateless validation using \a pValidator and the specified policy
 	/// (\a pValidationPolicy). Validation will only be performed for entities for which \a requiresValidationPredicate
 	/// returns \c true.
@@ -23,15 +23,45 @@
 #include "TransactionConsumers.h"
 #include "catapult/crypto/MerkleHashBuilder.h"
 #include "catapult/model/EntityHasher.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 
 namespace catapult { namespace consumers {
 
 	namespace {
+		using TransactionElementPointers = std::vector<model::TransactionElement*>;
+
+		void UpdateAllHashes(
+				const model::TransactionRegistry& transactionRegistry,
+				const GenerationHash& generationHash,
+				const std::shared_ptr<thread::IoThreadPool>& pPool,
+				TransactionElementPointers& transactionElements) {
+			if (!pPool || transactionElements.size() < 2) {
+				for (auto* pTransactionElement : transactionElements)
+					model::UpdateHashes(transactionRegistry, generationHash, *pTransactionElement);
+
+				return;
+			}
+
+			// hashing cost is proportional to transaction size, so let idle threads pick up work behind large transactions
+			thread::ParallelForDynamic(*pPool, transactionElements, pPool->numWorkerThreads(), [](
+					const auto* pTransactionElement) {
+				return pTransactionElement->Transaction.Size;
+			}, [&transactionRegistry, &generationHash](auto* pTransactionElement, auto) {
+				model::UpdateHashes(transactionRegistry, generationHash, *pTransactionElement);
+				return true;
+			}).get();
+		}
+
 		class BlockHashCalculatorConsumer {
 		public:
-			BlockHashCalculatorConsumer(const GenerationHash& generationHash, const model::TransactionRegistry& transactionRegistry)
+			BlockHashCalculatorConsumer(
+					const GenerationHash& generationHash,
+					const model::TransactionRegistry& transactionRegistry,
+					const std::shared_ptr<thread::IoThreadPool>& pPool)
 					: m_generationHash(generationHash)
 					, m_transactionRegistry(transactionRegistry)
+					, m_pPool(pPool)
 			{}
 
 		public:
@@ -39,17 +69,26 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
+				// note that disruptor input elements have been extracted from a packet (or created within this
+				// process), so their sizes have already been validated
 				for (auto& element : elements) {
-					// note that disruptor input elements have been extracted from a packet (or created within this
-					// process), so their sizes have already been validated
-					crypto::MerkleHashBuilder transactionsHashBuilder;
-					for (const auto& transaction : element.Block.Transactions()) {
-						model::TransactionElement transactionElement(transaction);
-						model::UpdateHashes(m_transactionRegistry, m_generationHash, transactionElement);
-						element.Transactions.push_back(transactionElement);
+					for (const auto& transaction : element.Block.Transactions())
+						element.Transactions.push_back(model::TransactionElement(transaction));
+				}
 
+				// calculate all transaction hashes up front (element transactions are not modified after this point)
+				TransactionElementPointers transactionElements;
+				for (auto& element : elements) {
+					for (auto& transactionElement : element.Transactions)
+						transactionElements.push_back(&transactionElement);
+				}
+
+				UpdateAllHashes(m_transactionRegistry, m_generationHash, m_pPool, transactionElements);
+
+				for (auto& element : elements) {
+					crypto::MerkleHashBuilder transactionsHashBuilder;
+					for (const auto& transactionElement : element.Transactions)
 						transactionsHashBuilder.update(transactionElement.MerkleComponentHash);
-					}
 
 					Hash256 transactionsHash;
 					transactionsHashBuilder.final(transactionsHash);
@@ -65,21 +104,33 @@ namespace catapult { namespace consumers {
 		private:
 			GenerationHash m_generationHash;
 			const model::TransactionRegistry& m_transactionRegistry;
+			std::shared_ptr<thread::IoThreadPool> m_pPool;
 		};
 	}
 
 	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
 			const GenerationHash& generationHash,
 			const model::TransactionRegistry& transactionRegistry) {
-		return BlockHashCalculatorConsumer(generationHash, transactionRegistry);
+		return BlockHashCalculatorConsumer(generationHash, transactionRegistry, nullptr);
+	}
+
+	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
+			const GenerationHash& generationHash,
+			const model::TransactionRegistry& transactionRegistry,
+			const std::shared_ptr<thread::IoThreadPool>& pPool) {
+		return BlockHashCalculatorConsumer(generationHash, transactionRegistry, pPool);
 	}
 
 	namespace {
 		class TransactionHashCalculatorConsumer {
 		public:
-			TransactionHashCalculatorConsumer(const GenerationHash& generationHash, const model::TransactionRegistry& transactionRegistry)
+			TransactionHashCalculatorConsumer(
+					const GenerationHash& generationHash,
+					const model::TransactionRegistry& transactionRegistry,
+					const std::shared_ptr<thread::IoThreadPool>& pPool)
 					: m_generationHash(generationHash)
 					, m_transactionRegistry(transactionRegistry)
+					, m_pPool(pPool)
 			{}
 
 		public:
@@ -87,21 +138,31 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
+				TransactionElementPointers transactionElements;
 				for (auto& element : elements)
-					model::UpdateHashes(m_transactionRegistry, m_generationHash, element);
+					transactionElements.push_back(&element);
 
+				UpdateAllHashes(m_transactionRegistry, m_generationHash, m_pPool, transactionElements);
 				return Continue();
 			}
 
 		private:
 			GenerationHash m_generationHash;
 			const model::TransactionRegistry& m_transactionRegistry;
+			std::shared_ptr<thread::IoThreadPool> m_pPool;
 		};
 	}
 
 	disruptor::TransactionConsumer CreateTransactionHashCalculatorConsumer(
 			const GenerationHash& generationHash,
 			const model::TransactionRegistry& transactionRegistry) {
-		return TransactionHashCalculatorConsumer(generationHash, transactionRegistry);
+		return TransactionHashCalculatorConsumer(generationHash, transactionRegistry, nullptr);
+	}
+
+	disruptor::TransactionConsumer CreateTransactionHashCalculatorConsumer(
+			const GenerationHash& generationHash,
+			const model::TransactionRegistry& transactionRegistry,
+			const std::shared_ptr<thread::IoThreadPool>& pPool) {
+		return TransactionHashCalculatorConsumer(generationHash, transactionRegistry, pPool);
 	}
 }}
@@ -0,0 +1,139 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "BlockConsumers.h"
+#include "ConsumerResultFactory.h"
+#include "TransactionConsumers.h"
+#include "catapult/crypto/VerifiedSignatureCache.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+
+namespace catapult { namespace consumers {
+
+	namespace {
+		/// Minimum number of signatures verified by a single pool thread.
+		constexpr size_t Min_Signatures_Per_Partition = 16;
+
+		class SignatureCollector : public model::NotificationSubscriber {
+		public:
+			SignatureCollector(const GenerationHash& generationHash, std::vector<crypto::SignatureInput>& signatureInputs)
+					: m_generationHash(generationHash)
+					, m_signatureInputs(signatureInputs)
+			{}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				if (model::Core_Signature_v1_Notification != notification.Type)
+					return;
+
+				// notice that the signer, signature and data of all signature notifications reference the published entity,
+				// so they remain valid after notify returns
+				using SignatureNotification = model::SignatureNotification<1>;
+				const auto& signatureNotification = static_cast<const SignatureNotification&>(notification);
+				if (SignatureNotification::ReplayProtectionMode::Enabled == signatureNotification.DataReplayProtectionMode) {
+					m_signatureInputs.push_back({
+						signatureNotification.Signer,
+						{ m_generationHash, signatureNotification.Data },
+						signatureNotification.Signature
+					});
+				} else {
+					m_signatureInputs.push_back({ signatureNotification.Signer, { signatureNotification.Data }, signatureNotification.Signature });
+				}
+			}
+
+		private:
+			const GenerationHash& m_generationHash;
+			std::vector<crypto::SignatureInput>& m_signatureInputs;
+		};
+
+		class SignatureVerifier {
+		public:
+			SignatureVerifier(
+					const GenerationHash& generationHash,
+					const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
+					const std::shared_ptr<thread::IoThreadPool>& pPool,
+					const std::shared_ptr<crypto::VerifiedSignatureCache>& pVerifiedSignatureCache)
+					: m_generationHash(generationHash)
+					, m_pPublisher(pPublisher)
+					, m_pPool(pPool)
+					, m_pVerifiedSignatureCache(pVerifiedSignatureCache)
+			{}
+
+		public:
+			void verify(const model::WeakEntityInfos& entityInfos) const {
+				std::vector<crypto::SignatureInput> signatureInputs;
+				SignatureCollector collector(m_generationHash, signatureInputs);
+				for (const auto& entityInfo : entityInfos)
+					m_pPublisher->publish(entityInfo, collector);
+
+				if (signatureInputs.empty())
+					return;
+
+				// invalid signatures are not added to the cache, so they are verified (and rejected) again by the signature validator
+				auto numPartitions = std::min<size_t>(
+						m_pPool->numWorkerThreads(),
+						(signatureInputs.size() + Min_Signatures_Per_Partition - 1) / Min_Signatures_Per_Partition);
+				auto& verifiedSignatureCache = *m_pVerifiedSignatureCache;
+				thread::ParallelForPartition(*m_pPool, signatureInputs, numPartitions, [&verifiedSignatureCache](
+						auto itBegin,
+						auto itEnd,
+						auto,
+						auto) {
+					auto count = static_cast<size_t>(std::distance(itBegin, itEnd));
+					auto results = crypto::VerifyMulti(crypto::SecureRandomFill, &*itBegin, count);
+					for (auto i = 0u; i < count; ++i) {
+						if (results.first[i])
+							verifiedSignatureCache.add(*(itBegin + static_cast<std::ptrdiff_t>(i)));
+					}
+				}).get();
+			}
+
+		private:
+			GenerationHash m_generationHash;
+			std::shared_ptr<const model::NotificationPublisher> m_pPublisher;
+			std::shared_ptr<thread::IoThreadPool> m_pPool;
+			std::shared_ptr<crypto::VerifiedSignatureCache> m_pVerifiedSignatureCache;
+		};
+	}
+
+	disruptor::ConstBlockConsumer CreateBlockSignatureVerificationConsumer(
+			const GenerationHash& generationHash,
+			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
+			const std::shared_ptr<thread::IoThreadPool>& pPool,
+			const std::shared_ptr<crypto::VerifiedSignatureCache>& pVerifiedSignatureCache,
+			const RequiresValidationPredicate& requiresValidationPredicate) {
+		SignatureVerifier verifier(generationHash, pPublisher, pPool, pVerifiedSignatureCache);
+		return [verifier, requiresValidationPredicate](const auto& elements) {
+			if (elements.empty())
+				return Abort(Failure_Consumer_Empty_Input);
+
+			model::WeakEntityInfos entityInfos;
+			ExtractMatchingEntityInfos(elements, entityInfos, requiresValidationPredicate);
+			verifier.verify(entityInfos);
+			return Continue();
+		};
+	}
+
+	disruptor::TransactionConsumer CreateTransactionSignatureVerificationConsumer(
+			const GenerationHash& generationHash,
+			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
+			const std::shared_ptr<thread::IoThreadPool>& pPool,
+			const std::shared_ptr<crypto::VerifiedSignatureCache>& pVerifiedSignatureCache) {
+		SignatureVerifier verifier(generationHash, pPublisher, pPool, pVerifiedSignatureCache);
+		return [verifier](auto& elements) {
+			if (elements.empty())
+				return Abort(Failure_Consumer_Empty_Input);
+
+			model::WeakEntityInfos entityInfos;
+			std::vector<size_t> entityInfoElementIndexes;
+			ExtractEntityInfos(elements, entityInfos, entityInfoElementIndexes, config::HEIGHT_OF_LATEST_CONFIG);
+			verifier.verify(entityInfos);
+			return Continue();
+		};
+	}
+}}
@@ -26,7 +26,11 @@
 #include "catapult/model/EntityInfo.h"
 #include "catapult/validators/ParallelValidationPolicy.h"
 
-namespace catapult { namespace model { class NotificationPublisher; } }
+namespace catapult {
+	namespace crypto { class VerifiedSignatureCache; }
+	namespace model { class NotificationPublisher; }
+	namespace thread { class IoThreadPool; }
+}
 
 namespace catapult { namespace consumers {
 
@@ -36,6 +40,13 @@ namespace catapult { namespace consumers {
 			const GenerationHash& generationHash,
 			const model::TransactionRegistry& transactionRegistry);
 
+	/// Creates a consumer that calculates hashes of all entities using \a transactionRegistry for the network with the specified
+	/// generation hash (\a generationHash). Hashes are calculated in parallel using \a pPool.
+	disruptor::TransactionConsumer CreateTransactionHashCalculatorConsumer(
+			const GenerationHash& generationHash,
+			const model::TransactionRegistry& transactionRegistry,
+			const std::shared_ptr<thread::IoThreadPool>& pPool);
+
 	/// Creates a consumer that checks entities for previous processing based on their hash.
 	/// \a timeSupplier is used for generating timestamps and \a options specifies additional cache options.
 	/// \a knownHashPredicate returns \c true for known hashes.
@@ -44,6 +55,16 @@ namespace catapult { namespace consumers {
 			const HashCheckOptions& options,
 			const chain::KnownHashPredicate& knownHashPredicate);
 
+	/// Creates a consumer that batch verifies, using \a pPool, all signatures published by \a pPublisher for all non-skipped
+	/// transactions. All valid signatures are added to \a pVerifiedSignatureCache.
+	/// Replay protected signatures are verified for the network with the specified generation hash (\a generationHash).
+	/// \note This consumer never skips transactions with invalid signatures, they are rejected by stateless validation.
+	disruptor::TransactionConsumer CreateTransactionSignatureVerificationConsumer(
+			const GenerationHash& generationHash,
+			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
+			const std::shared_ptr<thread::IoThreadPool>& pPool,
+			const std::shared_ptr<crypto::VerifiedSignatureCache>& pVerifiedSignatureCache);
+
 	/// Creates a consumer that runs stateless validation using \a pValidator and the specified policy
 	/// (\a pValidationPolicy) and calls \a failedTransactionSink for each failure.
 	disruptor::TransactionConsumer CreateTransactionStatelessValidationConsumer(
@@ -23,6 +23,7 @@
 #include "Hashes.h"
 #include "catapult/exceptions.h"
 #include <ref10/crypto_verify_32.h>
+#include <openssl/rand.h>
 
 extern "C" {
 #include <ref10/ge.h>
@@ -41,6 +42,7 @@ namespace catapult { namespace crypto {
 	namespace {
 		const std::string FILECOIN_DST("BLS_SIG_BLS12381G2_XMD:SHA-256_SSWU_RO_NUL_");
 		const std::string ETH2_DST("BLS_SIG_BLS12381G2_XMD:SHA-256_SSWU_RO_POP_");
+		const std::string POP_DST("BLS_POP_BLS12381G2_XMD:SHA-256_SSWU_RO_POP_");
 
 		const size_t Encoded_Size = Signature_Size / 2;
 		static_assert(Encoded_Size * 2 == Hash512_Size, "hash must be big enough to hold two encoded elements");
@@ -136,14 +138,24 @@ namespace catapult { namespace crypto {
 		CheckEncodedS(encodedS);
 	}
 
+	namespace {
+		void Sign(const BLSKeyPair& keyPair, const RawBuffer& message, const std::string& dst, BLSSignature& computedSignature) {
+			blst::blst_p2 hash_point;
+			blst::blst_hash_to_g2(&hash_point, message.pData, message.Size,
+								  reinterpret_cast<const uint8_t*>(dst.data()), dst.size());
+			const auto* temp = reinterpret_cast<const blst::blst_scalar*>(&keyPair.privateKey().m_array);
+			blst::blst_p2_affine out_point;
+			blst::blst_sign_pk2_in_g1(nullptr, &out_point, &hash_point, temp);
+			blst::blst_p2_affine_compress(computedSignature.m_array, &out_point);
+		}
+	}
+
 	void Sign(const BLSKeyPair& keyPair, const RawBuffer& message, BLSSignature& computedSignature) {
-		blst::blst_p2 hash_point;
-		blst::blst_hash_to_g2(&hash_point, message.pData, message.Size,
-							  reinterpret_cast<const uint8_t*>(FILECOIN_DST.data()), FILECOIN_DST.size());
-		const auto* temp = reinterpret_cast<const blst::blst_scalar*>(&keyPair.privateKey().m_array);
-		blst::blst_p2_affine out_point;
-		blst::blst_sign_pk2_in_g1(nullptr, &out_point, &hash_point, temp);
-		blst::blst_p2_affine_compress(computedSignature.m_array, &out_point);
+		Sign(keyPair, message, FILECOIN_DST, computedSignature);
+	}
+
+	void ProvePossession(const BLSKeyPair& keyPair, BLSSignature& proof) {
+		Sign(keyPair, keyPair.publicKey(), POP_DST, proof);
 	}
 
 	bool Verify(const Key& publicKey, const RawBuffer& dataBuffer, const Signature& signature) {
@@ -187,20 +199,374 @@ namespace catapult { namespace crypto {
 		return 0 == crypto_verify_32(checkr, encodedR);
 	}
 
-	bool Verify(const BLSPublicKey& publicKey, const RawBuffer& dataBuffer, const BLSSignature& signature) {
-		blst::P2_Affine sig;
-		auto res = sig.uncompress(signature.m_array);
-		if (res != blst::BLST_SUCCESS) {
-			CATAPULT_LOG(error) << "can't uncompress signature " << signature;
-			return false;
+	namespace {
+		// region batch verification
+
+		/// Maximum number of signatures verified by a single multi-scalar multiplication.
+		constexpr size_t Max_Batch_Size = 64;
+
+		/// Number of random bytes used for each batch coefficient.
+		constexpr size_t Batch_Coefficient_Size = 16;
+
+		using Scalar = std::array<uint8_t, Encoded_Size>;
+
+		/// Signature input with all per-signature work (hashing, point decoding) already performed.
+		struct PreparedSignature {
+			/// Negated public key (-A).
+			ge_p3 NegatedPublicKey;
+
+			/// Negated encoded R part of the signature (-R).
+			ge_p3 NegatedR;
+
+			/// Reduced h = H(encodedR || public || data).
+			Scalar H;
+
+			/// Encoded S part of the signature.
+			const uint8_t* pEncodedS;
+
+			/// Encoded R part of the signature.
+			const uint8_t* pEncodedR;
+		};
+
+		/// Point with precomputed odd multiples (P, 3P, ..., 15P) and a sliding window representation of its scalar.
+		struct MultiScalarTerm {
+			ge_cached Multiples[8];
+			signed char Slide[256];
+		};
+
+		void Slide(signed char* pSlide, const uint8_t* pScalar) {
+			// same width-5 sliding window representation as used by ge_double_scalarmult_vartime
+			for (auto i = 0; i < 256; ++i)
+				pSlide[i] = 1 & (pScalar[i >> 3] >> (i & 7));
+
+			for (auto i = 0; i < 256; ++i) {
+				if (!pSlide[i])
+					continue;
+
+				for (auto b = 1; b <= 6 && i + b < 256; ++b) {
+					if (!pSlide[i + b])
+						continue;
+
+					if (pSlide[i] + (pSlide[i + b] << b) <= 15) {
+						pSlide[i] = static_cast<signed char>(pSlide[i] + (pSlide[i + b] << b));
+						pSlide[i + b] = 0;
+					} else if (pSlide[i] - (pSlide[i + b] << b) >= -15) {
+						pSlide[i] = static_cast<signed char>(pSlide[i] - (pSlide[i + b] << b));
+						for (auto k = i + b; k < 256; ++k) {
+							if (!pSlide[k]) {
+								pSlide[k] = 1;
+								break;
+							}
+
+							pSlide[k] = 0;
+						}
+					} else {
+						break;
+					}
+				}
+			}
 		}
-		blst::P1_Affine pk;
-		res = pk.uncompress(publicKey.m_array);
-		if (res != blst::BLST_SUCCESS) {
-			CATAPULT_LOG(error) << "can't uncompress public key " << publicKey;
-			return false;
+
+		void InitTerm(MultiScalarTerm& term, const ge_p3& point, const uint8_t* pScalar) {
+			Slide(term.Slide, pScalar);
+
+			ge_p1p1 t;
+			ge_p3 u;
+			ge_p3 point2;
+			ge_p3_to_cached(&term.Multiples[0], &point);
+			ge_p3_dbl(&t, &point);
+			ge_p1p1_to_p3(&point2, &t);
+			for (auto i = 1u; i < 8; ++i) {
+				ge_add(&t, &point2, &term.Multiples[i - 1]);
+				ge_p1p1_to_p3(&u, &t);
+				ge_p3_to_cached(&term.Multiples[i], &u);
+			}
+		}
+
+		void MultiplyByCofactor(ge_p2& point) {
+			// multiplying by the cofactor (8) annihilates all small order (torsion) components
+			ge_p1p1 t;
+			for (auto i = 0; i < 3; ++i) {
+				ge_p2_dbl(&t, &point);
+				ge_p1p1_to_p2(&point, &t);
+			}
+		}
+
+		bool IsIdentity(const ge_p2& point) {
+			// the identity is (0, 1), so in projective coordinates X == 0 and Y == Z
+			fe difference;
+			fe_sub(difference, point.Y, point.Z);
+			return !fe_isnonzero(point.X) && !fe_isnonzero(difference);
+		}
+
+
+		/// Calculates sum(scalar_i * point_i) for all \a terms (Straus' interleaved sliding window method)
+		/// and returns \c true if eight times the result is the identity.
+		bool IsCofactoredMultiScalarSumIdentity(const std::vector<MultiScalarTerm>& terms) {
+			auto i = 255;
+			for (; i >= 0; --i) {
+				if (std::any_of(terms.cbegin(), terms.cend(), [i](const auto& term) { return 0 != term.Slide[i]; }))
+					break;
+			}
+
+			ge_p2 r;
+			ge_p1p1 t;
+			ge_p3 u;
+			ge_p2_0(&r);
+			for (; i >= 0; --i) {
+				ge_p2_dbl(&t, &r);
+
+				for (const auto& term : terms) {
+					auto digit = term.Slide[i];
+					if (0 == digit)
+						continue;
+
+					ge_p1p1_to_p3(&u, &t);
+					if (digit > 0)
+						ge_add(&t, &u, &term.Multiples[digit / 2]);
+					else
+						ge_sub(&t, &u, &term.Multiples[-digit / 2]);
+				}
+
+				ge_p1p1_to_p2(&r, &t);
+			}
+
+			MultiplyByCofactor(r);
+			return IsIdentity(r);
+		}
+
+		/// Prepares \a input for verification, returns \c false if \a input can be rejected without any multi-scalar multiplication.
+		/// \note All rejections mirror the rejections in Verify with the exception of small order public keys.
+		bool Prepare(const SignatureInput& input, PreparedSignature& prepared) {
+			const auto* pEncodedR = input.Signature.data();
+			const auto* pEncodedS = input.Signature.data() + Encoded_Size;
+			if (!IsCanonicalS(pEncodedS) || Key() == input.PublicKey)
+				return false;
+
+			if (0 != ge_frombytes_negate_vartime(&prepared.NegatedPublicKey, input.PublicKey.data()))
+				return false;
+
+			// the cofactored equation does not depend on h for small order public keys, so any payload would be accepted;
+			// rejecting them is safe because a rejected signature can still be checked with Verify
+			ge_p2 cofactoredPublicKey;
+			ge_p3_to_p2(&cofactoredPublicKey, &prepared.NegatedPublicKey);
+			MultiplyByCofactor(cofactoredPublicKey);
+			if (IsIdentity(cofactoredPublicKey))
+				return false;
+
+			// Verify compares the canonical encoding of the calculated R with the encoded R, so a signature can only be valid
+			// when its R part is the canonical encoding of a curve point
+			if (0 != ge_frombytes_negate_vartime(&prepared.NegatedR, pEncodedR))
+				return false;
+
+			ge_p3 r = prepared.NegatedR;
+			fe_neg(r.X, r.X);
+			fe_neg(r.T, r.T);
+			uint8_t reencodedR[Encoded_Size];
+			ge_p3_tobytes(reencodedR, &r);
+			if (0 != crypto_verify_32(reencodedR, pEncodedR))
+				return false;
+
+			Hash512 h;
+			HashBuilder hasher_h;
+			hasher_h.update({ { pEncodedR, Encoded_Size }, input.PublicKey });
+			for (const auto& buffer : input.Buffers)
+				hasher_h.update(buffer);
+
+			hasher_h.final(h);
+			sc_reduce(h.data());
+			std::memcpy(prepared.H.data(), h.data(), Encoded_Size);
+
+			prepared.pEncodedS = pEncodedS;
+			prepared.pEncodedR = pEncodedR;
+			return true;
+		}
+
+		/// Checks 8 * (S * B - h * A) == 8 * R for a single signature (\a prepared).
+		bool VerifySingle(const PreparedSignature& prepared) {
+			// calculatedR = encodedS * B - h * A
+			ge_p2 calculatedR;
+			ge_double_scalarmult_vartime(&calculatedR, prepared.H.data(), &prepared.NegatedPublicKey, prepared.pEncodedS);
+
+			ge_p2 negatedR;
+			ge_p3_to_p2(&negatedR, &prepared.NegatedR);
+
+			MultiplyByCofactor(calculatedR);
+			MultiplyByCofactor(negatedR);
+
+			// compare projective coordinates without inversions, notice that negation only flips the sign of X
+			fe lhs;
+			fe rhs;
+			fe difference;
+			fe_mul(lhs, calculatedR.X, negatedR.Z);
+			fe_mul(rhs, negatedR.X, calculatedR.Z);
+			fe_add(difference, lhs, rhs);
+			if (fe_isnonzero(difference))
+				return false;
+
+			fe_mul(lhs, calculatedR.Y, negatedR.Z);
+			fe_mul(rhs, negatedR.Y, calculatedR.Z);
+			fe_sub(difference, lhs, rhs);
+			return !fe_isnonzero(difference);
+		}
+
+		/// Checks 8 * sum(z_i * (S_i * B - h_i * A_i - R_i)) == 0 for random z_i.
+		/// \note The equation is cofactored, so its result does not depend on the random coefficients or on the batch composition.
+		///        It is satisfied by all signatures accepted by Verify and, in addition, by signatures that only fail Verify
+		///        because of small order components in A_i or R_i.
+		bool VerifyBatch(const RandomFiller& randomFiller, const PreparedSignature* const* ppPrepared, size_t count) {
+			if (1 == count)
+				return VerifySingle(**ppPrepared);
+
+			std::vector<MultiScalarTerm> terms(2 * count + 1);
+			Scalar zero{};
+			Scalar baseScalar{};
+			for (auto i = 0u; i < count; ++i) {
+				const auto& prepared = *ppPrepared[i];
+
+				Scalar z{};
+				randomFiller(z.data(), Batch_Coefficient_Size);
+
+				// baseScalar += z * S
+				sc_muladd(baseScalar.data(), z.data(), prepared.pEncodedS, baseScalar.data());
+
+				// zh = z * h
+				Scalar zh;
+				sc_muladd(zh.data(), z.data(), prepared.H.data(), zero.data());
+
+				InitTerm(terms[2 * i], prepared.NegatedPublicKey, zh.data());
+				InitTerm(terms[2 * i + 1], prepared.NegatedR, z.data());
+			}
+
+			Scalar one{};
+			one[0] = 1;
+			ge_p3 basePoint;
+			ge_scalarmult_base(&basePoint, one.data());
+			InitTerm(terms[2 * count], basePoint, baseScalar.data());
+
+			return IsCofactoredMultiScalarSumIdentity(terms);
+		}
+
+		/// Verifies all signatures in \a ppPrepared (of size \a count) and bisects failing batches.
+		/// Individual results are stored in \a pResults, when \a shortCircuit is set, processing stops at the first failure.
+		bool VerifyBisect(
+				const RandomFiller& randomFiller,
+				const PreparedSignature* const* ppPrepared,
+				size_t count,
+				std::vector<bool>::iterator resultsIter,
+				bool shortCircuit) {
+			if (VerifyBatch(randomFiller, ppPrepared, count)) {
+				std::fill_n(resultsIter, count, true);
+				return true;
+			}
+
+			if (1 == count) {
+				*resultsIter = false;
+				return false;
+			}
+
+			if (shortCircuit)
+				return false;
+
+			auto halfCount = count / 2;
+			auto isLeftValid = VerifyBisect(randomFiller, ppPrepared, halfCount, resultsIter, shortCircuit);
+			auto isRightValid = VerifyBisect(randomFiller, ppPrepared + halfCount, count - halfCount, resultsIter + halfCount, shortCircuit);
+			return isLeftValid && isRightValid;
+		}
+
+		bool VerifyMulti(
+				const RandomFiller& randomFiller,
+				const SignatureInput* pSignatureInputs,
+				size_t count,
+				std::vector<bool>& results,
+				bool shortCircuit) {
+			results.resize(count);
+
+			bool aggregateResult = true;
+			std::vector<PreparedSignature> preparedSignatures(std::min(count, Max_Batch_Size));
+			std::vector<const PreparedSignature*> batch;
+			std::vector<size_t> batchIndexes;
+			std::vector<bool> batchResults;
+			for (auto startIndex = 0u; startIndex < count; startIndex += Max_Batch_Size) {
+				auto endIndex = std::min(count, startIndex + Max_Batch_Size);
+
+				batch.clear();
+				batchIndexes.clear();
+				for (auto i = startIndex; i < endIndex; ++i) {
+					auto& prepared = preparedSignatures[i - startIndex];
+					if (!Prepare(pSignatureInputs[i], prepared)) {
+						results[i] = false;
+						aggregateResult = false;
+						if (shortCircuit)
+							return false;
+
+						continue;
+					}
+
+					batch.push_back(&prepared);
+					batchIndexes.push_back(i);
+				}
+
+				if (batch.empty())
+					continue;
+
+				batchResults.resize(batch.size());
+				if (!VerifyBisect(randomFiller, batch.data(), batch.size(), batchResults.begin(), shortCircuit)) {
+					aggregateResult = false;
+					if (shortCircuit)
+						return false;
+				}
+
+				for (auto i = 0u; i < batch.size(); ++i)
+					results[batchIndexes[i]] = batchResults[i];
+			}
+
+			return aggregateResult;
 		}
-		return sig.core_verify(pk, true /* hash_or_encode */, dataBuffer.pData, dataBuffer.Size, FILECOIN_DST, nullptr, NULL) == blst::BLST_SUCCESS;
+
+		// endregion
+	}
+
+	std::pair<std::vector<bool>, bool> VerifyMulti(const RandomFiller& randomFiller, const SignatureInput* pSignatureInputs, size_t count) {
+		std::vector<bool> results;
+		auto aggregateResult = VerifyMulti(randomFiller, pSignatureInputs, count, results, false);
+		return std::make_pair(std::move(results), aggregateResult);
+	}
+
+	bool VerifyMultiShortCircuit(const RandomFiller& randomFiller, const SignatureInput* pSignatureInputs, size_t count) {
+		std::vector<bool> results;
+		return VerifyMulti(randomFiller, pSignatureInputs, count, results, true);
+	}
+
+	void SecureRandomFill(uint8_t* pOut, size_t count) {
+		if (1 != RAND_bytes(pOut, static_cast<int>(count)))
+			CATAPULT_THROW_RUNTIME_ERROR("unable to generate secure random data");
+	}
+
+	namespace {
+		bool Verify(const BLSPublicKey& publicKey, const RawBuffer& dataBuffer, const std::string& dst, const BLSSignature& signature) {
+			blst::P2_Affine sig;
+			auto res = sig.uncompress(signature.m_array);
+			if (res != blst::BLST_SUCCESS) {
+				CATAPULT_LOG(error) << "can't uncompress signature " << signature;
+				return false;
+			}
+			blst::P1_Affine pk;
+			res = pk.uncompress(publicKey.m_array);
+			if (res != blst::BLST_SUCCESS) {
+				CATAPULT_LOG(error) << "can't uncompress public key " << publicKey;
+				return false;
+			}
+			return sig.core_verify(pk, true /* hash_or_encode */, dataBuffer.pData, dataBuffer.Size, dst, nullptr, NULL) == blst::BLST_SUCCESS;
+		}
+	}
+
+	bool Verify(const BLSPublicKey& publicKey, const RawBuffer& dataBuffer, const BLSSignature& signature) {
+		return Verify(publicKey, dataBuffer, FILECOIN_DST, signature);
+	}
+
+	bool VerifyPossession(const BLSPublicKey& publicKey, const BLSSignature& proof) {
+		return Verify(publicKey, publicKey, POP_DST, proof);
 	}
 
 	BLSSignature Aggregate(const std::vector<const BLSSignature*>& signatures) {
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "KeyPair.h"
+#include <functional>
 #include <vector>
 
 namespace catapult { namespace crypto {
@@ -35,6 +36,10 @@ namespace catapult { namespace crypto {
 	/// Signs data in \a message using \a keyPair by BLS algorithm, placing resulting BLS signature in \a computedSignature.
 	void Sign(const BLSKeyPair& keyPair, const RawBuffer& message, BLSSignature& computedSignature);
 
+	/// Proves possession of the BLS private key of \a keyPair, placing resulting proof in \a proof.
+	/// \note The proof is formed with a domain separation tag different from the one used by BLS signatures.
+	void ProvePossession(const BLSKeyPair& keyPair, BLSSignature& proof);
+
 	/// Verifies that \a signature of data pointed by \a dataBuffer is valid, using public key \a publicKey.
 	/// Returns \c true if signature is valid.
 	bool Verify(const Key& publicKey, const RawBuffer& dataBuffer, const Signature& signature);
@@ -43,10 +48,48 @@ namespace catapult { namespace crypto {
 	/// Returns \c true if signature is valid.
 	bool Verify(const Key& publicKey, std::initializer_list<const RawBuffer> buffersList, const Signature& signature);
 
+	/// Input for batch signature verification.
+	struct SignatureInput {
+		/// Public key.
+		const Key& PublicKey;
+
+		/// Data buffers.
+		std::vector<RawBuffer> Buffers;
+
+		/// Signature.
+		const catapult::Signature& Signature;
+	};
+
+	/// Function used to fill a buffer with random data.
+	using RandomFiller = std::function<void (uint8_t*, size_t)>;
+
+	/// Verifies signatures in \a pSignatureInputs (of size \a count) in batches using random data supplied by \a randomFiller.
+	/// Returns a pair consisting of a vector containing the results of individual verifications and the aggregate result.
+	/// \note When a batch fails, it is bisected until the invalid signatures are found.
+	/// \note Unlike Verify, signatures are checked with the cofactored equation 8 * (S * B - h * A - R) == 0,
+	///       so results do not depend on the random data or on how signatures are split into batches.
+	///       Every signature accepted by Verify is accepted, but a signature whose public key or R part has a small order
+	///       component can be accepted even though Verify rejects it. Such a signature can only be created by the owner
+	///       of the private key, so callers that skip Verify for accepted signatures relax consensus for those signers only.
+	/// \note Signatures with small order public keys are always rejected, even when Verify accepts them, so callers need to
+	///       check rejected signatures with Verify before treating them as invalid.
+	std::pair<std::vector<bool>, bool> VerifyMulti(const RandomFiller& randomFiller, const SignatureInput* pSignatureInputs, size_t count);
+
+	/// Verifies signatures in \a pSignatureInputs (of size \a count) in batches using random data supplied by \a randomFiller.
+	/// Returns \c true if all signatures are valid; stops at the first failing batch.
+	bool VerifyMultiShortCircuit(const RandomFiller& randomFiller, const SignatureInput* pSignatureInputs, size_t count);
+
+	/// Fills \a pOut (of size \a count) with cryptographically secure random data suitable for batch verification.
+	void SecureRandomFill(uint8_t* pOut, size_t count);
+
 	/// Verifies that \a BLS signature of data pointed by \a dataBuffer is valid, using BLS public key \a publicKey.
 	/// Returns \c true if signature is valid.
 	bool Verify(const BLSPublicKey& publicKey, const RawBuffer& dataBuffer, const BLSSignature& signature);
 
+	/// Verifies that \a proof is a valid proof of possession of the BLS private key corresponding to \a publicKey.
+	/// Returns \c true if proof is valid.
+	bool VerifyPossession(const BLSPublicKey& publicKey, const BLSSignature& proof);
+
 	/// Aggregates \a BLS signatures to one BLS signature.
 	/// Returns \c aggregated BLS signature.
 	BLSSignature Aggregate(const std::vector<const BLSSignature*>& signatures);
@@ -0,0 +1,51 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "VerifiedSignatureCache.h"
+#include "Hashes.h"
+
+namespace catapult { namespace crypto {
+
+	namespace {
+		Hash256 CalculateSignatureInputHash(const SignatureInput& signatureInput) {
+			Hash256 hash;
+			Sha3_256_Builder builder;
+			builder.update({ signatureInput.PublicKey, signatureInput.Signature });
+			for (const auto& buffer : signatureInput.Buffers)
+				builder.update(buffer);
+
+			builder.final(hash);
+			return hash;
+		}
+	}
+
+	VerifiedSignatureCache::VerifiedSignatureCache(size_t maxGenerationSize) : m_maxGenerationSize(maxGenerationSize)
+	{}
+
+	size_t VerifiedSignatureCache::size() const {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		return m_currentGeneration.size() + m_previousGeneration.size();
+	}
+
+	void VerifiedSignatureCache::add(const SignatureInput& signatureInput) {
+		auto hash = CalculateSignatureInputHash(signatureInput);
+
+		std::lock_guard<std::mutex> guard(m_mutex);
+		if (m_currentGeneration.size() >= m_maxGenerationSize) {
+			m_previousGeneration = std::move(m_currentGeneration);
+			m_currentGeneration.clear();
+		}
+
+		m_currentGeneration.insert(hash);
+	}
+
+	bool VerifiedSignatureCache::remove(const SignatureInput& signatureInput) {
+		auto hash = CalculateSignatureInputHash(signatureInput);
+
+		std::lock_guard<std::mutex> guard(m_mutex);
+		return 0 != m_currentGeneration.erase(hash) || 0 != m_previousGeneration.erase(hash);
+	}
+}}
@@ -0,0 +1,39 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#pragma once
+#include "Signer.h"
+#include "catapult/utils/ArraySet.h"
+#include <mutex>
+
+namespace catapult { namespace crypto {
+
+	/// Thread-safe cache of signatures that have already been successfully verified.
+	/// \note Entries are keyed on a hash of the public key, signature and all signed data.
+	/// \note Entries are kept in two generations, so the cache never holds more than twice \a maxGenerationSize entries.
+	class VerifiedSignatureCache {
+	public:
+		/// Creates a cache that rolls over to a new generation after \a maxGenerationSize entries.
+		explicit VerifiedSignatureCache(size_t maxGenerationSize);
+
+	public:
+		/// Gets the number of cached signatures.
+		size_t size() const;
+
+	public:
+		/// Adds the successfully verified signature described by \a signatureInput.
+		void add(const SignatureInput& signatureInput);
+
+		/// Removes the signature described by \a signatureInput and returns \c true if it was present.
+		bool remove(const SignatureInput& signatureInput);
+
+	private:
+		size_t m_maxGenerationSize;
+		utils::HashSet m_currentGeneration;
+		utils::HashSet m_previousGeneration;
+		mutable std::mutex m_mutex;
+	};
+}}
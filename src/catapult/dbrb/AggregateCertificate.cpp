@@ -0,0 +1,163 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "AggregateCertificate.h"
+#include "DbrbUtils.h"
+#include "catapult/crypto/Hashes.h"
+#include "catapult/crypto/SecureZero.h"
+#include "catapult/crypto/Signer.h"
+
+namespace catapult { namespace dbrb {
+
+	namespace {
+		constexpr auto Bls_Key_Derivation_Tag = "DBRB_BLS_KEY";
+
+		Hash256 CalculateAnnouncementHash(const ProcessId& processId, const BLSPublicKey& publicKey) {
+			return CalculateHash({ processId, publicKey });
+		}
+	}
+
+	bool BlsKeyAnnouncement::operator==(const BlsKeyAnnouncement& rhs) const {
+		return PublicKey == rhs.PublicKey && ProofOfPossession == rhs.ProofOfPossession && Binding == rhs.Binding;
+	}
+
+	size_t AggregateCertificate::packedSize() const {
+		return BLS_Signature_Size + sizeof(uint32_t) + SignerBitmap.size();
+	}
+
+	bool AggregateCertificate::operator==(const AggregateCertificate& rhs) const {
+		return Signature == rhs.Signature && SignerBitmap == rhs.SignerBitmap;
+	}
+
+	crypto::BLSKeyPair DeriveBlsKeyPair(const crypto::KeyPair& keyPair) {
+		crypto::Sha3_256_Builder builder;
+		builder.update({ keyPair.privateKey().data(), keyPair.privateKey().size() });
+		builder.update({ reinterpret_cast<const uint8_t*>(Bls_Key_Derivation_Tag), strlen(Bls_Key_Derivation_Tag) });
+
+		Hash256 seed;
+		builder.final(seed);
+
+		auto i = 0u;
+		auto privateKey = crypto::BLSPrivateKey::Generate([&seed, &i]() { return seed[i++]; });
+		crypto::SecureZero(seed.data(), seed.size());
+		return crypto::BLSKeyPair::FromPrivate(std::move(privateKey));
+	}
+
+	BlsKeyAnnouncement CreateBlsKeyAnnouncement(const crypto::KeyPair& keyPair, const crypto::BLSKeyPair& blsKeyPair) {
+		BlsKeyAnnouncement announcement;
+		announcement.PublicKey = blsKeyPair.publicKey();
+
+		auto hash = CalculateAnnouncementHash(keyPair.publicKey(), announcement.PublicKey);
+		crypto::ProvePossession(blsKeyPair, announcement.ProofOfPossession);
+		crypto::Sign(keyPair, hash, announcement.Binding);
+		return announcement;
+	}
+
+	bool VerifyBlsKeyAnnouncement(const ProcessId& processId, const BlsKeyAnnouncement& announcement) {
+		auto hash = CalculateAnnouncementHash(processId, announcement.PublicKey);
+		return crypto::Verify(processId, hash, announcement.Binding)
+				&& crypto::VerifyPossession(announcement.PublicKey, announcement.ProofOfPossession);
+	}
+
+	// region BlsKeyRegistry
+
+	BlsKeyRegistry::BlsKeyRegistry(size_t maxSize) : m_maxSize(maxSize)
+	{}
+
+	bool BlsKeyRegistry::add(const ProcessId& processId, const BlsKeyAnnouncement& announcement) {
+		auto iter = m_announcements.find(processId);
+		if (m_announcements.end() != iter && iter->second == announcement)
+			return true;
+
+		if (!VerifyBlsKeyAnnouncement(processId, announcement))
+			return false;
+
+		if (m_announcements.end() != iter) {
+			iter->second = announcement;
+			return true;
+		}
+
+		if (m_announcements.size() >= m_maxSize) {
+			m_announcements.erase(m_insertionOrder.front());
+			m_insertionOrder.pop_front();
+		}
+
+		m_announcements.emplace(processId, announcement);
+		m_insertionOrder.push_back(processId);
+		return true;
+	}
+
+	const BLSPublicKey* BlsKeyRegistry::find(const ProcessId& processId) const {
+		auto iter = m_announcements.find(processId);
+		return m_announcements.end() != iter ? &iter->second.PublicKey : nullptr;
+	}
+
+	size_t BlsKeyRegistry::size() const {
+		return m_announcements.size();
+	}
+
+	// endregion
+
+	AggregateCertificate CreateAggregateCertificate(const DbrbTreeView& processes, const std::map<ProcessId, BLSSignature>& signatures) {
+		AggregateCertificate certificate;
+		certificate.SignerBitmap.resize((processes.size() + 7) / 8, 0);
+
+		std::vector<const BLSSignature*> pSignatures;
+		pSignatures.reserve(signatures.size());
+		for (auto i = 0u; i < processes.size(); ++i) {
+			auto iter = signatures.find(processes[i]);
+			if (signatures.end() == iter)
+				continue;
+
+			certificate.SignerBitmap[i / 8] |= static_cast<uint8_t>(1 << (i % 8));
+			pSignatures.push_back(&iter->second);
+		}
+
+		certificate.Signature = crypto::Aggregate(pSignatures);
+		return certificate;
+	}
+
+	DbrbTreeView GetSigners(const AggregateCertificate& certificate, const DbrbTreeView& processes) {
+		if (certificate.SignerBitmap.size() != (processes.size() + 7) / 8)
+			return {};
+
+		DbrbTreeView signers;
+		for (auto i = 0u; i < certificate.SignerBitmap.size() * 8; ++i) {
+			if (!(certificate.SignerBitmap[i / 8] & (1 << (i % 8))))
+				continue;
+
+			// padding bits must not be set
+			if (i >= processes.size())
+				return {};
+
+			signers.push_back(processes[i]);
+		}
+
+		return signers;
+	}
+
+	bool VerifyAggregateCertificate(
+			const AggregateCertificate& certificate,
+			const DbrbTreeView& processes,
+			const BlsKeyRegistry& registry,
+			const Hash256& hash) {
+		auto signers = GetSigners(certificate, processes);
+		if (signers.empty())
+			return false;
+
+		std::vector<const BLSPublicKey*> pPublicKeys;
+		pPublicKeys.reserve(signers.size());
+		for (const auto& signer : signers) {
+			const auto* pPublicKey = registry.find(signer);
+			if (!pPublicKey)
+				return false;
+
+			pPublicKeys.push_back(pPublicKey);
+		}
+
+		return crypto::FastAggregateVerify(pPublicKeys, hash, certificate.Signature);
+	}
+}}
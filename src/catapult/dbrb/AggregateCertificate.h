@@ -0,0 +1,103 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#pragma once
+#include "DbrbDefinitions.h"
+#include "catapult/crypto/KeyPair.h"
+#include <list>
+#include <map>
+#include <vector>
+
+namespace catapult { namespace dbrb {
+
+	/// BLS public key of a DBRB process together with the proofs binding it to the process.
+	struct BlsKeyAnnouncement {
+		/// BLS public key.
+		BLSPublicKey PublicKey;
+
+		/// Proof of possession of the corresponding BLS private key.
+		BLSSignature ProofOfPossession;
+
+		/// Signature of the BLS public key formed by the process key.
+		catapult::Signature Binding;
+
+		/// Returns \c true if this announcement is equal to \a rhs.
+		bool operator==(const BlsKeyAnnouncement& rhs) const;
+	};
+
+	/// Size of a serialized BLS key announcement.
+	constexpr size_t BlsKeyAnnouncement_Size = BLS_Public_Key_Size + BLS_Signature_Size + Signature_Size;
+
+	/// Certificate consisting of a single aggregate BLS signature and a bitmap of signers
+	/// over an ordered list of processes (e.g. view members).
+	struct AggregateCertificate {
+		/// Aggregate of the signatures of all signers.
+		BLSSignature Signature;
+
+		/// Bitmap of signers, bit \c i is set when the i-th process signed.
+		std::vector<uint8_t> SignerBitmap;
+
+		/// Calculates the size in bytes required to serialize this certificate.
+		size_t packedSize() const;
+
+		/// Returns \c true if this certificate is equal to \a rhs.
+		bool operator==(const AggregateCertificate& rhs) const;
+	};
+
+	/// Derives a deterministic BLS key pair from the process \a keyPair.
+	crypto::BLSKeyPair DeriveBlsKeyPair(const crypto::KeyPair& keyPair);
+
+	/// Creates an announcement of \a blsKeyPair public key bound to the process \a keyPair.
+	BlsKeyAnnouncement CreateBlsKeyAnnouncement(const crypto::KeyPair& keyPair, const crypto::BLSKeyPair& blsKeyPair);
+
+	/// Returns \c true if \a announcement is a valid BLS key announcement of \a processId.
+	bool VerifyBlsKeyAnnouncement(const ProcessId& processId, const BlsKeyAnnouncement& announcement);
+
+	/// Registry of verified BLS public keys of DBRB processes.
+	class BlsKeyRegistry {
+	public:
+		/// Default maximum number of keys in a registry.
+		static constexpr size_t Default_Max_Size = 4096;
+
+	public:
+		/// Creates a registry holding at most \a maxSize keys.
+		explicit BlsKeyRegistry(size_t maxSize = Default_Max_Size);
+
+	public:
+		/// Adds BLS key \a announcement of \a processId.
+		/// Returns \c true if the key is known or the announcement is valid.
+		/// \note Announcements are verified only once per process and key.
+		/// \note When the registry is full, the key of the process added least recently is removed.
+		bool add(const ProcessId& processId, const BlsKeyAnnouncement& announcement);
+
+		/// Finds BLS public key of \a processId or returns \c nullptr if the key is unknown.
+		const BLSPublicKey* find(const ProcessId& processId) const;
+
+		/// Gets the number of known keys.
+		size_t size() const;
+
+	private:
+		size_t m_maxSize;
+		std::map<ProcessId, BlsKeyAnnouncement> m_announcements;
+		std::list<ProcessId> m_insertionOrder;
+	};
+
+	/// Aggregates \a signatures of \a processes into a certificate.
+	/// \note Signatures of processes not present in \a processes are ignored.
+	AggregateCertificate CreateAggregateCertificate(const DbrbTreeView& processes, const std::map<ProcessId, BLSSignature>& signatures);
+
+	/// Gets the signers of \a certificate over \a processes or an empty vector if the bitmap is malformed.
+	DbrbTreeView GetSigners(const AggregateCertificate& certificate, const DbrbTreeView& processes);
+
+	/// Verifies that \a certificate over \a processes is a valid aggregate signature of \a hash
+	/// using keys from \a registry.
+	/// \note Verification fails when the certificate has no signers or a key of any signer is unknown.
+	bool VerifyAggregateCertificate(
+			const AggregateCertificate& certificate,
+			const DbrbTreeView& processes,
+			const BlsKeyRegistry& registry,
+			const Hash256& hash);
+}}
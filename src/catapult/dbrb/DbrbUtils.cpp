@@ -4,6 +4,7 @@
 *** license that can be found in the LICENSE file.
 **/
 
+#include "AggregateCertificate.h"
 #include "View.h"
 #include "catapult/crypto/Hashes.h"
 #include "catapult/model/Block.h"
@@ -56,6 +57,18 @@ namespace catapult { namespace dbrb {
 			Write(pBuffer, id);
 	}
 
+	void Write(uint8_t*& pBuffer, const AggregateCertificate& certificate) {
+		Write(pBuffer, certificate.Signature);
+		Write(pBuffer, utils::checked_cast<size_t, uint32_t>(certificate.SignerBitmap.size()));
+		Write(pBuffer, { certificate.SignerBitmap.data(), certificate.SignerBitmap.size() });
+	}
+
+	void Write(uint8_t*& pBuffer, const BlsKeyAnnouncement& announcement) {
+		Write(pBuffer, announcement.PublicKey);
+		Write(pBuffer, announcement.ProofOfPossession);
+		Write(pBuffer, announcement.Binding);
+	}
+
 	template<>
 	ProcessId Read(const uint8_t*& pBuffer) {
 		ProcessId id;
@@ -134,6 +147,38 @@ namespace catapult { namespace dbrb {
 		return view;
 	}
 
+	template<>
+	BLSSignature Read(const uint8_t*& pBuffer) {
+		BLSSignature signature;
+		std::memcpy(signature.data(), pBuffer, BLS_Signature_Size);
+		pBuffer += BLS_Signature_Size;
+
+		return signature;
+	}
+
+	template<>
+	AggregateCertificate Read(const uint8_t*& pBuffer) {
+		AggregateCertificate certificate;
+		certificate.Signature = Read<BLSSignature>(pBuffer);
+		auto size = *reinterpret_cast<const uint32_t*>(pBuffer);
+		pBuffer += sizeof(uint32_t);
+		certificate.SignerBitmap.assign(pBuffer, pBuffer + size);
+		pBuffer += size;
+
+		return certificate;
+	}
+
+	template<>
+	BlsKeyAnnouncement Read(const uint8_t*& pBuffer) {
+		BlsKeyAnnouncement announcement;
+		std::memcpy(announcement.PublicKey.data(), pBuffer, BLS_Public_Key_Size);
+		pBuffer += BLS_Public_Key_Size;
+		announcement.ProofOfPossession = Read<BLSSignature>(pBuffer);
+		announcement.Binding = Read<Signature>(pBuffer);
+
+		return announcement;
+	}
+
 	Hash256 CalculateHash(const std::vector<RawBuffer>& buffers) {
 		crypto::Sha3_256_Builder hashBuilder;
 		for (const auto& buffer : buffers)
@@ -24,6 +24,10 @@ namespace catapult { namespace dbrb {
 	void Write(uint8_t*& pBuffer, const Payload& payload);
 	void Write(uint8_t*& pBuffer, const CertificateType& certificate);
 	void Write(uint8_t*& pBuffer, const DbrbTreeView& view);
+	struct AggregateCertificate;
+	void Write(uint8_t*& pBuffer, const AggregateCertificate& certificate);
+	struct BlsKeyAnnouncement;
+	void Write(uint8_t*& pBuffer, const BlsKeyAnnouncement& announcement);
 
 	template<typename T>
 	T Read(const uint8_t*& pBuffer);
@@ -41,6 +45,12 @@ namespace catapult { namespace dbrb {
 	CertificateType Read(const uint8_t*& pBuffer);
 	template<>
 	DbrbTreeView Read(const uint8_t*& pBuffer);
+	template<>
+	BLSSignature Read(const uint8_t*& pBuffer);
+	template<>
+	AggregateCertificate Read(const uint8_t*& pBuffer);
+	template<>
+	BlsKeyAnnouncement Read(const uint8_t*& pBuffer);
 
 	Hash256 CalculateHash(const std::vector<RawBuffer>& buffers);
 	Hash256 CalculatePayloadHash(const Payload& payload);
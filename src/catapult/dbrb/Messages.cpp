@@ -57,6 +57,23 @@ namespace catapult { namespace dbrb {
 
 #pragma pack(pop)
 
+		// optional fields are appended after the mandatory ones so that older processes can still parse the messages
+		bool HasTrailingData(const ionet::Packet& packet, const uint8_t* pBuffer, size_t size) {
+			const auto* pEnd = reinterpret_cast<const uint8_t*>(&packet) + packet.Size;
+			return pBuffer + size <= pEnd;
+		}
+
+		std::optional<AggregateCertificate> TryReadAggregateCertificate(const ionet::Packet& packet, const uint8_t*& pBuffer) {
+			if (!HasTrailingData(packet, pBuffer, BLS_Signature_Size + sizeof(uint32_t)))
+				return std::nullopt;
+
+			auto bitmapSize = *reinterpret_cast<const uint32_t*>(pBuffer + BLS_Signature_Size);
+			if (!HasTrailingData(packet, pBuffer, BLS_Signature_Size + sizeof(uint32_t) + bitmapSize))
+				return std::nullopt;
+
+			return Read<AggregateCertificate>(pBuffer);
+		}
+
 		template<typename MessagePacketType, typename MessageType>
 		auto ToShardMessage(const ionet::Packet& packet) {
 			const auto* pMessagePacket = reinterpret_cast<const MessagePacketType*>(&packet);
@@ -107,7 +124,11 @@ namespace catapult { namespace dbrb {
 			auto view = Read<View>(pBuffer);
 			auto bootstrapView = Read<View>(pBuffer);
 
-			return std::make_shared<PrepareMessage>(pMessagePacket->Sender, payload, view, bootstrapView);
+			auto pMessage = std::make_shared<PrepareMessage>(pMessagePacket->Sender, payload, view, bootstrapView);
+			if (HasTrailingData(packet, pBuffer, BlsKeyAnnouncement_Size))
+				pMessage->SenderBlsKey = Read<BlsKeyAnnouncement>(pBuffer);
+
+			return pMessage;
 		});
 
 		registerConverter(ionet::PacketType::Dbrb_Acknowledged_Declined_Message, [](const ionet::Packet& packet) {
@@ -125,7 +146,11 @@ namespace catapult { namespace dbrb {
 			auto view = Read<View>(pBuffer);
 			auto payloadSignature = Read<Signature>(pBuffer);
 
-			return std::make_shared<AcknowledgedMessage>(pMessagePacket->Sender, payloadHash, view, payloadSignature);
+			auto pMessage = std::make_shared<AcknowledgedMessage>(pMessagePacket->Sender, payloadHash, view, payloadSignature);
+			if (HasTrailingData(packet, pBuffer, BLS_Signature_Size))
+				pMessage->BlsPayloadSignature = Read<BLSSignature>(pBuffer);
+
+			return pMessage;
 		});
 
 		registerConverter(ionet::PacketType::Dbrb_Commit_Message, [](const ionet::Packet& packet) {
@@ -135,7 +160,10 @@ namespace catapult { namespace dbrb {
 			auto certificate = Read<CertificateType>(pBuffer);
 			auto view = Read<View>(pBuffer);
 
-			return std::make_shared<CommitMessage>(pMessagePacket->Sender, payloadHash, certificate, view);
+			auto pMessage = std::make_shared<CommitMessage>(pMessagePacket->Sender, payloadHash, certificate, view);
+			pMessage->AggregateCertificate = TryReadAggregateCertificate(packet, pBuffer);
+
+			return pMessage;
 		});
 
 		registerConverter(ionet::PacketType::Dbrb_Deliver_Message, [](const ionet::Packet& packet) {
@@ -180,13 +208,16 @@ namespace catapult { namespace dbrb {
 	}
 
 	std::shared_ptr<MessagePacket> PrepareMessage::toNetworkPacket() {
-		auto pPacket = ionet::CreateSharedPacket<PrepareMessagePacket>(Payload->Size + View.packedSize() + BootstrapView.packedSize());
+		auto payloadSize = Payload->Size + View.packedSize() + BootstrapView.packedSize() + (SenderBlsKey ? BlsKeyAnnouncement_Size : 0);
+		auto pPacket = ionet::CreateSharedPacket<PrepareMessagePacket>(payloadSize);
 		pPacket->Sender = Sender;
 
 		auto pBuffer = pPacket->payload();
 		Write(pBuffer, Payload);
 		Write(pBuffer, View);
 		Write(pBuffer, BootstrapView);
+		if (SenderBlsKey)
+			Write(pBuffer, *SenderBlsKey);
 
 		return pPacket;
 	}
@@ -202,19 +233,25 @@ namespace catapult { namespace dbrb {
 	}
 
 	std::shared_ptr<MessagePacket> AcknowledgedMessage::toNetworkPacket() {
-		auto pPacket = ionet::CreateSharedPacket<AcknowledgedMessagePacket>(Hash256_Size + View.packedSize() + Signature_Size);
+		auto payloadSize = Hash256_Size + View.packedSize() + Signature_Size + (BlsPayloadSignature ? BLS_Signature_Size : 0);
+		auto pPacket = ionet::CreateSharedPacket<AcknowledgedMessagePacket>(payloadSize);
 		pPacket->Sender = Sender;
 
 		auto pBuffer = pPacket->payload();
 		Write(pBuffer, PayloadHash);
 		Write(pBuffer, View);
 		Write(pBuffer, PayloadSignature);
+		if (BlsPayloadSignature)
+			Write(pBuffer, *BlsPayloadSignature);
 
 		return pPacket;
 	}
 
 	std::shared_ptr<MessagePacket> CommitMessage::toNetworkPacket() {
 		auto payloadSize = Hash256_Size + sizeof(uint32_t) + Certificate.size() * (ProcessId_Size + Signature_Size) + View.packedSize();
+		if (AggregateCertificate)
+			payloadSize += AggregateCertificate->packedSize();
+
 		auto pPacket = ionet::CreateSharedPacket<CommitMessagePacket>(payloadSize);
 		pPacket->Sender = Sender;
 
@@ -222,6 +259,8 @@ namespace catapult { namespace dbrb {
 		Write(pBuffer, PayloadHash);
 		Write(pBuffer, Certificate);
 		Write(pBuffer, View);
+		if (AggregateCertificate)
+			Write(pBuffer, *AggregateCertificate);
 
 		return pPacket;
 	}
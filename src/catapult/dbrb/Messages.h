@@ -5,7 +5,9 @@
 **/
 
 #pragma once
+#include "AggregateCertificate.h"
 #include "View.h"
+#include <optional>
 #include <utility>
 
 namespace catapult { namespace crypto { class KeyPair; }}
@@ -106,6 +108,9 @@ namespace catapult { namespace dbrb {
 
 		/// Current bootstrap view of the system from the perspective of the sender.
 		dbrb::View BootstrapView;
+
+		/// Optional BLS key announcement of the sender.
+		std::optional<BlsKeyAnnouncement> SenderBlsKey;
 	};
 
 	struct AcknowledgedDeclinedMessage : Message {
@@ -142,6 +147,9 @@ namespace catapult { namespace dbrb {
 
 		/// Signature formed by Sender.
 		catapult::Signature PayloadSignature;
+
+		/// Optional BLS signature formed by Sender.
+		std::optional<BLSSignature> BlsPayloadSignature;
 	};
 
 	struct CommitMessage : BaseMessage {
@@ -162,6 +170,11 @@ namespace catapult { namespace dbrb {
 
 		/// Message certificate for supplied payload.
 		CertificateType Certificate;
+
+		/// Optional aggregate certificate over the members of View.
+		/// \note It is verified instead of Certificate when BLS keys of all its signers are known.
+		/// \note Processes only relay certificates they have verified.
+		std::optional<dbrb::AggregateCertificate> AggregateCertificate;
 	};
 
 	struct DeliverMessage : BaseMessage {
@@ -21,6 +21,7 @@
 #pragma once
 #include "BaseSetDefaultTraits.h"
 #include "BaseSetFindIterator.h"
+#include "ConditionalContainer.h"
 #include "DeltaElements.h"
 #include "catapult/utils/NonCopyable.h"
 #include "catapult/exceptions.h"
@@ -174,6 +175,10 @@ namespace catapult { namespace deltaset {
 		}
 
 		FindConstIterator find(const KeyType& key, ImmutableTypeTag) const {
+			auto prefetchedIter = m_prefetchedElements.find(key);
+			if (m_prefetchedElements.cend() != prefetchedIter)
+				return FindConstIterator(std::move(prefetchedIter));
+
 			auto originalIter = m_originalElements.find(key);
 			return m_originalElements.cend() != originalIter ? FindConstIterator(std::move(originalIter)) : FindConstIterator();
 		}
@@ -190,7 +195,7 @@ namespace catapult { namespace deltaset {
 		/// Searches for \a key in this set.
 		/// Returns \c true if it is found or \c false if it is not found.
 		bool contains(const KeyType& key) const {
-			return !Contains(m_removedElements, key) && (Contains(m_addedElements, key) || Contains(m_originalElements, key));
+			return !Contains(m_removedElements, key) && (Contains(m_addedElements, key) || containsOriginal(key));
 		}
 
 	private:
@@ -199,6 +204,46 @@ namespace catapult { namespace deltaset {
 			return set.cend() != set.find(key);
 		}
 
+		bool containsOriginal(const KeyType& key) const {
+			return Contains(m_prefetchedElements, key) || Contains(m_originalElements, key);
+		}
+
+	public:
+		/// Loads all original elements identified by \a keys into memory with a single batched lookup.
+		/// \note Prefetched elements are unmodified copies of original elements, so they are not part of the pending modifications.
+		void prefetch(const std::vector<KeyType>& keys) {
+			using SupportsBatchFind = detail::SupportsBatchFind<SetType, KeyType>;
+			prefetch(keys, std::integral_constant<bool, SupportsBatchFind::value>());
+		}
+
+	private:
+		void prefetch(const std::vector<KeyType>&, std::false_type) {
+			// original elements are not backed by storage, so they are already in memory
+		}
+
+		void prefetch(const std::vector<KeyType>& keys, std::true_type) {
+			if (ConditionalContainerMode::Memory == m_originalElements.mode())
+				return;
+
+			std::vector<KeyType> missingKeys;
+			for (const auto& key : keys) {
+				if (Contains(m_removedElements, key) || Contains(m_addedElements, key) || Contains(m_copiedElements, key))
+					continue;
+
+				if (!Contains(m_prefetchedElements, key))
+					missingKeys.push_back(key);
+			}
+
+			if (missingKeys.empty())
+				return;
+
+			auto originalIters = m_originalElements.find(missingKeys);
+			for (auto i = 0u; i < missingKeys.size(); ++i) {
+				if (m_originalElements.cend() != originalIters[i])
+					m_prefetchedElements.insert(TSetTraits::ToStorage(missingKeys[i], std::move(originalIters[i])));
+			}
+		}
+
 	public:
 		/// Inserts \a element into this set.
 		/// \note The algorithm relies on the data used for comparing elements being immutable.
@@ -226,7 +271,7 @@ namespace catapult { namespace deltaset {
 				m_removedElements.erase(removedIter);
 				pTargetElements = Contains(m_addedElements, key) ? &m_addedElements : &m_copiedElements;
 				insertResult = InsertResult::Unremoved;
-			} else if (Contains(m_originalElements, key)) {
+			} else if (containsOriginal(key)) {
 				pTargetElements = &m_copiedElements; // original element, possibly modified
 				insertResult = InsertResult::Updated;
 			} else {
@@ -254,7 +299,7 @@ namespace catapult { namespace deltaset {
 				return InsertResult::Unremoved;
 			}
 
-			if (Contains(m_originalElements, key) || Contains(m_addedElements, key))
+			if (containsOriginal(key) || Contains(m_addedElements, key))
 				return InsertResult::Redundant;
 
 			markKey(key);
@@ -301,6 +346,13 @@ namespace catapult { namespace deltaset {
 				return RemoveResult::Uninserted;
 			}
 
+			auto prefetchedIter = m_prefetchedElements.find(key);
+			if (m_prefetchedElements.cend() != prefetchedIter) {
+				markKey(key);
+				m_removedElements.insert(*prefetchedIter);
+				return RemoveResult::Removed;
+			}
+
 			auto originalIter = m_originalElements.find(key);
 			if (m_originalElements.cend() != originalIter) {
 				markKey(key);
@@ -343,6 +395,7 @@ namespace catapult { namespace deltaset {
 			m_addedElements.clear();
 			m_removedElements.clear();
 			m_copiedElements.clear();
+			m_prefetchedElements.clear();
 
 			m_generationId = 1;
 			m_keyGenerationIdMap.clear();
@@ -398,6 +451,7 @@ namespace catapult { namespace deltaset {
 		MemorySetType m_addedElements;
 		MemorySetType m_removedElements;
 		MemorySetType m_copiedElements;
+		MemorySetType m_prefetchedElements;
 
 		uint32_t m_generationId;
 		typename KeyGenerationIdMap<SetType>::Type m_keyGenerationIdMap;
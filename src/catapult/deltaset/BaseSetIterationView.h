@@ -20,14 +20,29 @@
 
 #pragma once
 #include "BaseSet.h"
+#include "catapult/utils/traits/Traits.h"
 
 namespace catapult { namespace deltaset {
 
+	namespace detail {
+		// sets that delegate to an in memory container (e.g. ConditionalContainer) are iterated using that container,
+		// which is not required to have the same type as the memory sets used by deltas
+		template<typename TSetTraits, typename = void>
+		struct IterableSetType {
+			using type = typename TSetTraits::MemorySetType;
+		};
+
+		template<typename TSetTraits>
+		struct IterableSetType<TSetTraits, utils::traits::is_type_expression_t<typename TSetTraits::SetType::MemorySetType>> {
+			using type = typename TSetTraits::SetType::MemorySetType;
+		};
+	}
+
 	/// A view that provides iteration support to a base set.
 	template<typename TSetTraits>
 	class BaseSetIterationView {
 	private:
-		using SetType = typename TSetTraits::MemorySetType;
+		using SetType = typename detail::IterableSetType<TSetTraits>::type;
 		using KeyType = typename TSetTraits::KeyType;
 
 	public:
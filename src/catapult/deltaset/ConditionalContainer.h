@@ -22,6 +22,7 @@
 #include "BaseSetCommitPolicy.h"
 #include "DeltaElements.h"
 #include <memory>
+#include <vector>
 
 namespace catapult { namespace deltaset {
 
@@ -37,6 +38,18 @@ namespace catapult { namespace deltaset {
 			using hasher = typename T::hasher;
 			using key_equal = typename T::key_equal;
 		};
+
+		// storage containers can optionally support batched lookups
+		template<typename T, typename TKey, typename = void>
+		struct SupportsBatchFind : std::false_type {};
+
+		template<typename T, typename TKey>
+		struct SupportsBatchFind<
+				T,
+				TKey,
+				utils::traits::is_type_expression_t<decltype(std::declval<const T&>().find(std::declval<const std::vector<TKey>&>()))>>
+				: std::true_type
+		{};
 	}
 
 	/// Possible conditional container modes.
@@ -127,6 +140,11 @@ namespace catapult { namespace deltaset {
 		}
 
 	public:
+		/// Gets the mode of this container.
+		ConditionalContainerMode mode() const {
+			return m_pContainer1 ? ConditionalContainerMode::Storage : ConditionalContainerMode::Memory;
+		}
+
 		/// Gets a value indicating whether or not this set is empty.
 		bool empty() const {
 			return m_pContainer1 ? m_pContainer1->empty() : m_pContainer2->empty();
@@ -152,6 +170,23 @@ namespace catapult { namespace deltaset {
 					: ConditionalIterator(m_pContainer2->find(key), MemoryFlag());
 		}
 
+		/// Searches for all \a keys in this set.
+		/// \note Storage containers look up all keys in a single batch.
+		std::vector<ConditionalIterator> find(const std::vector<typename TKeyTraits::KeyType>& keys) const {
+			using SupportsBatchFind = detail::SupportsBatchFind<StorageSetType, typename TKeyTraits::KeyType>;
+
+			std::vector<ConditionalIterator> iters;
+			iters.reserve(keys.size());
+			if (m_pContainer1) {
+				findAll(keys, iters, std::integral_constant<bool, SupportsBatchFind::value>());
+			} else {
+				for (const auto& key : keys)
+					iters.push_back(ConditionalIterator(m_pContainer2->find(key), MemoryFlag()));
+			}
+
+			return iters;
+		}
+
 		/// Searches for \a key or previous key in this set or map.
 		ConditionalIterator findLowerOrEqual(const typename TKeyTraits::KeyType& key) const {
 			if (m_pContainer1) {
@@ -186,7 +221,8 @@ namespace catapult { namespace deltaset {
 
 	public:
 		/// Applies all changes in \a deltas to the underlying container.
-		void update(const DeltaElements<MemorySetType>& deltas) {
+		template<typename TDeltaSet>
+		void update(const DeltaElements<TDeltaSet>& deltas) {
 			if (m_pContainer1)
 				UpdateSet<TKeyTraits>(*m_pContainer1, deltas);
 			else
@@ -202,6 +238,17 @@ namespace catapult { namespace deltaset {
 				PruneBaseSet(*m_pContainer2, pruningBoundary);
 		}
 
+	private:
+		void findAll(const std::vector<typename TKeyTraits::KeyType>& keys, std::vector<ConditionalIterator>& iters, std::true_type) const {
+			for (auto& iter : m_pContainer1->find(keys))
+				iters.push_back(ConditionalIterator(std::move(iter), StorageFlag()));
+		}
+
+		void findAll(const std::vector<typename TKeyTraits::KeyType>& keys, std::vector<ConditionalIterator>& iters, std::false_type) const {
+			for (const auto& key : keys)
+				iters.push_back(ConditionalIterator(m_pContainer1->find(key), StorageFlag()));
+		}
+
 	private:
 		std::unique_ptr<StorageSetType> m_pContainer1;
 		std::unique_ptr<MemorySetType> m_pContainer2;
@@ -234,8 +281,8 @@ namespace catapult { namespace deltaset {
 
 	/// Applies all changes in \a deltas to \a container.
 	/// \note Specialization for ConditionalContainer.
-	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet>
-	void UpdateSet(ConditionalContainer<TKeyTraits, TStorageSet, TMemorySet>& container, const DeltaElements<TMemorySet>& deltas) {
+	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet, typename TDeltaSet>
+	void UpdateSet(ConditionalContainer<TKeyTraits, TStorageSet, TMemorySet>& container, const DeltaElements<TDeltaSet>& deltas) {
 		container.update(deltas);
 	}
 
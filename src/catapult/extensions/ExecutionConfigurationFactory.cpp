@@ -34,6 +34,11 @@ namespace catapult { namespace extensions {
 		executionConfig.pObserver = pluginManager.createObserver();
 		executionConfig.pValidator = pluginManager.createStatefulValidator();
 		executionConfig.pNotificationPublisher = pluginManager.createNotificationPublisher();
+
+		// prefetching only pays off when cache entries are loaded from the cache database
+		if (pluginManager.storageConfig().PreferCacheDatabase)
+			executionConfig.pPrefetchPublisher = executionConfig.pNotificationPublisher;
+
 		executionConfig.ResolverContextFactory = [&pluginManager](const auto& cache) {
 			return pluginManager.createResolverContext(cache);
 		};
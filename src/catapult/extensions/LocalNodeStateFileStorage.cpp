@@ -23,12 +23,15 @@
 #include "LocalNodeStateRef.h"
 #include "NemesisBlockLoader.h"
 #include "catapult/cache/SupplementalDataStorage.h"
+#include "catapult/config_holder/BlockchainConfigurationHolder.h"
 #include "catapult/consumers/BlockChainSyncHandlers.h"
 #include "catapult/io/BlockStorageCache.h"
 #include "catapult/io/BufferedFileStream.h"
 #include "catapult/io/FilesystemUtils.h"
 #include "catapult/io/IndexFile.h"
 #include "catapult/plugins/PluginManager.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
 #include "plugins/txes/config/src/cache/NetworkConfigCache.h"
 
@@ -44,6 +47,27 @@ namespace catapult { namespace extensions {
 		std::string GetStorageFilename(const cache::CacheStorage& storage) {
 			return storage.name() + ".dat";
 		}
+
+		template<typename TStorages, typename TCostEstimator, typename TAction>
+		void ForEachStorage(TStorages& storages, uint32_t maxWorkerThreads, TCostEstimator costEstimator, TAction action) {
+			auto numWorkerThreads = std::min<size_t>(maxWorkerThreads, storages.size());
+			if (numWorkerThreads < 2) {
+				for (const auto& pStorage : storages)
+					action(*pStorage);
+
+				return;
+			}
+
+			// sub cache state files are independent, so they can be processed concurrently
+			auto pPool = thread::CreateIoThreadPool(numWorkerThreads, "state file");
+			pPool->start();
+			thread::ParallelForDynamic(*pPool, storages, numWorkerThreads, [costEstimator](const auto& pStorage) {
+				return costEstimator(*pStorage);
+			}, [action](const auto& pStorage, auto) {
+				action(*pStorage);
+				return true;
+			}).get();
+		}
 	}
 
 	// endregion
@@ -74,16 +98,22 @@ namespace catapult { namespace extensions {
 		bool LoadStateFromDirectory(
 				const config::CatapultDirectory& directory,
 				cache::CatapultCache& cache,
+				uint32_t maxWorkerThreads,
 				cache::SupplementalData& supplementalData) {
 			if (!HasSerializedState(directory))
 				return false;
 
 			// 1. load cache data
 			utils::StackLogger stopwatch("load state", utils::LogLevel::Warning);
-			for (const auto& pStorage : cache.storages()) {
-				auto inputStream = OpenInputStream(directory, GetStorageFilename(*pStorage));
-				pStorage->loadAll(inputStream, Default_Loader_Batch_Size);
-			}
+			auto storages = cache.storages();
+			ForEachStorage(storages, maxWorkerThreads, [&directory](const auto& storage) {
+				boost::system::error_code ec;
+				auto fileSize = boost::filesystem::file_size(directory.file(GetStorageFilename(storage)), ec);
+				return ec ? 0u : fileSize;
+			}, [&directory](auto& storage) {
+				auto inputStream = OpenInputStream(directory, GetStorageFilename(storage));
+				storage.loadAll(inputStream, Default_Loader_Batch_Size);
+			});
 
 			// 2. load supplemental data
 			Height chainHeight;
@@ -118,7 +148,8 @@ namespace catapult { namespace extensions {
 			const LocalNodeStateRef& stateRef,
 			const plugins::PluginManager& pluginManager) {
 		cache::SupplementalData supplementalData;
-		if (LoadStateFromDirectory(directory, stateRef.Cache, supplementalData)) {
+		auto maxWorkerThreads = stateRef.ConfigHolder->Config().Node.MaxStateFileThreads;
+		if (LoadStateFromDirectory(directory, stateRef.Cache, maxWorkerThreads, supplementalData)) {
 			stateRef.State = supplementalData.State;
 			stateRef.Score += supplementalData.ChainScore;
 		} else {
@@ -166,16 +197,17 @@ namespace catapult { namespace extensions {
 				const model::ChainScore& score,
 				Height height,
 				const std::optional<state::NetworkConfigEntry>& config,
+				uint32_t maxWorkerThreads,
 				const consumer<const cache::CacheStorage&, io::OutputStream&>& save) {
 			// 1. create directory if required
 			if (!boost::filesystem::exists(directory.path()))
 				boost::filesystem::create_directory(directory.path());
 
 			// 2. save cache data
-			for (const auto& pStorage : cacheStorages) {
-				auto outputStream = OpenOutputStream(directory, GetStorageFilename(*pStorage));
-				save(*pStorage, outputStream);
-			}
+			ForEachStorage(cacheStorages, maxWorkerThreads, [](const auto&) { return 1u; }, [&directory, &save](const auto& storage) {
+				auto outputStream = OpenOutputStream(directory, GetStorageFilename(storage));
+				save(storage, outputStream);
+			});
 
 			// 3. save supplemental data
 			cache::SupplementalData supplementalData{ state, score };
@@ -192,7 +224,9 @@ namespace catapult { namespace extensions {
 		}
 	}
 
-	LocalNodeStateSerializer::LocalNodeStateSerializer(const config::CatapultDirectory& directory) : m_directory(directory)
+	LocalNodeStateSerializer::LocalNodeStateSerializer(const config::CatapultDirectory& directory, uint32_t maxWorkerThreads)
+			: m_directory(directory)
+			, m_maxWorkerThreads(maxWorkerThreads)
 	{}
 
 	void LocalNodeStateSerializer::save(
@@ -212,7 +246,7 @@ namespace catapult { namespace extensions {
 				config = std::make_optional(configIter);
 			}
 		}
-		SaveStateToDirectory(m_directory, cacheStorages, state, score, height, config, [&cacheView](const auto& storage, auto& outputStream) {
+		SaveStateToDirectory(m_directory, cacheStorages, state, score, height, config, m_maxWorkerThreads, [&cacheView](const auto& storage, auto& outputStream) {
 			storage.saveAll(cacheView, outputStream);
 		});
 	}
@@ -235,7 +269,7 @@ namespace catapult { namespace extensions {
 				config = std::make_optional(configIter);
 			}
 		}
-		SaveStateToDirectory(m_directory, cacheStorages, state, score, height, config, [&cacheDelta](const auto& storage, auto& outputStream) {
+		SaveStateToDirectory(m_directory, cacheStorages, state, score, height, config, m_maxWorkerThreads, [&cacheDelta](const auto& storage, auto& outputStream) {
 			storage.saveSummary(cacheDelta, outputStream);
 		});
 	}
@@ -264,7 +298,7 @@ namespace catapult { namespace extensions {
 			const model::ChainScore& score) {
 		SetCommitStep(dataDirectory, consumers::CommitOperationStep::Blocks_Written);
 
-		LocalNodeStateSerializer serializer(dataDirectory.dir("state.tmp"));
+		LocalNodeStateSerializer serializer(dataDirectory.dir("state.tmp"), nodeConfig.MaxStateFileThreads);
 
 		if (nodeConfig.ShouldUseCacheDatabaseStorage) {
 			auto storages = cache.storages();
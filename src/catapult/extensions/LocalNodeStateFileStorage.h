@@ -54,6 +54,7 @@ namespace catapult { namespace extensions {
 	bool HasActiveNetworkConfig(const config::CatapultDirectory& directory);
 
 	/// Loads catapult state into \a stateRef from \a directory given \a pluginManager.
+	/// \note Sub cache state files are loaded concurrently when the configured maximum number of state file threads is greater than one.
 	StateHeights LoadStateFromDirectory(
 			const config::CatapultDirectory& directory,
 			const LocalNodeStateRef& stateRef,
@@ -64,8 +65,8 @@ namespace catapult { namespace extensions {
 	/// Serializes local node state.
 	class LocalNodeStateSerializer {
 	public:
-		/// Creates a serializer around specified \a directory.
-		explicit LocalNodeStateSerializer(const config::CatapultDirectory& directory);
+		/// Creates a serializer around specified \a directory that uses up to \a maxWorkerThreads threads for saving sub cache data.
+		explicit LocalNodeStateSerializer(const config::CatapultDirectory& directory, uint32_t maxWorkerThreads = 1);
 
 	public:
 		/// Saves state composed of \a cache, \a state and \a score.
@@ -85,6 +86,7 @@ namespace catapult { namespace extensions {
 
 	private:
 		config::CatapultDirectory m_directory;
+		uint32_t m_maxWorkerThreads;
 	};
 	/// Loads the last active network configuration from a file.
 	const std::string LoadActiveNetworkConfigString(const config::CatapultDirectory& directory);
@@ -30,6 +30,10 @@ namespace catapult { namespace extensions {
 		storageConfig.PreferCacheDatabase = config.Node.ShouldUseCacheDatabaseStorage;
 		storageConfig.CacheDatabaseDirectory = (boost::filesystem::path(config.User.DataDirectory) / "statedb").generic_string();
 		storageConfig.MaxCacheDatabaseWriteBatchSize = config.Node.MaxCacheDatabaseWriteBatchSize;
+		storageConfig.CacheDatabaseTuning.BlockCacheSize = config.Node.CacheDatabaseBlockCacheSize;
+		storageConfig.CacheDatabaseTuning.BloomFilterBitsPerKey = config.Node.CacheDatabaseBloomFilterBitsPerKey;
+		storageConfig.CacheDatabaseTuning.CompressionMode = config.Node.CacheDatabaseCompressionMode;
+		storageConfig.CacheDatabaseTuning.ShouldSyncWrites = config.Node.ShouldSyncCacheDatabaseWrites;
 		return storageConfig;
 	}
 
@@ -25,6 +25,15 @@
 
 namespace catapult { namespace extensions {
 
+	namespace {
+		thread::IoThreadPoolOptions CreateThreadPoolOptions(const config::NodeConfiguration& nodeConfig) {
+			thread::IoThreadPoolOptions options;
+			options.Mode = nodeConfig.ShouldUseShardedThreadPool ? thread::IoThreadPoolMode::Sharded : thread::IoThreadPoolMode::Shared;
+			options.ShouldPinThreads = nodeConfig.ShouldPinThreadPoolThreads;
+			return options;
+		}
+	}
+
 	ProcessBootstrapper::ProcessBootstrapper(
 		const std::shared_ptr<config::BlockchainConfigurationHolder>& pConfigHolder,
 			const std::string& resourcesPath,
@@ -38,7 +47,8 @@ namespace catapult { namespace extensions {
 					thread::MultiServicePool::DefaultPoolConcurrency(),
 					m_pConfigHolder->Config().Node.ShouldUseSingleThreadPool
 							? thread::MultiServicePool::IsolatedPoolMode::Disabled
-							: thread::MultiServicePool::IsolatedPoolMode::Enabled))
+							: thread::MultiServicePool::IsolatedPoolMode::Enabled,
+					CreateThreadPoolOptions(m_pConfigHolder->Config().Node)))
 			, m_subscriptionManager(m_pConfigHolder->Config())
 			, m_pluginManager(m_pConfigHolder, CreateStorageConfiguration(m_pConfigHolder->Config()))
 	{}
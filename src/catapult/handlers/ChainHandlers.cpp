@@ -128,18 +128,8 @@ namespace catapult { namespace handlers {
 				auto numBlocks = ClampNumBlocks(info, config);
 				auto numResponseBytes = ClampNumResponseBytes(info, config);
 
-				uint32_t payloadSize = 0;
-				std::vector<std::shared_ptr<const model::Block>> blocks;
-				for (auto i = 0u; i < numBlocks; ++i) {
-					// always return at least one block
-					auto pBlock = storageView.loadBlock(info.pRequest->Height + Height(i));
-					if (!blocks.empty() && payloadSize + pBlock->Size > numResponseBytes)
-						break;
-
-					payloadSize += pBlock->Size;
-					blocks.push_back(std::move(pBlock));
-				}
-
+				// blocks are shared with the storage, so the payload references them instead of copying them
+				auto blocks = storageView.loadBlocks(info.pRequest->Height, numBlocks, numResponseBytes);
 				auto payload = ionet::PacketPayloadFactory::FromEntities(responseType, blocks);
 				context.response(std::move(payload));
 			};
@@ -21,6 +21,7 @@
 #include "TransactionHandlers.h"
 #include "HandlerUtils.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
+#include "catapult/utils/ShortHashSketch.h"
 
 namespace catapult { namespace handlers {
 
@@ -87,4 +88,88 @@ namespace catapult { namespace handlers {
 	void RegisterPullTransactionsHandler(ionet::ServerPacketHandlers& handlers, const UtRetriever& utRetriever) {
 		handlers.registerHandler(ionet::PacketType::Pull_Transactions, CreatePullTransactionsHandler(utRetriever));
 	}
+
+	namespace {
+		struct PullTransactionsSketchInfo {
+		public:
+			PullTransactionsSketchInfo() : IsValid(false)
+			{}
+
+		public:
+			bool IsValid;
+			BlockFeeMultiplier MinFeeMultiplier;
+			std::vector<utils::ShortHashSketchCell> SketchCells;
+		};
+
+		auto ProcessPullTransactionsSketchRequest(const ionet::Packet& packet) {
+			auto dataSize = ionet::CalculatePacketDataSize(packet);
+			if (dataSize < sizeof(BlockFeeMultiplier))
+				return PullTransactionsSketchInfo();
+
+			// data is prepended with min fee multiplier
+			PullTransactionsSketchInfo info;
+			info.MinFeeMultiplier = BlockFeeMultiplier(reinterpret_cast<const BlockFeeMultiplier::ValueType&>(*packet.Data()));
+			dataSize -= sizeof(BlockFeeMultiplier);
+
+			// followed by sketch cells
+			const auto* pCellDataStart = packet.Data() + sizeof(BlockFeeMultiplier);
+			auto numCells = ionet::CountFixedSizeStructures<utils::ShortHashSketchCell>({ pCellDataStart, dataSize });
+			if (0 == numCells || 0 != numCells % utils::ShortHashSketch::Num_Hash_Functions)
+				return PullTransactionsSketchInfo();
+
+			const auto* pCell = reinterpret_cast<const utils::ShortHashSketchCell*>(pCellDataStart);
+			info.SketchCells.assign(pCell, pCell + numCells);
+			info.IsValid = true;
+			return info;
+		}
+
+		auto CreatePullTransactionsSketchHandler(const UtShortHashesSupplier& utShortHashesSupplier, const UtRetriever& utRetriever) {
+			return [utShortHashesSupplier, utRetriever](const auto& packet, auto& context) {
+				auto info = ProcessPullTransactionsSketchRequest(packet);
+				if (!info.IsValid)
+					return;
+
+				// subtracting the remote sketch leaves a sketch of the short hashes known by only one of the nodes
+				auto shortHashes = utShortHashesSupplier();
+				utils::ShortHashSketch sketch(info.SketchCells.size());
+				for (auto shortHash : shortHashes)
+					sketch.insert(shortHash);
+
+				sketch.subtract(utils::ShortHashSketch(std::move(info.SketchCells)));
+
+				ionet::PacketPayloadBuilder builder(ionet::PacketType::Pull_Transactions_Sketch);
+				utils::ShortHashesSet localOnlyShortHashes;
+				utils::ShortHashesSet remoteOnlyShortHashes;
+				if (!sketch.tryDecode(localOnlyShortHashes, remoteOnlyShortHashes)) {
+					builder.appendValue(utils::ShortHashSketchDecodeResult::Failure);
+					context.response(builder.build());
+					return;
+				}
+
+				builder.appendValue(utils::ShortHashSketchDecodeResult::Success);
+				if (!localOnlyShortHashes.empty()) {
+					// remote node knows all local transactions except for the decoded local only ones
+					utils::ShortHashesSet knownShortHashes;
+					knownShortHashes.reserve(shortHashes.size());
+					for (auto shortHash : shortHashes) {
+						if (localOnlyShortHashes.cend() == localOnlyShortHashes.find(shortHash))
+							knownShortHashes.insert(shortHash);
+					}
+
+					builder.appendEntities(utRetriever(info.MinFeeMultiplier, knownShortHashes));
+				}
+
+				context.response(builder.build());
+			};
+		}
+	}
+
+	void RegisterPullTransactionsSketchHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const UtShortHashesSupplier& utShortHashesSupplier,
+			const UtRetriever& utRetriever) {
+		handlers.registerHandler(
+				ionet::PacketType::Pull_Transactions_Sketch,
+				CreatePullTransactionsSketchHandler(utShortHashesSupplier, utRetriever));
+	}
 }}
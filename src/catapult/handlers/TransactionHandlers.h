@@ -24,6 +24,7 @@
 #include "catapult/model/RangeTypes.h"
 #include "catapult/model/Transaction.h"
 #include "catapult/utils/ShortHash.h"
+#include "catapult/functions.h"
 #include <unordered_set>
 
 namespace catapult { namespace handlers {
@@ -45,4 +46,16 @@ namespace catapult { namespace handlers {
 	/// Registers a pull transactions handler in \a handlers that responds with unconfirmed transactions
 	/// returned by the retriever (\a utRetriever).
 	void RegisterPullTransactionsHandler(ionet::ServerPacketHandlers& handlers, const UtRetriever& utRetriever);
+
+	/// Prototype for a function that supplies the short hashes of all unconfirmed transactions.
+	using UtShortHashesSupplier = supplier<model::ShortHashRange>;
+
+	/// Registers a pull transactions sketch handler in \a handlers that decodes the difference between the short hashes
+	/// supplied by \a utShortHashesSupplier and a remote short hash sketch and responds with the unconfirmed transactions
+	/// unknown to the remote node returned by the retriever (\a utRetriever).
+	/// \note The response is prefixed with a utils::ShortHashSketchDecodeResult, transactions are only present on success.
+	void RegisterPullTransactionsSketchHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const UtShortHashesSupplier& utShortHashesSupplier,
+			const UtRetriever& utRetriever);
 }}
@@ -28,42 +28,6 @@ namespace catapult { namespace harvesting {
 	namespace {
 		using TransactionInfoPointers = std::vector<const model::TransactionInfo*>;
 
-		enum class SortDirection { Ascending, Descending };
-
-		enum class LimitedTransactionsPlace { Left, Right };
-
-		template<SortDirection Direction, LimitedTransactionsPlace LimitedTransactionsPlace>
-		class MaxFeeMultiplierComparer {
-		public:
-			explicit MaxFeeMultiplierComparer(const model::TransactionFeeCalculator& transactionFeeCalculator)
-				: m_transactionFeeCalculator(transactionFeeCalculator)
-			{}
-
-		public:
-			bool operator()(const model::TransactionInfo* pLhs, const model::TransactionInfo* pRhs) const {
-				// Move limited fee transactions (that are actually without fees) to the required end, left or right.
-				bool isLeftLimitedFee = m_transactionFeeCalculator.isTransactionFeeLimited(pLhs->pEntity->Type, pLhs->pEntity->EntityVersion());
-				bool isRightLimitedFee = m_transactionFeeCalculator.isTransactionFeeLimited(pRhs->pEntity->Type, pRhs->pEntity->EntityVersion());
-				if (isLeftLimitedFee && isRightLimitedFee) {
-					return false;
-				} else if (isLeftLimitedFee) {
-					return (LimitedTransactionsPlace == LimitedTransactionsPlace::Left);
-				} else if (isRightLimitedFee) {
-					return (LimitedTransactionsPlace == LimitedTransactionsPlace::Right);
-				}
-
-				// Sort all others.
-				auto lhsMaxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*pLhs->pEntity);
-				auto rhsMaxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*pRhs->pEntity);
-				return SortDirection::Ascending == Direction
-						? lhsMaxFeeMultiplier < rhsMaxFeeMultiplier
-						: lhsMaxFeeMultiplier > rhsMaxFeeMultiplier;
-			}
-
-		private:
-			const model::TransactionFeeCalculator& m_transactionFeeCalculator;
-		};
-
 		TransactionsInfo ToTransactionsInfo(TransactionInfoPointers&& transactionInfoPointers, BlockFeeMultiplier feeMultiplier) {
 			TransactionsInfo transactionsInfo;
 			transactionsInfo.FeeMultiplier = feeMultiplier;
@@ -81,21 +45,33 @@ namespace catapult { namespace harvesting {
 				stopCallback);
 
 			// 2. pick the smallest multiplier so that all transactions pass validation
+			//    (transactions with limited fees are ignored unless there are no other transactions)
+			const auto& transactionFeeCalculator = utCacheView.transactionFeeCalculator();
 			auto minFeeMultiplier = BlockFeeMultiplier();
-			if (!candidates.empty()) {
-				auto comparer = MaxFeeMultiplierComparer<SortDirection::Ascending, LimitedTransactionsPlace::Right>(utCacheView.transactionFeeCalculator());
-				auto minIter = std::min_element(candidates.cbegin(), candidates.cend(), comparer);
-				minFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*(*minIter)->pEntity);
+			auto hasUnlimitedFeeTransaction = false;
+			for (const auto* pTransactionInfo : candidates) {
+				const auto& transaction = *pTransactionInfo->pEntity;
+				if (transactionFeeCalculator.isTransactionFeeLimited(transaction.Type, transaction.EntityVersion()))
+					continue;
+
+				auto maxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(transaction);
+				if (!hasUnlimitedFeeTransaction || maxFeeMultiplier < minFeeMultiplier)
+					minFeeMultiplier = maxFeeMultiplier;
+
+				hasUnlimitedFeeTransaction = true;
 			}
 
+			if (!hasUnlimitedFeeTransaction && !candidates.empty())
+				minFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*candidates.front()->pEntity);
+
 			return ToTransactionsInfo(std::move(candidates), minFeeMultiplier);
 		}
 
 		TransactionsInfo SupplyMinimumFee(const cache::MemoryUtCacheView& utCacheView, HarvestingUtFacade& utFacade, uint32_t count, const cache::StopTransactionFetchingFunc& stopCallback) {
-			// 1. get all transactions from the ut cache
+			// 1. get transactions from the ut cache in ascending order of max fee multipliers
 			const auto& transactionFeeCalculator = utCacheView.transactionFeeCalculator();
-			auto comparer = MaxFeeMultiplierComparer<SortDirection::Ascending, LimitedTransactionsPlace::Left>(transactionFeeCalculator);
-			auto candidates = cache::GetFirstTransactionInfoPointers(utCacheView, count, comparer, [&utFacade](const auto& transactionInfo) {
+			auto order = cache::MaxFeeMultiplierOrder::Ascending;
+			auto candidates = cache::GetFirstTransactionInfoPointers(utCacheView, count, order, [&utFacade](const auto& transactionInfo) {
 					return utFacade.apply(transactionInfo);
 				},
 				stopCallback);
@@ -114,11 +90,11 @@ namespace catapult { namespace harvesting {
 		}
 
 		TransactionsInfo SupplyMaximumFee(const cache::MemoryUtCacheView& utCacheView, HarvestingUtFacade& utFacade, uint32_t count, const cache::StopTransactionFetchingFunc& stopCallback) {
-			// 1. get all transactions from the ut cache
-			auto comparer = MaxFeeMultiplierComparer<SortDirection::Descending, LimitedTransactionsPlace::Left>(utCacheView.transactionFeeCalculator());
+			// 1. get transactions from the ut cache in descending order of max fee multipliers
+			auto order = cache::MaxFeeMultiplierOrder::Descending;
 			auto maximizer = TransactionFeeMaximizer();
 			auto numLimitedFeeTransactions = 0u;
-			auto candidates = cache::GetFirstTransactionInfoPointers(utCacheView, count, comparer,
+			auto candidates = cache::GetFirstTransactionInfoPointers(utCacheView, count, order,
 						[&utFacade, &maximizer, &numLimitedFeeTransactions, &transactionFeeCalculator=utCacheView.transactionFeeCalculator()](const auto& transactionInfo) {
 					if (!utFacade.apply(transactionInfo))
 						return false;
@@ -69,6 +69,10 @@ namespace catapult { namespace io {
 				return m_pStorage->loadBlockStatementData(height);
 			}
 
+			std::vector<std::shared_ptr<const model::Block>> loadBlocks(Height height, size_t maxBlocks, size_t maxBytes) const override {
+				return m_pStorage->loadBlocks(height, maxBlocks, maxBytes);
+			}
+
 			// endregion
 
 		private:
@@ -27,7 +27,7 @@ namespace catapult { namespace io {
 	// region ReadBlockElement
 
 	namespace {
-		auto ReadBlockElementImpl(InputStream& inputStream) {
+		auto ReadBlock(InputStream& inputStream) {
 			auto size = Read32(inputStream);
 
 			// read block
@@ -35,8 +35,12 @@ namespace catapult { namespace io {
 			pBlock->Size = size;
 			inputStream.read({ reinterpret_cast<uint8_t*>(pBlock.get()) + sizeof(uint32_t), size - sizeof(uint32_t) });
 
+			return pBlock;
+		}
+
+		auto ReadBlockElementMetadata(const std::shared_ptr<model::Block>& pBlock, InputStream& inputStream) {
 			// create the block element
-			auto pBlockElement = std::make_shared<model::BlockElement>(std::move(pBlock));
+			auto pBlockElement = std::make_shared<model::BlockElement>(pBlock);
 
 			// read metadata
 			inputStream.read(pBlockElement->EntityHash);
@@ -65,7 +69,11 @@ namespace catapult { namespace io {
 	}
 
 	std::shared_ptr<model::BlockElement> ReadBlockElement(InputStream& inputStream) {
-		auto pBlockElement = ReadBlockElementImpl(inputStream);
+		return ReadBlockElement(ReadBlock(inputStream), inputStream);
+	}
+
+	std::shared_ptr<model::BlockElement> ReadBlockElement(const std::shared_ptr<model::Block>& pBlock, InputStream& inputStream) {
+		auto pBlockElement = ReadBlockElementMetadata(pBlock, inputStream);
 		ReadTransactionHashes(inputStream, *pBlockElement);
 		ReadSubCacheMerkleRoots(inputStream, pBlockElement->SubCacheMerkleRoots);
 		return pBlockElement;
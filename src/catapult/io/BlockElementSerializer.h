@@ -35,6 +35,10 @@ namespace catapult { namespace io {
 	/// \note Shared pointer is returned for memory management reasons.
 	std::shared_ptr<model::BlockElement> ReadBlockElement(InputStream& inputStream);
 
+	/// Reads block element metadata from \a inputStream into a block element around \a pBlock.
+	/// \note \a inputStream is expected to be positioned after the block data.
+	std::shared_ptr<model::BlockElement> ReadBlockElement(const std::shared_ptr<model::Block>& pBlock, InputStream& inputStream);
+
 	/// Writes \a blockElement into \a outputStream.
 	void WriteBlockElement(OutputStream& outputStream, const model::BlockElement& blockElement);
 }}
@@ -0,0 +1,36 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "BlockStorage.h"
+#include "catapult/exceptions.h"
+#include <sstream>
+
+namespace catapult { namespace io {
+
+	std::vector<std::shared_ptr<const model::Block>> BlockStorage::loadBlocks(Height height, size_t maxBlocks, size_t maxBytes) const {
+		auto chainHeight = this->chainHeight();
+		if (height > chainHeight) {
+			std::ostringstream out;
+			out << "cannot load blocks at height (" << height << ") greater than chain height (" << chainHeight << ")";
+			CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
+		}
+
+		auto numBlocks = std::min<uint64_t>(maxBlocks, (chainHeight - height).unwrap() + 1);
+
+		size_t numBytes = 0;
+		std::vector<std::shared_ptr<const model::Block>> blocks;
+		for (auto i = 0u; i < numBlocks; ++i) {
+			auto pBlock = loadBlock(height + Height(i));
+			if (!blocks.empty() && numBytes + pBlock->Size > maxBytes)
+				break;
+
+			numBytes += pBlock->Size;
+			blocks.push_back(std::move(pBlock));
+		}
+
+		return blocks;
+	}
+}}
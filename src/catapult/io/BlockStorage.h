@@ -59,6 +59,10 @@ namespace catapult { namespace io {
 
 		/// Returns the optional block statement data at \a height.
 		virtual std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const = 0;
+
+		/// Returns at most \a maxBlocks consecutive blocks starting at \a height with a total size of at most \a maxBytes.
+		/// \note At least one block is always returned and loading stops at the chain height.
+		virtual std::vector<std::shared_ptr<const model::Block>> loadBlocks(Height height, size_t maxBlocks, size_t maxBytes) const;
 	};
 
 	/// Interface that allows saving, loading and pruning blocks.
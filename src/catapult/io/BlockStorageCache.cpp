@@ -20,6 +20,10 @@
 
 #include "BlockStorageCache.h"
 #include "MoveBlockFiles.h"
+#include "catapult/utils/Hashers.h"
+#include <list>
+#include <mutex>
+#include <unordered_map>
 
 namespace catapult { namespace io {
 
@@ -32,26 +36,104 @@ namespace catapult { namespace io {
 	// region CachedData
 
 	struct CachedData {
+	private:
+		using BlockStatementData = std::pair<std::vector<uint8_t>, bool>;
+
+		struct Entry {
+			catapult::Height Height;
+			std::shared_ptr<const model::BlockElement> pBlockElement;
+			std::shared_ptr<const BlockStatementData> pBlockStatementData;
+			size_t Size;
+		};
+
+		using Entries = std::list<Entry>;
+
+	public:
+		explicit CachedData(size_t maxSize)
+				: m_maxSize(maxSize)
+				, m_size(0)
+				, m_numHits(0)
+				, m_numMisses(0)
+		{}
+
 	public:
 		Height height() const {
 			return m_pBlockElement ? m_pBlockElement->Block.Height : Height(0);
 		}
 
-		std::shared_ptr<const model::Block> block(Height) const {
-			return BlockElementAsSharedBlock(m_pBlockElement);
+		std::shared_ptr<const model::Block> block(Height height, const BlockStorage& storage) const {
+			if (!m_maxSize && !contains(height)) {
+				++m_numMisses;
+				return storage.loadBlock(height);
+			}
+
+			return BlockElementAsSharedBlock(blockElement(height, storage));
 		}
 
-		std::shared_ptr<const model::BlockElement> blockElement(Height) const {
-			return m_pBlockElement;
+		std::shared_ptr<const model::BlockElement> blockElement(Height height, const BlockStorage& storage) const {
+			if (contains(height)) {
+				++m_numHits;
+				return m_pBlockElement;
+			}
+
+			return load(height, &Entry::pBlockElement, [&storage, height]() {
+				return storage.loadBlockElement(height);
+			});
 		}
 
-	public:
-		bool contains(Height height) const {
-			return height == m_pBlockElement->Block.Height;
+		std::shared_ptr<const model::Block> tryBlock(Height height) const {
+			if (contains(height)) {
+				++m_numHits;
+				return BlockElementAsSharedBlock(m_pBlockElement);
+			}
+
+			std::lock_guard<std::mutex> guard(m_mutex);
+			auto indexIter = m_index.find(height);
+			if (m_index.cend() == indexIter || !indexIter->second->pBlockElement)
+				return nullptr;
+
+			++m_numHits;
+			m_entries.splice(m_entries.begin(), m_entries, indexIter->second);
+			return BlockElementAsSharedBlock(indexIter->second->pBlockElement);
+		}
+
+		bool containsBlock(Height height) const {
+			if (contains(height))
+				return true;
+
+			std::lock_guard<std::mutex> guard(m_mutex);
+			auto indexIter = m_index.find(height);
+			return m_index.cend() != indexIter && indexIter->second->pBlockElement;
+		}
+
+		void addMisses(uint64_t numMisses) const {
+			m_numMisses += numMisses;
+		}
+
+		BlockStatementData blockStatementData(Height height, const BlockStorage& storage) const {
+			if (!m_maxSize) {
+				++m_numMisses;
+				return storage.loadBlockStatementData(height);
+			}
+
+			return *load(height, &Entry::pBlockStatementData, [&storage, height]() {
+				return std::make_shared<const BlockStatementData>(storage.loadBlockStatementData(height));
+			});
+		}
+
+		BlockStorageCacheStatistics statistics() const {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			return { m_numHits, m_numMisses, m_entries.size(), m_size };
 		}
 
 	public:
 		void update(const std::shared_ptr<const model::BlockElement>& pBlockElement) {
+			// previous most recent block element is still part of the chain
+			if (m_pBlockElement && m_pBlockElement->Block.Height < pBlockElement->Block.Height) {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				insert(m_pBlockElement->Block.Height, &Entry::pBlockElement, m_pBlockElement);
+			}
+
 			m_pBlockElement = pBlockElement;
 		}
 
@@ -59,8 +141,104 @@ namespace catapult { namespace io {
 			m_pBlockElement.reset();
 		}
 
+		void removeAfter(Height height) {
+			if (height < this->height())
+				reset();
+
+			std::lock_guard<std::mutex> guard(m_mutex);
+			for (auto iter = m_entries.begin(); m_entries.end() != iter;) {
+				if (iter->Height > height)
+					iter = remove(iter);
+				else
+					++iter;
+			}
+		}
+
+	private:
+		bool contains(Height height) const {
+			return m_pBlockElement && height == m_pBlockElement->Block.Height;
+		}
+
+		template<typename TValue, typename TLoader>
+		std::shared_ptr<const TValue> load(Height height, std::shared_ptr<const TValue> Entry::* pValue, TLoader loader) const {
+			if (!m_maxSize) {
+				++m_numMisses;
+				return loader();
+			}
+
+			{
+				std::lock_guard<std::mutex> guard(m_mutex);
+				auto indexIter = m_index.find(height);
+				if (m_index.cend() != indexIter && (*indexIter->second).*pValue) {
+					++m_numHits;
+					m_entries.splice(m_entries.begin(), m_entries, indexIter->second);
+					return (*indexIter->second).*pValue;
+				}
+
+				++m_numMisses;
+			}
+
+			// storage is accessed without holding the mutex, so that other readers are not blocked
+			auto pLoadedValue = loader();
+
+			std::lock_guard<std::mutex> guard(m_mutex);
+			insert(height, pValue, pLoadedValue);
+			return pLoadedValue;
+		}
+
+		template<typename TValue>
+		void insert(Height height, std::shared_ptr<const TValue> Entry::* pValue, const std::shared_ptr<const TValue>& pNewValue) const {
+			if (!m_maxSize)
+				return;
+
+			auto indexIter = m_index.find(height);
+			if (m_index.cend() == indexIter) {
+				m_entries.push_front(Entry{ height, nullptr, nullptr, 0 });
+				indexIter = m_index.emplace(height, m_entries.begin()).first;
+			} else {
+				m_entries.splice(m_entries.begin(), m_entries, indexIter->second);
+			}
+
+			auto& entry = *indexIter->second;
+			if (!(entry.*pValue)) {
+				entry.*pValue = pNewValue;
+				auto valueSize = CalculateSize(*pNewValue);
+				entry.Size += valueSize;
+				m_size += valueSize;
+			}
+
+			while (m_size > m_maxSize && !m_entries.empty())
+				remove(std::prev(m_entries.end()));
+		}
+
+		Entries::iterator remove(Entries::iterator iter) const {
+			m_size -= iter->Size;
+			m_index.erase(iter->Height);
+			return m_entries.erase(iter);
+		}
+
+		static size_t CalculateSize(const model::BlockElement& blockElement) {
+			return sizeof(model::BlockElement)
+					+ blockElement.Block.Size
+					+ blockElement.Transactions.size() * sizeof(model::TransactionElement)
+					+ blockElement.SubCacheMerkleRoots.size() * Hash256_Size;
+		}
+
+		static size_t CalculateSize(const BlockStatementData& blockStatementData) {
+			return sizeof(BlockStatementData) + blockStatementData.first.size();
+		}
+
 	private:
 		std::shared_ptr<const model::BlockElement> m_pBlockElement;
+
+		// readers share a reader lock, so the least recently used cache needs its own synchronization
+		size_t m_maxSize;
+		mutable Entries m_entries; // most recently used first
+		mutable std::unordered_map<Height, Entries::iterator, utils::BaseValueHasher<Height>> m_index;
+		mutable size_t m_size;
+		mutable std::atomic<uint64_t> m_numHits;
+		mutable std::atomic<uint64_t> m_numMisses;
+		mutable std::mutex m_mutex;
 	};
 
 	// endregion
@@ -86,23 +264,66 @@ namespace catapult { namespace io {
 
 	std::shared_ptr<const model::Block> BlockStorageView::loadBlock(Height height) const {
 		requireHeight(height, "block");
-		if (m_cachedData.contains(height))
-			return m_cachedData.block(height);
-
-		return m_storage.loadBlock(height);
+		return m_cachedData.block(height, m_storage);
 	}
 
 	std::shared_ptr<const model::BlockElement> BlockStorageView::loadBlockElement(Height height) const {
 		requireHeight(height, "block element");
-		if (m_cachedData.contains(height))
-			return m_cachedData.blockElement(height);
-
-		return m_storage.loadBlockElement(height);
+		return m_cachedData.blockElement(height, m_storage);
 	}
 
 	std::pair<std::vector<uint8_t>, bool> BlockStorageView::loadBlockStatementData(Height height) const {
 		requireHeight(height, "block statement data");
-		return m_storage.loadBlockStatementData(height);
+		return m_cachedData.blockStatementData(height, m_storage);
+	}
+
+	std::vector<std::shared_ptr<const model::Block>> BlockStorageView::loadBlocks(Height height, size_t maxBlocks, size_t maxBytes) const {
+		requireHeight(height, "blocks");
+
+		auto endHeight = height + Height(std::min<uint64_t>(maxBlocks, (chainHeight() - height).unwrap() + 1));
+
+		size_t numBytes = 0;
+		std::vector<std::shared_ptr<const model::Block>> blocks;
+		auto tryAppend = [maxBytes, &numBytes, &blocks](std::shared_ptr<const model::Block>&& pBlock) {
+			if (!blocks.empty() && numBytes + pBlock->Size > maxBytes)
+				return false;
+
+			numBytes += pBlock->Size;
+			blocks.push_back(std::move(pBlock));
+			return true;
+		};
+
+		// cached blocks are served from memory, only runs of uncached blocks are read from the underlying storage
+		while (height < endHeight) {
+			auto pBlock = m_cachedData.tryBlock(height);
+			if (pBlock) {
+				if (!tryAppend(std::move(pBlock)))
+					break;
+
+				height = height + Height(1);
+				continue;
+			}
+
+			auto uncachedEndHeight = height + Height(1);
+			while (uncachedEndHeight < endHeight && !m_cachedData.containsBlock(uncachedEndHeight))
+				uncachedEndHeight = uncachedEndHeight + Height(1);
+
+			auto numUncachedBlocks = (uncachedEndHeight - height).unwrap();
+			auto uncachedBlocks = m_storage.loadBlocks(height, numUncachedBlocks, numBytes < maxBytes ? maxBytes - numBytes : 0);
+			m_cachedData.addMisses(uncachedBlocks.size());
+			for (auto& pUncachedBlock : uncachedBlocks) {
+				if (!tryAppend(std::move(pUncachedBlock)))
+					return blocks;
+			}
+
+			// storage stops early only when the byte budget is exhausted
+			if (uncachedBlocks.size() < numUncachedBlocks)
+				break;
+
+			height = uncachedEndHeight;
+		}
+
+		return blocks;
 	}
 
 	void BlockStorageView::requireHeight(Height height, const char* description) const {
@@ -150,7 +371,8 @@ namespace catapult { namespace io {
 		// 1. apply staging changes to permananent storage
 		MoveBlockFiles(m_stagingStorage, m_storage, m_saveStartHeight + Height(1));
 
-		// 2. update cache
+		// 2. update cache (blocks after save start height might have been replaced)
+		m_cachedData.removeAfter(m_saveStartHeight);
 		auto newChainHeight = m_storage.chainHeight();
 		if (newChainHeight > Height(0))
 			m_cachedData.update(m_storage.loadBlockElement(newChainHeight));
@@ -163,9 +385,16 @@ namespace catapult { namespace io {
 	// region BlockStorageCache
 
 	BlockStorageCache::BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, std::unique_ptr<PrunableBlockStorage>&& pStagingStorage)
+			: BlockStorageCache(std::move(pStorage), std::move(pStagingStorage), utils::FileSize())
+	{}
+
+	BlockStorageCache::BlockStorageCache(
+			std::unique_ptr<BlockStorage>&& pStorage,
+			std::unique_ptr<PrunableBlockStorage>&& pStagingStorage,
+			utils::FileSize maxCacheSize)
 			: m_pStorage(std::move(pStorage))
 			, m_pStagingStorage(std::move(pStagingStorage))
-			, m_pCachedData(std::make_unique<CachedData>()) {
+			, m_pCachedData(std::make_unique<CachedData>(maxCacheSize.bytes())) {
 		m_pCachedData->update(m_pStorage->loadBlockElement(m_pStorage->chainHeight()));
 	}
 
@@ -179,5 +408,9 @@ namespace catapult { namespace io {
 		return BlockStorageModifier(*m_pStorage, *m_pStagingStorage, m_lock.acquireReader(), *m_pCachedData);
 	}
 
+	BlockStorageCacheStatistics BlockStorageCache::statistics() const {
+		return m_pCachedData->statistics();
+	}
+
 	// endregion
 }}
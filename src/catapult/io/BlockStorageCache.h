@@ -20,6 +20,7 @@
 
 #pragma once
 #include "BlockStorage.h"
+#include "catapult/utils/FileSize.h"
 #include "catapult/utils/SpinReaderWriterLock.h"
 
 namespace catapult { namespace io { struct CachedData; } }
@@ -51,6 +52,10 @@ namespace catapult { namespace io {
 		/// Returns the optional block statement data at \a height.
 		std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const;
 
+		/// Returns at most \a maxBlocks consecutive blocks starting at \a height with a total size of at most \a maxBytes.
+		/// \note At least one block is always returned.
+		std::vector<std::shared_ptr<const model::Block>> loadBlocks(Height height, size_t maxBlocks, size_t maxBytes) const;
+
 	private:
 		void requireHeight(Height height, const char* description) const;
 
@@ -92,13 +97,38 @@ namespace catapult { namespace io {
 		Height m_saveStartHeight;
 	};
 
+	/// Block storage cache statistics.
+	struct BlockStorageCacheStatistics {
+		/// Number of block elements and statements loaded from the cache.
+		uint64_t NumHits;
+
+		/// Number of block elements and statements loaded from the storage.
+		uint64_t NumMisses;
+
+		/// Number of cached heights.
+		uint64_t NumEntries;
+
+		/// Estimated memory used by cached heights in bytes.
+		uint64_t Size;
+	};
+
 	/// A cache around a BlockStorage.
-	/// \note Currently this "cache" provides synchronization and support for two-phase commit.
+	/// \note This cache provides synchronization and support for two-phase commit.
+	///       The most recent block element is always cached, recently loaded block elements and statements are cached
+	///       in a size bounded least recently used cache.
 	class BlockStorageCache {
 	public:
 		/// Creates a new cache around \a pStorage that uses \a pStagingStorage for staging blocks in order to enable two-phase commit.
+		/// Only the most recent block element is cached.
 		BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, std::unique_ptr<PrunableBlockStorage>&& pStagingStorage);
 
+		/// Creates a new cache around \a pStorage that uses \a pStagingStorage for staging blocks in order to enable two-phase commit.
+		/// Recently loaded block elements and statements are cached up to \a maxCacheSize.
+		BlockStorageCache(
+				std::unique_ptr<BlockStorage>&& pStorage,
+				std::unique_ptr<PrunableBlockStorage>&& pStagingStorage,
+				utils::FileSize maxCacheSize);
+
 		/// Destroys the cache.
 		~BlockStorageCache();
 
@@ -109,6 +139,9 @@ namespace catapult { namespace io {
 		/// Gets a write only view of the storage.
 		BlockStorageModifier modifier();
 
+		/// Gets the cache statistics.
+		BlockStorageCacheStatistics statistics() const;
+
 	private:
 		std::unique_ptr<BlockStorage> m_pStorage;
 		std::unique_ptr<PrunableBlockStorage> m_pStagingStorage;
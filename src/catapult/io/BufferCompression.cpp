@@ -0,0 +1,168 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "BufferCompression.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace catapult { namespace io {
+
+	namespace {
+		constexpr size_t Min_Match_Size = 4;
+		constexpr size_t Max_Match_Offset = 64 * 1024;
+		constexpr uint32_t Hash_Table_Bits = 14;
+		constexpr uint32_t Unused_Position = std::numeric_limits<uint32_t>::max();
+		constexpr size_t Max_Reserved_Decompressed_Size = 16 * 1024 * 1024;
+
+		uint32_t Read32(const uint8_t* pData) {
+			uint32_t value;
+			std::memcpy(&value, pData, sizeof(uint32_t));
+			return value;
+		}
+
+		uint32_t HashSequence(const uint8_t* pData) {
+			return (Read32(pData) * 2654435761u) >> (32 - Hash_Table_Bits);
+		}
+
+		void WriteVarint(std::vector<uint8_t>& output, uint64_t value) {
+			while (value >= 0x80) {
+				output.push_back(static_cast<uint8_t>(value | 0x80));
+				value >>= 7;
+			}
+
+			output.push_back(static_cast<uint8_t>(value));
+		}
+
+		void WriteLiterals(std::vector<uint8_t>& output, const uint8_t* pLiterals, size_t numLiterals) {
+			WriteVarint(output, numLiterals);
+			output.insert(output.end(), pLiterals, pLiterals + numLiterals);
+		}
+
+		class CompressedBufferReader {
+		public:
+			explicit CompressedBufferReader(const RawBuffer& buffer)
+					: m_buffer(buffer)
+					, m_position(0)
+			{}
+
+		public:
+			bool eof() const {
+				return m_position == m_buffer.Size;
+			}
+
+			uint64_t readVarint() {
+				uint64_t value = 0;
+				for (auto shift = 0u; shift < 64; shift += 7) {
+					requireSize(1);
+					auto byte = m_buffer.pData[m_position++];
+					value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+					if (0 == (byte & 0x80))
+						return value;
+				}
+
+				CATAPULT_THROW_INVALID_ARGUMENT("compressed buffer contains malformed varint");
+			}
+
+			const uint8_t* readBytes(size_t size) {
+				requireSize(size);
+				const auto* pData = m_buffer.pData + m_position;
+				m_position += size;
+				return pData;
+			}
+
+		private:
+			void requireSize(uint64_t size) const {
+				if (m_buffer.Size - m_position < size)
+					CATAPULT_THROW_INVALID_ARGUMENT_1("compressed buffer is truncated at position", m_position);
+			}
+
+		private:
+			RawBuffer m_buffer;
+			size_t m_position;
+		};
+	}
+
+	std::vector<uint8_t> CompressBuffer(const RawBuffer& buffer) {
+		std::vector<uint8_t> output;
+		output.reserve(buffer.Size / 2 + 16);
+
+		std::vector<uint32_t> hashTable(1u << Hash_Table_Bits, Unused_Position);
+		const auto* pData = buffer.pData;
+		size_t anchor = 0;
+		size_t position = 0;
+		while (position + Min_Match_Size <= buffer.Size) {
+			auto& candidatePosition = hashTable[HashSequence(pData + position)];
+			auto matchPosition = candidatePosition;
+			candidatePosition = static_cast<uint32_t>(position);
+
+			if (Unused_Position == matchPosition
+					|| position - matchPosition > Max_Match_Offset
+					|| Read32(pData + matchPosition) != Read32(pData + position)) {
+				++position;
+				continue;
+			}
+
+			auto matchSize = Min_Match_Size;
+			while (position + matchSize < buffer.Size && pData[matchPosition + matchSize] == pData[position + matchSize])
+				++matchSize;
+
+			WriteLiterals(output, pData + anchor, position - anchor);
+			WriteVarint(output, matchSize);
+			WriteVarint(output, position - matchPosition);
+
+			position += matchSize;
+			anchor = position;
+		}
+
+		// the encoding always ends with a (possibly empty) literals run
+		WriteLiterals(output, pData + anchor, buffer.Size - anchor);
+		return output;
+	}
+
+	std::vector<uint8_t> DecompressBuffer(const RawBuffer& buffer, size_t decompressedSize) {
+		// decompressedSize is untrusted, so only a bounded amount of memory is reserved up front
+		std::vector<uint8_t> output;
+		output.reserve(std::min(decompressedSize, Max_Reserved_Decompressed_Size));
+
+		auto requireCapacity = [&output, decompressedSize](uint64_t size) {
+			if (decompressedSize - output.size() < size)
+				CATAPULT_THROW_INVALID_ARGUMENT_1("compressed buffer decompresses into more bytes than", decompressedSize);
+		};
+
+		CompressedBufferReader reader(buffer);
+		while (true) {
+			auto numLiterals = reader.readVarint();
+			requireCapacity(numLiterals);
+			const auto* pLiterals = reader.readBytes(numLiterals);
+			output.insert(output.end(), pLiterals, pLiterals + numLiterals);
+
+			if (reader.eof())
+				break;
+
+			auto matchSize = reader.readVarint();
+			auto matchOffset = reader.readVarint();
+			if (matchSize < Min_Match_Size || 0 == matchOffset || matchOffset > output.size())
+				CATAPULT_THROW_INVALID_ARGUMENT_1("compressed buffer contains invalid match at decompressed position", output.size());
+
+			// the match must fit into the remaining output before any of it is copied
+			requireCapacity(matchSize);
+
+			// matches can overlap the bytes they produce, so they must be copied byte by byte
+			auto sourceIndex = output.size() - static_cast<size_t>(matchOffset);
+			auto destinationIndex = output.size();
+			output.resize(destinationIndex + static_cast<size_t>(matchSize));
+			for (size_t i = 0; i < matchSize; ++i)
+				output[destinationIndex + i] = output[sourceIndex + i];
+		}
+
+		if (decompressedSize != output.size())
+			CATAPULT_THROW_INVALID_ARGUMENT_1("compressed buffer decompresses into fewer bytes than", decompressedSize);
+
+		return output;
+	}
+}}
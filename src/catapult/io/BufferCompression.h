@@ -0,0 +1,21 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#pragma once
+#include "catapult/types.h"
+#include <vector>
+
+namespace catapult { namespace io {
+
+	/// Compresses \a buffer using a byte oriented lz77 encoding.
+	/// \note The encoding is a sequence of (literals, match) pairs, where each match references previously decoded bytes,
+	///       so it is effective for buffers containing repeated byte ranges (e.g. serialized cache entries sharing keys).
+	std::vector<uint8_t> CompressBuffer(const RawBuffer& buffer);
+
+	/// Decompresses \a buffer, which was compressed by CompressBuffer, into a buffer of \a decompressedSize bytes.
+	/// \throws catapult_invalid_argument if \a buffer is malformed or does not decompress into exactly \a decompressedSize bytes.
+	std::vector<uint8_t> DecompressBuffer(const RawBuffer& buffer, size_t decompressedSize);
+}}
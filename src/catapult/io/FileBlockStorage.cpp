@@ -23,6 +23,7 @@
 #include "BlockStatementSerializer.h"
 #include "BufferedFileStream.h"
 #include "FilesystemUtils.h"
+#include "PackFileBlockStorage.h"
 #include "PodIoUtils.h"
 #include <inttypes.h>
 
@@ -156,14 +157,31 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region GetFileBlockStorageMode
+
+	namespace {
+		constexpr auto Packs_Directory_Name = "packs";
+	}
+
+	FileBlockStorageMode GetFileBlockStorageMode(const std::string& dataDirectory) {
+		auto packsIndexPath = boost::filesystem::path(dataDirectory) / Packs_Directory_Name / "index.dat";
+		return IsRegularFile(packsIndexPath) ? FileBlockStorageMode::Pack_File : FileBlockStorageMode::Hash_Index;
+	}
+
+	// endregion
+
 	// region ctor
 
 	FileBlockStorage::FileBlockStorage(const std::string& dataDirectory, FileBlockStorageMode mode)
 			: m_dataDirectory(dataDirectory)
 			, m_mode(mode)
 			, m_hashFile(m_dataDirectory)
-			, m_indexFile((boost::filesystem::path(m_dataDirectory) / "index.dat").generic_string())
-	{}
+			, m_indexFile((boost::filesystem::path(m_dataDirectory) / "index.dat").generic_string()) {
+		if (FileBlockStorageMode::Pack_File == m_mode)
+			m_pPackStorage = std::make_unique<PackFileBlockStorage>((boost::filesystem::path(m_dataDirectory) / Packs_Directory_Name).generic_string());
+	}
+
+	FileBlockStorage::~FileBlockStorage() = default;
 
 	// endregion
 
@@ -192,10 +210,16 @@ namespace catapult { namespace io {
 	}
 
 	Height FileBlockStorage::chainHeight() const {
+		if (m_pPackStorage)
+			return m_pPackStorage->chainHeight();
+
 		return m_indexFile.exists() ? Height(m_indexFile.get()) : Height(0);
 	}
 
 	model::HashRange FileBlockStorage::loadHashesFrom(Height height, size_t maxHashes) const {
+		if (m_pPackStorage)
+			return m_pPackStorage->loadHashesFrom(height, maxHashes);
+
 		if (FileBlockStorageMode::Hash_Index != m_mode)
 			CATAPULT_THROW_INVALID_ARGUMENT("loadHashesFrom is not supported when Hash_Index mode is disabled");
 
@@ -209,6 +233,11 @@ namespace catapult { namespace io {
 	}
 
 	void FileBlockStorage::saveBlock(const model::BlockElement& blockElement) {
+		if (m_pPackStorage) {
+			m_pPackStorage->saveBlock(blockElement);
+			return;
+		}
+
 		auto currentHeight = chainHeight();
 		auto height = blockElement.Block.Height;
 
@@ -240,6 +269,11 @@ namespace catapult { namespace io {
 	}
 
 	void FileBlockStorage::dropBlocksAfter(Height height) {
+		if (m_pPackStorage) {
+			m_pPackStorage->dropBlocksAfter(height);
+			return;
+		}
+
 		m_indexFile.set(height.unwrap());
 	}
 
@@ -277,12 +311,18 @@ namespace catapult { namespace io {
 	}
 
 	std::shared_ptr<const model::Block> FileBlockStorage::loadBlock(Height height) const {
+		if (m_pPackStorage)
+			return m_pPackStorage->loadBlock(height);
+
 		requireHeight(height, "block");
 		auto pBlockFile = OpenBlockFile(m_dataDirectory, height);
 		return ReadBlock(*pBlockFile);
 	}
 
 	std::shared_ptr<const model::BlockElement> FileBlockStorage::loadBlockElement(Height height) const {
+		if (m_pPackStorage)
+			return m_pPackStorage->loadBlockElement(height);
+
 		requireHeight(height, "block element");
 		auto pBlockFile = OpenBlockFile(m_dataDirectory, height);
 		RawFileInputStreamAdapter streamAdapter(*pBlockFile);
@@ -295,6 +335,9 @@ namespace catapult { namespace io {
 	}
 
 	std::pair<std::vector<uint8_t>, bool> FileBlockStorage::loadBlockStatementData(Height height) const {
+		if (m_pPackStorage)
+			return m_pPackStorage->loadBlockStatementData(height);
+
 		requireHeight(height, "block statement data");
 		auto path = GetBlockStatementPath(m_dataDirectory, height);
 		if (!IsRegularFile(path))
@@ -307,11 +350,23 @@ namespace catapult { namespace io {
 		return std::make_pair(std::move(blockStatement), true);
 	}
 
+	std::vector<std::shared_ptr<const model::Block>> FileBlockStorage::loadBlocks(Height height, size_t maxBlocks, size_t maxBytes) const {
+		if (m_pPackStorage)
+			return m_pPackStorage->loadBlocks(height, maxBlocks, maxBytes);
+
+		return BlockStorage::loadBlocks(height, maxBlocks, maxBytes);
+	}
+
 	// endregion
 
 	// region PrunableBlockStorage
 
 	void FileBlockStorage::purge() {
+		if (m_pPackStorage) {
+			m_pPackStorage->purge();
+			return;
+		}
+
 		// remove everything under the directory
 		m_hashFile.reset();
 		PurgeDirectory(m_dataDirectory);
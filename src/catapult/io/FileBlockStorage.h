@@ -26,15 +26,24 @@
 
 namespace catapult { namespace io {
 
+	class PackFileBlockStorage;
+
 	/// File block storage modes.
 	enum class FileBlockStorageMode {
 		/// Maintain hash-based index.
 		Hash_Index,
 
 		/// None.
-		None
+		None,
+
+		/// Append blocks into pack files with an offset and hash index (see PackFileBlockStorage).
+		Pack_File
 	};
 
+	/// Gets the storage mode of the existing block storage inside \a dataDirectory.
+	/// \note Pack_File is returned when \a dataDirectory contains converted packs, Hash_Index otherwise.
+	FileBlockStorageMode GetFileBlockStorageMode(const std::string& dataDirectory);
+
 	/// File-based block storage.
 	class FileBlockStorage final : public PrunableBlockStorage {
 	public:
@@ -42,6 +51,9 @@ namespace catapult { namespace io {
 		/// with specified storage \a mode.
 		explicit FileBlockStorage(const std::string& dataDirectory, FileBlockStorageMode mode = FileBlockStorageMode::Hash_Index);
 
+		/// Destroys the storage.
+		~FileBlockStorage() override;
+
 	public:
 		// LightBlockStorage
 		Height chainHeight() const override;
@@ -53,6 +65,7 @@ namespace catapult { namespace io {
 		std::shared_ptr<const model::Block> loadBlock(Height height) const override;
 		std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override;
 		std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const override;
+		std::vector<std::shared_ptr<const model::Block>> loadBlocks(Height height, size_t maxBlocks, size_t maxBytes) const override;
 
 		// PrunableBlockStorage
 		void purge() override;
@@ -82,5 +95,8 @@ namespace catapult { namespace io {
 
 		HashFile m_hashFile;
 		IndexFile m_indexFile;
+
+		// used only in Pack_File mode
+		std::unique_ptr<PackFileBlockStorage> m_pPackStorage;
 	};
 }}
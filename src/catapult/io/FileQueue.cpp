@@ -19,8 +19,12 @@
 **/
 
 #include "FileQueue.h"
+#include "PodIoUtils.h"
 #include "catapult/exceptions.h"
 #include <boost/filesystem.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
 
 namespace catapult { namespace io {
 
@@ -45,6 +49,60 @@ namespace catapult { namespace io {
 			out << utils::HexFormat(value) << ".dat";
 			return out.str();
 		}
+
+		// region segments
+
+		constexpr auto Segment_Extension = ".seg";
+		constexpr size_t Segment_Name_Size = 2 * sizeof(uint64_t);
+
+		std::string GetSegmentFilename(uint64_t startIndex) {
+			std::ostringstream out;
+			out << utils::HexFormat(startIndex) << Segment_Extension;
+			return out.str();
+		}
+
+		std::vector<uint64_t> FindSegmentStartIndexes(const boost::filesystem::path& directory) {
+			std::vector<uint64_t> startIndexes;
+			for (boost::filesystem::directory_iterator iter(directory); boost::filesystem::directory_iterator() != iter; ++iter) {
+				const auto& path = iter->path();
+				auto stem = path.stem().generic_string();
+				if (Segment_Extension != path.extension().generic_string() || Segment_Name_Size != stem.size())
+					continue;
+
+				if (std::all_of(stem.cbegin(), stem.cend(), [](auto ch) { return 0 != std::isxdigit(ch); }))
+					startIndexes.push_back(std::stoull(stem, nullptr, 16));
+			}
+
+			std::sort(startIndexes.begin(), startIndexes.end());
+			return startIndexes;
+		}
+
+		// finds the start index of the last segment that can contain message with \a messageIndex
+		bool TryFindSegmentStartIndex(const std::vector<uint64_t>& startIndexes, uint64_t messageIndex, uint64_t& startIndex) {
+			auto iter = std::upper_bound(startIndexes.cbegin(), startIndexes.cend(), messageIndex);
+			if (startIndexes.cbegin() == iter)
+				return false;
+
+			startIndex = *--iter;
+			return true;
+		}
+
+		bool TrySkipRecords(RawFile& segmentFile, uint64_t numRecords) {
+			for (auto i = 0u; i < numRecords; ++i) {
+				if (segmentFile.position() + sizeof(uint32_t) > segmentFile.size())
+					return false;
+
+				auto recordSize = Read32(segmentFile);
+				if (segmentFile.position() + recordSize > segmentFile.size())
+					return false;
+
+				segmentFile.seek(segmentFile.position() + recordSize);
+			}
+
+			return true;
+		}
+
+		// endregion
 	}
 
 	// region FileQueueWriter
@@ -53,12 +111,27 @@ namespace catapult { namespace io {
 	{}
 
 	FileQueueWriter::FileQueueWriter(const std::string& directory, const std::string& indexFilename)
+			: FileQueueWriter(directory, indexFilename, FileQueueWriterOptions())
+	{}
+
+	FileQueueWriter::FileQueueWriter(const std::string& directory, const std::string& indexFilename, const FileQueueWriterOptions& options)
 			: m_directory(CreateDirectory(directory))
 			, m_indexFile((m_directory / indexFilename).generic_string(), LockMode::None)
 			, m_indexValue(CreateIfNotExists(m_indexFile) ? 0 : m_indexFile.get())
+			, m_options(options)
+			, m_numUnsyncedMessages(0)
 	{}
 
 	void FileQueueWriter::write(const RawBuffer& buffer) {
+		if (0 != m_options.MaxSegmentSize) {
+			// reserve space for record size, which is only known in flush
+			if (m_record.empty())
+				m_record.resize(sizeof(uint32_t));
+
+			m_record.insert(m_record.end(), buffer.pData, buffer.pData + buffer.Size);
+			return;
+		}
+
 		if (!m_pOutputStream) {
 			auto filename = (m_directory / GetFilename(m_indexValue)).generic_string();
 			RawFile outputFile(filename, OpenMode::Read_Write);
@@ -69,6 +142,11 @@ namespace catapult { namespace io {
 	}
 
 	void FileQueueWriter::flush() {
+		if (0 != m_options.MaxSegmentSize) {
+			flushToSegment();
+			return;
+		}
+
 		if (!m_pOutputStream)
 			return;
 
@@ -77,6 +155,65 @@ namespace catapult { namespace io {
 		m_indexValue = m_indexFile.increment();
 	}
 
+	void FileQueueWriter::flushToSegment() {
+		if (m_record.empty())
+			return;
+
+		auto recordSize = static_cast<uint32_t>(m_record.size() - sizeof(uint32_t));
+		std::memcpy(m_record.data(), &recordSize, sizeof(uint32_t));
+
+		auto& segmentFile = openSegment();
+		segmentFile.write(m_record);
+		m_record.clear();
+
+		// record must be completely written (and synced, if requested) before it is made visible to readers
+		auto isSegmentFull = segmentFile.size() >= m_options.MaxSegmentSize;
+		if (0 != m_options.SyncInterval && (++m_numUnsyncedMessages >= m_options.SyncInterval || isSegmentFull)) {
+			segmentFile.sync();
+			m_numUnsyncedMessages = 0;
+		}
+
+		m_indexValue = m_indexFile.increment();
+
+		if (isSegmentFull)
+			m_pSegmentFile.reset();
+	}
+
+	RawFile& FileQueueWriter::openSegment() {
+		if (m_pSegmentFile)
+			return *m_pSegmentFile;
+
+		// segments starting after the current index only contain uncommitted messages
+		auto startIndexes = FindSegmentStartIndexes(m_directory);
+		for (auto startIndex : startIndexes) {
+			if (startIndex > m_indexValue)
+				boost::filesystem::remove(m_directory / GetSegmentFilename(startIndex));
+		}
+
+		// try to continue last segment after its last committed message, dropping any uncommitted data
+		uint64_t startIndex;
+		if (TryFindSegmentStartIndex(startIndexes, m_indexValue, startIndex) && startIndex != m_indexValue) {
+			auto segmentPath = m_directory / GetSegmentFilename(startIndex);
+			uint64_t committedSize = 0;
+			{
+				RawFile segmentFile(segmentPath.generic_string(), OpenMode::Read_Only, LockMode::None);
+				if (TrySkipRecords(segmentFile, m_indexValue - startIndex))
+					committedSize = segmentFile.position();
+			}
+
+			if (0 != committedSize && committedSize < m_options.MaxSegmentSize) {
+				boost::filesystem::resize_file(segmentPath, committedSize);
+				m_pSegmentFile = std::make_unique<RawFile>(segmentPath.generic_string(), OpenMode::Read_Append, LockMode::None);
+				m_pSegmentFile->seek(committedSize);
+				return *m_pSegmentFile;
+			}
+		}
+
+		auto segmentFilename = (m_directory / GetSegmentFilename(m_indexValue)).generic_string();
+		m_pSegmentFile = std::make_unique<RawFile>(segmentFilename, OpenMode::Read_Write, LockMode::None);
+		return *m_pSegmentFile;
+	}
+
 	// endregion
 
 	// region FileQueueReader
@@ -88,6 +225,11 @@ namespace catapult { namespace io {
 			outputFile.read(buffer);
 			return buffer;
 		}
+
+		[[noreturn]]
+		void ThrowMissingMessage(const boost::filesystem::path& messageFilename) {
+			CATAPULT_THROW_RUNTIME_ERROR_1("reading from file queue failed due to missing message file", messageFilename);
+		}
 	}
 
 	FileQueueReader::FileQueueReader(const std::string& directory) : FileQueueReader(directory, "index_reader.dat", "index.dat")
@@ -99,7 +241,9 @@ namespace catapult { namespace io {
 			const std::string& writerIndexFilename)
 			: m_directory(CreateDirectory(directory))
 			, m_readerIndexFile((m_directory / readerIndexFilename).generic_string())
-			, m_writerIndexFile((m_directory / writerIndexFilename).generic_string(), LockMode::None) {
+			, m_writerIndexFile((m_directory / writerIndexFilename).generic_string(), LockMode::None)
+			, m_segmentStartIndex(0)
+			, m_segmentMessageIndex(0) {
 		CreateIfNotExists(m_readerIndexFile);
 	}
 
@@ -110,32 +254,83 @@ namespace catapult { namespace io {
 	}
 
 	bool FileQueueReader::tryReadNextMessage(const consumer<std::vector<uint8_t>>& consumer) {
-		return process([consumer](const auto& nextMessageFilename) {
-			auto buffer = ReadAllContents(nextMessageFilename);
+		return process([consumer](const auto& buffer) {
 			consumer(buffer);
 		});
 	}
 
 	void FileQueueReader::skip(uint32_t count) {
 		for (auto i = 0u; i < count; ++i)
-			process([](const auto&) {});
+			process(nullptr);
 	}
 
-	bool FileQueueReader::process(const consumer<const std::string&>& processFilename) {
+	bool FileQueueReader::process(const consumer<const std::vector<uint8_t>&>& processMessage) {
 		auto readerIndexValue = m_readerIndexFile.get();
 		if (!m_writerIndexFile.exists() || readerIndexValue >= m_writerIndexFile.get())
 			return false;
 
+		// messages written without segments are stored in their own files
 		auto nextMessageFilename = m_directory / GetFilename(readerIndexValue);
-		if (!boost::filesystem::exists(nextMessageFilename))
-			CATAPULT_THROW_RUNTIME_ERROR_1("reading from file queue failed due to missing message file", nextMessageFilename);
+		if (boost::filesystem::exists(nextMessageFilename)) {
+			if (processMessage)
+				processMessage(ReadAllContents(nextMessageFilename.generic_string()));
+
+			m_readerIndexFile.increment();
+			boost::filesystem::remove(nextMessageFilename);
+			return true;
+		}
 
-		processFilename(nextMessageFilename.generic_string());
+		auto buffer = readSegmentMessage(readerIndexValue);
+		if (processMessage)
+			processMessage(buffer);
 
 		m_readerIndexFile.increment();
-		boost::filesystem::remove(nextMessageFilename);
+		++m_segmentMessageIndex;
 		return true;
 	}
 
+	std::vector<uint8_t> FileQueueReader::readSegmentMessage(uint64_t messageIndex) {
+		if (!isSegmentOpen(messageIndex)) {
+			m_pSegmentFile.reset();
+
+			uint64_t startIndex;
+			auto startIndexes = FindSegmentStartIndexes(m_directory);
+			if (!TryFindSegmentStartIndex(startIndexes, messageIndex, startIndex))
+				ThrowMissingMessage(m_directory / GetFilename(messageIndex));
+
+			auto pSegmentFile = std::make_unique<RawFile>(
+					(m_directory / GetSegmentFilename(startIndex)).generic_string(),
+					OpenMode::Read_Only,
+					LockMode::None);
+			auto hasMessage = TrySkipRecords(*pSegmentFile, messageIndex - startIndex)
+					&& pSegmentFile->position() + sizeof(uint32_t) <= pSegmentFile->size();
+			if (!hasMessage)
+				ThrowMissingMessage(m_directory / GetFilename(messageIndex));
+
+			// all messages in preceding segments have been consumed
+			for (auto consumedStartIndex : startIndexes) {
+				if (consumedStartIndex < startIndex)
+					boost::filesystem::remove(m_directory / GetSegmentFilename(consumedStartIndex));
+			}
+
+			m_pSegmentFile = std::move(pSegmentFile);
+			m_segmentStartIndex = startIndex;
+			m_segmentMessageIndex = messageIndex;
+		}
+
+		// segment file size is not refreshed, so records appended after it was opened are read without bounds checks
+		std::vector<uint8_t> buffer(Read32(*m_pSegmentFile));
+		m_pSegmentFile->read(buffer);
+		return buffer;
+	}
+
+	bool FileQueueReader::isSegmentOpen(uint64_t messageIndex) const {
+		if (!m_pSegmentFile || m_segmentMessageIndex != messageIndex)
+			return false;
+
+		// writer starts a new segment when the current one is full
+		return m_segmentStartIndex == messageIndex || !boost::filesystem::exists(m_directory / GetSegmentFilename(messageIndex));
+	}
+
 	// endregion
 }}
@@ -24,11 +24,23 @@
 #include "catapult/functions.h"
 #include <boost/filesystem/path.hpp>
 #include <memory>
+#include <vector>
 
 namespace catapult { namespace io {
 
+	/// File queue writer options.
+	struct FileQueueWriterOptions {
+		/// Size after which a new segment file is started or \c 0 if each message should be written into its own file.
+		uint64_t MaxSegmentSize;
+
+		/// Number of messages after which segment data is synced to disk or \c 0 if segments should not be synced explicitly.
+		uint32_t SyncInterval;
+	};
+
 	/// File based queue writer where each message is represented by a file (with incrementing names) in a directory.
 	/// \note Each call to flush will additionally create a new file.
+	/// \note When segments are enabled, messages are instead appended as size prefixed records to segment files
+	///       (named after their first message), which avoids creating and deleting a file per message.
 	class FileQueueWriter final : public OutputStream {
 	public:
 		/// Creates a file queue writer around \a directory.
@@ -37,18 +49,33 @@ namespace catapult { namespace io {
 		/// Creates a file queue writer around \a directory containing a (writer) index file (\a indexFilename).
 		FileQueueWriter(const std::string& directory, const std::string& indexFilename);
 
+		/// Creates a file queue writer around \a directory containing a (writer) index file (\a indexFilename)
+		/// using \a options.
+		FileQueueWriter(const std::string& directory, const std::string& indexFilename, const FileQueueWriterOptions& options);
+
 	public:
 		void write(const RawBuffer& buffer) override;
 		void flush() override;
 
+	private:
+		void flushToSegment();
+		RawFile& openSegment();
+
 	private:
 		boost::filesystem::path m_directory;
 		IndexFile m_indexFile;
 		uint64_t m_indexValue;
+		FileQueueWriterOptions m_options;
 		std::unique_ptr<BufferedOutputFileStream> m_pOutputStream;
+
+		// used when segments are enabled
+		std::vector<uint8_t> m_record;
+		std::unique_ptr<RawFile> m_pSegmentFile;
+		uint32_t m_numUnsyncedMessages;
 	};
 
 	/// File based queue reader where each message is represented by a file (with incrementing names) in a directory.
+	/// \note Messages appended to segment files are supported too, so both writer formats can be mixed within a queue.
 	class FileQueueReader final {
 	public:
 		/// Creates a file queue reader around \a directory.
@@ -70,11 +97,18 @@ namespace catapult { namespace io {
 		void skip(uint32_t count);
 
 	private:
-		bool process(const consumer<const std::string&>& processFilename);
+		bool process(const consumer<const std::vector<uint8_t>&>& processMessage);
+		std::vector<uint8_t> readSegmentMessage(uint64_t messageIndex);
+		bool isSegmentOpen(uint64_t messageIndex) const;
 
 	private:
 		boost::filesystem::path m_directory;
 		IndexFile m_readerIndexFile;
 		IndexFile m_writerIndexFile;
+
+		// current position in segment files
+		std::unique_ptr<RawFile> m_pSegmentFile;
+		uint64_t m_segmentStartIndex;
+		uint64_t m_segmentMessageIndex;
 	};
 }}
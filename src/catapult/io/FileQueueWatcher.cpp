@@ -0,0 +1,162 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "FileQueueWatcher.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/exceptions.h"
+#include <boost/filesystem.hpp>
+#include <chrono>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#else
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace catapult { namespace io {
+
+#ifdef __linux__
+
+	class FileQueueWatcher::Impl {
+	private:
+		static constexpr uint32_t Watch_Mask = IN_MODIFY | IN_CLOSE_WRITE | IN_MOVED_TO;
+
+	public:
+		Impl(const std::vector<std::string>& directories, const std::string& indexFilename)
+				: m_indexFilename(indexFilename)
+				, m_inotifyFd(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+				, m_eventFd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {
+			if (-1 == m_inotifyFd || -1 == m_eventFd) {
+				close();
+				CATAPULT_THROW_RUNTIME_ERROR_1("could not create file queue watcher", errno);
+			}
+
+			for (const auto& directory : directories) {
+				boost::filesystem::create_directories(directory);
+				if (-1 == inotify_add_watch(m_inotifyFd, directory.c_str(), Watch_Mask)) {
+					close();
+					CATAPULT_THROW_RUNTIME_ERROR_1("could not watch file queue directory", directory);
+				}
+			}
+		}
+
+		~Impl() {
+			close();
+		}
+
+	public:
+		bool wait(const utils::TimeSpan& timeout) {
+			auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout.millis());
+			for (;;) {
+				auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+				if (remaining.count() < 0)
+					return false;
+
+				pollfd fds[] = { { m_inotifyFd, POLLIN, 0 }, { m_eventFd, POLLIN, 0 } };
+				auto result = poll(fds, 2, static_cast<int>(remaining.count()));
+				if (-1 == result && EINTR == errno)
+					continue;
+
+				// interrupt event is never consumed, so all subsequent waits return immediately
+				if (0 >= result || 0 != fds[1].revents)
+					return false;
+
+				if (readEvents())
+					return true;
+			}
+		}
+
+		void interrupt() {
+			uint64_t value = 1;
+			if (sizeof(value) != ::write(m_eventFd, &value, sizeof(value)))
+				CATAPULT_LOG(warning) << "could not interrupt file queue watcher";
+		}
+
+	private:
+		bool readEvents() {
+			alignas(inotify_event) char buffer[4096];
+			auto hasIndexChanged = false;
+			for (;;) {
+				auto numBytes = ::read(m_inotifyFd, buffer, sizeof(buffer));
+				if (0 >= numBytes)
+					return hasIndexChanged;
+
+				for (auto offset = 0; offset < numBytes;) {
+					const auto& event = reinterpret_cast<const inotify_event&>(buffer[offset]);
+					if (0 != event.len && m_indexFilename == event.name)
+						hasIndexChanged = true;
+
+					offset += static_cast<int>(sizeof(inotify_event) + event.len);
+				}
+			}
+		}
+
+		void close() {
+			if (-1 != m_inotifyFd)
+				::close(m_inotifyFd);
+
+			if (-1 != m_eventFd)
+				::close(m_eventFd);
+		}
+
+	private:
+		std::string m_indexFilename;
+		int m_inotifyFd;
+		int m_eventFd;
+	};
+
+#else
+
+	class FileQueueWatcher::Impl {
+	public:
+		Impl(const std::vector<std::string>& directories, const std::string&) : m_isInterrupted(false) {
+			for (const auto& directory : directories)
+				boost::filesystem::create_directories(directory);
+		}
+
+	public:
+		bool wait(const utils::TimeSpan& timeout) {
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condition.wait_for(lock, std::chrono::milliseconds(timeout.millis()), [this]() { return m_isInterrupted; });
+			return false;
+		}
+
+		void interrupt() {
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_isInterrupted = true;
+			}
+
+			m_condition.notify_all();
+		}
+
+	private:
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		bool m_isInterrupted;
+	};
+
+#endif
+
+	FileQueueWatcher::FileQueueWatcher(const std::vector<std::string>& directories, const std::string& indexFilename)
+			: m_pImpl(std::make_unique<Impl>(directories, indexFilename))
+	{}
+
+	FileQueueWatcher::~FileQueueWatcher() = default;
+
+	bool FileQueueWatcher::wait(const utils::TimeSpan& timeout) {
+		return m_pImpl->wait(timeout);
+	}
+
+	void FileQueueWatcher::interrupt() {
+		m_pImpl->interrupt();
+	}
+}}
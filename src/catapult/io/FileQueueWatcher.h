@@ -0,0 +1,38 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#pragma once
+#include "catapult/utils/TimeSpan.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace catapult { namespace io {
+
+	/// Watches file queue directories for changes of writer index files.
+	/// \note On linux, changes are detected via inotify, so readers are woken up by writers in other processes.
+	///       Elsewhere, waits always last until timeout or interruption.
+	class FileQueueWatcher {
+	public:
+		/// Creates a watcher for index files named \a indexFilename in \a directories.
+		FileQueueWatcher(const std::vector<std::string>& directories, const std::string& indexFilename);
+
+		/// Destroys the watcher.
+		~FileQueueWatcher();
+
+	public:
+		/// Waits at most \a timeout for a change of any watched index file.
+		/// Returns \c true if a change was detected, \c false on timeout or interruption.
+		bool wait(const utils::TimeSpan& timeout);
+
+		/// Interrupts all current and future waits.
+		void interrupt();
+
+	private:
+		class Impl;
+		std::unique_ptr<Impl> m_pImpl;
+	};
+}}
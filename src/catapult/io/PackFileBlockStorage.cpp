@@ -0,0 +1,371 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "PackFileBlockStorage.h"
+#include "BlockElementSerializer.h"
+#include "BlockStatementSerializer.h"
+#include "BufferInputStreamAdapter.h"
+#include "FilesystemUtils.h"
+#include "StringOutputStream.h"
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <inttypes.h>
+
+namespace catapult { namespace io {
+
+	namespace {
+		static constexpr uint64_t Unset_Pack_Id = std::numeric_limits<uint64_t>::max();
+		static constexpr uint32_t Blocks_Per_Pack = 65536u;
+		static constexpr uint64_t Pack_Mapping_Granularity = 64u * 1024 * 1024;
+		static constexpr auto Pack_File_Extension = ".pack";
+		static constexpr auto Pack_Index_File_Extension = ".index";
+
+#ifdef _MSC_VER
+#define SPRINTF sprintf_s
+#else
+#define SPRINTF sprintf
+#endif
+
+		uint64_t GetPackId(Height height) {
+			return height.unwrap() / Blocks_Per_Pack;
+		}
+
+		std::string GetPackPath(const std::string& baseDirectory, uint64_t packId, const char* extension) {
+			char filename[32];
+			SPRINTF(filename, "%05" PRId64, packId);
+			boost::filesystem::path path = baseDirectory;
+			path /= filename;
+			path += extension;
+			return path.generic_string();
+		}
+	}
+
+	// region PackIndexEntry
+
+#pragma pack(push, 1)
+
+	struct PackFileBlockStorage::PackIndexEntry {
+	public:
+		/// Offset of the block record in the pack file.
+		uint64_t Offset;
+
+		/// Size of the serialized block element (\c 0 if the entry is unset).
+		uint32_t BlockElementSize;
+
+		/// Size of the serialized block statement (\c 0 if the block has no statement).
+		uint32_t BlockStatementSize;
+
+		/// Entity hash of the block.
+		Hash256 EntityHash;
+	};
+
+#pragma pack(pop)
+
+	// endregion
+
+	// region MappedFile
+
+	/// Read-only memory mapping of a file that is only ever appended to.
+	class PackFileBlockStorage::MappedFile {
+	public:
+		/// Creates a mapping of the file at \a path, which is remapped in multiples of \a granularity bytes.
+		MappedFile(const std::string& path, uint64_t granularity)
+				: m_path(path)
+				, m_granularity(granularity)
+		{}
+
+	public:
+		/// Returns a view of \a size bytes starting at \a offset that keeps the underlying mapping alive.
+		std::shared_ptr<const uint8_t> view(uint64_t offset, uint64_t size) {
+			if (!m_pRegion || offset + size > m_pRegion->get_size())
+				remap(offset + size);
+
+			const auto* pData = static_cast<const uint8_t*>(m_pRegion->get_address()) + offset;
+			return std::shared_ptr<const uint8_t>(m_pRegion, pData);
+		}
+
+	private:
+		void remap(uint64_t requiredSize) {
+			auto fileSize = boost::filesystem::file_size(m_path);
+			if (fileSize < requiredSize) {
+				std::ostringstream out;
+				out << "file " << m_path << " has size " << fileSize << " but at least " << requiredSize << " bytes are required";
+				CATAPULT_THROW_RUNTIME_ERROR(out.str().c_str());
+			}
+
+#ifdef _WIN32
+			auto mappedSize = fileSize;
+#else
+			// map past the end of file so that appended data can be accessed without remapping;
+			// only bytes that have been written are ever accessed, which is safe because data is never truncated
+			auto mappedSize = (fileSize + m_granularity - 1) / m_granularity * m_granularity;
+#endif
+
+			// views into the previous mapping remain valid because they share its ownership
+			boost::interprocess::file_mapping mapping(m_path.c_str(), boost::interprocess::read_only);
+			m_pRegion = std::make_shared<boost::interprocess::mapped_region>(mapping, boost::interprocess::read_only, 0, mappedSize);
+		}
+
+	private:
+		std::string m_path;
+		uint64_t m_granularity;
+		std::shared_ptr<boost::interprocess::mapped_region> m_pRegion;
+	};
+
+	// endregion
+
+	// region ctor
+
+	PackFileBlockStorage::PackFileBlockStorage(const std::string& dataDirectory)
+			: m_dataDirectory(dataDirectory)
+			, m_indexFile((boost::filesystem::path(m_dataDirectory) / "index.dat").generic_string())
+			, m_cachedPackId(Unset_Pack_Id) {
+		if (!boost::filesystem::exists(m_dataDirectory))
+			boost::filesystem::create_directories(m_dataDirectory);
+	}
+
+	PackFileBlockStorage::~PackFileBlockStorage() = default;
+
+	// endregion
+
+	// region LightBlockStorage
+
+	Height PackFileBlockStorage::chainHeight() const {
+		return m_indexFile.exists() ? Height(m_indexFile.get()) : Height(0);
+	}
+
+	model::HashRange PackFileBlockStorage::loadHashesFrom(Height height, size_t maxHashes) const {
+		auto currentHeight = chainHeight();
+		if (Height(0) == height || currentHeight < height)
+			return model::HashRange();
+
+		auto numAvailableHashes = static_cast<size_t>((currentHeight - height).unwrap() + 1);
+		auto numHashes = std::min(maxHashes, numAvailableHashes);
+
+		uint8_t* pData = nullptr;
+		auto range = model::HashRange::PrepareFixed(numHashes, &pData);
+		while (numHashes) {
+			auto count = std::min<size_t>(numHashes, Blocks_Per_Pack - (height.unwrap() % Blocks_Per_Pack));
+			auto pEntries = mapIndexEntries(height, count);
+			const auto* pEntry = reinterpret_cast<const PackIndexEntry*>(pEntries.get());
+			for (auto i = 0u; i < count; ++i) {
+				std::memcpy(pData, pEntry[i].EntityHash.data(), Hash256_Size);
+				pData += Hash256_Size;
+			}
+
+			numHashes -= count;
+			height = height + Height(count);
+		}
+
+		return range;
+	}
+
+	void PackFileBlockStorage::saveBlock(const model::BlockElement& blockElement) {
+		auto currentHeight = chainHeight();
+		auto height = blockElement.Block.Height;
+
+		if (height != currentHeight + Height(1)) {
+			std::ostringstream out;
+			out << "cannot save block with height " << height << " when storage height is " << currentHeight;
+			CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
+		}
+
+		auto packId = GetPackId(height);
+		if (m_cachedPackId != packId) {
+			auto packPath = GetPackPath(m_dataDirectory, packId, Pack_File_Extension);
+			auto packIndexPath = GetPackPath(m_dataDirectory, packId, Pack_Index_File_Extension);
+			m_pCachedPackFile = std::make_unique<RawFile>(packPath, OpenMode::Read_Append, LockMode::None);
+			m_pCachedPackIndexFile = std::make_unique<RawFile>(packIndexPath, OpenMode::Read_Append, LockMode::None);
+			m_cachedPackId = packId;
+		}
+
+		// serialize the whole record upfront, so that it is appended with a single write
+		StringOutputStream recordStream(blockElement.Block.Size);
+		WriteBlockElement(recordStream, blockElement);
+		auto blockElementSize = recordStream.str().size();
+		if (blockElement.OptionalStatement)
+			WriteBlockStatement(recordStream, *blockElement.OptionalStatement);
+
+		// always append, even after blocks were dropped, so that data referenced by existing mappings never changes
+		PackIndexEntry entry;
+		entry.Offset = m_pCachedPackFile->size();
+		entry.BlockElementSize = static_cast<uint32_t>(blockElementSize);
+		entry.BlockStatementSize = static_cast<uint32_t>(recordStream.str().size() - blockElementSize);
+		entry.EntityHash = blockElement.EntityHash;
+
+		m_pCachedPackFile->seek(entry.Offset);
+		m_pCachedPackFile->write({ reinterpret_cast<const uint8_t*>(recordStream.str().data()), recordStream.str().size() });
+
+		// zero fill any gap in the index (e.g. the entry for height zero), zero sized entries are treated as unset
+		auto& packIndexFile = *m_pCachedPackIndexFile;
+		auto entryOffset = (height.unwrap() % Blocks_Per_Pack) * sizeof(PackIndexEntry);
+		if (packIndexFile.size() < entryOffset) {
+			packIndexFile.seek(packIndexFile.size());
+			packIndexFile.write(std::vector<uint8_t>(entryOffset - packIndexFile.size()));
+		}
+
+		packIndexFile.seek(entryOffset);
+		packIndexFile.write({ reinterpret_cast<const uint8_t*>(&entry), sizeof(PackIndexEntry) });
+
+		if (height > currentHeight)
+			m_indexFile.set(height.unwrap());
+	}
+
+	void PackFileBlockStorage::dropBlocksAfter(Height height) {
+		m_indexFile.set(height.unwrap());
+	}
+
+	// endregion
+
+	// region BlockStorage
+
+	std::shared_ptr<const model::Block> PackFileBlockStorage::loadBlock(Height height) const {
+		requireHeight(height, "block");
+		auto entry = loadIndexEntry(height);
+		auto pData = mapPackData(height, entry.Offset, entry.BlockElementSize);
+		return std::shared_ptr<const model::Block>(pData, reinterpret_cast<const model::Block*>(pData.get()));
+	}
+
+	std::shared_ptr<const model::BlockElement> PackFileBlockStorage::loadBlockElement(Height height) const {
+		requireHeight(height, "block element");
+		auto entry = loadIndexEntry(height);
+		auto pData = mapPackData(height, entry.Offset, entry.BlockElementSize);
+
+		// block element only exposes a const block, so the read-only mapped block is never modified
+		auto* pBlock = const_cast<model::Block*>(reinterpret_cast<const model::Block*>(pData.get()));
+		if (pBlock->Size > entry.BlockElementSize)
+			CATAPULT_THROW_RUNTIME_ERROR_1("block exceeds its pack record at height", height);
+
+		RawBuffer metadataBuffer(pData.get() + pBlock->Size, entry.BlockElementSize - pBlock->Size);
+		BufferInputStreamAdapter<RawBuffer> metadataStream(metadataBuffer);
+		auto pBlockElement = ReadBlockElement(std::shared_ptr<model::Block>(pData, pBlock), metadataStream);
+
+		if (!metadataStream.eof())
+			CATAPULT_THROW_RUNTIME_ERROR_1("additional data after block at height", height);
+
+		return pBlockElement;
+	}
+
+	std::pair<std::vector<uint8_t>, bool> PackFileBlockStorage::loadBlockStatementData(Height height) const {
+		requireHeight(height, "block statement data");
+		auto entry = loadIndexEntry(height);
+		if (0 == entry.BlockStatementSize)
+			return std::make_pair(std::vector<uint8_t>(), false);
+
+		auto pData = mapPackData(height, entry.Offset + entry.BlockElementSize, entry.BlockStatementSize);
+		return std::make_pair(std::vector<uint8_t>(pData.get(), pData.get() + entry.BlockStatementSize), true);
+	}
+
+	std::vector<std::shared_ptr<const model::Block>> PackFileBlockStorage::loadBlocks(
+			Height height,
+			size_t maxBlocks,
+			size_t maxBytes) const {
+		requireHeight(height, "blocks");
+		auto numBlocks = std::min<uint64_t>(maxBlocks, (chainHeight() - height).unwrap() + 1);
+
+		size_t numBytes = 0;
+		std::vector<std::shared_ptr<const model::Block>> blocks;
+		while (numBlocks) {
+			auto count = std::min<uint64_t>(numBlocks, Blocks_Per_Pack - (height.unwrap() % Blocks_Per_Pack));
+			auto pEntries = mapIndexEntries(height, count);
+			const auto* pEntry = reinterpret_cast<const PackIndexEntry*>(pEntries.get());
+
+			// records of consecutive blocks are usually adjacent, so a single view spans all blocks of the pack
+			auto startOffset = std::numeric_limits<uint64_t>::max();
+			uint64_t endOffset = 0;
+			for (auto i = 0u; i < count; ++i) {
+				if (0 == pEntry[i].BlockElementSize)
+					CATAPULT_THROW_RUNTIME_ERROR_1("pack index does not contain block at height", height + Height(i));
+
+				startOffset = std::min(startOffset, pEntry[i].Offset);
+				endOffset = std::max(endOffset, pEntry[i].Offset + pEntry[i].BlockElementSize);
+			}
+
+			auto pData = mapPackData(height, startOffset, endOffset - startOffset);
+			for (auto i = 0u; i < count; ++i) {
+				const auto* pBlock = reinterpret_cast<const model::Block*>(pData.get() + pEntry[i].Offset - startOffset);
+				if (!blocks.empty() && numBytes + pBlock->Size > maxBytes)
+					return blocks;
+
+				numBytes += pBlock->Size;
+				blocks.push_back(std::shared_ptr<const model::Block>(pData, pBlock));
+			}
+
+			numBlocks -= count;
+			height = height + Height(count);
+		}
+
+		return blocks;
+	}
+
+	// endregion
+
+	// region PrunableBlockStorage
+
+	void PackFileBlockStorage::purge() {
+		// outstanding views keep removed files mapped, so only cached handles need to be released
+		m_cachedPackId = Unset_Pack_Id;
+		m_pCachedPackFile.reset();
+		m_pCachedPackIndexFile.reset();
+
+		{
+			std::lock_guard<std::mutex> guard(m_mappingsMutex);
+			m_mappings.clear();
+		}
+
+		PurgeDirectory(m_dataDirectory);
+	}
+
+	// endregion
+
+	// region utils
+
+	void PackFileBlockStorage::requireHeight(Height height, const char* description) const {
+		auto chainHeight = this->chainHeight();
+		if (height <= chainHeight)
+			return;
+
+		std::ostringstream out;
+		out << "cannot load " << description << " at height (" << height << ") greater than chain height (" << chainHeight << ")";
+		CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
+	}
+
+	PackFileBlockStorage::PackIndexEntry PackFileBlockStorage::loadIndexEntry(Height height) const {
+		PackIndexEntry entry;
+		auto pEntry = mapIndexEntries(height, 1);
+		std::memcpy(static_cast<void*>(&entry), pEntry.get(), sizeof(PackIndexEntry));
+		if (0 == entry.BlockElementSize)
+			CATAPULT_THROW_RUNTIME_ERROR_1("pack index does not contain block at height", height);
+
+		return entry;
+	}
+
+	std::shared_ptr<const uint8_t> PackFileBlockStorage::mapPackData(Height height, uint64_t offset, uint64_t size) const {
+		auto path = GetPackPath(m_dataDirectory, GetPackId(height), Pack_File_Extension);
+
+		std::lock_guard<std::mutex> guard(m_mappingsMutex);
+		auto& pMappedFile = m_mappings[path];
+		if (!pMappedFile)
+			pMappedFile = std::make_unique<MappedFile>(path, Pack_Mapping_Granularity);
+
+		return pMappedFile->view(offset, size);
+	}
+
+	std::shared_ptr<const uint8_t> PackFileBlockStorage::mapIndexEntries(Height height, size_t numEntries) const {
+		auto path = GetPackPath(m_dataDirectory, GetPackId(height), Pack_Index_File_Extension);
+		auto offset = (height.unwrap() % Blocks_Per_Pack) * sizeof(PackIndexEntry);
+
+		std::lock_guard<std::mutex> guard(m_mappingsMutex);
+		auto& pMappedFile = m_mappings[path];
+		if (!pMappedFile)
+			pMappedFile = std::make_unique<MappedFile>(path, Blocks_Per_Pack * sizeof(PackIndexEntry));
+
+		return pMappedFile->view(offset, numEntries * sizeof(PackIndexEntry));
+	}
+
+	// endregion
+}}
@@ -0,0 +1,67 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#pragma once
+#include "BlockStorage.h"
+#include "IndexFile.h"
+#include "RawFile.h"
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace catapult { namespace io {
+
+	/// Pack file based block storage.
+	/// \note Blocks are appended into large pack files, each accompanied by an index file with fixed size entries
+	///       (offset, sizes and entity hash) per height. Pack data is never overwritten, so blocks are served directly
+	///       from read-only memory mappings of the pack files.
+	class PackFileBlockStorage final : public PrunableBlockStorage {
+	public:
+		/// Creates a pack file based block storage, where packs will be stored inside \a dataDirectory.
+		explicit PackFileBlockStorage(const std::string& dataDirectory);
+
+		/// Destroys the storage.
+		~PackFileBlockStorage() override;
+
+	public:
+		// LightBlockStorage
+		Height chainHeight() const override;
+		model::HashRange loadHashesFrom(Height height, size_t maxHashes) const override;
+		void saveBlock(const model::BlockElement& blockElement) override;
+		void dropBlocksAfter(Height height) override;
+
+		// BlockStorage
+		std::shared_ptr<const model::Block> loadBlock(Height height) const override;
+		std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override;
+		std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const override;
+		std::vector<std::shared_ptr<const model::Block>> loadBlocks(Height height, size_t maxBlocks, size_t maxBytes) const override;
+
+		// PrunableBlockStorage
+		void purge() override;
+
+	private:
+		struct PackIndexEntry;
+		class MappedFile;
+
+		void requireHeight(Height height, const char* description) const;
+		PackIndexEntry loadIndexEntry(Height height) const;
+		std::shared_ptr<const uint8_t> mapPackData(Height height, uint64_t offset, uint64_t size) const;
+		std::shared_ptr<const uint8_t> mapIndexEntries(Height height, size_t numEntries) const;
+
+	private:
+		std::string m_dataDirectory;
+		IndexFile m_indexFile;
+
+		// used for caching inside saveBlock()
+		uint64_t m_cachedPackId;
+		std::unique_ptr<RawFile> m_pCachedPackFile;
+		std::unique_ptr<RawFile> m_pCachedPackIndexFile;
+
+		// memory mappings of pack and pack index files
+		mutable std::mutex m_mappingsMutex;
+		mutable std::map<std::string, std::unique_ptr<MappedFile>> m_mappings;
+	};
+}}
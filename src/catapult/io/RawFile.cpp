@@ -50,6 +50,7 @@ namespace catapult { namespace io {
 		constexpr const char* Error_Read = "couldn't read from file";
 		constexpr const char* Error_Seek = "couldn't seek in file";
 		constexpr const char* Error_Seek_Outside = "couldn't seek past end of file";
+		constexpr const char* Error_Sync = "couldn't sync file";
 		constexpr const char* Error_Desc = "invalid file descriptor";
 
 		// endregion
@@ -97,6 +98,7 @@ namespace catapult { namespace io {
 		constexpr auto read = ::_read;
 		constexpr auto lseek = ::_lseeki64;
 		constexpr auto fstat = ::_fstati64;
+		constexpr auto fsync = ::_commit;
 		using StatStruct = struct ::_stat64;
 
 		template<typename TSize>
@@ -219,6 +221,10 @@ namespace catapult { namespace io {
 			return -1 == lseek(fd, offset, SEEK_SET) ? MakeFailureResult(false) : MakeSuccessResult(true);
 		}
 
+		FileOperationResult<bool> nemSync(int fd) {
+			return 0 != fsync(fd) ? MakeFailureResult(false) : MakeSuccessResult(true);
+		}
+
 		FileOperationResult<bool> nemFileSize(int fd, uint64_t& fileSize) {
 			StatStruct st;
 			fileSize = 0;
@@ -331,6 +337,11 @@ namespace catapult { namespace io {
 		m_position = position;
 	}
 
+	void RawFile::sync() {
+		auto syncResult = nemSync(m_fd.raw());
+		CATAPULT_CHECK_FILE_OPERATION_RESULT(Error_Sync, syncResult);
+	}
+
 	uint64_t RawFile::size() const {
 		return m_fileSize;
 	}
@@ -71,6 +71,10 @@ namespace catapult { namespace io {
 		/// Throws catapult_file_io_error exception if requested amount of data could not be read.
 		void read(const MutableRawBuffer& dataBuffer);
 
+		/// Flushes all written data to the underlying storage device.
+		/// Throws catapult_file_io_error exception if sync has failed.
+		void sync();
+
 		/// Returns size of the file.
 		uint64_t size() const;
 
@@ -80,21 +80,22 @@ namespace catapult { namespace ionet {
 				: model::EntityRange<TStructure>::CopyFixed(packet.Data(), numStructures);
 	}
 
-	/// Extracts batches of entities from \a packet with a validity check (\a isValid).
-	/// \note If the packet is invalid and/or contains partial entities, the returned result will be empty.
+	/// Extracts batches of entities from \a buffer with a validity check (\a isValid).
+	/// \note If the buffer is invalid and/or contains partial entities, the returned result will be empty.
 	template<typename TEntity, typename TIsValidPredicate>
-	std::vector<model::EntityRange<TEntity>> ExtractEntityBatchesFromPacket(const Packet& packet, size_t batchSize, TIsValidPredicate isValid) {
+	std::vector<model::EntityRange<TEntity>> ExtractEntityBatchesFromBuffer(const RawBuffer& buffer, size_t batchSize, TIsValidPredicate isValid) {
 		if (!batchSize)
 			CATAPULT_THROW_RUNTIME_ERROR("batch size is not set")
 
-		auto dataSize = CalculatePacketDataSize(packet);
-		auto offsets = ExtractEntityOffsets<TEntity>({ packet.Data(), dataSize }, isValid);
+		const auto* pData = buffer.pData;
+		auto dataSize = buffer.Size;
+		auto offsets = ExtractEntityOffsets<TEntity>(buffer, isValid);
 		std::vector<model::EntityRange<TEntity>> ranges;
 		if (offsets.empty())
 			return ranges;
 
 		if (offsets.size() <= batchSize) {
-			ranges.template emplace_back(model::EntityRange<TEntity>::CopyVariable(packet.Data(), dataSize, offsets));
+			ranges.template emplace_back(model::EntityRange<TEntity>::CopyVariable(pData, dataSize, offsets));
 			return ranges;
 		}
 
@@ -116,9 +117,16 @@ namespace catapult { namespace ionet {
 			for (auto k = i; k < endIndex; ++k)
 				subOffsets.push_back(offsets[k] - startOffset);
 
-			ranges.template emplace_back(model::EntityRange<TEntity>::CopyVariable(packet.Data() + startOffset, endOffset - startOffset, subOffsets));
+			ranges.template emplace_back(model::EntityRange<TEntity>::CopyVariable(pData + startOffset, endOffset - startOffset, subOffsets));
 		}
 
 		return ranges;
 	}
+
+	/// Extracts batches of entities from \a packet with a validity check (\a isValid).
+	/// \note If the packet is invalid and/or contains partial entities, the returned result will be empty.
+	template<typename TEntity, typename TIsValidPredicate>
+	std::vector<model::EntityRange<TEntity>> ExtractEntityBatchesFromPacket(const Packet& packet, size_t batchSize, TIsValidPredicate isValid) {
+		return ExtractEntityBatchesFromBuffer<TEntity>({ packet.Data(), CalculatePacketDataSize(packet) }, batchSize, isValid);
+	}
 }}
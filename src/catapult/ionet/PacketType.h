@@ -89,6 +89,9 @@ namespace catapult { namespace ionet {
 	\
     /* A remote node state has been pushed by a peer. */ \
     ENUM_VALUE(Pull_Remote_Node_State_Response, 20) \
+	\
+	/* Unconfirmed transactions missing from a short hash sketch have been requested by a peer. */ \
+	ENUM_VALUE(Pull_Transactions_Sketch, 21) \
 	\
 	/* api only packets have types [500, 550) */ \
 	\
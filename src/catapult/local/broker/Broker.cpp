@@ -21,6 +21,7 @@
 #include "Broker.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/extensions/ProcessBootstrapper.h"
+#include "catapult/io/FileQueueWatcher.h"
 #include "catapult/local/HostUtils.h"
 #include "catapult/subscribers/BlockChangeReader.h"
 #include "catapult/subscribers/BrokerMessageReaders.h"
@@ -28,13 +29,74 @@
 #include "catapult/subscribers/StateChangeReader.h"
 #include "catapult/subscribers/TransactionStatusReader.h"
 #include "catapult/subscribers/UtChangeReader.h"
-#include "catapult/thread/Scheduler.h"
 #include "catapult/utils/StackLogger.h"
 #include "catapult/extensions/NemesisBlockLoader.h"
+#include <atomic>
+#include <thread>
 
 namespace catapult { namespace local {
 
 	namespace {
+		constexpr auto Index_Reader_Filename = "index_broker_r.dat";
+		constexpr auto Index_Writer_Filename = "index.dat";
+
+		using QueueIngestor = consumer<io::FileQueueReader&>;
+
+		// ingests messages from all queues on a dedicated thread, which is woken up as soon as any queue writer commits a message
+		class IngestionService {
+		public:
+			explicit IngestionService(std::vector<std::pair<std::string, QueueIngestor>>&& queues)
+					: m_queues(std::move(queues))
+					, m_watcher(GetQueuePaths(m_queues), Index_Writer_Filename)
+					, m_isStopped(false)
+					, m_thread([this]() { run(); })
+			{}
+
+			~IngestionService() {
+				shutdown();
+			}
+
+		public:
+			void shutdown() {
+				if (m_isStopped.exchange(true))
+					return;
+
+				m_watcher.interrupt();
+				m_thread.join();
+			}
+
+		private:
+			void run() {
+				// readers are kept open across wakeups in order to reuse open segment files
+				std::vector<std::unique_ptr<io::FileQueueReader>> readers;
+				for (const auto& queue : m_queues)
+					readers.push_back(std::make_unique<io::FileQueueReader>(queue.first, Index_Reader_Filename, Index_Writer_Filename));
+
+				while (!m_isStopped) {
+					for (auto i = 0u; i < m_queues.size(); ++i)
+						m_queues[i].second(*readers[i]);
+
+					// timeout is a fallback for platforms and filesystems without change notifications
+					m_watcher.wait(utils::TimeSpan::FromMilliseconds(500));
+				}
+			}
+
+		private:
+			static std::vector<std::string> GetQueuePaths(const std::vector<std::pair<std::string, QueueIngestor>>& queues) {
+				std::vector<std::string> queuePaths;
+				for (const auto& queue : queues)
+					queuePaths.push_back(queue.first);
+
+				return queuePaths;
+			}
+
+		private:
+			std::vector<std::pair<std::string, QueueIngestor>> m_queues;
+			io::FileQueueWatcher m_watcher;
+			std::atomic_bool m_isStopped;
+			std::thread m_thread;
+		};
+
 		class DefaultBroker final : public Broker {
 		public:
 			explicit DefaultBroker(std::unique_ptr<extensions::ProcessBootstrapper>&& pBootstrapper)
@@ -64,7 +126,8 @@ namespace catapult { namespace local {
 				/// We must retrieve the configuration from the nemesis block
 				if(isFirstBoot) {
 					/// This is the first boot, so we must load the nemesis block network configuration.
-					io::FileBlockStorage storage(m_dataDirectory.rootDir().str(), io::FileBlockStorageMode::Hash_Index);
+					auto rootDirectory = m_dataDirectory.rootDir().str();
+					io::FileBlockStorage storage(rootDirectory, io::GetFileBlockStorageMode(rootDirectory));
 					const auto pNemesisBlockElement = storage.loadBlockElement(Height(1));
 					auto bundleConfig = extensions::NemesisBlockLoader::ReadNetworkConfiguration(pNemesisBlockElement);
 					m_pBootstrapper->configHolder()->InitializeNetworkConfiguration(std::get<0>(bundleConfig));
@@ -105,33 +168,35 @@ namespace catapult { namespace local {
 			void startIngestion() {
 				using namespace catapult::subscribers;
 
-				auto pServiceGroup = m_pBootstrapper->pool().pushServiceGroup("scheduler");
-				auto pScheduler = pServiceGroup->pushService(thread::CreateScheduler);
-				pScheduler->addTask(createIngestionTask("block_change", *m_pBlockChangeSubscriber, ReadNextBlockChange));
-				pScheduler->addTask(createIngestionTask("unconfirmed_transactions_change", *m_pUtChangeSubscriber, ReadNextUtChange));
-				pScheduler->addTask(createIngestionTask("partial_transactions_change", *m_pPtChangeSubscriber, ReadNextPtChange));
-				pScheduler->addTask(createIngestionTask("transaction_status", *m_pTransactionStatusSubscriber, ReadNextTransactionStatus));
-				pScheduler->addTask(createIngestionTask("state_change", *m_pStateChangeSubscriber, [&catapultCache = m_catapultCache](
+				std::vector<std::pair<std::string, QueueIngestor>> queues;
+				queues.push_back(createQueueIngestor("block_change", *m_pBlockChangeSubscriber, ReadNextBlockChange));
+				queues.push_back(createQueueIngestor("unconfirmed_transactions_change", *m_pUtChangeSubscriber, ReadNextUtChange));
+				queues.push_back(createQueueIngestor("partial_transactions_change", *m_pPtChangeSubscriber, ReadNextPtChange));
+				queues.push_back(createQueueIngestor("transaction_status", *m_pTransactionStatusSubscriber, ReadNextTransactionStatus));
+				queues.push_back(createQueueIngestor("state_change", *m_pStateChangeSubscriber, [&catapultCache = m_catapultCache](
 						auto& inputStream,
 						auto& subscriber) {
 					return ReadNextStateChange(inputStream, catapultCache.changesStorages(), subscriber);
 				}));
+
+				auto pServiceGroup = m_pBootstrapper->pool().pushServiceGroup("ingestion");
+				pServiceGroup->registerService(std::make_shared<IngestionService>(std::move(queues)));
 			}
 
 			template<typename TSubscriber, typename TMessageReader>
-			thread::Task createIngestionTask(const std::string& queueName, TSubscriber& subscriber, TMessageReader readNextMessage) {
-				thread::Task task;
-				task.StartDelay = utils::TimeSpan::FromMilliseconds(100);
-				task.NextDelay = thread::CreateUniformDelayGenerator(utils::TimeSpan::FromMilliseconds(500));
-				task.Name = queueName;
-
+			std::pair<std::string, QueueIngestor> createQueueIngestor(
+					const std::string& queueName,
+					TSubscriber& subscriber,
+					TMessageReader readNextMessage) {
 				auto queuePath = m_dataDirectory.spoolDir(queueName).str();
-				task.Callback = [&subscriber, readNextMessage, queuePath]() {
-					subscribers::ReadAll({ queuePath, "index_broker_r.dat", "index.dat" }, subscriber, readNextMessage);
-					return thread::make_ready_future(thread::TaskResult::Continue);
-				};
-
-				return task;
+				return std::make_pair(queuePath, [&subscriber, readNextMessage, queuePath](auto& reader) {
+					auto numPendingMessages = reader.pending();
+					if (0 == numPendingMessages)
+						return;
+
+					CATAPULT_LOG(debug) << "preparing to process " << numPendingMessages << " messages from " << queuePath;
+					subscribers::ReadAll(reader, subscriber, readNextMessage);
+				});
 			}
 
 		private:
@@ -111,8 +111,11 @@ namespace catapult { namespace local {
 				: m_observerFactory(observerFactory)
 				, m_pluginManager(pluginManager)
 				, m_stateRef(stateRef)
-				, m_startHeight(startHeight)
-		{}
+				, m_startHeight(startHeight) {
+			// prefetching only pays off when cache entries are loaded from the cache database
+			if (m_pluginManager.storageConfig().PreferCacheDatabase)
+				m_pPrefetchPublisher = m_pluginManager.createNotificationPublisher();
+		}
 
 	public:
 		model::ChainScore loadAll(const NotifyProgressFunc& notifyProgress) const {
@@ -155,7 +158,9 @@ namespace catapult { namespace local {
 
 			const auto& block = blockElement.Block;
 			observers::NotificationObserverAdapter observer(m_observerFactory(block), m_pluginManager.createNotificationPublisher());
-			chain::ExecuteBlock(blockElement, { observer, resolverContext, m_pluginManager.configHolder(), observerState });
+			chain::ExecuteBlock(
+					blockElement,
+					{ observer, resolverContext, m_pluginManager.configHolder(), observerState, m_pPrefetchPublisher.get() });
 
 			// populate patricia tree delta
 			auto stateHash = cacheDelta.calculateStateHash(block.Height).StateHash;
@@ -169,6 +174,7 @@ namespace catapult { namespace local {
 		const plugins::PluginManager& m_pluginManager;
 		const extensions::LocalNodeStateRef& m_stateRef;
 		Height m_startHeight;
+		std::unique_ptr<model::NotificationPublisher> m_pPrefetchPublisher;
 	};
 
 	model::ChainScore LoadBlockChain(
@@ -20,10 +20,13 @@
 
 #include "FileStateChangeStorage.h"
 #include "catapult/cache/CacheChangesStorage.h"
+#include "catapult/io/BufferCompression.h"
 #include "catapult/io/PodIoUtils.h"
+#include "catapult/io/StringOutputStream.h"
 #include "catapult/subscribers/StateChangeInfo.h"
 #include "catapult/subscribers/SubscriberOperationTypes.h"
 #include "catapult/utils/Casting.h"
+#include <limits>
 
 namespace catapult { namespace local {
 
@@ -38,9 +41,11 @@ namespace catapult { namespace local {
 		public:
 			FileStateChangeStorage(
 					std::unique_ptr<io::OutputStream>&& pOutputStream,
-					const supplier<CacheChangesStorages>& cacheChangesStoragesSupplier)
+					const supplier<CacheChangesStorages>& cacheChangesStoragesSupplier,
+					bool shouldCompressStateChanges)
 					: m_pOutputStream(std::move(pOutputStream))
 					, m_cacheChangesStoragesSupplier(cacheChangesStoragesSupplier)
+					, m_shouldCompressStateChanges(shouldCompressStateChanges)
 			{}
 
 		public:
@@ -52,18 +57,46 @@ namespace catapult { namespace local {
 			}
 
 			void notifyStateChange(const subscribers::StateChangeInfo& stateChangeInfo) override {
-				write(subscribers::StateChangeOperationType::State_Change);
-
-				WriteChainScore(*m_pOutputStream, stateChangeInfo.ScoreDelta);
-				io::Write(*m_pOutputStream, stateChangeInfo.Height);
-
-				for (const auto& pStorage : m_cacheChangesStoragesSupplier())
-					pStorage->saveAll(stateChangeInfo.CacheChanges, *m_pOutputStream);
+				if (m_shouldCompressStateChanges) {
+					writeCompressed(stateChangeInfo);
+				} else {
+					write(subscribers::StateChangeOperationType::State_Change);
+					writeStateChange(*m_pOutputStream, stateChangeInfo);
+				}
 
 				m_pOutputStream->flush();
 			}
 
 		private:
+			void writeCompressed(const subscribers::StateChangeInfo& stateChangeInfo) {
+				io::StringOutputStream stateChangeStream(0);
+				writeStateChange(stateChangeStream, stateChangeInfo);
+
+				const auto& stateChange = stateChangeStream.str();
+				auto stateChangeBuffer = RawBuffer(reinterpret_cast<const uint8_t*>(stateChange.data()), stateChange.size());
+				auto compressedStateChange = io::CompressBuffer(stateChangeBuffer);
+
+				// fall back to the uncompressed format when compression does not pay off
+				if (compressedStateChange.size() >= stateChange.size() || stateChange.size() > std::numeric_limits<uint32_t>::max()) {
+					write(subscribers::StateChangeOperationType::State_Change);
+					m_pOutputStream->write(stateChangeBuffer);
+					return;
+				}
+
+				write(subscribers::StateChangeOperationType::Compressed_State_Change);
+				io::Write32(*m_pOutputStream, static_cast<uint32_t>(stateChange.size()));
+				io::Write32(*m_pOutputStream, static_cast<uint32_t>(compressedStateChange.size()));
+				m_pOutputStream->write(compressedStateChange);
+			}
+
+			void writeStateChange(io::OutputStream& outputStream, const subscribers::StateChangeInfo& stateChangeInfo) {
+				WriteChainScore(outputStream, stateChangeInfo.ScoreDelta);
+				io::Write(outputStream, stateChangeInfo.Height);
+
+				for (const auto& pStorage : m_cacheChangesStoragesSupplier())
+					pStorage->saveAll(stateChangeInfo.CacheChanges, outputStream);
+			}
+
 			void write(subscribers::StateChangeOperationType operationType) {
 				io::Write8(*m_pOutputStream, utils::to_underlying_type(operationType));
 			}
@@ -71,12 +104,17 @@ namespace catapult { namespace local {
 		private:
 			std::unique_ptr<io::OutputStream> m_pOutputStream;
 			supplier<CacheChangesStorages> m_cacheChangesStoragesSupplier;
+			bool m_shouldCompressStateChanges;
 		};
 	}
 
 	std::unique_ptr<subscribers::StateChangeSubscriber> CreateFileStateChangeStorage(
 			std::unique_ptr<io::OutputStream>&& pOutputStream,
-			const supplier<CacheChangesStorages>& cacheChangesStoragesSupplier) {
-		return std::make_unique<FileStateChangeStorage>(std::move(pOutputStream), cacheChangesStoragesSupplier);
+			const supplier<CacheChangesStorages>& cacheChangesStoragesSupplier,
+			bool shouldCompressStateChanges) {
+		return std::make_unique<FileStateChangeStorage>(
+				std::move(pOutputStream),
+				cacheChangesStoragesSupplier,
+				shouldCompressStateChanges);
 	}
 }}
@@ -33,9 +33,10 @@ namespace catapult { namespace local {
 	using CacheChangesStorages = std::vector<std::unique_ptr<const cache::CacheChangesStorage>>;
 
 	/// Creates a state change storage around \a pOutputStream using \a cacheChangesStoragesSupplier for creating storages
-	/// used for serialization.
+	/// used for serialization. State changes are compressed when \a shouldCompressStateChanges is \c true.
 	/// \note Supplier is used because cache changes storages are not available when this storage is created.
 	std::unique_ptr<subscribers::StateChangeSubscriber> CreateFileStateChangeStorage(
 			std::unique_ptr<io::OutputStream>&& pOutputStream,
-			const supplier<CacheChangesStorages>& cacheChangesStoragesSupplier);
+			const supplier<CacheChangesStorages>& cacheChangesStoragesSupplier,
+			bool shouldCompressStateChanges = false);
 }}
@@ -21,6 +21,7 @@
 #include "LocalNode.h"
 #include "FileStateChangeStorage.h"
 #include "MemoryCounters.h"
+#include "MerkleRootCounters.h"
 #include "NemesisBlockNotifier.h"
 #include "NodeUtils.h"
 #include "catapult/crypto/CertificateDirectoryGenerator.h"
@@ -45,10 +46,12 @@ namespace catapult { namespace local {
 		std::unique_ptr<subscribers::StateChangeSubscriber> CreateStateChangeSubscriber(
 				subscribers::SubscriptionManager& subscriptionManager,
 				const extensions::CacheHolder& cacheHolder,
-				const config::CatapultDataDirectory& dataDirectory) {
+				const config::CatapultDataDirectory& dataDirectory,
+				const config::NodeConfiguration& nodeConfig) {
 			subscriptionManager.addStateChangeSubscriber(CreateFileStateChangeStorage(
 					std::make_unique<io::FileQueueWriter>(dataDirectory.spoolDir("state_change").str(), "index_server.dat"),
-					[&cacheHolder]() { return cacheHolder.cache().changesStorages(); }));
+					[&cacheHolder]() { return cacheHolder.cache().changesStorages(); },
+					nodeConfig.ShouldCompressStateChanges));
 			return subscriptionManager.createStateChangeSubscriber();
 		}
 
@@ -69,7 +72,8 @@ namespace catapult { namespace local {
 					, m_cacheHolder(m_pBootstrapper->cacheHolder()) // note that sub caches are added in boot
 					, m_storage(
 							m_pBootstrapper->subscriptionManager().createBlockStorage(m_pBlockChangeSubscriber),
-							CreateStagingBlockStorage(m_dataDirectory))
+							CreateStagingBlockStorage(m_dataDirectory),
+							m_pBootstrapper->config().Node.BlockStorageCacheMaxSize)
 					, m_pUtCache(m_pBootstrapper->subscriptionManager().createUtCache(
 							extensions::GetUtCacheOptions(m_pBootstrapper->config().Node),
 						    m_pBootstrapper->pluginManager().transactionFeeCalculator()))
@@ -77,7 +81,8 @@ namespace catapult { namespace local {
 					, m_pStateChangeSubscriber(CreateStateChangeSubscriber(
 							m_pBootstrapper->subscriptionManager(),
 							m_cacheHolder,
-							m_dataDirectory))
+							m_dataDirectory,
+							m_pBootstrapper->config().Node))
 					, m_pPostBlockCommitSubscriber(m_pBootstrapper->subscriptionManager().createPostBlockCommitSubscriber())
 					, m_pNotificationSubscriber(m_pBootstrapper->subscriptionManager().createNotificationSubscriber())
 					, m_pNodeSubscriber(CreateNodeSubscriber(m_pBootstrapper->subscriptionManager(), m_nodes))
@@ -151,6 +156,7 @@ namespace catapult { namespace local {
 				CATAPULT_LOG(debug) << "initializing addon plugins cache";
 				CATAPULT_LOG(debug) << "initializing system cache";
 				m_cacheHolder.cache() = m_pluginManager.createCache();
+				m_cacheHolder.cache().setMerkleRootPool(m_pBootstrapper->pool().pushIsolatedPool("merkle root"));
 				pConfigHolder->SetCache(&m_cacheHolder.cache());
 				if (m_pluginManager.isStorageStateSet())
 					m_pluginManager.storageState().setCache(&m_cacheHolder.cache());
@@ -215,9 +221,28 @@ namespace catapult { namespace local {
 				});
 
 				m_pluginManager.addDiagnosticCounters(m_counters, m_cacheHolder.cache()); // add cache counters
+				AddMerkleRootCounters(m_counters, m_cacheHolder.cache());
 				m_counters.emplace_back(utils::DiagnosticCounterId("UT CACHE"), [&source = *m_pUtCache]() {
 					return source.view().size();
 				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("BLK C HIT"), [&storage = m_storage]() {
+					return storage.statistics().NumHits;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("BLK C MISS"), [&storage = m_storage]() {
+					return storage.statistics().NumMisses;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("BLK C SIZE KB"), [&storage = m_storage]() {
+					return utils::FileSize::FromBytes(storage.statistics().Size).kilobytes();
+				});
+
+				// only ParallelFor work is posted through the pools, so these counters do not cover network or timer handlers;
+				// they are summed over the primary and all isolated pools
+				m_counters.emplace_back(utils::DiagnosticCounterId("PFOR Q DEPTH"), [&pool = m_pBootstrapper->pool()]() {
+					return pool.diagnostics().QueueDepth;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("PFOR Q MAX US"), [&pool = m_pBootstrapper->pool()]() {
+					return pool.diagnostics().MaxQueueLatencyMicros;
+				});
 			}
 
 			bool executeAndNotifyNemesis() {
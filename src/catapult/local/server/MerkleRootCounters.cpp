@@ -0,0 +1,61 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "MerkleRootCounters.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache/MerkleRootCalculationContext.h"
+#include "catapult/utils/DiagnosticCounter.h"
+#include <cctype>
+
+namespace catapult { namespace local {
+
+	namespace {
+		constexpr size_t Max_Counter_Name_Size = utils::DiagnosticCounterId::Max_Counter_Name_Size;
+		constexpr size_t Num_Id_Letters = 2;
+		constexpr size_t Max_Sub_Cache_Id = 26 * 26 - 1;
+
+		std::string MakeCounterName(size_t id, const std::string& subCacheName) {
+			// strip any key qualifier and the common "Cache" suffix because counter names are short and contain only letters
+			auto name = subCacheName.substr(0, subCacheName.find_first_of(": "));
+			const std::string cacheSuffix = "Cache";
+			if (name.size() > cacheSuffix.size() && 0 == name.compare(name.size() - cacheSuffix.size(), cacheSuffix.size(), cacheSuffix))
+				name.resize(name.size() - cacheSuffix.size());
+
+			// truncated names of different sub caches can collide, so every name ends with a unique suffix derived from the id
+			std::string counterName = "MR ";
+			for (auto ch : name) {
+				if (Max_Counter_Name_Size - Num_Id_Letters - 1 == counterName.size())
+					break;
+
+				if (std::isalpha(static_cast<unsigned char>(ch)))
+					counterName.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(ch))));
+			}
+
+			counterName.push_back(' ');
+			counterName.push_back(static_cast<char>('A' + id / 26));
+			counterName.push_back(static_cast<char>('A' + id % 26));
+			return counterName;
+		}
+	}
+
+	void AddMerkleRootCounters(std::vector<utils::DiagnosticCounter>& counters, const cache::CatapultCache& cache) {
+		auto pContext = cache.merkleRootContext();
+		for (auto id = 0u; id < pContext->numSubCaches() && id <= Max_Sub_Cache_Id; ++id) {
+			const auto& subCacheName = pContext->subCacheName(id);
+			if (subCacheName.empty())
+				continue;
+
+			// the context can be replaced, so always retrieve it from the cache
+			counters.emplace_back(utils::DiagnosticCounterId(MakeCounterName(id, subCacheName)), [&cache, id]() {
+				return cache.merkleRootContext()->lastDuration(id);
+			});
+		}
+
+		counters.emplace_back(utils::DiagnosticCounterId("MR TOTAL"), [&cache]() {
+			return cache.merkleRootContext()->lastTotalDuration();
+		});
+	}
+}}
@@ -0,0 +1,20 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#pragma once
+#include <vector>
+
+namespace catapult {
+	namespace cache { class CatapultCache; }
+	namespace utils { class DiagnosticCounter; }
+}
+
+namespace catapult { namespace local {
+
+	/// Adds merkle root calculation timing counters for all sub caches of \a cache to \a counters.
+	/// \note Counter values are the number of milliseconds spent during the last state hash calculation.
+	void AddMerkleRootCounters(std::vector<utils::DiagnosticCounter>& counters, const cache::CatapultCache& cache);
+}}
@@ -125,6 +125,8 @@ namespace catapult { namespace model {
 		TRY_LOAD_CHAIN_PROPERTY(EnableDbrbSharding);
 		config.DbrbShardSize = 6;
 		TRY_LOAD_CHAIN_PROPERTY(DbrbShardSize);
+		config.EnableDbrbAggregateCertificates = false;
+		TRY_LOAD_CHAIN_PROPERTY(EnableDbrbAggregateCertificates);
 		config.EnableDbrbFastFinality = false;
 		TRY_LOAD_CHAIN_PROPERTY(EnableDbrbFastFinality);
 		config.CheckNetworkHeightInterval = 10;
@@ -180,6 +180,9 @@ namespace catapult { namespace model {
 		/// DBRB shard size.
 		uint32_t DbrbShardSize;
 
+		/// Enables BLS aggregate certificates in DBRB commit messages (not used by sharded DBRB).
+		bool EnableDbrbAggregateCertificates;
+
 		/// Allows block confirmation using DBRB protocol without Weighted Voting.
 		bool EnableDbrbFastFinality;
 
@@ -242,7 +245,8 @@ namespace catapult { namespace model {
 			if (T::Id >= m_pluginConfigs.size() || !m_pluginConfigs[T::Id])
 				CATAPULT_THROW_AND_LOG_1(catapult_invalid_argument, "plugin configuration not found", std::string(T::Name));
 
-			return *dynamic_cast<const T*>(m_pluginConfigs[T::Id].get());
+			// slot T::Id can only be filled by SetPluginConfiguration<T>, so the type is known
+			return *static_cast<const T*>(m_pluginConfigs[T::Id].get());
 		}
 
 		/// Removes all plugin configs.
@@ -0,0 +1,119 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#pragma once
+#include "NotificationType.h"
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <map>
+#include <vector>
+
+namespace catapult { namespace model {
+
+	/// Immutable lookup table mapping notification types to values.
+	/// \note The table is frozen at construction. Each facility maps to a dense array of slots indexed by notification code,
+	///       so a lookup is two array accesses instead of a tree search.
+	template<typename TValue>
+	class NotificationDispatchTable {
+	private:
+		static constexpr uint32_t Invalid_Entry_Index = std::numeric_limits<uint32_t>::max();
+
+		struct Entry {
+			NotificationType Type;
+			TValue Value;
+		};
+
+		struct FacilitySlots {
+			uint32_t SlotsOffset = 0;
+			uint32_t MinCode = 0;
+			uint32_t NumCodes = 0;
+		};
+
+	public:
+		/// Creates a table around \a values.
+		explicit NotificationDispatchTable(std::map<NotificationType, TValue>&& values) {
+			m_entries.reserve(values.size());
+			for (auto& pair : values)
+				m_entries.push_back(Entry{ pair.first, std::move(pair.second) });
+
+			// group entries by facility and code, types only differing by channel are kept in their original order
+			std::stable_sort(m_entries.begin(), m_entries.end(), [](const auto& lhs, const auto& rhs) {
+				return ToFacilityAndCode(lhs.Type) < ToFacilityAndCode(rhs.Type);
+			});
+
+			buildSlots();
+		}
+
+	public:
+		/// Gets the number of notification types in the table.
+		size_t size() const {
+			return m_entries.size();
+		}
+
+		/// Finds the value associated with \a type or \c nullptr if \a type is unknown.
+		const TValue* find(NotificationType type) const {
+			const auto& facilitySlots = m_facilitySlots[ToFacility(type)];
+			auto codeOffset = ToCode(type) - facilitySlots.MinCode;
+			if (codeOffset >= facilitySlots.NumCodes)
+				return nullptr;
+
+			// facility and code match all entries starting at the slot entry index, so only the channel needs to be checked
+			auto facilityAndCode = ToFacilityAndCode(type);
+			for (auto i = m_slots[facilitySlots.SlotsOffset + codeOffset]; i < m_entries.size(); ++i) {
+				const auto& entry = m_entries[i];
+				if (facilityAndCode != ToFacilityAndCode(entry.Type))
+					break;
+
+				if (type == entry.Type)
+					return &entry.Value;
+			}
+
+			return nullptr;
+		}
+
+	private:
+		void buildSlots() {
+			for (auto i = 0u; i < m_entries.size();) {
+				// entries are sorted, so the first and last entries of each facility bound its code range
+				auto facility = ToFacility(m_entries[i].Type);
+				auto j = i;
+				while (j + 1 < m_entries.size() && facility == ToFacility(m_entries[j + 1].Type))
+					++j;
+
+				auto& facilitySlots = m_facilitySlots[facility];
+				facilitySlots.SlotsOffset = static_cast<uint32_t>(m_slots.size());
+				facilitySlots.MinCode = ToCode(m_entries[i].Type);
+				facilitySlots.NumCodes = ToCode(m_entries[j].Type) - facilitySlots.MinCode + 1;
+				m_slots.resize(m_slots.size() + facilitySlots.NumCodes, Invalid_Entry_Index);
+
+				// point each slot to the first entry with a matching code
+				for (auto k = j + 1; k > i; --k)
+					m_slots[facilitySlots.SlotsOffset + ToCode(m_entries[k - 1].Type) - facilitySlots.MinCode] = k - 1;
+
+				i = j + 1;
+			}
+		}
+
+	private:
+		static uint8_t ToFacility(NotificationType type) {
+			return static_cast<uint8_t>(utils::to_underlying_type(type) >> 16);
+		}
+
+		static uint32_t ToCode(NotificationType type) {
+			return utils::to_underlying_type(type) & 0xFFFF;
+		}
+
+		static uint32_t ToFacilityAndCode(NotificationType type) {
+			return utils::to_underlying_type(type) & 0x00FF'FFFF;
+		}
+
+	private:
+		std::vector<Entry> m_entries;
+		std::vector<uint32_t> m_slots;
+		std::array<FacilitySlots, 256> m_facilitySlots;
+	};
+}}
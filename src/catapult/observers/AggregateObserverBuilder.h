@@ -20,6 +20,7 @@
 
 #pragma once
 #include "ObserverTypes.h"
+#include "catapult/model/NotificationDispatchTable.h"
 #include "catapult/utils/NamedObject.h"
 #include <vector>
 
@@ -48,8 +49,9 @@ namespace catapult { namespace observers {
 		class DefaultAggregateNotificationObserver : public AggregateNotificationObserverT<TNotification> {
 		public:
 			explicit DefaultAggregateNotificationObserver(NotificationObserverPointerMap&& observers)
-					: m_observers(std::move(observers))
-					, m_name(utils::ReduceNames(utils::ExtractNames(m_observers)))
+					: m_names(utils::ExtractNames(observers))
+					, m_name(utils::ReduceNames(m_names))
+					, m_observers(std::move(observers))
 			{}
 
 		public:
@@ -58,15 +60,15 @@ namespace catapult { namespace observers {
 			}
 
 			std::vector<std::string> names() const override {
-				return utils::ExtractNames(m_observers);
+				return m_names;
 			}
 
 			void notify(const TNotification& notification, ObserverContext& context) const override {
-				auto observerIter = m_observers.find(notification.Type);
-				if (m_observers.end() == observerIter)
+				const auto* pObservers = m_observers.find(notification.Type);
+				if (!pObservers)
 					return;
 
-				const auto& observers = observerIter->second;
+				const auto& observers = *pObservers;
 				if (NotifyMode::Commit == context.Mode)
 					notify(observers.cbegin(), observers.cend(), notification, context);
 				else
@@ -81,8 +83,9 @@ namespace catapult { namespace observers {
 			}
 
 		private:
-			NotificationObserverPointerMap m_observers;
+			std::vector<std::string> m_names;
 			std::string m_name;
+			model::NotificationDispatchTable<std::vector<NotificationObserverPointer>> m_observers;
 		};
 
 	private:
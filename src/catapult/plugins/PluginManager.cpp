@@ -22,6 +22,10 @@
 
 namespace catapult { namespace plugins {
 
+	namespace {
+		constexpr size_t Verified_Signature_Cache_Generation_Size = 100'000;
+	}
+
 	PluginManager::PluginManager(
 			const std::shared_ptr<config::BlockchainConfigurationHolder>& pConfigHolder,
 			const StorageConfiguration& storageConfig)
@@ -29,6 +33,7 @@ namespace catapult { namespace plugins {
 			, m_storageConfig(storageConfig)
 			, m_shouldEnableVerifiableState(immutableConfig().ShouldEnableVerifiableState)
 			, m_pTransactionFeeCalculator(std::make_shared<model::TransactionFeeCalculator>())
+			, m_pVerifiedSignatureCache(std::make_shared<crypto::VerifiedSignatureCache>(Verified_Signature_Cache_Generation_Size))
 	{}
 
 	// region config
@@ -60,7 +65,8 @@ namespace catapult { namespace plugins {
 		return cache::CacheConfiguration(
 				(boost::filesystem::path(m_storageConfig.CacheDatabaseDirectory) / name).generic_string(),
 				m_storageConfig.MaxCacheDatabaseWriteBatchSize,
-				m_shouldEnableVerifiableState ? cache::PatriciaTreeStorageMode::Enabled : cache::PatriciaTreeStorageMode::Disabled);
+				m_shouldEnableVerifiableState ? cache::PatriciaTreeStorageMode::Enabled : cache::PatriciaTreeStorageMode::Disabled,
+				m_storageConfig.CacheDatabaseTuning);
 	}
 
 	void PluginManager::setShouldEnableVerifiableState(bool shouldEnableVerifiableState) {
@@ -403,6 +409,14 @@ namespace catapult { namespace plugins {
 
 	// endregion
 
+	// region verified signatures
+
+	const std::shared_ptr<crypto::VerifiedSignatureCache>& PluginManager::verifiedSignatureCache() const {
+		return m_pVerifiedSignatureCache;
+	}
+
+	// endregion
+
 	// region DBRB process update listeners
 
 	const std::vector<std::unique_ptr<observers::DbrbProcessUpdateListener>>& PluginManager::dbrbProcessUpdateListeners() const {
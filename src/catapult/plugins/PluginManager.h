@@ -29,6 +29,7 @@
 #include "catapult/chain/CommitteeManager.h"
 #include "catapult/config/InflationConfiguration.h"
 #include "catapult/config_holder/BlockchainConfigurationHolder.h"
+#include "catapult/crypto/VerifiedSignatureCache.h"
 #include "catapult/dbrb/DbrbViewFetcher.h"
 #include "catapult/ionet/PacketHandlers.h"
 #include "catapult/model/ExtractorContext.h"
@@ -57,6 +58,9 @@ namespace catapult { namespace plugins {
 
 		/// Maximum cache database write batch size.
 		utils::FileSize MaxCacheDatabaseWriteBatchSize;
+
+		/// Cache database engine tuning.
+		cache::CacheDatabaseTuning CacheDatabaseTuning;
 	};
 
 	/// A manager for registering plugins.
@@ -312,6 +316,13 @@ namespace catapult { namespace plugins {
 
 		// endregion
 
+		// region verified signatures
+
+		/// Gets the cache of signatures that have been verified ahead of stateless validation.
+		const std::shared_ptr<crypto::VerifiedSignatureCache>& verifiedSignatureCache() const;
+
+		// endregion
+
 		// region configure plugin manager
 
 		void reset();
@@ -359,6 +370,7 @@ namespace catapult { namespace plugins {
 		std::vector<std::unique_ptr<observers::StorageUpdatesListener>> m_storageUpdatesListeners;
 
 		std::shared_ptr<model::TransactionFeeCalculator> m_pTransactionFeeCalculator;
+		std::shared_ptr<crypto::VerifiedSignatureCache> m_pVerifiedSignatureCache;
 
 		std::vector<std::unique_ptr<observers::DbrbProcessUpdateListener>> m_dbrbProcessUpdateListeners;
 	};
@@ -23,6 +23,8 @@
 #include "StateChangeSubscriber.h"
 #include "SubscriberOperationTypes.h"
 #include "catapult/cache/CacheChangesStorage.h"
+#include "catapult/io/BufferCompression.h"
+#include "catapult/io/BufferInputStreamAdapter.h"
 #include "catapult/io/PodIoUtils.h"
 #include "catapult/io/Stream.h"
 #include "catapult/exceptions.h"
@@ -58,6 +60,22 @@ namespace catapult { namespace subscribers {
 			auto cacheChanges = ReadCacheChanges(inputStream, cacheChangesStorages);
 			subscriber.notifyStateChange({ std::move(cacheChanges), chainScore, height });
 		}
+
+		void ReadAndNotifyCompressedStateChange(
+				io::InputStream& inputStream,
+				const CacheChangesStorages& cacheChangesStorages,
+				StateChangeSubscriber& subscriber) {
+			auto stateChangeSize = io::Read32(inputStream);
+			std::vector<uint8_t> compressedStateChange(io::Read32(inputStream));
+			inputStream.read(compressedStateChange);
+
+			auto stateChange = io::DecompressBuffer(compressedStateChange, stateChangeSize);
+			io::BufferInputStreamAdapter<std::vector<uint8_t>> stateChangeStream(stateChange);
+			ReadAndNotifyStateChange(stateChangeStream, cacheChangesStorages, subscriber);
+
+			if (!stateChangeStream.eof())
+				CATAPULT_THROW_INVALID_ARGUMENT_1("compressed state change contains trailing bytes", stateChange.size() - stateChangeStream.position());
+		}
 	}
 
 	void ReadNextStateChange(
@@ -71,6 +89,8 @@ namespace catapult { namespace subscribers {
 			return ReadAndNotifyScoreChange(inputStream, subscriber);
 		case StateChangeOperationType::State_Change:
 			return ReadAndNotifyStateChange(inputStream, cacheChangesStorages, subscriber);
+		case StateChangeOperationType::Compressed_State_Change:
+			return ReadAndNotifyCompressedStateChange(inputStream, cacheChangesStorages, subscriber);
 		}
 
 		CATAPULT_THROW_INVALID_ARGUMENT_1("invalid state change operation type", static_cast<uint16_t>(operationType));
@@ -50,7 +50,10 @@ namespace catapult { namespace subscribers {
 		Score_Change,
 
 		/// State change.
-		State_Change
+		State_Change,
+
+		/// State change with compressed payload.
+		Compressed_State_Change
 	};
 
 	/// Unconfirmed transactions change operation type.
@@ -33,7 +33,9 @@
 namespace catapult { namespace subscribers {
 
 	SubscriptionManager::SubscriptionManager(const config::BlockchainConfiguration& config)
-			: m_pStorage(std::make_unique<io::FileBlockStorage>(config.User.DataDirectory)) {
+			: m_pStorage(std::make_unique<io::FileBlockStorage>(
+					config.User.DataDirectory,
+					io::GetFileBlockStorageMode(config.User.DataDirectory))) {
 		m_subscriberUsedFlags.fill(false);
 	}
 
@@ -24,20 +24,29 @@
 #include "catapult/exceptions.h"
 #include <boost/asio.hpp>
 #include <boost/thread.hpp>
+#include <chrono>
+#include <thread>
 
 namespace catapult { namespace thread {
 
 	namespace {
+		using IoContexts = std::vector<std::unique_ptr<boost::asio::io_context>>;
+
 		// helper RAII class to simplify a restartable thread pool with limitless work
 		class ThreadPoolContext {
 		public:
-			explicit ThreadPoolContext(boost::asio::io_context& ioContext) : m_work(boost::asio::make_work_guard(ioContext)) {
-				ioContext.reset();
+			explicit ThreadPoolContext(IoContexts& ioContexts) {
+				for (auto& pIoContext : ioContexts) {
+					m_works.push_back(boost::asio::make_work_guard(*pIoContext));
+					pIoContext->reset();
+				}
 			}
 
 			~ThreadPoolContext() {
 				// destroy the work before waiting for the thread pool threads to stop
-				m_work.reset();
+				for (auto& work : m_works)
+					work.reset();
+
 				m_threads.join_all();
 			}
 
@@ -52,17 +61,77 @@ namespace catapult { namespace thread {
 			}
 
 		private:
-			boost::asio::executor_work_guard<boost::asio::io_context::executor_type> m_work;
+			std::vector<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> m_works;
 			boost::thread_group m_threads;
 		};
 
+		// helper class for collecting diagnostics of posted handlers
+		class PostDiagnostics {
+		private:
+			using Clock = std::chrono::steady_clock;
+
+		public:
+			PostDiagnostics()
+					: m_queueDepth(0)
+					, m_numExecutedHandlers(0)
+					, m_totalQueueLatencyMicros(0)
+					, m_maxQueueLatencyMicros(0)
+			{}
+
+		public:
+			IoThreadPoolDiagnostics get() const {
+				IoThreadPoolDiagnostics diagnostics;
+				diagnostics.QueueDepth = m_queueDepth;
+				diagnostics.NumExecutedHandlers = m_numExecutedHandlers;
+				diagnostics.TotalQueueLatencyMicros = m_totalQueueLatencyMicros;
+				diagnostics.MaxQueueLatencyMicros = m_maxQueueLatencyMicros;
+				return diagnostics;
+			}
+
+		public:
+			void post(boost::asio::io_context& ioContext, const action& handler) {
+				++m_queueDepth;
+				boost::asio::post(ioContext, [this, handler, postTime = Clock::now()]() {
+					markExecuted(postTime);
+					handler();
+				});
+			}
+
+		private:
+			void markExecuted(Clock::time_point postTime) {
+				auto latencyMicros = static_cast<uint64_t>(
+						std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - postTime).count());
+
+				--m_queueDepth;
+				++m_numExecutedHandlers;
+				m_totalQueueLatencyMicros += latencyMicros;
+
+				auto maxLatencyMicros = m_maxQueueLatencyMicros.load();
+				while (maxLatencyMicros < latencyMicros && !m_maxQueueLatencyMicros.compare_exchange_weak(maxLatencyMicros, latencyMicros))
+				{}
+			}
+
+		private:
+			std::atomic<uint64_t> m_queueDepth;
+			std::atomic<uint64_t> m_numExecutedHandlers;
+			std::atomic<uint64_t> m_totalQueueLatencyMicros;
+			std::atomic<uint64_t> m_maxQueueLatencyMicros;
+		};
+
+		// worker threads are assigned to io contexts round robin, so a shared pool has a single io context
+		// and a sharded pool has one io context per worker thread
 		class DefaultIoThreadPool : public IoThreadPool {
 		public:
-			DefaultIoThreadPool(size_t numWorkerThreads, const std::string& tag)
+			DefaultIoThreadPool(size_t numWorkerThreads, const std::string& tag, const IoThreadPoolOptions& options)
 					: m_numConfiguredWorkerThreads(numWorkerThreads)
 					, m_tag(tag)
-					, m_numWorkerThreads(0)
-			{}
+					, m_options(options)
+					, m_nextIoContextIndex(0)
+					, m_numWorkerThreads(0) {
+				auto numIoContexts = IoThreadPoolMode::Sharded == m_options.Mode ? std::max<size_t>(1, numWorkerThreads) : 1;
+				for (auto i = 0u; i < numIoContexts; ++i)
+					m_ioContexts.push_back(std::make_unique<boost::asio::io_context>(1 == numIoContexts ? BOOST_ASIO_CONCURRENCY_HINT_DEFAULT : 1));
+			}
 
 			~DefaultIoThreadPool() override {
 				join();
@@ -78,7 +147,21 @@ namespace catapult { namespace thread {
 			}
 
 			boost::asio::io_context& ioContext() override {
-				return m_ioContext;
+				// avoid touching the shared counter when there is nothing to balance
+				return 1 == m_ioContexts.size() ? *m_ioContexts[0] : ioContext(m_nextIoContextIndex++);
+			}
+
+			boost::asio::io_context& ioContext(size_t affinityKey) override {
+				return *m_ioContexts[affinityKey % m_ioContexts.size()];
+			}
+
+			IoThreadPoolDiagnostics diagnostics() const override {
+				return m_postDiagnostics.get();
+			}
+
+		public:
+			void post(size_t affinityKey, const action& handler) override {
+				m_postDiagnostics.post(ioContext(affinityKey), handler);
 			}
 
 		public:
@@ -88,18 +171,23 @@ namespace catapult { namespace thread {
 
 				// spawn the number of configured threads
 				CATAPULT_LOG(trace) << m_tag << " spawning threads";
-				m_pContext = std::make_unique<ThreadPoolContext>(m_ioContext);
+				m_pContext = std::make_unique<ThreadPoolContext>(m_ioContexts);
 				for (auto i = 0u; i < m_numConfiguredWorkerThreads; ++i) {
 					m_pContext->createThread([this, i]() {
 						thread::SetThreadName(std::to_string(i) + " " + this->tag() + " worker");
-						ioWorkerFunction();
+						if (m_options.ShouldPinThreads)
+							pinThread(i);
+
+						ioWorkerFunction(ioContext(i));
 					});
 				}
 
 				// wait for the threads to be spawned
 				CATAPULT_LOG(trace) << m_tag << " waiting for threads to be spawned";
 				while (m_numWorkerThreads < m_numConfiguredWorkerThreads) {}
-				CATAPULT_LOG(info) << m_tag << " spawned " << m_pContext->numThreads() << " workers";
+				CATAPULT_LOG(info)
+						<< m_tag << " spawned " << m_pContext->numThreads() << " workers running "
+						<< m_ioContexts.size() << " io contexts";
 			}
 
 			void join() override {
@@ -112,11 +200,17 @@ namespace catapult { namespace thread {
 			}
 
 		private:
-			void ioWorkerFunction() {
+			void pinThread(size_t workerIndex) {
+				auto cpuIndex = workerIndex % std::max<size_t>(1, std::thread::hardware_concurrency());
+				if (!thread::PinThreadToCpu(cpuIndex))
+					CATAPULT_LOG(warning) << m_tag << " could not pin worker thread " << workerIndex << " to cpu " << cpuIndex;
+			}
+
+			void ioWorkerFunction(boost::asio::io_context& ioContext) {
 				CATAPULT_LOG(trace) << m_tag << " worker thread started";
 
 				auto incrementDecrementGuard = utils::MakeIncrementDecrementGuard(m_numWorkerThreads);
-				m_ioContext.run();
+				ioContext.run();
 
 				CATAPULT_LOG(trace) << m_tag << " worker thread finished";
 			}
@@ -124,8 +218,11 @@ namespace catapult { namespace thread {
 		private:
 			size_t m_numConfiguredWorkerThreads;
 			std::string m_tag;
+			IoThreadPoolOptions m_options;
 
-			boost::asio::io_context m_ioContext;
+			IoContexts m_ioContexts;
+			std::atomic<size_t> m_nextIoContextIndex;
+			PostDiagnostics m_postDiagnostics;
 			std::unique_ptr<ThreadPoolContext> m_pContext;
 			std::atomic<uint32_t> m_numWorkerThreads;
 		};
@@ -143,6 +240,10 @@ namespace catapult { namespace thread {
 	}
 
 	std::unique_ptr<IoThreadPool> CreateIoThreadPool(size_t numWorkerThreads, const char* name) {
-		return std::make_unique<DefaultIoThreadPool>(numWorkerThreads, CreateTagFromName(name));
+		return CreateIoThreadPool(numWorkerThreads, name, IoThreadPoolOptions());
+	}
+
+	std::unique_ptr<IoThreadPool> CreateIoThreadPool(size_t numWorkerThreads, const char* name, const IoThreadPoolOptions& options) {
+		return std::make_unique<DefaultIoThreadPool>(numWorkerThreads, CreateTagFromName(name), options);
 	}
 }}
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/functions.h"
 #include <memory>
 #include <string>
 
@@ -26,7 +27,44 @@ namespace boost { namespace asio { class io_context; } }
 
 namespace catapult { namespace thread {
 
-	/// Represents a thread pool that shares a single io context across multiple threads.
+	/// Io thread pool modes.
+	enum class IoThreadPoolMode {
+		/// All worker threads share a single io context.
+		Shared,
+
+		/// Each worker thread runs its own io context.
+		/// \note Handlers must not block waiting for other work posted to the same pool because that work might be queued
+		///       behind them on the same io context.
+		Sharded
+	};
+
+	/// Io thread pool options.
+	struct IoThreadPoolOptions {
+		/// Pool mode.
+		IoThreadPoolMode Mode = IoThreadPoolMode::Shared;
+
+		/// \c true if each worker thread should be pinned to a single cpu core.
+		bool ShouldPinThreads = false;
+	};
+
+	/// Diagnostics of the handlers posted via IoThreadPool::post.
+	/// \note Only ParallelFor posts via IoThreadPool::post, so handlers dispatched directly to an io context
+	///       (e.g. network and timer handlers) are not included.
+	struct IoThreadPoolDiagnostics {
+		/// Number of posted handlers that have not started executing.
+		uint64_t QueueDepth = 0;
+
+		/// Number of posted handlers that have started executing.
+		uint64_t NumExecutedHandlers = 0;
+
+		/// Total time posted handlers spent in the queue (in microseconds).
+		uint64_t TotalQueueLatencyMicros = 0;
+
+		/// Maximum time a posted handler spent in the queue (in microseconds).
+		uint64_t MaxQueueLatencyMicros = 0;
+	};
+
+	/// Represents a thread pool that runs one or more io contexts on multiple threads.
 	class IoThreadPool {
 	public:
 		virtual ~IoThreadPool() = default;
@@ -38,9 +76,21 @@ namespace catapult { namespace thread {
 		/// Gets the friendly name of this thread pool.
 		virtual const std::string& tag() const = 0;
 
-		/// Gets the underlying io_context.
+		/// Gets an underlying io_context.
+		/// \note When there are multiple io contexts, they are returned in round robin order.
 		virtual boost::asio::io_context& ioContext() = 0;
 
+		/// Gets the underlying io_context associated with \a affinityKey.
+		/// \note The same key is always associated with the same io context.
+		virtual boost::asio::io_context& ioContext(size_t affinityKey) = 0;
+
+		/// Gets diagnostics of the handlers posted via post.
+		virtual IoThreadPoolDiagnostics diagnostics() const = 0;
+
+	public:
+		/// Posts \a handler to the io_context associated with \a affinityKey.
+		virtual void post(size_t affinityKey, const action& handler) = 0;
+
 	public:
 		/// Starts the thread pool.
 		/// \note All worker threads will be active when this function returns.
@@ -53,4 +103,8 @@ namespace catapult { namespace thread {
 	/// Creates an io thread pool with the specified number of threads (\a numWorkerThreads) and the
 	/// optional friendly \a name used in logging.
 	std::unique_ptr<IoThreadPool> CreateIoThreadPool(size_t numWorkerThreads, const char* name = nullptr);
+
+	/// Creates an io thread pool with the specified number of threads (\a numWorkerThreads), the
+	/// friendly \a name used in logging and custom \a options.
+	std::unique_ptr<IoThreadPool> CreateIoThreadPool(size_t numWorkerThreads, const char* name, const IoThreadPoolOptions& options);
 }}
@@ -22,7 +22,9 @@
 #include "IoThreadPool.h"
 #include "catapult/utils/Logging.h"
 #include "catapult/functions.h"
+#include <algorithm>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 #include <atomic>
@@ -117,14 +119,20 @@ namespace catapult { namespace thread {
 
 	public:
 		/// Creates a pool with the specified number of threads (\a numWorkerThreads) and \a name with optional
-		/// isolated pool mode (\a isolatedPoolMode).
+		/// isolated pool mode (\a isolatedPoolMode) and optional default thread pool options (\a poolOptions).
 		/// \note If \a numWorkerThreads is \c 0, a default number of threads will be used.
-		MultiServicePool(const std::string& name, size_t numWorkerThreads, IsolatedPoolMode isolatedPoolMode = IsolatedPoolMode::Enabled)
+		/// \note \a poolOptions are used for the primary pool and for all isolated pools created without custom options.
+		MultiServicePool(
+				const std::string& name,
+				size_t numWorkerThreads,
+				IsolatedPoolMode isolatedPoolMode = IsolatedPoolMode::Enabled,
+				const IoThreadPoolOptions& poolOptions = IoThreadPoolOptions())
 				: m_name(name)
 				, m_isolatedPoolMode(isolatedPoolMode)
+				, m_poolOptions(poolOptions)
 				, m_numTotalIsolatedPoolThreads(0)
 				, m_numServiceGroups(0)
-				, m_pPool(CreateThreadPool(numWorkerThreads, name))
+				, m_pPool(CreateThreadPool(numWorkerThreads, name, poolOptions))
 		{}
 
 		/// Destroys the pool.
@@ -154,6 +162,31 @@ namespace catapult { namespace thread {
 			return numServices;
 		}
 
+		/// Gets the combined diagnostics of the handlers posted (by ParallelFor) to the primary pool and all isolated pools.
+		/// \note This accessor is threadsafe and can be called concurrently with pool creation and shutdown.
+		IoThreadPoolDiagnostics diagnostics() const {
+			IoThreadPoolDiagnostics diagnostics;
+			auto addDiagnostics = [&diagnostics](const auto& pool) {
+				auto poolDiagnostics = pool.diagnostics();
+				diagnostics.QueueDepth += poolDiagnostics.QueueDepth;
+				diagnostics.NumExecutedHandlers += poolDiagnostics.NumExecutedHandlers;
+				diagnostics.TotalQueueLatencyMicros += poolDiagnostics.TotalQueueLatencyMicros;
+				diagnostics.MaxQueueLatencyMicros = std::max(diagnostics.MaxQueueLatencyMicros, poolDiagnostics.MaxQueueLatencyMicros);
+			};
+
+			std::lock_guard<std::mutex> lock(m_poolsMutex);
+			if (m_pPool)
+				addDiagnostics(*m_pPool);
+
+			for (const auto& pIsolatedPoolWeak : m_isolatedPools) {
+				auto pIsolatedPool = pIsolatedPoolWeak.lock();
+				if (pIsolatedPool)
+					addDiagnostics(*pIsolatedPool);
+			}
+
+			return diagnostics;
+		}
+
 	private:
 		template<typename TService>
 		auto registerService(const std::shared_ptr<TService>& pService, const std::string& serviceName) {
@@ -186,6 +219,16 @@ namespace catapult { namespace thread {
 		/// Creates a new isolated thread pool with the specified number of threads (\a numWorkerThreads) and \a name.
 		/// \note If \a numWorkerThreads is \c 0, a default number of threads will be used.
 		std::shared_ptr<thread::IoThreadPool> pushIsolatedPool(const std::string& name, size_t numWorkerThreads) {
+			return pushIsolatedPool(name, numWorkerThreads, m_poolOptions);
+		}
+
+		/// Creates a new isolated thread pool with the specified number of threads (\a numWorkerThreads), \a name
+		/// and custom thread pool options (\a poolOptions).
+		/// \note If \a numWorkerThreads is \c 0, a default number of threads will be used.
+		std::shared_ptr<thread::IoThreadPool> pushIsolatedPool(
+				const std::string& name,
+				size_t numWorkerThreads,
+				const IoThreadPoolOptions& poolOptions) {
 			class PoolServiceAdapter {
 			public:
 				explicit PoolServiceAdapter(const std::shared_ptr<thread::IoThreadPool>& pPool) : m_pPool(pPool)
@@ -205,8 +248,13 @@ namespace catapult { namespace thread {
 			if (IsolatedPoolMode::Disabled == m_isolatedPoolMode)
 				return m_pPool;
 
-			auto pPool = CreateThreadPool(numWorkerThreads, name);
+			auto pPool = CreateThreadPool(numWorkerThreads, name, poolOptions);
 			registerService(std::make_shared<PoolServiceAdapter>(pPool), name + " (isolated pool)");
+			{
+				std::lock_guard<std::mutex> lock(m_poolsMutex);
+				m_isolatedPools.push_back(pPool);
+			}
+
 			m_numTotalIsolatedPoolThreads += pPool->numWorkerThreads();
 			return pPool;
 		}
@@ -226,18 +274,33 @@ namespace catapult { namespace thread {
 				(*iter)();
 
 			m_shutdownFunctions.clear();
+			{
+				std::lock_guard<std::mutex> lock(m_poolsMutex);
+				m_isolatedPools.clear();
+			}
+
 			m_numTotalIsolatedPoolThreads = 0;
 			m_numServiceGroups = 0;
 
 			// 3. after the services are destroyed, the thread pool can be safely destroyed
+			//    (outside of the lock because destroying it joins threads that might be waiting for diagnostics)
 			WaitForLastReference(m_pPool);
-			m_pPool.reset();
+			std::shared_ptr<thread::IoThreadPool> pPool;
+			{
+				std::lock_guard<std::mutex> lock(m_poolsMutex);
+				pPool = std::move(m_pPool);
+			}
+
+			pPool.reset();
 		}
 
 	private:
-		static std::shared_ptr<thread::IoThreadPool> CreateThreadPool(size_t numWorkerThreads, const std::string& name) {
+		static std::shared_ptr<thread::IoThreadPool> CreateThreadPool(
+				size_t numWorkerThreads,
+				const std::string& name,
+				const IoThreadPoolOptions& poolOptions) {
 			numWorkerThreads = DefaultPoolConcurrency() == numWorkerThreads ? std::thread::hardware_concurrency() : numWorkerThreads;
-			auto pPool = thread::CreateIoThreadPool(numWorkerThreads, name.c_str());
+			auto pPool = thread::CreateIoThreadPool(numWorkerThreads, name.c_str(), poolOptions);
 			pPool->start();
 			return std::move(pPool);
 		}
@@ -252,10 +315,13 @@ namespace catapult { namespace thread {
 	private:
 		std::string m_name;
 		IsolatedPoolMode m_isolatedPoolMode;
+		IoThreadPoolOptions m_poolOptions;
 		size_t m_numTotalIsolatedPoolThreads;
 		std::atomic<size_t> m_numServiceGroups;
 		std::shared_ptr<thread::IoThreadPool> m_pPool;
 		std::vector<std::shared_ptr<ServiceGroup>> m_serviceGroups;
+		std::vector<std::weak_ptr<thread::IoThreadPool>> m_isolatedPools; // weak to not delay isolated pool shutdown
 		std::vector<action> m_shutdownFunctions;
+		mutable std::mutex m_poolsMutex; // guards m_pPool and m_isolatedPools against concurrent diagnostics
 	};
 }}
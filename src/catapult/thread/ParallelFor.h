@@ -20,15 +20,35 @@
 
 #pragma once
 #include "Future.h"
+#include "IoThreadPool.h"
 #include <boost/asio.hpp>
+#include <algorithm>
+#include <mutex>
+#include <vector>
 
 namespace catapult { namespace thread {
 
-	/// Uses \a ioContext to process \a items in \a numPartitions batches and calls \a callback for each partition.
+	namespace detail {
+		/// Posts \a handler to \a ioContext.
+		template<typename THandler>
+		void PostWork(boost::asio::io_context& ioContext, size_t, THandler&& handler) {
+			boost::asio::post(ioContext, std::forward<THandler>(handler));
+		}
+
+		/// Posts \a handler to the io context of \a pool associated with \a workIndex.
+		/// \note This spreads work across all io contexts of a sharded pool.
+		template<typename THandler>
+		void PostWork(IoThreadPool& pool, size_t workIndex, THandler&& handler) {
+			pool.post(workIndex, std::forward<THandler>(handler));
+		}
+	}
+
+	/// Uses \a executor to process \a items in \a numPartitions batches and calls \a callback for each partition.
 	/// A future is returned that is resolved when all items have been processed.
-	template<typename TItems, typename TWorkCallback>
+	/// \note \a executor can either be an io_context or an IoThreadPool.
+	template<typename TExecutor, typename TItems, typename TWorkCallback>
 	thread::future<bool> ParallelForPartition(
-			boost::asio::io_context& ioContext,
+			TExecutor& executor,
 			TItems& items,
 			size_t numPartitions,
 			TWorkCallback callback) {
@@ -99,7 +119,7 @@ namespace catapult { namespace thread {
 			pParallelContext->incrementOutstandingOperations();
 			auto startIndex = numTotalItems - numRemainingItems;
 			auto batchIndex = numPartitions - numRemainingPartitions;
-			boost::asio::post(ioContext, [callback, pParallelContext, itBegin, itEnd, startIndex, batchIndex]() {
+			detail::PostWork(executor, batchIndex, [callback, pParallelContext, itBegin, itEnd, startIndex, batchIndex]() {
 				DecrementGuard threadOperationGuard(*pParallelContext);
 				callback(itBegin, itEnd, startIndex, batchIndex);
 			});
@@ -112,11 +132,11 @@ namespace catapult { namespace thread {
 		return pParallelContext->future();
 	}
 
-	/// Uses \a ioContext to process \a items in \a numPartitions batches and calls \a callback for each item.
+	/// Uses \a executor to process \a items in \a numPartitions batches and calls \a callback for each item.
 	/// A future is returned that is resolved when all items have been processed.
-	template<typename TItems, typename TWorkCallback>
-	thread::future<bool> ParallelFor(boost::asio::io_context& ioContext, TItems& items, size_t numPartitions, TWorkCallback callback) {
-		return ParallelForPartition(ioContext, items, numPartitions, [callback](auto itBegin, auto itEnd, auto startIndex, auto) {
+	template<typename TExecutor, typename TItems, typename TWorkCallback>
+	thread::future<bool> ParallelFor(TExecutor& executor, TItems& items, size_t numPartitions, TWorkCallback callback) {
+		return ParallelForPartition(executor, items, numPartitions, [callback](auto itBegin, auto itEnd, auto startIndex, auto) {
 			auto i = 0u;
 			for (auto iter = itBegin; itEnd != iter; ++iter, ++i) {
 				if (!callback(*iter, startIndex + i))
@@ -124,4 +144,180 @@ namespace catapult { namespace thread {
 			}
 		});
 	}
+
+	/// Uses \a executor to process \a items with up to \a numWorkers workers and calls \a callback for each item.
+	/// Items are grouped into contiguous chunks of roughly equal cost, as estimated by \a costEstimator, and idle workers claim
+	/// the remaining chunks on demand (most expensive first), so a few expensive items do not stall processing of other items.
+	/// A future is returned that is resolved when all items have been processed or with the first exception thrown by \a callback.
+	/// \note All workers stop claiming items as soon as \a callback returns \c false.
+	/// \note \a executor can either be an io_context or an IoThreadPool.
+	template<typename TExecutor, typename TItems, typename TCostEstimator, typename TWorkCallback>
+	thread::future<bool> ParallelForDynamic(
+			TExecutor& executor,
+			TItems& items,
+			size_t numWorkers,
+			TCostEstimator costEstimator,
+			TWorkCallback callback) {
+		using IteratorType = decltype(items.begin());
+
+		// region Chunk
+
+		struct Chunk {
+			IteratorType Begin;
+			IteratorType End;
+			size_t StartIndex;
+			uint64_t Cost;
+		};
+
+		// endregion
+
+		// region ParallelContext
+
+		class ParallelContext {
+		public:
+			ParallelContext(std::vector<Chunk>&& chunks, const TWorkCallback& callback)
+					: m_chunks(std::move(chunks))
+					, m_callback(callback)
+					, m_nextChunkIndex(0)
+					, m_isStopped(false)
+					, m_numOutstandingOperations(1) // note that the work partitioning is the initial operation
+			{}
+
+		public:
+			auto future() {
+				return m_promise.get_future();
+			}
+
+		public:
+			void incrementOutstandingOperations() {
+				++m_numOutstandingOperations;
+			}
+
+			void decrementOutstandingOperations() {
+				if (0 != --m_numOutstandingOperations)
+					return;
+
+				if (m_pException)
+					m_promise.set_exception(m_pException);
+				else
+					m_promise.set_value(true);
+			}
+
+		public:
+			void process() {
+				try {
+					while (!m_isStopped) {
+						auto chunkIndex = m_nextChunkIndex++;
+						if (chunkIndex >= m_chunks.size())
+							return;
+
+						const auto& chunk = m_chunks[chunkIndex];
+						auto index = chunk.StartIndex;
+						for (auto iter = chunk.Begin; chunk.End != iter; ++iter, ++index) {
+							if (!m_callback(*iter, index)) {
+								m_isStopped = true;
+								return;
+							}
+						}
+					}
+				} catch (...) {
+					std::lock_guard<std::mutex> guard(m_exceptionMutex);
+					if (!m_pException)
+						m_pException = std::current_exception();
+
+					m_isStopped = true;
+				}
+			}
+
+		private:
+			std::vector<Chunk> m_chunks;
+			TWorkCallback m_callback;
+			std::atomic<size_t> m_nextChunkIndex;
+			std::atomic_bool m_isStopped;
+			std::atomic<size_t> m_numOutstandingOperations;
+			std::exception_ptr m_pException;
+			std::mutex m_exceptionMutex;
+			thread::promise<bool> m_promise;
+		};
+
+		// endregion
+
+		// region DecrementGuard
+
+		class DecrementGuard {
+		public:
+			explicit DecrementGuard(ParallelContext& context) : m_context(context)
+			{}
+
+			~DecrementGuard() {
+				m_context.decrementOutstandingOperations();
+			}
+
+		private:
+			ParallelContext& m_context;
+		};
+
+		// endregion
+
+		if (items.empty())
+			return thread::make_ready_future(true);
+
+		// create enough chunks so that every worker can claim several of them
+		constexpr size_t Num_Chunks_Per_Worker = 8;
+		numWorkers = std::max<size_t>(1, numWorkers);
+
+		std::vector<uint64_t> costs;
+		uint64_t totalCost = 0;
+		for (const auto& item : items) {
+			costs.push_back(std::max<uint64_t>(1, costEstimator(item)));
+			totalCost += costs.back();
+		}
+
+		// note: a chunk is closed before it exceeds the target cost, so an expensive item always starts a new chunk
+		auto targetChunkCost = std::max<uint64_t>(1, totalCost / (numWorkers * Num_Chunks_Per_Worker));
+		std::vector<Chunk> chunks;
+		auto itChunkBegin = items.begin();
+		size_t chunkStartIndex = 0;
+		uint64_t chunkCost = 0;
+		size_t index = 0;
+		for (auto iter = items.begin(); items.end() != iter; ++iter, ++index) {
+			if (0 != chunkCost && chunkCost + costs[index] > targetChunkCost) {
+				chunks.push_back({ itChunkBegin, iter, chunkStartIndex, chunkCost });
+				itChunkBegin = iter;
+				chunkStartIndex = index;
+				chunkCost = 0;
+			}
+
+			chunkCost += costs[index];
+		}
+
+		chunks.push_back({ itChunkBegin, items.end(), chunkStartIndex, chunkCost });
+
+		// claim expensive chunks first so that they do not end up being processed last
+		std::stable_sort(chunks.begin(), chunks.end(), [](const auto& lhs, const auto& rhs) {
+			return lhs.Cost > rhs.Cost;
+		});
+
+		auto numPostedWorkers = std::min(numWorkers, chunks.size());
+		auto pParallelContext = std::make_shared<ParallelContext>(std::move(chunks), callback);
+		DecrementGuard mainOperationGuard(*pParallelContext);
+		for (auto i = 0u; i < numPostedWorkers; ++i) {
+			// each thread captures pParallelContext by value, which keeps that object alive
+			pParallelContext->incrementOutstandingOperations();
+			detail::PostWork(executor, i, [pParallelContext]() {
+				DecrementGuard threadOperationGuard(*pParallelContext);
+				pParallelContext->process();
+			});
+		}
+
+		return pParallelContext->future();
+	}
+
+	/// Uses \a executor to process \a items with up to \a numWorkers workers and calls \a callback for each item.
+	/// All items are assumed to have the same cost.
+	/// A future is returned that is resolved when all items have been processed or with the first exception thrown by \a callback.
+	template<typename TExecutor, typename TItems, typename TWorkCallback>
+	thread::future<bool> ParallelForDynamic(TExecutor& executor, TItems& items, size_t numWorkers, TWorkCallback callback) {
+		return ParallelForDynamic(executor, items, numWorkers, [](const auto&) { return 1u; }, callback);
+	}
 }}
@@ -80,6 +80,19 @@ namespace catapult { namespace thread {
 #else
 		// musl libc (from alpine) defines __GNU_SOURCE__ but it only has pthread_setname_np
 		return std::string();
+#endif
+	}
+
+	bool PinThreadToCpu(size_t cpuIndex) {
+#if defined(__linux__) && defined(__GLIBC__)
+		cpu_set_t cpuSet;
+		CPU_ZERO(&cpuSet);
+		CPU_SET(cpuIndex, &cpuSet);
+		return 0 == pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+#else
+		// thread affinity is only supported on linux
+		CATAPULT_LOG(debug) << "cannot pin thread to cpu " << cpuIndex << " on this platform";
+		return false;
 #endif
 	}
 }}
@@ -32,4 +32,8 @@ namespace catapult { namespace thread {
 
 	/// Gets a thread name in a platform-dependent way.
 	std::string GetThreadName();
+
+	/// Pins the current thread to the cpu core with index \a cpuIndex in a platform-dependent way.
+	/// Returns \c false if the thread could not be pinned.
+	bool PinThreadToCpu(size_t cpuIndex);
 }}
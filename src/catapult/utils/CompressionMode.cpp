@@ -0,0 +1,25 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "CompressionMode.h"
+#include "ConfigurationValueParsers.h"
+
+namespace catapult { namespace utils {
+
+	namespace {
+		const std::array<std::pair<const char*, CompressionMode>, 5> String_To_Compression_Mode_Pairs{{
+			{ "default", CompressionMode::Default },
+			{ "none", CompressionMode::None },
+			{ "snappy", CompressionMode::Snappy },
+			{ "lz4", CompressionMode::Lz4 },
+			{ "zstd", CompressionMode::Zstd }
+		}};
+	}
+
+	bool TryParseValue(const std::string& str, CompressionMode& mode) {
+		return TryParseEnumValue(String_To_Compression_Mode_Pairs, str, mode);
+	}
+}}
@@ -0,0 +1,32 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#pragma once
+#include <string>
+
+namespace catapult { namespace utils {
+
+	/// Storage compression modes.
+	enum class CompressionMode {
+		/// Use the storage engine default compression.
+		Default,
+
+		/// Disable compression.
+		None,
+
+		/// Use snappy compression.
+		Snappy,
+
+		/// Use lz4 compression.
+		Lz4,
+
+		/// Use zstd compression.
+		Zstd
+	};
+
+	/// Tries to parse \a str into a compression \a mode.
+	bool TryParseValue(const std::string& str, CompressionMode& mode);
+}}
@@ -0,0 +1,127 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "ShortHashSketch.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+#include <array>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		constexpr std::array<uint32_t, ShortHashSketch::Num_Hash_Functions> Cell_Seeds{ { 0x5BD1E995, 0x1B873593, 0xCC9E2D51 } };
+		constexpr uint32_t Check_Seed = 0x9E3779B9;
+
+		// finalization mix of murmur3
+		uint32_t Mix(uint32_t value) {
+			value ^= value >> 16;
+			value *= 0x85EBCA6B;
+			value ^= value >> 13;
+			value *= 0xC2B2AE35;
+			value ^= value >> 16;
+			return value;
+		}
+
+		uint32_t CalculateCheckHash(ShortHash shortHash) {
+			return Mix(shortHash.unwrap() ^ Check_Seed);
+		}
+
+		// each hash function maps into its own partition, so a short hash is always mapped to distinct cells
+		template<typename TAction>
+		void ForEachCellIndex(size_t numCells, ShortHash shortHash, TAction action) {
+			auto partitionSize = numCells / ShortHashSketch::Num_Hash_Functions;
+			for (auto i = 0u; i < ShortHashSketch::Num_Hash_Functions; ++i)
+				action(i * partitionSize + Mix(shortHash.unwrap() ^ Cell_Seeds[i]) % partitionSize);
+		}
+
+		void Update(std::vector<ShortHashSketchCell>& cells, ShortHash shortHash, int32_t countDelta) {
+			auto checkHash = CalculateCheckHash(shortHash);
+			ForEachCellIndex(cells.size(), shortHash, [&cells, shortHash, countDelta, checkHash](auto index) {
+				auto& cell = cells[index];
+				cell.Count += countDelta;
+				cell.KeySum = ShortHash(cell.KeySum.unwrap() ^ shortHash.unwrap());
+				cell.CheckSum ^= checkHash;
+			});
+		}
+
+		bool IsPure(const ShortHashSketchCell& cell) {
+			return (1 == cell.Count || -1 == cell.Count) && CalculateCheckHash(cell.KeySum) == cell.CheckSum;
+		}
+
+		bool IsEmpty(const ShortHashSketchCell& cell) {
+			return 0 == cell.Count && 0 == cell.KeySum.unwrap() && 0 == cell.CheckSum;
+		}
+
+		size_t CalculateNumCells(size_t numCells) {
+			auto numCellsPerFunction = std::max<size_t>(1, (numCells + ShortHashSketch::Num_Hash_Functions - 1) / ShortHashSketch::Num_Hash_Functions);
+			return numCellsPerFunction * ShortHashSketch::Num_Hash_Functions;
+		}
+	}
+
+	ShortHashSketch::ShortHashSketch(size_t numCells) : m_cells(CalculateNumCells(numCells), ShortHashSketchCell())
+	{}
+
+	ShortHashSketch::ShortHashSketch(std::vector<ShortHashSketchCell>&& cells) : m_cells(std::move(cells)) {
+		if (m_cells.empty() || 0 != m_cells.size() % Num_Hash_Functions)
+			CATAPULT_THROW_INVALID_ARGUMENT_1("sketch must have positive multiple of hash functions cells", m_cells.size());
+	}
+
+	size_t ShortHashSketch::size() const {
+		return m_cells.size();
+	}
+
+	const std::vector<ShortHashSketchCell>& ShortHashSketch::cells() const {
+		return m_cells;
+	}
+
+	void ShortHashSketch::insert(ShortHash shortHash) {
+		Update(m_cells, shortHash, 1);
+	}
+
+	void ShortHashSketch::subtract(const ShortHashSketch& sketch) {
+		if (size() != sketch.size())
+			CATAPULT_THROW_INVALID_ARGUMENT_2("cannot subtract sketches with different sizes", size(), sketch.size());
+
+		for (auto i = 0u; i < m_cells.size(); ++i) {
+			auto& cell = m_cells[i];
+			const auto& otherCell = sketch.m_cells[i];
+			cell.Count -= otherCell.Count;
+			cell.KeySum = ShortHash(cell.KeySum.unwrap() ^ otherCell.KeySum.unwrap());
+			cell.CheckSum ^= otherCell.CheckSum;
+		}
+	}
+
+	bool ShortHashSketch::tryDecode(ShortHashesSet& positiveShortHashes, ShortHashesSet& negativeShortHashes) const {
+		auto cells = m_cells;
+		std::vector<size_t> pureCellIndexes;
+		for (auto i = 0u; i < cells.size(); ++i) {
+			if (IsPure(cells[i]))
+				pureCellIndexes.push_back(i);
+		}
+
+		// peel pure cells until no more are left, which might make other cells pure
+		while (!pureCellIndexes.empty()) {
+			const auto& cell = cells[pureCellIndexes.back()];
+			pureCellIndexes.pop_back();
+			if (!IsPure(cell))
+				continue;
+
+			auto shortHash = cell.KeySum;
+			auto count = cell.Count;
+			auto& shortHashes = 1 == count ? positiveShortHashes : negativeShortHashes;
+			if (!shortHashes.insert(shortHash).second)
+				return false;
+
+			Update(cells, shortHash, -count);
+			ForEachCellIndex(cells.size(), shortHash, [&cells, &pureCellIndexes](auto index) {
+				if (IsPure(cells[index]))
+					pureCellIndexes.push_back(index);
+			});
+		}
+
+		return std::all_of(cells.cbegin(), cells.cend(), IsEmpty);
+	}
+}}
@@ -0,0 +1,77 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#pragma once
+#include "ShortHash.h"
+#include <vector>
+
+namespace catapult { namespace utils {
+
+#pragma pack(push, 1)
+
+	/// Cell of a short hash sketch.
+	struct ShortHashSketchCell {
+		/// Signed number of short hashes mapped to this cell.
+		int32_t Count;
+
+		/// Xor of all short hashes mapped to this cell.
+		ShortHash KeySum;
+
+		/// Xor of the check hashes of all short hashes mapped to this cell.
+		uint32_t CheckSum;
+	};
+
+#pragma pack(pop)
+
+	/// Result of decoding a short hash sketch.
+	enum class ShortHashSketchDecodeResult : uint32_t {
+		/// Sketch could not be decoded.
+		Failure,
+
+		/// Sketch was decoded.
+		Success
+	};
+
+	/// Invertible bloom lookup table of short hashes.
+	/// \note Subtracting the sketch of one set from the sketch of another set of the same size yields a sketch of their
+	///       symmetric difference, which can be decoded as long as the difference is small relative to the number of cells.
+	class ShortHashSketch {
+	public:
+		/// Number of cells each short hash is mapped to.
+		static constexpr size_t Num_Hash_Functions = 3;
+
+	public:
+		/// Creates an empty sketch with at least \a numCells cells.
+		explicit ShortHashSketch(size_t numCells);
+
+		/// Creates a sketch around \a cells.
+		/// \throws catapult_invalid_argument if the number of cells is not a positive multiple of Num_Hash_Functions.
+		explicit ShortHashSketch(std::vector<ShortHashSketchCell>&& cells);
+
+	public:
+		/// Gets the number of cells.
+		size_t size() const;
+
+		/// Gets the cells.
+		const std::vector<ShortHashSketchCell>& cells() const;
+
+	public:
+		/// Inserts \a shortHash into the sketch.
+		void insert(ShortHash shortHash);
+
+		/// Subtracts \a sketch from this sketch.
+		/// \throws catapult_invalid_argument if the sketches have different sizes.
+		void subtract(const ShortHashSketch& sketch);
+
+		/// Tries to decode the sketch into short hashes that were only inserted into this sketch (\a positiveShortHashes)
+		/// and short hashes that were only inserted into subtracted sketches (\a negativeShortHashes).
+		/// Returns \c false if the sketch cannot be fully decoded.
+		bool tryDecode(ShortHashesSet& positiveShortHashes, ShortHashesSet& negativeShortHashes) const;
+
+	private:
+		std::vector<ShortHashSketchCell> m_cells;
+	};
+}}
@@ -21,6 +21,7 @@
 #pragma once
 #include "AggregateValidationResult.h"
 #include "ValidatorTypes.h"
+#include "catapult/model/NotificationDispatchTable.h"
 #include "catapult/utils/NamedObject.h"
 #include <utility>
 #include <vector>
@@ -53,9 +54,10 @@ namespace catapult { namespace validators {
 			explicit DefaultAggregateNotificationValidator(
 					NotificationValidatorPointerMap&& validators,
 					ValidationResultPredicate isSuppressedFailure)
-					: m_validators(std::move(validators))
+					: m_names(utils::ExtractNames(validators))
+					, m_name(utils::ReduceNames(m_names))
+					, m_validators(std::move(validators))
 					, m_isSuppressedFailure(std::move(isSuppressedFailure))
-					, m_name(utils::ReduceNames(utils::ExtractNames(m_validators)))
 			{}
 
 		public:
@@ -64,17 +66,17 @@ namespace catapult { namespace validators {
 			}
 
 			std::vector<std::string> names() const override {
-				return utils::ExtractNames(m_validators);
+				return m_names;
 			}
 
 			ValidationResult validate(const TNotification& notification, TArgs&&... args) const override {
 				auto aggregateResult = ValidationResult::Success;
 
-				auto validatorIter = m_validators.find(notification.Type);
-				if (m_validators.end() == validatorIter)
+				const auto* pValidators = m_validators.find(notification.Type);
+				if (!pValidators)
 					return aggregateResult;
 
-				for (const auto& pValidator : validatorIter->second) {
+				for (const auto& pValidator : *pValidators) {
 					auto result = pValidator->validate(notification, std::forward<TArgs>(args)...);
 
 					// ignore suppressed failures
@@ -92,9 +94,10 @@ namespace catapult { namespace validators {
 			}
 
 		private:
-			NotificationValidatorPointerMap m_validators;
-			ValidationResultPredicate m_isSuppressedFailure;
+			std::vector<std::string> m_names;
 			std::string m_name;
+			model::NotificationDispatchTable<std::vector<NotificationValidatorPointer>> m_validators;
+			ValidationResultPredicate m_isSuppressedFailure;
 		};
 
 	private:
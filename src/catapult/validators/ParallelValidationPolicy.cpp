@@ -144,8 +144,7 @@ namespace catapult { namespace validators {
 				, public std::enable_shared_from_this<DefaultParallelValidationPolicy> {
 		public:
 			explicit DefaultParallelValidationPolicy(const std::shared_ptr<thread::IoThreadPool>& pPool)
-					: m_pPool(pPool)
-					, m_ioContext(pPool->ioContext()) {
+					: m_pPool(pPool) {
 				CATAPULT_LOG(trace) << "DefaultParallelValidationPolicy created with " << pPool->numWorkerThreads() << " worker threads";
 			}
 
@@ -154,9 +153,11 @@ namespace catapult { namespace validators {
 			auto validateT(const model::WeakEntityInfos& entityInfos, const ValidationFunctions& validationFunctions) const {
 				auto pWork = std::make_shared<ValidationWork<TTraits>>(shared_from_this(), validationFunctions, entityInfos);
 				return thread::compose(
-						thread::ParallelFor(m_ioContext, pWork->entityInfos(), m_pPool->numWorkerThreads(), [pWork](
-								const auto& entityInfo,
-								auto index) {
+						thread::ParallelForDynamic(*m_pPool, pWork->entityInfos(), m_pPool->numWorkerThreads(), [](
+								const auto& entityInfo) {
+							// larger entities (e.g. aggregates with many cosignatures) are more expensive to validate
+							return entityInfo.entity().Size;
+						}, [pWork](const auto& entityInfo, auto index) {
 							return pWork->validateEntity(entityInfo, index);
 						}),
 						[pWork](const auto&) {
@@ -179,8 +180,7 @@ namespace catapult { namespace validators {
 			}
 
 		private:
-			std::shared_ptr<const thread::IoThreadPool> m_pPool;
-			boost::asio::io_context& m_ioContext;
+			std::shared_ptr<thread::IoThreadPool> m_pPool;
 		};
 	}
 
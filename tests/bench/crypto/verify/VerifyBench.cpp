@@ -41,6 +41,91 @@ namespace catapult { namespace crypto {
 
 			state.SetBytesProcessed(static_cast<int64_t>(buffer.size() * state.iterations()));
 		}
+
+		// region valid signatures
+
+		struct SignedBuffers {
+			std::vector<Key> PublicKeys;
+			std::vector<std::vector<uint8_t>> Buffers;
+			std::vector<Signature> Signatures;
+			std::vector<SignatureInput> SignatureInputs;
+		};
+
+		void PrepareSignedBuffers(SignedBuffers& signedBuffers, size_t count) {
+			signedBuffers.PublicKeys.resize(count);
+			signedBuffers.Buffers.resize(count);
+			signedBuffers.Signatures.resize(count);
+			signedBuffers.SignatureInputs.clear();
+			for (auto i = 0u; i < count; ++i) {
+				auto keyPair = KeyPair::FromPrivate(PrivateKey::Generate(bench::RandomByte));
+				signedBuffers.PublicKeys[i] = keyPair.publicKey();
+				signedBuffers.Buffers[i].resize(279);
+				bench::FillWithRandomData(signedBuffers.Buffers[i]);
+				Sign(keyPair, signedBuffers.Buffers[i], signedBuffers.Signatures[i]);
+			}
+
+			for (auto i = 0u; i < count; ++i) {
+				signedBuffers.SignatureInputs.push_back({
+					signedBuffers.PublicKeys[i],
+					{ signedBuffers.Buffers[i] },
+					signedBuffers.Signatures[i]
+				});
+			}
+		}
+
+		void SetProcessedCounts(benchmark::State& state, const SignedBuffers& signedBuffers) {
+			auto count = signedBuffers.Buffers.size();
+			state.SetItemsProcessed(static_cast<int64_t>(count * state.iterations()));
+			state.SetBytesProcessed(static_cast<int64_t>(count * signedBuffers.Buffers[0].size() * state.iterations()));
+		}
+
+		void BenchmarkVerifySingleValid(benchmark::State& state) {
+			SignedBuffers signedBuffers;
+			for (auto _ : state) {
+				state.PauseTiming();
+				PrepareSignedBuffers(signedBuffers, static_cast<size_t>(state.range(0)));
+				state.ResumeTiming();
+
+				for (auto i = 0u; i < signedBuffers.Buffers.size(); ++i)
+					Verify(signedBuffers.PublicKeys[i], signedBuffers.Buffers[i], signedBuffers.Signatures[i]);
+			}
+
+			SetProcessedCounts(state, signedBuffers);
+		}
+
+		void BenchmarkVerifyMultiValid(benchmark::State& state) {
+			SignedBuffers signedBuffers;
+			for (auto _ : state) {
+				state.PauseTiming();
+				PrepareSignedBuffers(signedBuffers, static_cast<size_t>(state.range(0)));
+				state.ResumeTiming();
+
+				VerifyMulti(SecureRandomFill, signedBuffers.SignatureInputs.data(), signedBuffers.SignatureInputs.size());
+			}
+
+			SetProcessedCounts(state, signedBuffers);
+		}
+
+		void BenchmarkVerifyMultiOneInvalid(benchmark::State& state) {
+			SignedBuffers signedBuffers;
+			for (auto _ : state) {
+				state.PauseTiming();
+				PrepareSignedBuffers(signedBuffers, static_cast<size_t>(state.range(0)));
+				signedBuffers.Buffers[bench::Random() % signedBuffers.Buffers.size()][0] ^= 0xFF;
+				state.ResumeTiming();
+
+				VerifyMulti(SecureRandomFill, signedBuffers.SignatureInputs.data(), signedBuffers.SignatureInputs.size());
+			}
+
+			SetProcessedCounts(state, signedBuffers);
+		}
+
+		void AddBatchArguments(benchmark::internal::Benchmark& benchmark) {
+			for (auto arg : { 1, 4, 16, 64, 256 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+
+		// endregion
 	}
 }}
 
@@ -52,4 +137,11 @@ void RegisterTests() {
 			->Threads(2)
 			->Threads(4)
 			->Threads(8);
+
+	catapult::crypto::AddBatchArguments(
+			*benchmark::RegisterBenchmark("BenchmarkVerifySingleValid", catapult::crypto::BenchmarkVerifySingleValid));
+	catapult::crypto::AddBatchArguments(
+			*benchmark::RegisterBenchmark("BenchmarkVerifyMultiValid", catapult::crypto::BenchmarkVerifyMultiValid));
+	catapult::crypto::AddBatchArguments(
+			*benchmark::RegisterBenchmark("BenchmarkVerifyMultiOneInvalid", catapult::crypto::BenchmarkVerifyMultiOneInvalid));
 }
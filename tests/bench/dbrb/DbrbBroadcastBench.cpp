@@ -0,0 +1,97 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "DbrbSimulator.h"
+#include "catapult/utils/Logging.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace bench {
+
+	namespace {
+		constexpr uint32_t Payload_Size = 1024;
+
+		enum class ProcessType { Default, Aggregate_Certificates, Sharded };
+
+		// DBRB processes log every broadcast, which would dominate the measured time
+		void SetupLogging() {
+			static std::shared_ptr<utils::LoggingBootstrapper> pBootstrapper;
+			if (pBootstrapper)
+				return;
+
+			utils::BasicLoggerOptions options;
+			options.SinkType = utils::LogSinkType::Sync;
+			pBootstrapper = std::make_shared<utils::LoggingBootstrapper>();
+			pBootstrapper->addConsoleLogger(options, utils::LogFilter(utils::LogLevel::Warning));
+		}
+
+		// region benchmarks
+
+		void BenchmarkBroadcast(benchmark::State& state) {
+			SetupLogging();
+
+			SimulationSettings settings;
+			settings.NumProcesses = static_cast<size_t>(state.range(0));
+			settings.Sharded = ProcessType::Sharded == static_cast<ProcessType>(state.range(1));
+			settings.AggregateCertificates = ProcessType::Aggregate_Certificates == static_cast<ProcessType>(state.range(1));
+			settings.Network.LossProbability = static_cast<double>(state.range(2)) / 100;
+			settings.Network.ReorderProbability = 0.1;
+			DbrbSimulator simulator(settings);
+
+			// simulated times do not depend on the host, wall time only measures the cost of message processing
+			size_t numBroadcasts = 0;
+			size_t numQuorums = 0;
+			BroadcastResult totals;
+			uint64_t maxLastDeliveryMicros = 0;
+			for (auto _ : state) {
+				auto result = simulator.broadcast(numBroadcasts % simulator.numProcesses(), Payload_Size);
+				++numBroadcasts;
+
+				if (result.QuorumDeliveryMicros) {
+					++numQuorums;
+					totals.QuorumDeliveryMicros += result.QuorumDeliveryMicros;
+				}
+
+				totals.NumDelivered += result.NumDelivered;
+				totals.LastDeliveryMicros += result.LastDeliveryMicros;
+				totals.NumMessages += result.NumMessages;
+				totals.NumBytes += result.NumBytes;
+				totals.NumLostMessages += result.NumLostMessages;
+				maxLastDeliveryMicros = std::max(maxLastDeliveryMicros, result.LastDeliveryMicros);
+			}
+
+			auto perBroadcast = [numBroadcasts](auto value) {
+				return static_cast<double>(value) / static_cast<double>(numBroadcasts);
+			};
+			state.counters["quorum ms"] = numQuorums ? static_cast<double>(totals.QuorumDeliveryMicros) / 1000 / static_cast<double>(numQuorums) : 0;
+			state.counters["last ms"] = perBroadcast(totals.LastDeliveryMicros) / 1000;
+			state.counters["max last ms"] = static_cast<double>(maxLastDeliveryMicros) / 1000;
+			state.counters["quorum ratio"] = perBroadcast(numQuorums);
+			state.counters["delivered ratio"] = perBroadcast(totals.NumDelivered) / static_cast<double>(settings.NumProcesses);
+			state.counters["messages/broadcast"] = perBroadcast(totals.NumMessages);
+			state.counters["bytes/broadcast"] = perBroadcast(totals.NumBytes);
+			state.counters["lost/broadcast"] = perBroadcast(totals.NumLostMessages);
+			state.SetItemsProcessed(static_cast<int64_t>(numBroadcasts));
+		}
+
+		void AddBroadcastArguments(benchmark::internal::Benchmark& benchmark) {
+			benchmark.ArgNames({ "processes", "type", "loss%" });
+			for (auto type : { ProcessType::Default, ProcessType::Aggregate_Certificates, ProcessType::Sharded }) {
+				for (auto numProcesses : { 4, 16, 64 }) {
+					for (auto lossPercentage : { 0, 5 })
+						benchmark.Args({ numProcesses, static_cast<int64_t>(type), lossPercentage });
+				}
+			}
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	catapult::bench::AddBroadcastArguments(
+			*benchmark::RegisterBenchmark("BenchmarkBroadcast", catapult::bench::BenchmarkBroadcast)->Unit(benchmark::kMillisecond));
+}
@@ -0,0 +1,310 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "DbrbSimulator.h"
+#include "fastfinality/src/dbrb/DbrbProcess.h"
+#include "fastfinality/src/dbrb/ShardedDbrbProcess.h"
+#include "catapult/dbrb/DbrbViewFetcher.h"
+#include "catapult/dbrb/View.h"
+#include "catapult/ionet/Node.h"
+#include "catapult/ionet/PacketHandlers.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "tests/test/core/mocks/MockBlockchainConfigurationHolder.h"
+#include <queue>
+
+namespace catapult { namespace bench {
+
+	// region nested types
+
+	struct DbrbSimulator::SimulatedProcess {
+		std::shared_ptr<dbrb::DbrbProcess> pProcess;
+		std::shared_ptr<dbrb::ShardedDbrbProcess> pShardedProcess;
+		ionet::ServerPacketHandlers Handlers;
+	};
+
+	struct DbrbSimulator::Event {
+		uint64_t TimeMicros;
+		uint64_t Sequence;
+		size_t SenderIndex;
+		size_t RecipientIndex;
+		dbrb::Payload pPacket;
+	};
+
+	class DbrbSimulator::EventQueue {
+	private:
+		struct EventComparer {
+			bool operator()(const Event& lhs, const Event& rhs) const {
+				// events scheduled for the same time are processed in the order they were scheduled
+				return lhs.TimeMicros != rhs.TimeMicros ? lhs.TimeMicros > rhs.TimeMicros : lhs.Sequence > rhs.Sequence;
+			}
+		};
+
+	public:
+		bool empty() const {
+			return m_events.empty();
+		}
+
+		void push(Event&& event) {
+			m_events.push(std::move(event));
+		}
+
+		Event pop() {
+			auto event = m_events.top();
+			m_events.pop();
+			return event;
+		}
+
+	private:
+		std::priority_queue<Event, std::vector<Event>, EventComparer> m_events;
+	};
+
+	class DbrbSimulator::SimulatedMessageSender : public dbrb::MessageSender {
+	public:
+		SimulatedMessageSender(DbrbSimulator& simulator, size_t senderIndex)
+				: m_simulator(simulator)
+				, m_senderIndex(senderIndex)
+		{}
+
+	public:
+		void enqueue(const dbrb::Payload& payload, bool, const std::set<dbrb::ProcessId>& recipients) override {
+			m_simulator.send(m_senderIndex, payload, recipients);
+		}
+
+		void clearQueue() override
+		{}
+
+	public:
+		void connectNodes(const std::set<dbrb::ProcessId>&) override
+		{}
+
+		void closeAllConnections() override
+		{}
+
+		void closeConnections(const std::set<dbrb::ProcessId>&) override
+		{}
+
+		void addNodes(const std::vector<ionet::Node>&) override
+		{}
+
+		void sendNodes(const std::vector<ionet::Node>&, const dbrb::ProcessId&) override
+		{}
+
+		dbrb::ViewData getUnreachableNodes(dbrb::ViewData&) const override {
+			return {};
+		}
+
+		size_t getUnreachableNodeCount(const dbrb::ViewData&) const override {
+			return 0;
+		}
+
+		std::vector<ionet::Node> getKnownNodes(const dbrb::ViewData&) const override {
+			return {};
+		}
+
+	private:
+		DbrbSimulator& m_simulator;
+		size_t m_senderIndex;
+	};
+
+	class DbrbSimulator::SimulatedViewFetcher : public dbrb::DbrbViewFetcher {
+	public:
+		explicit SimulatedViewFetcher(const dbrb::ViewData& view) : m_view(view)
+		{}
+
+	public:
+		dbrb::ViewData getView(Timestamp) const override {
+			return m_view;
+		}
+
+		Timestamp getExpirationTime(const dbrb::ProcessId&) const override {
+			return Timestamp(std::numeric_limits<uint64_t>::max());
+		}
+
+		BlockDuration getBanPeriod(const dbrb::ProcessId&) const override {
+			return BlockDuration(0);
+		}
+
+		void logAllProcesses() const override
+		{}
+
+		void logView(const dbrb::ViewData&) const override
+		{}
+
+	private:
+		const dbrb::ViewData& m_view;
+	};
+
+	// endregion
+
+	namespace {
+		auto CreateConfigHolder(const std::vector<crypto::KeyPair>& keyPairs, const SimulationSettings& settings) {
+			auto numBootstrapProcesses = 0 == settings.NumBootstrapProcesses
+					? keyPairs.size()
+					: std::min(settings.NumBootstrapProcesses, keyPairs.size());
+
+			auto config = model::NetworkConfiguration::Uninitialized();
+			for (auto i = 0u; i < numBootstrapProcesses; ++i)
+				config.DbrbBootstrapProcesses.emplace(keyPairs[i].publicKey());
+
+			config.EnableDbrbSharding = settings.Sharded;
+			config.DbrbShardSize = static_cast<uint32_t>(settings.ShardSize);
+			config.EnableDbrbAggregateCertificates = settings.AggregateCertificates;
+			return config::CreateMockConfigurationHolder(config);
+		}
+	}
+
+	DbrbSimulator::DbrbSimulator(const SimulationSettings& settings)
+			: m_settings(settings)
+			, m_random(settings.Seed)
+			, m_pPool(thread::CreateIoThreadPool(1, "dbrb simulator"))
+			, m_processes(settings.NumProcesses)
+			, m_pEvents(std::make_unique<EventQueue>())
+			, m_nowMicros(0)
+			, m_nextSequence(0) {
+		// processes keep references to their key pairs, so all key pairs need to be created upfront
+		m_keyPairs.reserve(m_settings.NumProcesses);
+		for (auto i = 0u; i < m_settings.NumProcesses; ++i) {
+			m_keyPairs.push_back(crypto::KeyPair::FromPrivate(crypto::PrivateKey::Generate([this]() {
+				return static_cast<uint8_t>(m_random());
+			})));
+			m_view.emplace(m_keyPairs.back().publicKey());
+			m_processIndexes.emplace(m_keyPairs.back().publicKey(), i);
+		}
+
+		m_pViewFetcher = std::make_unique<SimulatedViewFetcher>(m_view);
+		auto pConfigHolder = CreateConfigHolder(m_keyPairs, m_settings);
+
+		// the pool is never started, all posted work is executed by poll() on the calling thread
+		for (auto i = 0u; i < m_settings.NumProcesses; ++i) {
+			auto& process = m_processes[i];
+			auto pMessageSender = std::make_shared<SimulatedMessageSender>(*this, i);
+			auto validationCallback = [](const auto&, const auto&) { return dbrb::MessageValidationResult::Message_Valid; };
+			auto getDbrbModeCallback = []() { return dbrb::DbrbMode::Running; };
+			auto deliverCallback = [this, i](const auto&) {
+				if (m_delivered[i])
+					return;
+
+				m_delivered[i] = true;
+				m_result.LastDeliveryMicros = m_nowMicros;
+				if (dbrb::View::quorumSize(m_view.size()) == ++m_result.NumDelivered)
+					m_result.QuorumDeliveryMicros = m_nowMicros;
+			};
+
+			if (m_settings.Sharded) {
+				process.pShardedProcess = std::make_shared<dbrb::ShardedDbrbProcess>(
+						m_keyPairs[i],
+						pMessageSender,
+						m_pPool,
+						nullptr,
+						*m_pViewFetcher,
+						m_settings.ShardSize);
+				process.pShardedProcess->setValidationCallback(validationCallback);
+				process.pShardedProcess->setGetDbrbModeCallback(getDbrbModeCallback);
+				process.pShardedProcess->setDeliverCallback(deliverCallback);
+				process.pShardedProcess->registerPacketHandlers(process.Handlers);
+				process.pShardedProcess->updateView(pConfigHolder, Timestamp(), Height(1));
+			} else {
+				process.pProcess = std::make_shared<dbrb::DbrbProcess>(
+						m_keyPairs[i],
+						pMessageSender,
+						m_pPool,
+						nullptr,
+						*m_pViewFetcher,
+						m_settings.AggregateCertificates);
+				process.pProcess->setValidationCallback(validationCallback);
+				process.pProcess->setGetDbrbModeCallback(getDbrbModeCallback);
+				process.pProcess->setDeliverCallback(deliverCallback);
+				process.pProcess->registerPacketHandlers(process.Handlers);
+				process.pProcess->updateView(pConfigHolder, Timestamp(), Height(1));
+			}
+		}
+
+		poll();
+	}
+
+	DbrbSimulator::~DbrbSimulator() = default;
+
+	size_t DbrbSimulator::numProcesses() const {
+		return m_processes.size();
+	}
+
+	BroadcastResult DbrbSimulator::broadcast(size_t broadcasterIndex, uint32_t payloadSize) {
+		m_result = BroadcastResult();
+		m_delivered = std::vector<bool>(m_processes.size(), false);
+		m_nowMicros = 0;
+
+		// payloads must be unique because processes track broadcasts by payload hash
+		auto pPayload = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+		pPayload->Type = ionet::PacketType::Push_Precommit_Messages;
+		std::generate_n(reinterpret_cast<uint8_t*>(pPayload.get() + 1), payloadSize, [this]() {
+			return static_cast<uint8_t>(m_random());
+		});
+
+		auto& broadcaster = m_processes[broadcasterIndex];
+		if (broadcaster.pShardedProcess)
+			broadcaster.pShardedProcess->broadcast(pPayload, m_view);
+		else
+			broadcaster.pProcess->broadcast(pPayload, m_view);
+
+		run();
+
+		for (auto& process : m_processes) {
+			if (process.pShardedProcess)
+				process.pShardedProcess->clearData();
+			else
+				process.pProcess->clearData();
+		}
+
+		poll();
+		return m_result;
+	}
+
+	void DbrbSimulator::send(size_t senderIndex, const dbrb::Payload& pPacket, const dbrb::ViewData& recipients) {
+		const auto& network = m_settings.Network;
+		std::uniform_int_distribution<uint32_t> delayDistribution(network.MinDelayMicros, std::max(network.MinDelayMicros, network.MaxDelayMicros));
+		std::uniform_real_distribution<double> probabilityDistribution(0, 1);
+		for (const auto& recipient : recipients) {
+			auto iter = m_processIndexes.find(recipient);
+			if (m_processIndexes.cend() == iter)
+				continue;
+
+			++m_result.NumMessages;
+			m_result.NumBytes += pPacket->Size;
+
+			// random decisions are always drawn, so that changing one probability does not shift the others
+			auto delayMicros = static_cast<uint64_t>(delayDistribution(m_random));
+			auto isLost = probabilityDistribution(m_random) < network.LossProbability;
+			auto isReordered = probabilityDistribution(m_random) < network.ReorderProbability;
+			if (isLost) {
+				++m_result.NumLostMessages;
+				continue;
+			}
+
+			if (isReordered)
+				delayMicros += network.ReorderDelayMicros;
+
+			m_pEvents->push(Event{ m_nowMicros + delayMicros, m_nextSequence++, senderIndex, iter->second, pPacket });
+		}
+	}
+
+	void DbrbSimulator::run() {
+		poll();
+		while (!m_pEvents->empty()) {
+			auto event = m_pEvents->pop();
+			m_nowMicros = event.TimeMicros;
+
+			ionet::ServerPacketHandlerContext context(m_keyPairs[event.SenderIndex].publicKey(), "simulator");
+			m_processes[event.RecipientIndex].Handlers.process(*event.pPacket, context);
+			poll();
+		}
+	}
+
+	void DbrbSimulator::poll() {
+		auto& ioContext = m_pPool->ioContext();
+		ioContext.restart();
+		ioContext.poll();
+	}
+}}
@@ -0,0 +1,128 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#pragma once
+#include "catapult/dbrb/DbrbDefinitions.h"
+#include "catapult/crypto/KeyPair.h"
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace catapult { namespace thread { class IoThreadPool; }}
+
+namespace catapult { namespace bench {
+
+	/// Conditions of the simulated network.
+	struct SimulatedNetworkSettings {
+		/// Minimum one way message delay in microseconds.
+		uint32_t MinDelayMicros = 1'000;
+
+		/// Maximum one way message delay in microseconds.
+		/// \note Delays are uniformly distributed, so messages sent close to each other can overtake each other.
+		uint32_t MaxDelayMicros = 5'000;
+
+		/// Probability that a message is lost.
+		double LossProbability = 0;
+
+		/// Probability that a message is held back and delivered after messages sent later.
+		double ReorderProbability = 0;
+
+		/// Additional delay of held back messages in microseconds.
+		uint32_t ReorderDelayMicros = 20'000;
+	};
+
+	/// Settings of a simulated DBRB network.
+	struct SimulationSettings {
+		/// Number of DBRB processes.
+		size_t NumProcesses = 10;
+
+		/// Number of bootstrap processes (\c 0 means all processes).
+		size_t NumBootstrapProcesses = 0;
+
+		/// \c true if ShardedDbrbProcess should be simulated instead of DbrbProcess.
+		bool Sharded = false;
+
+		/// Shard size used by sharded processes.
+		size_t ShardSize = 6;
+
+		/// \c true if DbrbProcess should use aggregate certificates.
+		bool AggregateCertificates = false;
+
+		/// Network conditions.
+		SimulatedNetworkSettings Network;
+
+		/// Seed of all random decisions, runs with equal settings produce equal results.
+		uint64_t Seed = 0;
+	};
+
+	/// Result of a single simulated broadcast.
+	struct BroadcastResult {
+		/// Number of processes that delivered the payload.
+		size_t NumDelivered = 0;
+
+		/// Simulated time in microseconds when a quorum of processes delivered the payload (\c 0 if never).
+		uint64_t QuorumDeliveryMicros = 0;
+
+		/// Simulated time in microseconds when the last process delivered the payload.
+		uint64_t LastDeliveryMicros = 0;
+
+		/// Number of messages sent over the network (messages processes send to themselves are excluded).
+		size_t NumMessages = 0;
+
+		/// Number of bytes sent over the network.
+		size_t NumBytes = 0;
+
+		/// Number of lost messages.
+		size_t NumLostMessages = 0;
+	};
+
+	/// Deterministic in-process simulator of a DBRB network.
+	/// \note Real DBRB processes exchange serialized packets through an in-memory MessageSender replacement,
+	///       all work is done on the calling thread and time is simulated, so results do not depend on the host.
+	class DbrbSimulator {
+	public:
+		/// Creates a simulator with \a settings.
+		explicit DbrbSimulator(const SimulationSettings& settings);
+
+		/// Destroys the simulator.
+		~DbrbSimulator();
+
+	public:
+		/// Gets the number of processes.
+		size_t numProcesses() const;
+
+		/// Broadcasts a payload of \a payloadSize bytes from the process with index \a broadcasterIndex
+		/// to all processes and runs the simulation until no messages are in flight.
+		BroadcastResult broadcast(size_t broadcasterIndex, uint32_t payloadSize);
+
+	private:
+		struct SimulatedProcess;
+		struct Event;
+		class EventQueue;
+		class SimulatedMessageSender;
+		class SimulatedViewFetcher;
+
+		void send(size_t senderIndex, const dbrb::Payload& pPacket, const dbrb::ViewData& recipients);
+		void run();
+		void poll();
+
+	private:
+		SimulationSettings m_settings;
+		std::mt19937_64 m_random;
+		std::vector<crypto::KeyPair> m_keyPairs;
+		dbrb::ViewData m_view;
+		std::map<dbrb::ProcessId, size_t> m_processIndexes;
+		std::shared_ptr<thread::IoThreadPool> m_pPool;
+		std::unique_ptr<SimulatedViewFetcher> m_pViewFetcher;
+		std::vector<SimulatedProcess> m_processes;
+		std::unique_ptr<EventQueue> m_pEvents;
+		uint64_t m_nowMicros;
+		uint64_t m_nextSequence;
+		BroadcastResult m_result;
+		std::vector<bool> m_delivered;
+	};
+}}
@@ -0,0 +1,131 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace thread {
+
+	namespace {
+		constexpr size_t Num_Items = 2000;
+		constexpr uint32_t Num_Rounds_Per_Unit_Cost = 200;
+
+		// region item costs
+
+		enum class CostDistribution { Uniform, Single_Heavy_Item, Clustered_Heavy_Items, Long_Tail };
+
+		// simulates entity sizes, where most entities are small transfers and few are large aggregates
+		std::vector<uint32_t> GenerateItemCosts(CostDistribution distribution) {
+			std::vector<uint32_t> costs(Num_Items, 1);
+			switch (distribution) {
+			case CostDistribution::Uniform:
+				break;
+
+			case CostDistribution::Single_Heavy_Item:
+				// one aggregate that is as expensive as a quarter of all other entities
+				costs[bench::Random() % Num_Items] = Num_Items / 4;
+				break;
+
+			case CostDistribution::Clustered_Heavy_Items:
+				// a contiguous run of aggregates, as produced by a single account announcing a batch
+				for (auto i = Num_Items / 8; i < Num_Items / 8 + 20; ++i)
+					costs[i] = 50;
+				break;
+
+			case CostDistribution::Long_Tail:
+				// roughly pareto distributed costs
+				for (auto& cost : costs) {
+					auto value = bench::Random() % 1000;
+					cost = value < 900 ? 1 : value < 990 ? 10 : 100;
+				}
+				break;
+			}
+
+			return costs;
+		}
+
+		void Process(uint32_t cost) {
+			uint64_t value = cost;
+			for (auto i = 0u; i < cost * Num_Rounds_Per_Unit_Cost; ++i) {
+				value = value * 6364136223846793005ull + 1442695040888963407ull;
+				benchmark::DoNotOptimize(value);
+			}
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		template<typename TParallelFor>
+		void RunBenchmark(benchmark::State& state, TParallelFor parallelFor) {
+			auto pPool = CreateIoThreadPool(std::thread::hardware_concurrency());
+			pPool->start();
+
+			auto costs = GenerateItemCosts(static_cast<CostDistribution>(state.range(0)));
+			for (auto _ : state)
+				parallelFor(pPool->ioContext(), costs, pPool->numWorkerThreads());
+
+			state.SetItemsProcessed(static_cast<int64_t>(costs.size() * state.iterations()));
+			pPool->join();
+		}
+
+		void BenchmarkParallelFor(benchmark::State& state) {
+			RunBenchmark(state, [](auto& ioContext, const auto& costs, auto numWorkers) {
+				ParallelFor(ioContext, costs, numWorkers, [](auto cost, auto) {
+					Process(cost);
+					return true;
+				}).get();
+			});
+		}
+
+		void BenchmarkParallelForDynamic(benchmark::State& state) {
+			RunBenchmark(state, [](auto& ioContext, const auto& costs, auto numWorkers) {
+				ParallelForDynamic(ioContext, costs, numWorkers, [](auto cost) {
+					return cost;
+				}, [](auto cost, auto) {
+					Process(cost);
+					return true;
+				}).get();
+			});
+		}
+
+		void BenchmarkParallelForDynamicWithoutCostEstimator(benchmark::State& state) {
+			RunBenchmark(state, [](auto& ioContext, const auto& costs, auto numWorkers) {
+				ParallelForDynamic(ioContext, costs, numWorkers, [](auto cost, auto) {
+					Process(cost);
+					return true;
+				}).get();
+			});
+		}
+
+		void AddDistributionArguments(benchmark::internal::Benchmark& benchmark) {
+			benchmark.ArgNames({ "distribution" });
+			for (auto distribution : {
+				CostDistribution::Uniform,
+				CostDistribution::Single_Heavy_Item,
+				CostDistribution::Clustered_Heavy_Items,
+				CostDistribution::Long_Tail
+			}) {
+				benchmark.UseRealTime()->Arg(static_cast<int64_t>(distribution));
+			}
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	catapult::thread::AddDistributionArguments(
+			*benchmark::RegisterBenchmark("BenchmarkParallelFor", catapult::thread::BenchmarkParallelFor));
+	catapult::thread::AddDistributionArguments(
+			*benchmark::RegisterBenchmark("BenchmarkParallelForDynamic", catapult::thread::BenchmarkParallelForDynamic));
+	catapult::thread::AddDistributionArguments(*benchmark::RegisterBenchmark(
+			"BenchmarkParallelForDynamicWithoutCostEstimator",
+			catapult::thread::BenchmarkParallelForDynamicWithoutCostEstimator));
+}
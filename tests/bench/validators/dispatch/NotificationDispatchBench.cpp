@@ -0,0 +1,157 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "catapult/model/NotificationDispatchTable.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/model/TransactionFeeCalculator.h"
+#include "catapult/validators/AggregateValidatorBuilder.h"
+#include "catapult/validators/FunctionalNotificationValidator.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/mocks/MockTransaction.h"
+#include <benchmark/benchmark.h>
+#include <set>
+
+namespace catapult { namespace validators {
+
+	namespace {
+		constexpr size_t Num_Blocks = 20;
+		constexpr size_t Num_Transactions_Per_Block = 100;
+
+		// region recorded notifications
+
+		class NotificationTypeRecorder : public model::NotificationSubscriber {
+		public:
+			explicit NotificationTypeRecorder(std::vector<model::NotificationType>& types) : m_types(types)
+			{}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				m_types.push_back(notification.Type);
+			}
+
+		private:
+			std::vector<model::NotificationType>& m_types;
+		};
+
+		// records the notification types published by generated blocks in publication order
+		const std::vector<model::NotificationType>& GetRecordedNotificationTypes() {
+			static std::vector<model::NotificationType> types;
+			if (!types.empty())
+				return types;
+
+			auto registry = mocks::CreateDefaultTransactionRegistry();
+			model::TransactionFeeCalculator transactionFeeCalculator;
+			auto pPublisher = model::CreateNotificationPublisher(registry, UnresolvedMosaicId(1234), transactionFeeCalculator);
+
+			NotificationTypeRecorder recorder(types);
+			for (auto i = 0u; i < Num_Blocks; ++i) {
+				auto pBlock = test::GenerateBlockWithTransactions(Num_Transactions_Per_Block, Height(i + 1));
+				pPublisher->publish(model::WeakEntityInfo(*pBlock, Hash256(), pBlock->Height), recorder);
+				for (const auto& transaction : pBlock->Transactions())
+					pPublisher->publish(model::WeakEntityInfo(transaction, Hash256(), pBlock->Height), recorder);
+			}
+
+			return types;
+		}
+
+		// endregion
+
+		// region registered notification types
+
+		// registers all recorded types and \a numCodesPerFacility other types for each facility, which approximates
+		// the notification types handled by a node with all plugins loaded
+		std::set<model::NotificationType> GetRegisteredNotificationTypes(uint16_t numCodesPerFacility) {
+			const auto& recordedTypes = GetRecordedNotificationTypes();
+			std::set<model::NotificationType> types(recordedTypes.cbegin(), recordedTypes.cend());
+			for (auto facility = 0x3Du; facility <= 0x6Fu; ++facility) {
+				for (uint16_t code = 1; code <= numCodesPerFacility; ++code) {
+					auto channel = 0 == code % 2 ? model::NotificationChannel::Validator : model::NotificationChannel::All;
+					types.insert(model::MakeNotificationType(channel, static_cast<model::FacilityCode>(facility), code));
+				}
+			}
+
+			return types;
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		template<typename TLookup>
+		void RunLookupBenchmark(benchmark::State& state, const TLookup& lookup) {
+			const auto& recordedTypes = GetRecordedNotificationTypes();
+			for (auto _ : state) {
+				for (auto type : recordedTypes)
+					benchmark::DoNotOptimize(lookup(type));
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(recordedTypes.size() * state.iterations()));
+		}
+
+		void BenchmarkMapLookup(benchmark::State& state) {
+			std::map<model::NotificationType, std::vector<uint32_t>> map;
+			for (auto type : GetRegisteredNotificationTypes(static_cast<uint16_t>(state.range(0))))
+				map.emplace(type, std::vector<uint32_t>{ utils::to_underlying_type(type) });
+
+			RunLookupBenchmark(state, [&map](auto type) {
+				auto iter = map.find(type);
+				return map.cend() == iter ? nullptr : &iter->second;
+			});
+		}
+
+		void BenchmarkDispatchTableLookup(benchmark::State& state) {
+			std::map<model::NotificationType, std::vector<uint32_t>> map;
+			for (auto type : GetRegisteredNotificationTypes(static_cast<uint16_t>(state.range(0))))
+				map.emplace(type, std::vector<uint32_t>{ utils::to_underlying_type(type) });
+
+			model::NotificationDispatchTable<std::vector<uint32_t>> table(std::move(map));
+			RunLookupBenchmark(state, [&table](auto type) {
+				return table.find(type);
+			});
+		}
+
+		void BenchmarkAggregateValidator(benchmark::State& state) {
+			AggregateValidatorBuilder<model::Notification> builder;
+			for (auto type : GetRegisteredNotificationTypes(static_cast<uint16_t>(state.range(0)))) {
+				builder.add(type, std::make_unique<FunctionalNotificationValidatorT<model::Notification>>("validator", [](const auto&) {
+					return ValidationResult::Success;
+				}));
+			}
+
+			auto pValidator = builder.build([](auto) { return false; });
+
+			std::vector<model::Notification> notifications;
+			for (auto type : GetRecordedNotificationTypes())
+				notifications.emplace_back(type, sizeof(model::Notification));
+
+			for (auto _ : state) {
+				for (const auto& notification : notifications)
+					benchmark::DoNotOptimize(pValidator->validate(notification));
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(notifications.size() * state.iterations()));
+		}
+
+		void AddRegistrationArguments(benchmark::internal::Benchmark& benchmark) {
+			benchmark.ArgNames({ "codes/facility" });
+			for (auto numCodesPerFacility : { 4, 16, 64 })
+				benchmark.Arg(numCodesPerFacility);
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	catapult::validators::AddRegistrationArguments(
+			*benchmark::RegisterBenchmark("BenchmarkMapLookup", catapult::validators::BenchmarkMapLookup));
+	catapult::validators::AddRegistrationArguments(
+			*benchmark::RegisterBenchmark("BenchmarkDispatchTableLookup", catapult::validators::BenchmarkDispatchTableLookup));
+	catapult::validators::AddRegistrationArguments(
+			*benchmark::RegisterBenchmark("BenchmarkAggregateValidator", catapult::validators::BenchmarkAggregateValidator));
+}
@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/api/RemoteTransactionApi.h"
+#include "catapult/utils/ShortHashSketch.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/other/RemoteApiFactory.h"
 #include "tests/test/other/RemoteApiTestUtils.h"
@@ -47,6 +48,33 @@ namespace catapult { namespace api {
 			return pPacket;
 		}
 
+		std::shared_ptr<ionet::Packet> CreateSketchResponsePacket(utils::ShortHashSketchDecodeResult decodeResult, uint16_t numTransactions) {
+			// Arrange: prepend transactions with decode result
+			auto pTransactionsPacket = CreatePacketWithTransactions(numTransactions);
+			auto transactionsSize = pTransactionsPacket->Size - static_cast<uint32_t>(sizeof(ionet::PacketHeader));
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(sizeof(utils::ShortHashSketchDecodeResult) + transactionsSize);
+			pPacket->Type = ionet::PacketType::Pull_Transactions_Sketch;
+			reinterpret_cast<utils::ShortHashSketchDecodeResult&>(*pPacket->Data()) = decodeResult;
+			std::memcpy(pPacket->Data() + sizeof(utils::ShortHashSketchDecodeResult), pTransactionsPacket->Data(), transactionsSize);
+			return pPacket;
+		}
+
+		void AssertTransactions(const uint8_t* pExpectedData, const std::vector<model::TransactionRange>& transactions) {
+			ASSERT_EQ(3u, transactions[0].size());
+
+			auto parsedIter = transactions[0].cbegin();
+			for (auto i = 0u; i < transactions.size(); ++i) {
+				std::string message = "comparing transactions at " + std::to_string(i);
+				const auto& expectedTransaction = reinterpret_cast<const TransactionType&>(*pExpectedData);
+				const auto& actualTransaction = *parsedIter;
+				ASSERT_EQ(expectedTransaction.Size, actualTransaction.Size) << message;
+				EXPECT_EQ(Timestamp(5 * i), actualTransaction.Deadline) << message;
+				EXPECT_EQ(expectedTransaction, actualTransaction) << message;
+				++parsedIter;
+				pExpectedData += expectedTransaction.Size;
+			}
+		}
+
 		struct UtTraits {
 			static constexpr uint32_t Request_Data_Header_Size = sizeof(BlockFeeMultiplier);
 			static constexpr uint32_t Request_Data_Size = 3 * sizeof(utils::ShortHash);
@@ -84,20 +112,47 @@ namespace catapult { namespace api {
 			}
 
 			static void ValidateResponse(const ionet::Packet& response, const std::vector<model::TransactionRange>& transactions) {
-				ASSERT_EQ(3u, transactions[0].size());
-
-				auto pExpectedData = response.Data();
-				auto parsedIter = transactions[0].cbegin();
-				for (auto i = 0u; i < transactions.size(); ++i) {
-					std::string message = "comparing transactions at " + std::to_string(i);
-					const auto& expectedTransaction = reinterpret_cast<const TransactionType&>(*pExpectedData);
-					const auto& actualTransaction = *parsedIter;
-					ASSERT_EQ(expectedTransaction.Size, actualTransaction.Size) << message;
-					EXPECT_EQ(Timestamp(5 * i), actualTransaction.Deadline) << message;
-					EXPECT_EQ(expectedTransaction, actualTransaction) << message;
-					++parsedIter;
-					pExpectedData += expectedTransaction.Size;
-				}
+				AssertTransactions(response.Data(), transactions);
+			}
+		};
+
+		struct UtSketchTraits {
+			static constexpr uint32_t Request_Data_Header_Size = sizeof(BlockFeeMultiplier);
+			static constexpr uint32_t Request_Data_Size = 6 * sizeof(utils::ShortHashSketchCell);
+
+			static utils::ShortHashSketch KnownShortHashesSketch() {
+				utils::ShortHashSketch sketch(6);
+				for (auto value : { 123u, 234u, 345u })
+					sketch.insert(utils::ShortHash(value));
+
+				return sketch;
+			}
+
+			static auto Invoke(const RemoteTransactionApi& api) {
+				return api.unconfirmedTransactions(BlockFeeMultiplier(17), KnownShortHashesSketch(), 10);
+			}
+
+			static auto CreateValidResponsePacket() {
+				return CreateSketchResponsePacket(utils::ShortHashSketchDecodeResult::Success, 3);
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// the packet is malformed because it contains a partial transaction
+				auto pResponsePacket = CreateValidResponsePacket();
+				--pResponsePacket->Size;
+				return pResponsePacket;
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				EXPECT_EQ(ionet::PacketType::Pull_Transactions_Sketch, packet.Type);
+				ASSERT_EQ(sizeof(ionet::Packet) + Request_Data_Header_Size + Request_Data_Size, packet.Size);
+				EXPECT_EQ(BlockFeeMultiplier(17), reinterpret_cast<const BlockFeeMultiplier&>(*packet.Data()));
+				EXPECT_EQ_MEMORY(packet.Data() + sizeof(BlockFeeMultiplier), KnownShortHashesSketch().cells().data(), Request_Data_Size);
+			}
+
+			static void ValidateResponse(const ionet::Packet& response, const SketchedUnconfirmedTransactions& result) {
+				EXPECT_TRUE(result.IsDecoded);
+				AssertTransactions(response.Data() + sizeof(utils::ShortHashSketchDecodeResult), result.Transactions);
 			}
 		};
 
@@ -115,4 +170,53 @@ namespace catapult { namespace api {
 
 	DEFINE_REMOTE_API_TESTS(RemoteTransactionApi)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteTransactionApi, Ut)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteTransactionApi, UtSketch)
+
+	// region unconfirmedTransactions (sketch) - decode result
+
+	namespace {
+		auto InvokeUtSketch(const std::shared_ptr<ionet::Packet>& pResponsePacket) {
+			auto pPacketIo = std::make_shared<mocks::MockPacketIo>();
+			pPacketIo->queueWrite(ionet::SocketOperationCode::Success);
+			pPacketIo->queueRead(ionet::SocketOperationCode::Success, [pResponsePacket](const auto*) { return pResponsePacket; });
+			auto pApi = RemoteTransactionApiTraits::Create(*pPacketIo);
+			return UtSketchTraits::Invoke(*pApi);
+		}
+	}
+
+	TEST(RemoteTransactionApiTests, CanParseSuccessResponseWithoutTransactions) {
+		// Act:
+		auto result = InvokeUtSketch(CreateSketchResponsePacket(utils::ShortHashSketchDecodeResult::Success, 0)).get();
+
+		// Assert:
+		EXPECT_TRUE(result.IsDecoded);
+		EXPECT_TRUE(result.Transactions.empty());
+	}
+
+	TEST(RemoteTransactionApiTests, CanParseFailureResponse) {
+		// Act:
+		auto result = InvokeUtSketch(CreateSketchResponsePacket(utils::ShortHashSketchDecodeResult::Failure, 0)).get();
+
+		// Assert:
+		EXPECT_FALSE(result.IsDecoded);
+		EXPECT_TRUE(result.Transactions.empty());
+	}
+
+	TEST(RemoteTransactionApiTests, CannotParseFailureResponseWithTransactions) {
+		// Arrange:
+		auto future = InvokeUtSketch(CreateSketchResponsePacket(utils::ShortHashSketchDecodeResult::Failure, 3));
+
+		// Act + Assert:
+		EXPECT_THROW(future.get(), catapult_api_error);
+	}
+
+	TEST(RemoteTransactionApiTests, CannotParseResponseWithUnknownDecodeResult) {
+		// Arrange:
+		auto future = InvokeUtSketch(CreateSketchResponsePacket(static_cast<utils::ShortHashSketchDecodeResult>(2), 0));
+
+		// Act + Assert:
+		EXPECT_THROW(future.get(), catapult_api_error);
+	}
+
+	// endregion
 }}
@@ -34,6 +34,8 @@ namespace catapult { namespace cache {
 		EXPECT_TRUE(config.CacheDatabaseDirectory.empty());
 		EXPECT_EQ(utils::FileSize(), config.MaxCacheDatabaseWriteBatchSize);
 		EXPECT_FALSE(config.ShouldStorePatriciaTrees);
+		EXPECT_EQ(0u, config.CacheDatabaseTuning.BloomFilterBitsPerKey);
+		EXPECT_TRUE(config.CacheDatabaseTuning.ShouldSyncWrites);
 	}
 
 	TEST(TEST_CLASS, CanCreateConfigurationWithPathButNotPatriciaTreeStorage) {
@@ -57,4 +59,26 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(utils::FileSize::FromMegabytes(4), config.MaxCacheDatabaseWriteBatchSize);
 		EXPECT_TRUE(config.ShouldStorePatriciaTrees);
 	}
+
+	TEST(TEST_CLASS, CanCreateConfigurationWithDatabaseTuning) {
+		// Arrange:
+		CacheDatabaseTuning tuning;
+		tuning.BlockCacheSize = utils::FileSize::FromMegabytes(32);
+		tuning.BloomFilterBitsPerKey = 10;
+		tuning.CompressionMode = utils::CompressionMode::Lz4;
+		tuning.ShouldSyncWrites = false;
+
+		// Act:
+		CacheConfiguration config("xyz", utils::FileSize::FromMegabytes(4), PatriciaTreeStorageMode::Enabled, tuning);
+
+		// Assert:
+		EXPECT_TRUE(config.ShouldUseCacheDatabase);
+		EXPECT_EQ("xyz", config.CacheDatabaseDirectory);
+		EXPECT_EQ(utils::FileSize::FromMegabytes(4), config.MaxCacheDatabaseWriteBatchSize);
+		EXPECT_TRUE(config.ShouldStorePatriciaTrees);
+		EXPECT_EQ(utils::FileSize::FromMegabytes(32), config.CacheDatabaseTuning.BlockCacheSize);
+		EXPECT_EQ(10u, config.CacheDatabaseTuning.BloomFilterBitsPerKey);
+		EXPECT_EQ(utils::CompressionMode::Lz4, config.CacheDatabaseTuning.CompressionMode);
+		EXPECT_FALSE(config.CacheDatabaseTuning.ShouldSyncWrites);
+	}
 }}
@@ -19,11 +19,13 @@
 **/
 
 #include "catapult/cache/CatapultCacheBuilder.h"
+#include "catapult/cache/MerkleRootCalculationContext.h"
 #include "catapult/cache/ReadOnlyCatapultCache.h"
 #include "catapult/crypto/Hashes.h"
 #include "tests/test/cache/CacheBasicTests.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 
 namespace catapult { namespace cache {
 
@@ -226,6 +228,116 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region merkle root context
+
+	TEST(TEST_CLASS, MerkleRootContextInitiallyTracksAllSubCachesWithoutPool) {
+		// Act:
+		auto cache = CreateSimpleCatapultCacheForStateHashTests();
+		const auto& context = *cache.merkleRootContext();
+
+		// Assert:
+		EXPECT_FALSE(!!context.pool());
+		EXPECT_EQ(9u, context.numSubCaches());
+		EXPECT_EQ("SimpleCache (id = 2)", context.subCacheName(2));
+		EXPECT_EQ("", context.subCacheName(3));
+		EXPECT_EQ("SimpleCache (id = 8)", context.subCacheName(8));
+		EXPECT_EQ("", context.subCacheName(9));
+	}
+
+	TEST(TEST_CLASS, CanSetMerkleRootPool) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCacheForStateHashTests();
+		std::shared_ptr<thread::IoThreadPool> pPool = test::CreateStartedIoThreadPool(2);
+
+		// Act:
+		cache.setMerkleRootPool(pPool);
+		const auto& context = *cache.merkleRootContext();
+
+		// Assert:
+		EXPECT_EQ(pPool, context.pool());
+		EXPECT_EQ(9u, context.numSubCaches());
+	}
+
+	TEST(TEST_CLASS, MerkleRootContextDoesNotExtendPoolLifetime) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCacheForStateHashTests();
+		std::shared_ptr<thread::IoThreadPool> pPool = test::CreateStartedIoThreadPool(2);
+		cache.setMerkleRootPool(pPool);
+
+		// Act:
+		pPool.reset();
+
+		// Assert:
+		EXPECT_FALSE(!!cache.merkleRootContext()->pool());
+	}
+
+	TEST(TEST_CLASS, MerkleRootContextRemainsValidWhenReplaced) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCacheForStateHashTests();
+		std::shared_ptr<thread::IoThreadPool> pPool = test::CreateStartedIoThreadPool(2);
+		auto pOriginalContext = cache.merkleRootContext();
+
+		// Act:
+		cache.setMerkleRootPool(pPool);
+		auto pContext = cache.merkleRootContext();
+
+		// Assert: the original context is still usable but is not updated
+		EXPECT_NE(pOriginalContext, pContext);
+		EXPECT_FALSE(!!pOriginalContext->pool());
+		EXPECT_EQ(9u, pOriginalContext->numSubCaches());
+		EXPECT_EQ(pPool, pContext->pool());
+	}
+
+	TEST(TEST_CLASS, StateHashIsCalculatedDeterministicallyWhenMerkleRootPoolIsSet) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCacheForStateHashTests();
+		std::shared_ptr<thread::IoThreadPool> pPool = test::CreateStartedIoThreadPool(2);
+		cache.setMerkleRootPool(pPool);
+		auto view = cache.createDelta();
+
+		std::vector<Hash256> expectedSubCacheMerkleRoots{
+			DeltaTraits::GetMerkleRoot(view.sub<test::SimpleCacheT<2>>()),
+			DeltaTraits::GetMerkleRoot(view.sub<test::SimpleCacheT<6>>())
+		};
+
+		Hash256 expectedStateHash;
+		crypto::Sha3_256_Builder stateHashBuilder;
+		stateHashBuilder.update(expectedSubCacheMerkleRoots[0]);
+		stateHashBuilder.update(expectedSubCacheMerkleRoots[1]);
+		stateHashBuilder.final(expectedStateHash);
+
+		// Act:
+		auto stateHashInfo = view.calculateStateHash(Height(123));
+
+		// Assert:
+		EXPECT_EQ(expectedStateHash, stateHashInfo.StateHash);
+		EXPECT_EQ(expectedSubCacheMerkleRoots, stateHashInfo.SubCacheMerkleRoots);
+	}
+
+	TEST(TEST_CLASS, StateHashCalculationIsIndependentOfMerkleRootPool) {
+		// Arrange: use same merkle roots for both caches
+		auto cache1 = CreateSimpleCatapultCacheForStateHashTests();
+		auto cache2 = CreateSimpleCatapultCacheForStateHashTests();
+		std::shared_ptr<thread::IoThreadPool> pPool = test::CreateStartedIoThreadPool(2);
+		cache2.setMerkleRootPool(pPool);
+
+		auto hashes = test::GenerateRandomDataVector<Hash256>(2);
+		auto delta1 = cache1.createDelta();
+		auto delta2 = cache2.createDelta();
+		delta1.setSubCacheMerkleRoots(hashes);
+		delta2.setSubCacheMerkleRoots(hashes);
+
+		// Act:
+		auto stateHashInfo1 = delta1.calculateStateHash(Height(123));
+		auto stateHashInfo2 = delta2.calculateStateHash(Height(123));
+
+		// Assert:
+		EXPECT_EQ(stateHashInfo1.StateHash, stateHashInfo2.StateHash);
+		EXPECT_EQ(stateHashInfo1.SubCacheMerkleRoots, stateHashInfo2.SubCacheMerkleRoots);
+	}
+
+	// endregion
+
 	// region commit
 
 	namespace {
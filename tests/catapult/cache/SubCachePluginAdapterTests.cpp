@@ -499,6 +499,67 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region prefetch
+
+	namespace {
+		class PrefetchAwareDeltaExtension : public test::SimpleCacheDefaultDeltaExtension {
+		public:
+			using test::SimpleCacheDefaultDeltaExtension::SimpleCacheDefaultDeltaExtension;
+
+		public:
+			const std::vector<CachePrefetchKeys>& prefetchedKeys() const {
+				return m_prefetchedKeys;
+			}
+
+			void prefetch(const CachePrefetchKeys& keys) {
+				m_prefetchedKeys.push_back(keys);
+			}
+
+		private:
+			std::vector<CachePrefetchKeys> m_prefetchedKeys;
+		};
+	}
+
+	TEST(TEST_CLASS, PrefetchIsForwardedToDeltaWhenSupported) {
+		// Arrange:
+		using ViewExtension = test::SimpleCacheDefaultViewExtension;
+		using DeltaExtension = PrefetchAwareDeltaExtension;
+		SimpleCachePluginAdapterT<ViewExtension, DeltaExtension> adapter(
+				CreateSimpleCacheWithValueT<ViewExtension, DeltaExtension>(5, test::SimpleCacheViewMode::Iterable));
+		auto pDelta = adapter.createDelta(Height{0});
+
+		CachePrefetchKeys keys;
+		keys.PublicKeys = test::GenerateRandomDataVector<Key>(3);
+		keys.MosaicIds = { MosaicId(123) };
+
+		// Act:
+		pDelta->prefetch(keys);
+
+		// Assert:
+		using DeltaType = SimpleCacheT<ViewExtension, DeltaExtension>::CacheDeltaType;
+		const auto& prefetchedKeys = static_cast<const DeltaType*>(pDelta->get())->prefetchedKeys();
+		ASSERT_EQ(1u, prefetchedKeys.size());
+		EXPECT_EQ(keys.PublicKeys, prefetchedKeys[0].PublicKeys);
+		EXPECT_EQ(keys.MosaicIds, prefetchedKeys[0].MosaicIds);
+	}
+
+	TEST(TEST_CLASS, PrefetchIsBypassedWhenUnsupported) {
+		// Arrange:
+		SimpleCachePluginAdapter adapter(CreateSimpleCacheWithValue(5));
+		auto pDelta = adapter.createDelta(Height{0});
+
+		CachePrefetchKeys keys;
+		keys.PublicKeys = test::GenerateRandomDataVector<Key>(3);
+
+		// Act:
+		pDelta->prefetch(keys);
+
+		// Assert: delta is unchanged
+		AssertView<test::SimpleCacheDelta>(pDelta, 5, SubCacheViewType::Delta);
+	}
+
+	// endregion
+
 	// region createStorage
 
 	namespace {
@@ -83,6 +83,10 @@ namespace catapult { namespace test {
 		void restoreChanges() override {
 			CATAPULT_THROW_RUNTIME_ERROR("restoreChanges is not supported");
 		}
+
+		void prefetch(const CachePrefetchKeys&) override {
+			CATAPULT_THROW_RUNTIME_ERROR("prefetch is not supported");
+		}
 	};
 
 	// endregion
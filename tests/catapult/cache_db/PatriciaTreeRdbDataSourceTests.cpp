@@ -50,6 +50,10 @@ namespace catapult { namespace cache {
 				return m_dataSource.get(hash);
 			}
 
+			std::vector<std::unique_ptr<const tree::TreeNode>> get(const std::vector<Hash256>& hashes) {
+				return m_dataSource.get(hashes);
+			}
+
 			void set(const tree::BranchTreeNode& node) {
 				m_dataSource.set(node);
 				m_container.setSize(size() + 1);
@@ -73,4 +77,28 @@ namespace catapult { namespace cache {
 	}
 
 	DEFINE_PATRICIA_TREE_DATA_SOURCE_TESTS(RocksDataSourceTraits)
+
+	// region batched get
+
+	TEST(TEST_CLASS, CanGetMultipleNodesInSingleBatch) {
+		// Arrange:
+		RocksDataSourceWrapper dataSource;
+		auto node1 = tree::LeafTreeNode(tree::TreeNodePath(0x64'3F'D3'B5), test::GenerateRandomByteArray<Hash256>());
+		auto node2 = tree::LeafTreeNode(tree::TreeNodePath(0x11'22'33'44), test::GenerateRandomByteArray<Hash256>());
+		dataSource.set(node1);
+		dataSource.set(node2);
+
+		// Act:
+		auto nodes = dataSource.get({ node2.hash(), test::GenerateRandomByteArray<Hash256>(), node1.hash() });
+
+		// Assert:
+		ASSERT_EQ(3u, nodes.size());
+		ASSERT_TRUE(!!nodes[0]);
+		EXPECT_EQ(node2.hash(), nodes[0]->hash());
+		EXPECT_FALSE(!!nodes[1]);
+		ASSERT_TRUE(!!nodes[2]);
+		EXPECT_EQ(node1.hash(), nodes[2]->hash());
+	}
+
+	// endregion
 }}
@@ -55,6 +55,20 @@ namespace catapult { namespace cache {
 		auto MultiColumnSettings() {
 			return CreateSettings({ "default", "beta", "gamma" });
 		}
+
+		auto TunedSettings(utils::CompressionMode compressionMode = utils::CompressionMode::None) {
+			RocksTuningSettings tuning;
+			tuning.BlockCacheSize = utils::FileSize::FromMegabytes(8);
+			tuning.BloomFilterBitsPerKey = 10;
+			tuning.CompressionMode = compressionMode;
+			tuning.ShouldSyncWrites = false;
+			return RocksDatabaseSettings(
+					test::TempDirectoryGuard::DefaultName(),
+					{ "default", "foo" },
+					utils::FileSize(),
+					FilterPruningMode::Disabled,
+					tuning);
+		}
 	}
 
 	// region constructor
@@ -119,6 +133,58 @@ namespace catapult { namespace cache {
 		EXPECT_TRUE(database.canPrune());
 	}
 
+	TEST(TEST_CLASS, CanOpenDatabaseWithTuning) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+
+		// Act:
+		RocksDatabase database(TunedSettings());
+
+		// Assert:
+		EXPECT_EQ((std::vector<std::string>{ "default", "foo" }), database.columnFamilyNames());
+		EXPECT_FALSE(database.canPrune());
+	}
+
+	TEST(TEST_CLASS, CanOpenMultipleDatabasesSharingBlockCache) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard1("db1");
+		test::TempDirectoryGuard dbDirGuard2("db2");
+		RocksTuningSettings tuning;
+		tuning.BlockCacheSize = utils::FileSize::FromMegabytes(8);
+
+		// Act:
+		RocksDatabase database1(RocksDatabaseSettings(dbDirGuard1.name(), { "default" }, utils::FileSize(), FilterPruningMode::Disabled, tuning));
+		RocksDatabase database2(RocksDatabaseSettings(dbDirGuard2.name(), { "default" }, utils::FileSize(), FilterPruningMode::Disabled, tuning));
+		database1.put(0, "hello", "amazing");
+		database2.put(0, "hello", "awesome");
+		database1.flush();
+		database2.flush();
+
+		// Assert:
+		RdbDataIterator iter1;
+		RdbDataIterator iter2;
+		database1.get(0, "hello", iter1);
+		database2.get(0, "hello", iter2);
+		test::AssertIteratorValue("amazing", iter1);
+		test::AssertIteratorValue("awesome", iter2);
+	}
+
+	TEST(TEST_CLASS, CanWriteAndReadTunedDatabaseWithoutSync) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		RocksDatabase database(TunedSettings());
+
+		// Act:
+		database.put(1, "hello", "amazing");
+		database.flush();
+
+		RdbDataIterator iter;
+		database.get(1, "hello", iter);
+
+		// Assert:
+		test::AssertIteratorValue("amazing", iter);
+	}
+
 	TEST(TEST_CLASS, CanCreatePlaceholderDatabase) {
 		// Act:
 		RocksDatabase database;
@@ -322,6 +388,71 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region multiGet
+
+	TEST(TEST_CLASS, DefaultCreatedRdbDoesNotAllowMultiGet) {
+		// Arrange:
+		RocksDatabase database;
+		std::vector<RdbDataIterator> iters;
+
+		// Act + Assert:
+		EXPECT_THROW(database.multiGet(0, { "hello" }, iters), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, MultiGetWithNoKeysReturnsNoIterators) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings());
+		auto& database = context.database();
+		std::vector<RdbDataIterator> iters(3);
+
+		// Act:
+		database.multiGet(0, {}, iters);
+
+		// Assert:
+		EXPECT_TRUE(iters.empty());
+	}
+
+	TEST(TEST_CLASS, CanReadMultipleValuesWithMultiGet) {
+		// Arrange:
+		test::RdbTestContext context(MultiColumnSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[1], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[1], "world", "awesome");
+			db.Put(rocksdb::WriteOptions(), columns[2], "other", "fractured");
+		});
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(1, { "world", "other", "hello" }, iters);
+
+		// Assert: results are ordered by keys and keys from other columns are not found
+		ASSERT_EQ(3u, iters.size());
+		test::AssertIteratorValue("awesome", iters[0]);
+		EXPECT_EQ(RdbDataIterator::End(), iters[1]);
+		test::AssertIteratorValue("amazing", iters[2]);
+	}
+
+	TEST(TEST_CLASS, CanReadMultipleValuesWithMultiGetFromTunedDatabase) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		RocksDatabase database(TunedSettings());
+		database.put(0, "hello", "amazing");
+		database.put(0, "world", "awesome");
+		database.flush();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(0, { "hello", "missing", "world" }, iters);
+
+		// Assert:
+		ASSERT_EQ(3u, iters.size());
+		test::AssertIteratorValue("amazing", iters[0]);
+		EXPECT_EQ(RdbDataIterator::End(), iters[1]);
+		test::AssertIteratorValue("awesome", iters[2]);
+	}
+
+	// endregion
+
 	// region multiple values
 
 	TEST(TEST_CLASS, CanReadFromDb_MultipleValues) {
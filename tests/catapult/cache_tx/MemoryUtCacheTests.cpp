@@ -522,6 +522,119 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region forEach (max fee multiplier order)
+
+	namespace {
+		constexpr auto Limited_Fee_Transaction_Type = static_cast<model::EntityType>(0x7FFF);
+
+		std::vector<model::TransactionInfo> CreateTransactionInfosWithMaxFeeMultipliers() {
+			// generate transactions with (deadline, fee multiples) { (1, 20x), (2, limited), (3, 40x), (4, 20x),
+			// (5, 60x), (6, limited), (7, 40x), (8, 0x) }, limited fee transactions have the highest multiples
+			auto transactionInfos = test::CreateTransactionInfos(8);
+			auto transactionSize = transactionInfos[0].pEntity->Size;
+			std::vector<uint64_t> feeMultiples{ 20, 100, 40, 20, 60, 100, 40, 0 };
+			for (auto i = 0u; i < transactionInfos.size(); ++i) {
+				const auto& transaction = *transactionInfos[i].pEntity;
+				const_cast<Amount&>(transaction.MaxFee) = Amount(transactionSize * feeMultiples[i]);
+				if (1 == i % 4)
+					const_cast<model::EntityType&>(transaction.Type) = Limited_Fee_Transaction_Type;
+			}
+
+			return transactionInfos;
+		}
+
+		std::unique_ptr<MemoryUtCache> CreateCacheWithMaxFeeMultipliers(const std::vector<model::TransactionInfo>& transactionInfos) {
+			auto pTransactionFeeCalculator = std::make_shared<model::TransactionFeeCalculator>();
+			pTransactionFeeCalculator->addLimitedFeeTransaction(Limited_Fee_Transaction_Type, transactionInfos[1].pEntity->EntityVersion());
+			auto pCache = std::make_unique<MemoryUtCache>(Default_Options, pTransactionFeeCalculator);
+			test::AddAll(*pCache, transactionInfos);
+			return pCache;
+		}
+
+		std::vector<Timestamp::ValueType> GetDeadlines(
+				const MemoryUtCache& cache,
+				MaxFeeMultiplierOrder order,
+				size_t numRequested = std::numeric_limits<size_t>::max()) {
+			std::vector<Timestamp::ValueType> rawDeadlines;
+			cache.view().forEach(order, [numRequested, &rawDeadlines](const auto& info) {
+				rawDeadlines.push_back(info.pEntity->Deadline.unwrap());
+				return numRequested != rawDeadlines.size();
+			});
+			return rawDeadlines;
+		}
+	}
+
+	TEST(TEST_CLASS, ForEachInMaxFeeMultiplierOrderForwardsNoTransactionInfosWhenCacheIsEmpty) {
+		// Arrange:
+		auto pCache = test::CreateSeededMemoryUtCache(0);
+
+		// Act + Assert:
+		EXPECT_TRUE(GetDeadlines(*pCache, MaxFeeMultiplierOrder::Ascending).empty());
+		EXPECT_TRUE(GetDeadlines(*pCache, MaxFeeMultiplierOrder::Descending).empty());
+	}
+
+	TEST(TEST_CLASS, ForEachInAscendingMaxFeeMultiplierOrderForwardsLimitedFeeTransactionsFirstAndOlderTransactionsFirst) {
+		// Arrange:
+		auto pCache = CreateCacheWithMaxFeeMultipliers(CreateTransactionInfosWithMaxFeeMultipliers());
+
+		// Act:
+		auto rawDeadlines = GetDeadlines(*pCache, MaxFeeMultiplierOrder::Ascending);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 6, 8, 1, 4, 3, 7, 5 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, ForEachInDescendingMaxFeeMultiplierOrderForwardsLimitedFeeTransactionsFirstAndOlderTransactionsFirst) {
+		// Arrange:
+		auto pCache = CreateCacheWithMaxFeeMultipliers(CreateTransactionInfosWithMaxFeeMultipliers());
+
+		// Act:
+		auto rawDeadlines = GetDeadlines(*pCache, MaxFeeMultiplierOrder::Descending);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 6, 5, 3, 7, 1, 4, 8 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, ForEachInMaxFeeMultiplierOrderForwardsSubsetOfTransactionsWhenShortCircuited) {
+		// Arrange:
+		auto pCache = CreateCacheWithMaxFeeMultipliers(CreateTransactionInfosWithMaxFeeMultipliers());
+
+		// Act:
+		auto rawDeadlinesAscending = GetDeadlines(*pCache, MaxFeeMultiplierOrder::Ascending, 4);
+		auto rawDeadlinesDescending = GetDeadlines(*pCache, MaxFeeMultiplierOrder::Descending, 4);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 6, 8, 1 }), rawDeadlinesAscending);
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 6, 5, 3 }), rawDeadlinesDescending);
+	}
+
+	TEST(TEST_CLASS, ForEachInMaxFeeMultiplierOrderDoesNotForwardRemovedTransactions) {
+		// Arrange:
+		auto transactionInfos = CreateTransactionInfosWithMaxFeeMultipliers();
+		auto pCache = CreateCacheWithMaxFeeMultipliers(transactionInfos);
+
+		// Act: remove transactions with deadlines 3 and 6
+		test::RemoveAll(*pCache, { transactionInfos[2].EntityHash, transactionInfos[5].EntityHash });
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 8, 1, 4, 7, 5 }), GetDeadlines(*pCache, MaxFeeMultiplierOrder::Ascending));
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 5, 7, 1, 4, 8 }), GetDeadlines(*pCache, MaxFeeMultiplierOrder::Descending));
+	}
+
+	TEST(TEST_CLASS, ForEachInMaxFeeMultiplierOrderForwardsNoTransactionsAfterRemoveAll) {
+		// Arrange:
+		auto pCache = CreateCacheWithMaxFeeMultipliers(CreateTransactionInfosWithMaxFeeMultipliers());
+
+		// Act:
+		pCache->modifier().removeAll();
+
+		// Assert:
+		EXPECT_TRUE(GetDeadlines(*pCache, MaxFeeMultiplierOrder::Ascending).empty());
+		EXPECT_TRUE(GetDeadlines(*pCache, MaxFeeMultiplierOrder::Descending).empty());
+	}
+
+	// endregion
+
 	// region shortHashes
 
 	TEST(TEST_CLASS, ShortHashesReturnsAllShortHashes) {
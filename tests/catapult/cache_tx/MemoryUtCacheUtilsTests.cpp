@@ -214,4 +214,41 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region MaxFeeMultiplierOrder
+
+	namespace {
+		void AssertMaxFeeMultiplierOrderIsApplied(MaxFeeMultiplierOrder order, const std::vector<size_t>& expectedIndexes) {
+			// Arrange: fee multipliers are { 4, 8, 2, 8, 6, 1 }
+			auto transactionInfos = test::CreateTransactionInfosFromSizeMultiplierPairs({
+				{ 500, 40 }, { 1000, 80 }, { 500, 20 }, { 500, 80 }, { 1000, 60 }, { 500, 10 }
+			});
+			auto pUtCache = std::make_unique<MemoryUtCache>(MemoryCacheOptions(1000, 1000), std::make_shared<model::TransactionFeeCalculator>());
+			test::AddAll(*pUtCache, transactionInfos);
+			auto utCacheView = pUtCache->view();
+
+			// Act: filter out transaction with multiplier 6
+			auto transactionInfoPointers = GetFirstTransactionInfoPointers(utCacheView, 4, order, [](const auto& transactionInfo) {
+				return 1000 * 60 / 10 != transactionInfo.pEntity->MaxFee.unwrap();
+			},
+			[](){ return false; });
+
+			// Assert:
+			ASSERT_EQ(expectedIndexes.size(), transactionInfoPointers.size());
+			for (auto i = 0u; i < expectedIndexes.size(); ++i)
+				EXPECT_EQ(transactionInfos[expectedIndexes[i]].EntityHash, transactionInfoPointers[i]->EntityHash) << "transaction at " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesAscendingMaxFeeMultiplierOrderAndFiltering) {
+		// Assert: (1, 2, 4, 8) should be returned
+		AssertMaxFeeMultiplierOrderIsApplied(MaxFeeMultiplierOrder::Ascending, { 5, 2, 0, 1 });
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesDescendingMaxFeeMultiplierOrderAndFiltering) {
+		// Assert: (8, 8, 4, 2) should be returned with older transaction first for equal multipliers
+		AssertMaxFeeMultiplierOrderIsApplied(MaxFeeMultiplierOrder::Descending, { 1, 3, 0, 2 });
+	}
+
+	// endregion
 }}
@@ -60,10 +60,11 @@ namespace catapult { namespace chain {
 
 		class ProcessorTestContext {
 		public:
-			ProcessorTestContext()
-				: m_executionConfig(CreateBlockchainConfiguration())
-				, m_processor(CreateBatchEntityProcessor(m_executionConfig.Config))
-			{}
+			explicit ProcessorTestContext(const std::shared_ptr<test::MockNotificationPublisher>& pPrefetchPublisher = nullptr)
+					: m_executionConfig(CreateBlockchainConfiguration()) {
+				m_executionConfig.Config.pPrefetchPublisher = pPrefetchPublisher;
+				m_processor = CreateBatchEntityProcessor(m_executionConfig.Config);
+			}
 
 		public:
 			const auto& statefulValidatorParams() const {
@@ -248,6 +249,40 @@ namespace catapult { namespace chain {
 		context.assertEntityInfos(entityInfos);
 	}
 
+	TEST(TEST_CLASS, PrefetchPublisherIsCalledForAllEntitiesWhenSet) {
+		// Arrange:
+		auto pPrefetchPublisher = std::make_shared<test::MockNotificationPublisher>();
+		ProcessorTestContext context(pPrefetchPublisher);
+		auto pBlock = test::GenerateBlockWithTransactions(3);
+		auto entityInfos = ExtractEntityInfosFromBlock(*pBlock);
+
+		// Act:
+		auto result = context.process(Height(247), Timestamp(723), entityInfos);
+
+		// Assert: prefetching does not affect processing
+		EXPECT_EQ(ValidationResult::Success, result);
+		context.assertCounters(4, 8, 8);
+		context.assertEntityInfos(entityInfos);
+
+		const auto& prefetchPublisherParams = pPrefetchPublisher->params();
+		ASSERT_EQ(4u, prefetchPublisherParams.size());
+		for (auto i = 0u; i < prefetchPublisherParams.size(); ++i)
+			EXPECT_EQ(entityInfos[i], prefetchPublisherParams[i].EntityInfo) << "publisher at " << i;
+	}
+
+	TEST(TEST_CLASS, PrefetchPublisherIsNotCalledWhenThereAreNoEntities) {
+		// Arrange:
+		auto pPrefetchPublisher = std::make_shared<test::MockNotificationPublisher>();
+		ProcessorTestContext context(pPrefetchPublisher);
+
+		// Act:
+		auto result = context.process(Height(246), Timestamp(721), {});
+
+		// Assert:
+		EXPECT_EQ(ValidationResult::Neutral, result);
+		EXPECT_EQ(0u, pPrefetchPublisher->params().size());
+	}
+
 	namespace {
 		void AssertValidatorContext(const validators::ValidatorContext& context, Height height, Timestamp blockTime) {
 			EXPECT_EQ(height, context.Height);
@@ -23,6 +23,7 @@
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/mocks/MockBlockchainConfigurationHolder.h"
+#include "tests/test/core/mocks/MockNotificationPublisher.h"
 #include "tests/test/core/ResolverTestUtils.h"
 #include "tests/test/other/mocks/MockEntityObserver.h"
 
@@ -58,10 +59,11 @@ namespace catapult { namespace chain {
 			static void ProcessBlock(
 					const model::Block& block,
 					const observers::EntityObserver& observer,
-					observers::ObserverState& state) {
+					observers::ObserverState& state,
+					const model::NotificationPublisher* pPrefetchPublisher = nullptr) {
 				auto blockElement = test::BlockToBlockElement(block);
 				FixHashes(blockElement);
-				ExecuteBlock(blockElement, { observer, CreateResolverContext(), config::CreateMockConfigurationHolder(), state });
+				ExecuteBlock(blockElement, { observer, CreateResolverContext(), config::CreateMockConfigurationHolder(), state, pPrefetchPublisher });
 			}
 		};
 
@@ -77,10 +79,11 @@ namespace catapult { namespace chain {
 			static void ProcessBlock(
 					const model::Block& block,
 					const observers::EntityObserver& observer,
-					observers::ObserverState& state) {
+					observers::ObserverState& state,
+					const model::NotificationPublisher* pPrefetchPublisher = nullptr) {
 				auto blockElement = test::BlockToBlockElement(block);
 				FixHashes(blockElement);
-				RollbackBlock(blockElement, { observer, CreateResolverContext(), config::CreateMockConfigurationHolder(), state });
+				RollbackBlock(blockElement, { observer, CreateResolverContext(), config::CreateMockConfigurationHolder(), state, pPrefetchPublisher });
 			}
 		};
 
@@ -198,6 +201,27 @@ namespace catapult { namespace chain {
 		AssertContexts(std::vector<observers::ObserverContext>(contextsSplitIter, contexts.cend()), state, Height(25), mode);
 	}
 
+	TRAITS_BASED_TEST(PrefetchPublisherIsCalledForAllEntitiesWhenProvided) {
+		// Arrange:
+		auto cache = test::CreateEmptyCatapultCache();
+		auto delta = cache.createDelta();
+		mocks::MockEntityObserver observer;
+		mocks::MockNotificationPublisher publisher;
+		auto pBlock = test::GenerateBlockWithTransactions(7, Height(10));
+
+		state::CatapultState catapultState;
+		std::vector<std::unique_ptr<model::Notification>> notifications;
+		observers::ObserverState state(delta, catapultState, notifications);
+
+		// Act:
+		TTraits::ProcessBlock(*pBlock, observer, state, &publisher);
+
+		// Assert: all entities were published for prefetching and observed
+		EXPECT_EQ(8u, publisher.numPublishCalls());
+		EXPECT_EQ(8u, observer.versions().size());
+		EXPECT_EQ(TTraits::GetExpectedHashes(*pBlock), observer.entityHashes());
+	}
+
 	TEST(TEST_CLASS, RollbackCommitsAccountRemovals) {
 		// Arrange:
 		auto cache = test::CreateEmptyCatapultCache();
@@ -0,0 +1,216 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "catapult/chain/CachePrefetcher.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/model/ResolverContext.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace chain {
+
+#define TEST_CLASS CachePrefetcherTests
+
+	namespace {
+		using PublishFunc = std::function<void (model::NotificationSubscriber&)>;
+
+		class MockNotificationPublisher : public model::NotificationPublisher {
+		public:
+			explicit MockNotificationPublisher(const PublishFunc& publish)
+					: m_publish(publish)
+					, m_numPublishCalls(0)
+			{}
+
+		public:
+			size_t numPublishCalls() const {
+				return m_numPublishCalls;
+			}
+
+		public:
+			void publish(const model::WeakEntityInfo&, model::NotificationSubscriber& sub) const override {
+				++m_numPublishCalls;
+				m_publish(sub);
+			}
+
+		private:
+			PublishFunc m_publish;
+			mutable size_t m_numPublishCalls;
+		};
+
+		Address ResolveAddress(const UnresolvedAddress& unresolved) {
+			auto address = model::ResolverContext().resolve(unresolved);
+			address[Address_Decoded_Size - 1] ^= 0xFF;
+			return address;
+		}
+
+		MosaicId ResolveMosaicId(UnresolvedMosaicId unresolved) {
+			return MosaicId(unresolved.unwrap() + 1000);
+		}
+
+		model::ResolverContext CreateResolverContext() {
+			return model::ResolverContext(ResolveMosaicId, ResolveAddress, [](const auto& unresolved) {
+				return model::ResolverContext().resolve(unresolved);
+			});
+		}
+
+		cache::CachePrefetchKeys CollectKeys(size_t numEntities, const PublishFunc& publish) {
+			auto pBlock = test::GenerateBlockWithTransactions(numEntities - 1, Height(10));
+			auto blockElement = test::BlockToBlockElement(*pBlock);
+			model::WeakEntityInfos entityInfos;
+			model::ExtractEntityInfos(blockElement, entityInfos);
+
+			MockNotificationPublisher publisher(publish);
+			auto keys = CollectCachePrefetchKeys(publisher, CreateResolverContext(), entityInfos);
+
+			// Sanity: publisher is called once for each entity
+			EXPECT_EQ(numEntities, publisher.numPublishCalls());
+			return keys;
+		}
+
+		template<typename T>
+		void AssertUnorderedEqual(const std::vector<T>& expected, const std::vector<T>& actual) {
+			auto sortedExpected = expected;
+			auto sortedActual = actual;
+			std::sort(sortedExpected.begin(), sortedExpected.end());
+			std::sort(sortedActual.begin(), sortedActual.end());
+			EXPECT_EQ(sortedExpected, sortedActual);
+		}
+	}
+
+	// region CollectCachePrefetchKeys
+
+	TEST(TEST_CLASS, CollectsNoKeysWhenThereAreNoEntities) {
+		// Arrange:
+		MockNotificationPublisher publisher([](auto&) {});
+
+		// Act:
+		auto keys = CollectCachePrefetchKeys(publisher, CreateResolverContext(), {});
+
+		// Assert:
+		EXPECT_EQ(0u, publisher.numPublishCalls());
+		EXPECT_TRUE(keys.empty());
+	}
+
+	TEST(TEST_CLASS, CollectsNoKeysFromUnsupportedNotifications) {
+		// Act:
+		using SourceChangeType = model::SourceChangeNotification<1>::SourceChangeType;
+		auto keys = CollectKeys(3, [](auto& sub) {
+			sub.notify(model::SourceChangeNotification<1>(SourceChangeType::Relative, 1, SourceChangeType::Relative, 2));
+		});
+
+		// Assert:
+		EXPECT_TRUE(keys.empty());
+	}
+
+	TEST(TEST_CLASS, CollectsPublicKeysFromAccountBlockAndTransactionNotifications) {
+		// Arrange:
+		auto publicKeys = test::GenerateRandomDataVector<Key>(5);
+
+		// Act:
+		auto keys = CollectKeys(3, [&publicKeys](auto& sub) {
+			sub.notify(model::AccountPublicKeyNotification<1>(publicKeys[0]));
+			sub.notify(model::BlockNotification<1>(publicKeys[1], publicKeys[2], Timestamp(), Difficulty(), 0, 0));
+			sub.notify(model::TransactionNotification<1>(publicKeys[3], Hash256(), model::EntityType(), Timestamp()));
+			sub.notify(model::AccountPublicKeyNotification<1>(publicKeys[4]));
+		});
+
+		// Assert: duplicate keys from multiple entities are collapsed
+		AssertUnorderedEqual(publicKeys, keys.PublicKeys);
+		EXPECT_TRUE(keys.Addresses.empty());
+		EXPECT_TRUE(keys.MosaicIds.empty());
+	}
+
+	TEST(TEST_CLASS, CollectsResolvedAddresses) {
+		// Arrange:
+		auto addresses = test::GenerateRandomDataVector<UnresolvedAddress>(2);
+
+		// Act:
+		auto keys = CollectKeys(2, [&addresses](auto& sub) {
+			sub.notify(model::AccountAddressNotification<1>(addresses[0]));
+			sub.notify(model::AccountAddressNotification<1>(addresses[1]));
+		});
+
+		// Assert:
+		EXPECT_TRUE(keys.PublicKeys.empty());
+		AssertUnorderedEqual(std::vector<Address>({ ResolveAddress(addresses[0]), ResolveAddress(addresses[1]) }), keys.Addresses);
+		EXPECT_TRUE(keys.MosaicIds.empty());
+	}
+
+	TEST(TEST_CLASS, CollectsKeysFromBalanceNotifications) {
+		// Arrange:
+		auto publicKeys = test::GenerateRandomDataVector<Key>(3);
+		auto address = test::GenerateRandomByteArray<UnresolvedAddress>();
+
+		// Act:
+		auto keys = CollectKeys(1, [&publicKeys, &address](auto& sub) {
+			sub.notify(model::BalanceTransferNotification<1>(publicKeys[0], address, UnresolvedMosaicId(111), Amount(1)));
+			sub.notify(model::BalanceDebitNotification<1>(publicKeys[1], UnresolvedMosaicId(222), Amount(2)));
+			sub.notify(model::BalanceCreditNotification<1>(publicKeys[2], UnresolvedMosaicId(333), Amount(3)));
+		});
+
+		// Assert:
+		AssertUnorderedEqual(publicKeys, keys.PublicKeys);
+		EXPECT_EQ(std::vector<Address>({ ResolveAddress(address) }), keys.Addresses);
+		AssertUnorderedEqual(std::vector<MosaicId>({ MosaicId(1111), MosaicId(1222), MosaicId(1333) }), keys.MosaicIds);
+	}
+
+	TEST(TEST_CLASS, CollectsKeysFromMosaicRequiredNotifications) {
+		// Arrange:
+		auto publicKeys = test::GenerateRandomDataVector<Key>(2);
+
+		// Act:
+		auto keys = CollectKeys(1, [&publicKeys](auto& sub) {
+			sub.notify(model::MosaicRequiredNotification<1>(publicKeys[0], MosaicId(111)));
+			sub.notify(model::MosaicRequiredNotification<1>(publicKeys[1], UnresolvedMosaicId(222)));
+		});
+
+		// Assert: only unresolved mosaic ids are resolved
+		AssertUnorderedEqual(publicKeys, keys.PublicKeys);
+		EXPECT_TRUE(keys.Addresses.empty());
+		AssertUnorderedEqual(std::vector<MosaicId>({ MosaicId(111), MosaicId(1222) }), keys.MosaicIds);
+	}
+
+	// endregion
+
+	// region PrefetchCacheEntries
+
+	TEST(TEST_CLASS, PrefetchDoesNotAddPendingChanges) {
+		// Arrange:
+		auto cache = test::CreateEmptyCatapultCache();
+		auto publicKey = test::GenerateRandomByteArray<Key>();
+		{
+			auto delta = cache.createDelta();
+			delta.sub<cache::AccountStateCache>().addAccount(publicKey, Height(1));
+			cache.commit(Height(1));
+		}
+
+		auto pBlock = test::GenerateBlockWithTransactions(1, Height(10));
+		model::WeakEntityInfos entityInfos;
+		model::ExtractEntityInfos(test::BlockToBlockElement(*pBlock), entityInfos);
+		MockNotificationPublisher publisher([&publicKey](auto& sub) {
+			sub.notify(model::AccountPublicKeyNotification<1>(publicKey));
+		});
+
+		auto delta = cache.createDelta();
+
+		// Act:
+		PrefetchCacheEntries(publisher, CreateResolverContext(), entityInfos, delta);
+
+		// Assert:
+		EXPECT_EQ(2u, publisher.numPublishCalls());
+
+		const auto& accountStateCacheDelta = delta.sub<cache::AccountStateCache>();
+		EXPECT_TRUE(accountStateCacheDelta.contains(publicKey));
+
+		EXPECT_TRUE(accountStateCacheDelta.updatedAddresses().empty());
+	}
+
+	// endregion
+}}
@@ -91,4 +91,98 @@ namespace catapult { namespace chain {
 	}
 
 	DEFINE_ENTITIES_SYNCHRONIZER_TESTS(UtSynchronizer)
+
+	// region sketch
+
+	namespace {
+		struct SketchTestContext {
+		public:
+			SketchTestContext()
+					: ShortHashes(UtSynchronizerTraits::CreateRequestRange(5))
+					, Transactions(test::CreateTransactionEntityRange(3))
+					, Api(Transactions)
+					, NumConsumedTransactions(0)
+			{}
+
+		public:
+			ionet::NodeInteractionResultCode synchronize() {
+				auto synchronizer = CreateUtSynchronizer(
+						[]() { return BlockFeeMultiplier(17); },
+						[this]() { return model::ShortHashRange::CopyRange(ShortHashes); },
+						[this](auto&& range) { NumConsumedTransactions += range.Range.size(); },
+						10,
+						30);
+				return synchronizer(Api).get();
+			}
+
+		public:
+			model::ShortHashRange ShortHashes;
+			model::TransactionRange Transactions;
+			MockRemoteApi Api;
+			size_t NumConsumedTransactions;
+		};
+	}
+
+	TEST(UtSynchronizerTests, SynchronizerSendsSketchWhenSketchCellsAreNonzero) {
+		// Arrange:
+		SketchTestContext context;
+
+		// Act:
+		auto code = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_EQ(3u, context.NumConsumedTransactions);
+		EXPECT_EQ(0u, context.Api.utRequests().size());
+		ASSERT_EQ(1u, context.Api.utSketchRequests().size());
+
+		const auto& request = context.Api.utSketchRequests()[0];
+		EXPECT_EQ(BlockFeeMultiplier(17), request.first);
+
+		utils::ShortHashSketch expectedSketch(30);
+		for (auto shortHash : context.ShortHashes)
+			expectedSketch.insert(shortHash);
+
+		ASSERT_EQ(expectedSketch.size(), request.second.size());
+		EXPECT_EQ_MEMORY(
+				expectedSketch.cells().data(),
+				request.second.cells().data(),
+				expectedSketch.size() * sizeof(utils::ShortHashSketchCell));
+	}
+
+	TEST(UtSynchronizerTests, SynchronizerSendsShortHashesWhenSketchCannotBeDecoded) {
+		// Arrange:
+		SketchTestContext context;
+		context.Api.setSketchDecoded(false);
+
+		// Act:
+		auto code = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_EQ(3u, context.NumConsumedTransactions);
+		EXPECT_EQ(1u, context.Api.utSketchRequests().size());
+		ASSERT_EQ(1u, context.Api.utRequests().size());
+
+		const auto& request = context.Api.utRequests()[0];
+		EXPECT_EQ(BlockFeeMultiplier(17), request.first);
+		test::AssertEqualRange(context.ShortHashes, request.second, "request");
+	}
+
+	TEST(UtSynchronizerTests, SynchronizerFailsWhenSketchRequestFails) {
+		// Arrange:
+		SketchTestContext context;
+		context.Api.setError(MockRemoteApi::EntryPoint::Unconfirmed_Transactions_Sketch);
+
+		// Act:
+		auto code = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Failure, code);
+		EXPECT_EQ(0u, context.NumConsumedTransactions);
+		EXPECT_EQ(1u, context.Api.utSketchRequests().size());
+		EXPECT_EQ(0u, context.Api.utRequests().size());
+	}
+
+	// endregion
 }}
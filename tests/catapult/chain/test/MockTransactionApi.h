@@ -20,6 +20,7 @@
 
 #pragma once
 #include "catapult/api/RemoteTransactionApi.h"
+#include "catapult/utils/ShortHashSketch.h"
 #include "tests/test/nodeps/Random.h"
 
 namespace catapult { namespace mocks {
@@ -30,7 +31,8 @@ namespace catapult { namespace mocks {
 	public:
 		enum class EntryPoint {
 			None,
-			Unconfirmed_Transactions
+			Unconfirmed_Transactions,
+			Unconfirmed_Transactions_Sketch
 		};
 
 	public:
@@ -39,6 +41,7 @@ namespace catapult { namespace mocks {
 				: api::RemoteTransactionApi(test::GenerateRandomByteArray<Key>())
 				, m_transactions(model::TransactionRange::CopyRange(transactions))
 				, m_errorEntryPoint(EntryPoint::None)
+				, m_isSketchDecoded(true)
 		{}
 
 	public:
@@ -47,11 +50,21 @@ namespace catapult { namespace mocks {
 			m_errorEntryPoint = entryPoint;
 		}
 
+		/// Sets whether or not sketches should be reported as decoded (\a isSketchDecoded).
+		void setSketchDecoded(bool isSketchDecoded) {
+			m_isSketchDecoded = isSketchDecoded;
+		}
+
 		/// Returns a vector of parameters that were passed to the unconfirmed transactions requests.
 		const auto& utRequests() const {
 			return m_utRequests;
 		}
 
+		/// Returns a vector of parameters that were passed to the unconfirmed transactions sketch requests.
+		const auto& utSketchRequests() const {
+			return m_utSketchRequests;
+		}
+
 	public:
 		/// Returns the configured unconfirmed transactions and throws if the error entry point is set to Unconfirmed_Transactions.
 		/// \note The \a minFeeMultiplier and \a knownShortHashes parameters are captured.
@@ -68,6 +81,24 @@ namespace catapult { namespace mocks {
 			return thread::make_ready_future(std::move(ranges));
 		}
 
+		/// Returns the configured unconfirmed transactions and throws if the error entry point is set to Unconfirmed_Transactions_Sketch.
+		/// \note The \a minFeeMultiplier and \a knownShortHashesSketch parameters are captured.
+		thread::future<api::SketchedUnconfirmedTransactions> unconfirmedTransactions(
+				BlockFeeMultiplier minFeeMultiplier,
+				const utils::ShortHashSketch& knownShortHashesSketch,
+				size_t) const override {
+			m_utSketchRequests.push_back(std::make_pair(minFeeMultiplier, knownShortHashesSketch));
+			if (shouldRaiseException(EntryPoint::Unconfirmed_Transactions_Sketch))
+				return CreateFutureException<api::SketchedUnconfirmedTransactions>("unconfirmed transactions sketch error has been set");
+
+			api::SketchedUnconfirmedTransactions result;
+			result.IsDecoded = m_isSketchDecoded;
+			if (m_isSketchDecoded)
+				result.Transactions.push_back(model::TransactionRange::CopyRange(m_transactions));
+
+			return thread::make_ready_future(std::move(result));
+		}
+
 	private:
 		bool shouldRaiseException(EntryPoint entryPoint) const {
 			return m_errorEntryPoint == entryPoint;
@@ -81,6 +112,8 @@ namespace catapult { namespace mocks {
 	private:
 		model::TransactionRange m_transactions;
 		EntryPoint m_errorEntryPoint;
+		bool m_isSketchDecoded;
 		mutable std::vector<std::pair<BlockFeeMultiplier, model::ShortHashRange>> m_utRequests;
+		mutable std::vector<std::pair<BlockFeeMultiplier, utils::ShortHashSketch>> m_utSketchRequests;
 	};
 }}
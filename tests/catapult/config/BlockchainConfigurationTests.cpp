@@ -101,14 +101,19 @@ namespace catapult { namespace config {
 			EXPECT_EQ(7903u, config.DbrbPort);
 			EXPECT_FALSE(config.ShouldAllowAddressReuse);
 			EXPECT_FALSE(config.ShouldUseSingleThreadPool);
+			EXPECT_FALSE(config.ShouldUseShardedThreadPool);
+			EXPECT_FALSE(config.ShouldPinThreadPoolThreads);
 			EXPECT_TRUE(config.ShouldUseCacheDatabaseStorage);
 			EXPECT_TRUE(config.ShouldEnableAutoSyncCleanup);
+			EXPECT_FALSE(config.ShouldCompressStateChanges);
+			EXPECT_EQ(4u, config.MaxStateFileThreads);
 
 			EXPECT_TRUE(config.ShouldEnableTransactionSpamThrottling);
 			EXPECT_EQ(Amount(10'000'000), config.TransactionSpamThrottlingMaxBoostFee);
 
 			EXPECT_EQ(400u, config.MaxBlocksPerSyncAttempt);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(100), config.MaxChainBytesPerSyncAttempt);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(100), config.BlockStorageCacheMaxSize);
 
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(10), config.ShortLivedCacheTransactionDuration);
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(100), config.ShortLivedCacheBlockDuration);
@@ -134,13 +139,21 @@ namespace catapult { namespace config {
 
 			EXPECT_TRUE(config.ShouldAbortWhenDispatcherIsFull);
 			EXPECT_TRUE(config.ShouldAuditDispatcherInputs);
+			EXPECT_FALSE(config.ShouldBatchVerifySignatures);
 
 			EXPECT_EQ(ionet::ConnectionSecurityMode::None, config.OutgoingSecurityMode);
 			EXPECT_EQ(ionet::ConnectionSecurityMode::None, config.IncomingSecurityModes);
 
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.MaxCacheDatabaseWriteBatchSize);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(256), config.CacheDatabaseBlockCacheSize);
+			EXPECT_EQ(10u, config.CacheDatabaseBloomFilterBitsPerKey);
+			EXPECT_EQ(utils::CompressionMode::Default, config.CacheDatabaseCompressionMode);
+			EXPECT_TRUE(config.ShouldSyncCacheDatabaseWrites);
 			EXPECT_EQ(5'000u, config.MaxTrackedNodes);
 
+			EXPECT_EQ(50u, config.TransactionBatchSize);
+			EXPECT_EQ(0u, config.UnconfirmedTransactionsSketchCells);
+
 			EXPECT_EQ("", config.Local.Host);
 			EXPECT_EQ("", config.Local.FriendlyName);
 			EXPECT_EQ(0u, config.Local.Version);
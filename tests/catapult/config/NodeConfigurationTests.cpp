@@ -37,14 +37,19 @@ namespace catapult { namespace config {
 							{ "dbrbPort", "4321" },
 							{ "shouldAllowAddressReuse", "true" },
 							{ "shouldUseSingleThreadPool", "true" },
+							{ "shouldUseShardedThreadPool", "true" },
+							{ "shouldPinThreadPoolThreads", "true" },
 							{ "shouldUseCacheDatabaseStorage", "true" },
 							{ "shouldEnableAutoSyncCleanup", "true" },
+							{ "shouldCompressStateChanges", "true" },
+							{ "maxStateFileThreads", "6" },
 
 							{ "shouldEnableTransactionSpamThrottling", "true" },
 							{ "transactionSpamThrottlingMaxBoostFee", "54'123" },
 
 							{ "maxBlocksPerSyncAttempt", "50" },
 							{ "maxChainBytesPerSyncAttempt", "2MB" },
+							{ "blockStorageCacheMaxSize", "3MB" },
 
 							{ "shortLivedCacheTransactionDuration", "17h" },
 							{ "shortLivedCacheBlockDuration", "23m" },
@@ -73,14 +78,20 @@ namespace catapult { namespace config {
 
 							{ "shouldAbortWhenDispatcherIsFull", "true" },
 							{ "shouldAuditDispatcherInputs", "true" },
+							{ "shouldBatchVerifySignatures", "true" },
 
 							{ "outgoingSecurityMode", "Signed" },
 							{ "incomingSecurityModes", "None, Signed" },
 
 							{ "maxCacheDatabaseWriteBatchSize", "17KB" },
+							{ "cacheDatabaseBlockCacheSize", "12MB" },
+							{ "cacheDatabaseBloomFilterBitsPerKey", "7" },
+							{ "cacheDatabaseCompressionMode", "lz4" },
+							{ "shouldSyncCacheDatabaseWrites", "false" },
 							{ "maxTrackedNodes", "222" },
 
 							{ "transactionBatchSize", "50" },
+							{ "unconfirmedTransactionsSketchCells", "360" },
 						}
 					},
 					{
@@ -133,14 +144,19 @@ namespace catapult { namespace config {
 				EXPECT_EQ(0u, config.DbrbPort);
 				EXPECT_FALSE(config.ShouldAllowAddressReuse);
 				EXPECT_FALSE(config.ShouldUseSingleThreadPool);
+				EXPECT_FALSE(config.ShouldUseShardedThreadPool);
+				EXPECT_FALSE(config.ShouldPinThreadPoolThreads);
 				EXPECT_FALSE(config.ShouldUseCacheDatabaseStorage);
 				EXPECT_FALSE(config.ShouldEnableAutoSyncCleanup);
+				EXPECT_FALSE(config.ShouldCompressStateChanges);
+				EXPECT_EQ(0u, config.MaxStateFileThreads);
 
 				EXPECT_FALSE(config.ShouldEnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(), config.TransactionSpamThrottlingMaxBoostFee);
 
 				EXPECT_EQ(0u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.BlockStorageCacheMaxSize);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheBlockDuration);
@@ -169,14 +185,20 @@ namespace catapult { namespace config {
 
 				EXPECT_FALSE(config.ShouldAbortWhenDispatcherIsFull);
 				EXPECT_FALSE(config.ShouldAuditDispatcherInputs);
+				EXPECT_FALSE(config.ShouldBatchVerifySignatures);
 
 				EXPECT_EQ(static_cast<ionet::ConnectionSecurityMode>(0), config.OutgoingSecurityMode);
 				EXPECT_EQ(static_cast<ionet::ConnectionSecurityMode>(0), config.IncomingSecurityModes);
 
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxCacheDatabaseWriteBatchSize);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabaseBlockCacheSize);
+				EXPECT_EQ(0u, config.CacheDatabaseBloomFilterBitsPerKey);
+				EXPECT_EQ(utils::CompressionMode::Default, config.CacheDatabaseCompressionMode);
+				EXPECT_FALSE(config.ShouldSyncCacheDatabaseWrites);
 				EXPECT_EQ(0u, config.MaxTrackedNodes);
 
 				EXPECT_EQ(0u, config.TransactionBatchSize);
+				EXPECT_EQ(0u, config.UnconfirmedTransactionsSketchCells);
 
 				EXPECT_EQ("", config.Local.Host);
 				EXPECT_EQ("", config.Local.FriendlyName);
@@ -202,14 +224,19 @@ namespace catapult { namespace config {
 				EXPECT_EQ(4321u, config.DbrbPort);
 				EXPECT_TRUE(config.ShouldAllowAddressReuse);
 				EXPECT_TRUE(config.ShouldUseSingleThreadPool);
+				EXPECT_TRUE(config.ShouldUseShardedThreadPool);
+				EXPECT_TRUE(config.ShouldPinThreadPoolThreads);
 				EXPECT_TRUE(config.ShouldUseCacheDatabaseStorage);
 				EXPECT_TRUE(config.ShouldEnableAutoSyncCleanup);
+				EXPECT_TRUE(config.ShouldCompressStateChanges);
+				EXPECT_EQ(6u, config.MaxStateFileThreads);
 
 				EXPECT_TRUE(config.ShouldEnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(54'123), config.TransactionSpamThrottlingMaxBoostFee);
 
 				EXPECT_EQ(50u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(2), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(3), config.BlockStorageCacheMaxSize);
 
 				EXPECT_EQ(utils::TimeSpan::FromHours(17), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(23), config.ShortLivedCacheBlockDuration);
@@ -238,14 +265,20 @@ namespace catapult { namespace config {
 
 				EXPECT_TRUE(config.ShouldAbortWhenDispatcherIsFull);
 				EXPECT_TRUE(config.ShouldAuditDispatcherInputs);
+				EXPECT_TRUE(config.ShouldBatchVerifySignatures);
 
 				EXPECT_EQ(ionet::ConnectionSecurityMode::Signed, config.OutgoingSecurityMode);
 				EXPECT_EQ(ionet::ConnectionSecurityMode::None | ionet::ConnectionSecurityMode::Signed, config.IncomingSecurityModes);
 
 				EXPECT_EQ(utils::FileSize::FromKilobytes(17), config.MaxCacheDatabaseWriteBatchSize);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(12), config.CacheDatabaseBlockCacheSize);
+				EXPECT_EQ(7u, config.CacheDatabaseBloomFilterBitsPerKey);
+				EXPECT_EQ(utils::CompressionMode::Lz4, config.CacheDatabaseCompressionMode);
+				EXPECT_FALSE(config.ShouldSyncCacheDatabaseWrites);
 				EXPECT_EQ(222u, config.MaxTrackedNodes);
 
 				EXPECT_EQ(50u, config.TransactionBatchSize);
+				EXPECT_EQ(360u, config.UnconfirmedTransactionsSketchCells);
 
 				EXPECT_EQ("alice.com", config.Local.Host);
 				EXPECT_EQ("a GREAT node", config.Local.FriendlyName);
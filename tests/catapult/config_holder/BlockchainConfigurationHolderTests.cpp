@@ -163,6 +163,63 @@ namespace catapult { namespace config {
 		EXPECT_THROW(testee.Config(Height{777}), catapult_invalid_argument);
 	}
 
+	namespace {
+		auto CreateNetworkConfiguration(uint32_t importanceGrouping) {
+			test::MutableBlockchainConfiguration config;
+			config.Network.ImportanceGrouping = importanceGrouping;
+			return config.Network;
+		}
+
+		auto CreateBlockchainConfiguration(uint32_t importanceGrouping) {
+			test::MutableBlockchainConfiguration config;
+			config.Network.ImportanceGrouping = importanceGrouping;
+			return config.ToConst();
+		}
+	}
+
+	TEST(TEST_CLASS, ConfigReturnsLastConfigAtOrBelowHeight) {
+		// Arrange:
+		BlockchainConfigurationHolder testee(CreateBlockchainConfiguration(1));
+		testee.InsertConfig(Height{10}, CreateNetworkConfiguration(10), SupportedEntityVersions());
+		testee.InsertConfig(Height{20}, CreateNetworkConfiguration(20), SupportedEntityVersions());
+
+		// Act + Assert:
+		EXPECT_EQ(1u, testee.Config(Height{0}).Network.ImportanceGrouping);
+		EXPECT_EQ(1u, testee.Config(Height{9}).Network.ImportanceGrouping);
+		EXPECT_EQ(10u, testee.Config(Height{10}).Network.ImportanceGrouping);
+		EXPECT_EQ(10u, testee.Config(Height{19}).Network.ImportanceGrouping);
+		EXPECT_EQ(20u, testee.Config(Height{20}).Network.ImportanceGrouping);
+		EXPECT_EQ(20u, testee.Config(Height{777}).Network.ImportanceGrouping);
+	}
+
+	TEST(TEST_CLASS, ConfigReflectsInsertedAndRemovedConfigs) {
+		// Arrange: resolve config at height before modifications
+		BlockchainConfigurationHolder testee(CreateBlockchainConfiguration(1));
+		EXPECT_EQ(1u, testee.Config(Height{15}).Network.ImportanceGrouping);
+
+		// Act + Assert:
+		testee.InsertConfig(Height{10}, CreateNetworkConfiguration(10), SupportedEntityVersions());
+		EXPECT_EQ(10u, testee.Config(Height{15}).Network.ImportanceGrouping);
+
+		testee.InsertConfig(Height{10}, CreateNetworkConfiguration(11), SupportedEntityVersions());
+		EXPECT_EQ(11u, testee.Config(Height{15}).Network.ImportanceGrouping);
+
+		testee.RemoveConfig(Height{10});
+		EXPECT_EQ(1u, testee.Config(Height{15}).Network.ImportanceGrouping);
+	}
+
+	TEST(TEST_CLASS, ConfigDoesNotMixUpHolders) {
+		// Arrange:
+		BlockchainConfigurationHolder testee1(CreateBlockchainConfiguration(1));
+		BlockchainConfigurationHolder testee2(CreateBlockchainConfiguration(2));
+
+		// Act + Assert: alternate lookups at same height
+		for (auto i = 0u; i < 3; ++i) {
+			EXPECT_EQ(1u, testee1.Config(Height{777}).Network.ImportanceGrouping);
+			EXPECT_EQ(2u, testee2.Config(Height{777}).Network.ImportanceGrouping);
+		}
+	}
+
 	// endregion
 
 	// region Config()
@@ -315,6 +372,57 @@ namespace catapult { namespace config {
 	// endregion
 
 	// region thread safety
+
+	TEST(TEST_CLASS, ConfigCanBeResolvedWhileConfigsAreInserted) {
+		// Arrange:
+		constexpr auto Num_Readers = 4u;
+		constexpr auto Num_Configs = 100u;
+		BlockchainConfigurationHolder testee(CreateBlockchainConfiguration(0));
+
+		std::atomic_bool isDone(false);
+		std::atomic<uint32_t> numFailures(0);
+		boost::thread_group threads;
+		for (auto i = 0u; i < Num_Readers; ++i) {
+			threads.create_thread([&testee, &isDone, &numFailures] {
+				// configs are inserted at increasing heights, so a reader must never see an older config
+				uint64_t lastImportanceGrouping = 0;
+				while (!isDone) {
+					auto importanceGrouping = testee.Config(Height{1000}).Network.ImportanceGrouping;
+					if (importanceGrouping < lastImportanceGrouping)
+						++numFailures;
+
+					lastImportanceGrouping = importanceGrouping;
+				}
+			});
+		}
+
+		// Act:
+		for (auto i = 1u; i <= Num_Configs; ++i)
+			testee.InsertConfig(Height{i}, CreateNetworkConfiguration(i), SupportedEntityVersions());
+
+		isDone = true;
+		threads.join_all();
+
+		// Assert:
+		EXPECT_EQ(0u, numFailures);
+		EXPECT_EQ(Num_Configs, testee.Config(Height{1000}).Network.ImportanceGrouping);
+	}
+
+	TEST(TEST_CLASS, ResolvedConfigOutlivesItsRemoval) {
+		// Arrange:
+		BlockchainConfigurationHolder testee(CreateBlockchainConfiguration(1));
+		testee.InsertConfig(Height{10}, CreateNetworkConfiguration(10), SupportedEntityVersions());
+		const auto& config = testee.Config(Height{15});
+
+		// Act: replace and remove the resolved config
+		testee.InsertConfig(Height{10}, CreateNetworkConfiguration(11), SupportedEntityVersions());
+		testee.RemoveConfig(Height{10});
+
+		// Assert: the config is still owned by the snapshot cached by this thread
+		EXPECT_EQ(10u, config.Network.ImportanceGrouping);
+		EXPECT_EQ(1u, testee.Config(Height{15}).Network.ImportanceGrouping);
+	}
+
 	// endregion
 
 	// region total chain currency validation
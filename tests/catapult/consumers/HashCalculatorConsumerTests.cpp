@@ -26,6 +26,7 @@
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockTransactionPluginWithCustomBuffers.h"
 #include "tests/test/nodeps/TestConstants.h"
 
@@ -428,4 +429,57 @@ namespace catapult { namespace consumers {
 	}
 
 	// endregion
+
+	// region parallel hash calculation
+
+	TEST(BLOCK_TEST_CLASS, CanProcessMultipleEntitiesWithTransactionsInParallel) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		auto registry = CustomBuffersTraits::CreateTransactionRegistry();
+		auto input = CreateBlockConsumerInput(registry, 3, 20);
+		auto& blockElements = input.blocks();
+
+		// Act:
+		auto result = CreateBlockHashCalculatorConsumer(GetNetworkGenerationHash(), registry, std::move(pPool))(blockElements);
+
+		// Assert:
+		test::AssertContinued(result);
+		EXPECT_EQ(3u, blockElements.size());
+		for (const auto& blockElement : blockElements)
+			AssertCorrectHashes(blockElement, 20);
+	}
+
+	TEST(BLOCK_TEST_CLASS, MultipleEntitiesAreSkippedWhenAnyBlockTransactionsHashDoesNotMatchInParallel) {
+		// Arrange: corrupt the block transactions hash
+		auto pPool = test::CreateStartedIoThreadPool();
+		auto registry = mocks::CreateDefaultTransactionRegistry();
+		auto input = CreateBlockConsumerInput(3, 20);
+		auto& blockElements = input.blocks();
+		const_cast<model::Block&>(blockElements[1].Block).BlockTransactionsHash[0] ^= 0xFF;
+
+		// Act:
+		auto result = CreateBlockHashCalculatorConsumer(GetNetworkGenerationHash(), registry, std::move(pPool))(blockElements);
+
+		// Assert:
+		test::AssertAborted(result, Failure_Consumer_Block_Transactions_Hash_Mismatch);
+	}
+
+	TEST(TRANSACTION_TEST_CLASS, CanProcessMultipleEntitiesInParallel) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		auto registry = CustomBuffersTraits::CreateTransactionRegistry();
+		auto input = CreateTransactionConsumerInput(50);
+		auto& transactionElements = input.transactions();
+
+		// Act:
+		auto result = CreateTransactionHashCalculatorConsumer(GetNetworkGenerationHash(), registry, std::move(pPool))(transactionElements);
+
+		// Assert:
+		test::AssertContinued(result);
+		EXPECT_EQ(50u, transactionElements.size());
+		for (const auto& transactionElement : transactionElements)
+			AssertCorrectHash(transactionElement);
+	}
+
+	// endregion
 }}
@@ -0,0 +1,325 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "catapult/consumers/BlockConsumers.h"
+#include "catapult/consumers/InputUtils.h"
+#include "catapult/consumers/TransactionConsumers.h"
+#include "catapult/crypto/VerifiedSignatureCache.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/utils/HexParser.h"
+#include "tests/catapult/consumers/test/ConsumerTestUtils.h"
+#include "tests/test/core/AddressTestUtils.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/core/TransactionTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace consumers {
+
+#define BLOCK_TEST_CLASS BlockSignatureVerificationConsumerTests
+#define TRANSACTION_TEST_CLASS TransactionSignatureVerificationConsumerTests
+
+	namespace {
+		using ReplayProtectionMode = model::SignatureNotification<1>::ReplayProtectionMode;
+
+		// publishes a single signature notification for each entity signing the entity hash
+		class MockSignatureNotificationPublisher : public model::NotificationPublisher {
+		public:
+			explicit MockSignatureNotificationPublisher(ReplayProtectionMode mode) : m_mode(mode)
+			{}
+
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& sub) const override {
+				const auto& entity = entityInfo.entity();
+				sub.notify(model::SignatureNotification<1>(entity.Signer, entity.Signature, entityInfo.hash(), m_mode));
+			}
+
+		private:
+			ReplayProtectionMode m_mode;
+		};
+
+		struct TestContext {
+		public:
+			explicit TestContext(ReplayProtectionMode mode)
+					: Mode(mode)
+					, GenerationHash(test::GenerateRandomByteArray<catapult::GenerationHash>())
+					, pPublisher(std::make_shared<MockSignatureNotificationPublisher>(mode))
+					, pPool(test::CreateStartedIoThreadPool(4))
+					, pVerifiedSignatureCache(std::make_shared<crypto::VerifiedSignatureCache>(1000))
+			{}
+
+		public:
+			void signAll(const model::WeakEntityInfos& entityInfos) const {
+				for (const auto& entityInfo : entityInfos) {
+					auto keyPair = test::GenerateKeyPair();
+					auto& entity = const_cast<model::VerifiableEntity&>(entityInfo.entity());
+					entity.Signer = keyPair.publicKey();
+					if (ReplayProtectionMode::Enabled == Mode)
+						crypto::Sign(keyPair, { GenerationHash, entityInfo.hash() }, entity.Signature);
+					else
+						crypto::Sign(keyPair, entityInfo.hash(), entity.Signature);
+				}
+			}
+
+			bool removeVerified(const model::WeakEntityInfo& entityInfo) const {
+				const auto& entity = entityInfo.entity();
+				std::vector<RawBuffer> buffers;
+				if (ReplayProtectionMode::Enabled == Mode)
+					buffers.push_back(GenerationHash);
+
+				buffers.push_back(entityInfo.hash());
+				return pVerifiedSignatureCache->remove({ entity.Signer, buffers, entity.Signature });
+			}
+
+		public:
+			ReplayProtectionMode Mode;
+			catapult::GenerationHash GenerationHash;
+			std::shared_ptr<const model::NotificationPublisher> pPublisher;
+			std::shared_ptr<thread::IoThreadPool> pPool;
+			std::shared_ptr<crypto::VerifiedSignatureCache> pVerifiedSignatureCache;
+		};
+
+		model::WeakEntityInfos ExtractAllEntityInfos(const TransactionElements& elements) {
+			model::WeakEntityInfos entityInfos;
+			std::vector<size_t> entityInfoElementIndexes;
+			ExtractEntityInfos(elements, entityInfos, entityInfoElementIndexes, config::HEIGHT_OF_LATEST_CONFIG);
+			return entityInfos;
+		}
+	}
+
+#define ALL_REPLAY_PROTECTION_MODES_TEST(TEST_CLASS, TEST_NAME) \
+	template<ReplayProtectionMode Mode> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_ReplayProtectionEnabled) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ReplayProtectionMode::Enabled>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_ReplayProtectionDisabled) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ReplayProtectionMode::Disabled>(); } \
+	template<ReplayProtectionMode Mode> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	// region block
+
+	namespace {
+		auto CreateBlockConsumer(const TestContext& context, const RequiresValidationPredicate& requiresValidationPredicate) {
+			return CreateBlockSignatureVerificationConsumer(
+					context.GenerationHash,
+					context.pPublisher,
+					context.pPool,
+					context.pVerifiedSignatureCache,
+					requiresValidationPredicate);
+		}
+	}
+
+	TEST(BLOCK_TEST_CLASS, CanProcessZeroEntities) {
+		// Arrange:
+		TestContext context(ReplayProtectionMode::Disabled);
+		auto consumer = CreateBlockConsumer(context, [](auto, auto, const auto&) { return true; });
+
+		// Assert:
+		test::AssertPassthroughForEmptyInput(consumer);
+	}
+
+	ALL_REPLAY_PROTECTION_MODES_TEST(BLOCK_TEST_CLASS, AddsAllValidSignaturesToCache) {
+		// Arrange:
+		TestContext context(Mode);
+		auto consumer = CreateBlockConsumer(context, [](auto, auto, const auto&) { return true; });
+		auto pBlock = test::GenerateBlockWithTransactions(50, Height(246));
+		auto elements = test::CreateBlockElements({ pBlock.get() });
+
+		model::WeakEntityInfos entityInfos;
+		model::ExtractMatchingEntityInfos(elements, entityInfos, [](auto, auto, const auto&) { return true; });
+		context.signAll(entityInfos);
+
+		// Act:
+		auto result = consumer(elements);
+
+		// Assert:
+		test::AssertContinued(result);
+		EXPECT_EQ(entityInfos.size(), context.pVerifiedSignatureCache->size());
+		for (const auto& entityInfo : entityInfos)
+			EXPECT_TRUE(context.removeVerified(entityInfo));
+	}
+
+	TEST(BLOCK_TEST_CLASS, OnlyVerifiesSignaturesOfEntitiesRequiringValidation) {
+		// Arrange: only verify block signatures
+		TestContext context(ReplayProtectionMode::Disabled);
+		auto consumer = CreateBlockConsumer(context, [](auto entityType, auto, const auto&) {
+			return model::BasicEntityType::Block == entityType;
+		});
+		auto pBlock = test::GenerateBlockWithTransactions(5, Height(246));
+		auto elements = test::CreateBlockElements({ pBlock.get() });
+
+		model::WeakEntityInfos entityInfos;
+		model::ExtractMatchingEntityInfos(elements, entityInfos, [](auto, auto, const auto&) { return true; });
+		context.signAll(entityInfos);
+
+		// Act:
+		auto result = consumer(elements);
+
+		// Assert: the block is extracted after its transactions
+		test::AssertContinued(result);
+		EXPECT_EQ(1u, context.pVerifiedSignatureCache->size());
+		EXPECT_TRUE(context.removeVerified(entityInfos.back()));
+	}
+
+	// endregion
+
+	// region transaction
+
+	namespace {
+		auto CreateTransactionConsumer(const TestContext& context) {
+			return CreateTransactionSignatureVerificationConsumer(
+					context.GenerationHash,
+					context.pPublisher,
+					context.pPool,
+					context.pVerifiedSignatureCache);
+		}
+	}
+
+	TEST(TRANSACTION_TEST_CLASS, CanProcessZeroEntities) {
+		// Arrange:
+		TestContext context(ReplayProtectionMode::Disabled);
+
+		// Assert:
+		test::AssertPassthroughForEmptyInput(CreateTransactionConsumer(context));
+	}
+
+	ALL_REPLAY_PROTECTION_MODES_TEST(TRANSACTION_TEST_CLASS, AddsAllValidSignaturesToCache) {
+		// Arrange:
+		TestContext context(Mode);
+		auto consumer = CreateTransactionConsumer(context);
+		auto elements = test::CreateTransactionElements(100);
+		auto entityInfos = ExtractAllEntityInfos(elements);
+		context.signAll(entityInfos);
+
+		// Act:
+		auto result = consumer(elements);
+
+		// Assert:
+		test::AssertContinued(result);
+		EXPECT_EQ(100u, context.pVerifiedSignatureCache->size());
+		for (const auto& entityInfo : entityInfos)
+			EXPECT_TRUE(context.removeVerified(entityInfo));
+	}
+
+	ALL_REPLAY_PROTECTION_MODES_TEST(TRANSACTION_TEST_CLASS, DoesNotAddInvalidSignaturesToCache) {
+		// Arrange: invalidate every third signature
+		TestContext context(Mode);
+		auto consumer = CreateTransactionConsumer(context);
+		auto elements = test::CreateTransactionElements(100);
+		auto entityInfos = ExtractAllEntityInfos(elements);
+		context.signAll(entityInfos);
+		for (auto i = 0u; i < entityInfos.size(); i += 3)
+			const_cast<model::VerifiableEntity&>(entityInfos[i].entity()).Signature[0] ^= 0xFF;
+
+		// Act:
+		auto result = consumer(elements);
+
+		// Assert: invalid transactions are not skipped
+		test::AssertContinued(result);
+		EXPECT_EQ(66u, context.pVerifiedSignatureCache->size());
+		for (auto i = 0u; i < entityInfos.size(); ++i) {
+			EXPECT_EQ(0 != i % 3, context.removeVerified(entityInfos[i])) << "entity at " << i;
+			EXPECT_EQ(disruptor::ConsumerResultSeverity::Success, elements[i].ResultSeverity) << "entity at " << i;
+		}
+	}
+
+	// endregion
+
+	// region torsion
+
+	namespace {
+		struct TorsionTestVector {
+			const char* PublicKey;
+			const char* Payload;
+			const char* Signature;
+			bool IsVerified;
+			bool IsMultiVerified;
+		};
+
+		std::vector<TorsionTestVector> GetTorsionTestVectors() {
+			// signatures with small order (torsion) components in the public key and / or R part (see SignerTests),
+			// which are accepted by VerifyMulti unless the public key has small order
+#ifdef SIGNATURE_SCHEME_NIS1
+			return {
+				{ "6B0AE55C87EF0A93E1C5FBB97A1F557C9D25003DF04D3BC7F381C727EDE1FBC6", "torsion 6", "3C32B5AA2C0F09F1C70DD8B39F5C6ABADDC210A87D1ACFA49909C769020DE23ED2C20EB940681BB674EB63867AF937FA5FF88FA4DC7B300D2AF03B88DF836802", true, true },
+				{ "6B0AE55C87EF0A93E1C5FBB97A1F557C9D25003DF04D3BC7F381C727EDE1FBC6", "torsion 7", "2653731782616C6FE50EAC0B9323B8005E30D7959E7353C64ACE7212229864BB54726EA7D6E4F05568A2DA66F3DE2B1A1A02312908F85A1432DF656FBB1E4E03", false, true },
+				{ "1E82A29F0F7F62AA6F33D6967AF79CC82BFD0A3F338F706544CF5A6A1C527ED2", "torsion 8", "9EB597C5967202E50092FC62269CD849851A797F1388160AE3DCBE8CD5C76ACC94F00AF9130306AD37388285399F186CE1BFA6AEF9D39AE0F653ECBF3B5BCA08", false, true },
+				{ "6B0AE55C87EF0A93E1C5FBB97A1F557C9D25003DF04D3BC7F381C727EDE1FBC6", "torsion 9", "14EC32615A15D5899D61C710178B6431A8266F6AE6FDC186BFCEC1189FC5612B4464603E8EBA8112A65D3EC29A672487D14BB1ADFEBEF1FF604A36267B3B5A02", true, true },
+				{ "C7176A703D4DD84FBA3C0B760D10670F2A2053FA2C39CCC64EC7FD7792AC037A", "torsion 17", "6FA2680916F0755085316093E5CB8E7C0B5753875D4428B5F9B5730963EC59DF14A58A06BB922A81ECB3AD21B9FE2A1856F63D1C98F9E91B8EF989D903E4C905", true, false },
+				{ "1E82A29F0F7F62AA6F33D6967AF79CC82BFD0A3F338F706544CF5A6A1C527ED2", "torsion 22", "C7176A703D4DD84FBA3C0B760D10670F2A2053FA2C39CCC64EC7FD7792AC037ACAC8112C02F18CF5C87F1E43A93AD377A3331516AECF975BADD1CBB81BDCA40C", false, true }
+			};
+#else
+			return {
+				{ "5E097F521DB803CE78D49EA4E55F1B24636A290716CD01EEA8E74C1491392740", "torsion 2", "25C05FC2E8EA6D373A122C34C4FC211FF3CDE4DD81516D657CBF2A6C2C4005FE9952DBB34F71190AA90EDC8647AD663BD54330899C5335C2969DEFED1725090B", true, true },
+				{ "5E097F521DB803CE78D49EA4E55F1B24636A290716CD01EEA8E74C1491392740", "torsion 3", "8C8A796F605A5E44125368AC33E639E9EDF9BE68C92855CAFC46482458A9FE749233B5298E4FD61486D69F706BA1C67DC0269A3841EA08E34CBD362DFCB1830A", false, true },
+				{ "CC171724C67AD5D0E3438529CB9A703AFA35EE04ECB5A9A6E377AE5BD40A3EAC", "torsion 4", "1A18F9743C6D9F5BD7881DA0E23FB9454D262ADCB9D8C5D964F1DF2EC4719AFA856344D28B39341340542ADB7237BD00C86701819646B008680724042137A00A", false, true },
+				{ "5E097F521DB803CE78D49EA4E55F1B24636A290716CD01EEA8E74C1491392740", "torsion 5", "B83F54CEA91CAD80035ED9250CB905351E27691165A7384D9D58BF79147C0227CCFF25D401BF67F181F99EF350E13302AE6649BE9C3AFE5780A2206F0194E400", true, true },
+				{ "C7176A703D4DD84FBA3C0B760D10670F2A2053FA2C39CCC64EC7FD7792AC037A", "torsion 7", "A08B9FD81F42C894E5A87E727CCC008AD2B968DC80B1167758EC4F4F3E07337724E3469F784E7D5D370A042FAF6E98C287FA3B1D73DEAF9076970C10A9A0D605", true, false },
+				{ "CC171724C67AD5D0E3438529CB9A703AFA35EE04ECB5A9A6E377AE5BD40A3EAC", "torsion 12", "C7176A703D4DD84FBA3C0B760D10670F2A2053FA2C39CCC64EC7FD7792AC037AE64A459529F358F082D375900736C9F27B412C2065E085D86EA62F16A6246F04", false, true }
+			};
+#endif
+		}
+
+		// publishes a single signature notification for each entity signing the payload of the torsion test vector
+		// that the entity was signed with
+		class MockTorsionSignatureNotificationPublisher : public model::NotificationPublisher {
+		public:
+			explicit MockTorsionSignatureNotificationPublisher(const std::vector<TorsionTestVector>& testVectors)
+					: m_testVectors(testVectors)
+			{}
+
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& sub) const override {
+				const auto& entity = entityInfo.entity();
+				for (const auto& testVector : m_testVectors) {
+					if (entity.Signature != utils::ParseByteArray<Signature>(testVector.Signature))
+						continue;
+
+					auto payload = RawBuffer{ reinterpret_cast<const uint8_t*>(testVector.Payload), strlen(testVector.Payload) };
+					sub.notify(model::SignatureNotification<1>(entity.Signer, entity.Signature, payload, ReplayProtectionMode::Disabled));
+				}
+			}
+
+		private:
+			std::vector<TorsionTestVector> m_testVectors;
+		};
+	}
+
+	TEST(TRANSACTION_TEST_CLASS, OnlyAddsSignaturesWithTorsionComponentsToCacheWhenAcceptedByVerifyMulti) {
+		// Arrange: sign each transaction with a torsion test vector
+		auto testVectors = GetTorsionTestVectors();
+		auto elements = test::CreateTransactionElements(testVectors.size());
+		auto entityInfos = ExtractAllEntityInfos(elements);
+		for (auto i = 0u; i < entityInfos.size(); ++i) {
+			auto& entity = const_cast<model::VerifiableEntity&>(entityInfos[i].entity());
+			entity.Signer = utils::ParseByteArray<Key>(testVectors[i].PublicKey);
+			entity.Signature = utils::ParseByteArray<Signature>(testVectors[i].Signature);
+		}
+
+		TestContext context(ReplayProtectionMode::Disabled);
+		context.pPublisher = std::make_shared<MockTorsionSignatureNotificationPublisher>(testVectors);
+		auto consumer = CreateTransactionConsumer(context);
+
+		// Act:
+		auto result = consumer(elements);
+
+		// Assert: the cache contains exactly the signatures accepted by (cofactored) VerifyMulti
+		test::AssertContinued(result);
+		for (auto i = 0u; i < testVectors.size(); ++i) {
+			const auto& entity = entityInfos[i].entity();
+			auto payload = RawBuffer{ reinterpret_cast<const uint8_t*>(testVectors[i].Payload), strlen(testVectors[i].Payload) };
+
+			// Sanity:
+			EXPECT_EQ(testVectors[i].IsVerified, crypto::Verify(entity.Signer, { payload }, entity.Signature)) << "vector at " << i;
+
+			EXPECT_EQ(testVectors[i].IsMultiVerified, context.pVerifiedSignatureCache->remove({ entity.Signer, { payload }, entity.Signature }))
+					<< "vector at " << i;
+		}
+
+		EXPECT_EQ(0u, context.pVerifiedSignatureCache->size());
+	}
+
+	// endregion
+}}
@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/crypto/Signer.h"
+#include "catapult/utils/HexParser.h"
 #include "tests/TestHarness.h"
 #include <type_traits>
 #include <numeric>
@@ -516,6 +517,338 @@ namespace catapult { namespace crypto {
 		}
 	}
 
+	// region VerifyMulti
+
+	namespace {
+		struct SignedPayloads {
+			std::vector<KeyPair> KeyPairs;
+			std::vector<Key> PublicKeys;
+			std::vector<std::vector<uint8_t>> Payloads;
+			std::vector<Signature> Signatures;
+		};
+
+		SignedPayloads GenerateSignedPayloads(size_t count) {
+			SignedPayloads signedPayloads;
+			for (auto i = 0u; i < count; ++i) {
+				signedPayloads.KeyPairs.push_back(KeyPair::FromPrivate(PrivateKey::Generate(test::RandomByte)));
+				signedPayloads.PublicKeys.push_back(signedPayloads.KeyPairs.back().publicKey());
+				signedPayloads.Payloads.push_back(test::GenerateRandomVector(100 + i));
+				signedPayloads.Signatures.push_back(KeyTraits::SignPayload(signedPayloads.KeyPairs.back(), signedPayloads.Payloads.back()));
+			}
+
+			return signedPayloads;
+		}
+
+		std::vector<SignatureInput> ToSignatureInputs(const SignedPayloads& signedPayloads) {
+			std::vector<SignatureInput> signatureInputs;
+			for (auto i = 0u; i < signedPayloads.Signatures.size(); ++i) {
+				signatureInputs.push_back({
+					signedPayloads.PublicKeys[i],
+					{ signedPayloads.Payloads[i] },
+					signedPayloads.Signatures[i]
+				});
+			}
+
+			return signatureInputs;
+		}
+
+		void CorruptSignedPayloads(SignedPayloads& signedPayloads, const std::vector<size_t>& indexes) {
+			// corrupt R part, S part, payload and public key in turn
+			for (auto i = 0u; i < indexes.size(); ++i) {
+				auto index = indexes[i];
+				switch (i % 4) {
+				case 0:
+					signedPayloads.Signatures[index][5] ^= 0xFF;
+					break;
+				case 1:
+					signedPayloads.Signatures[index][Signature_Size / 2 + 5] ^= 0x01;
+					break;
+				case 2:
+					signedPayloads.Payloads[index][0] ^= 0xFF;
+					break;
+				default:
+					signedPayloads.PublicKeys[index][3] ^= 0x01;
+					break;
+				}
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenInputIsEmpty) {
+		// Act:
+		auto result = VerifyMulti(SecureRandomFill, nullptr, 0);
+		auto shortCircuitResult = VerifyMultiShortCircuit(SecureRandomFill, nullptr, 0);
+
+		// Assert:
+		EXPECT_TRUE(result.first.empty());
+		EXPECT_TRUE(result.second);
+		EXPECT_TRUE(shortCircuitResult);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenAllSignaturesAreValid) {
+		// Arrange: use more signatures than fit in a single batch
+		auto signedPayloads = GenerateSignedPayloads(150);
+		auto signatureInputs = ToSignatureInputs(signedPayloads);
+
+		// Act:
+		auto result = VerifyMulti(SecureRandomFill, signatureInputs.data(), signatureInputs.size());
+		auto shortCircuitResult = VerifyMultiShortCircuit(SecureRandomFill, signatureInputs.data(), signatureInputs.size());
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(150, true), result.first);
+		EXPECT_TRUE(result.second);
+		EXPECT_TRUE(shortCircuitResult);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSupportsChunkedData) {
+		// Arrange:
+		auto keyPair = KeyPair::FromPrivate(PrivateKey::Generate(test::RandomByte));
+		auto payload = test::GenerateRandomVector(123);
+		auto signature = KeyTraits::SignPayload(keyPair, payload);
+		auto partSize = payload.size() / 3;
+		std::vector<SignatureInput> signatureInputs;
+		for (auto i = 0u; i < 3; ++i) {
+			signatureInputs.push_back({ keyPair.publicKey(), {
+				{ payload.data(), partSize },
+				{ payload.data() + partSize, payload.size() - partSize }
+			}, signature });
+		}
+
+		// Act:
+		auto result = VerifyMulti(SecureRandomFill, signatureInputs.data(), signatureInputs.size());
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(3, true), result.first);
+		EXPECT_TRUE(result.second);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiResultsMatchVerifyWhenSomeSignaturesAreInvalid) {
+		// Arrange:
+		auto signedPayloads = GenerateSignedPayloads(150);
+		CorruptSignedPayloads(signedPayloads, { 0, 17, 63, 64, 65, 101, 149 });
+		auto signatureInputs = ToSignatureInputs(signedPayloads);
+
+		// Act:
+		auto result = VerifyMulti(SecureRandomFill, signatureInputs.data(), signatureInputs.size());
+		auto shortCircuitResult = VerifyMultiShortCircuit(SecureRandomFill, signatureInputs.data(), signatureInputs.size());
+
+		// Assert:
+		ASSERT_EQ(150u, result.first.size());
+		for (auto i = 0u; i < signatureInputs.size(); ++i) {
+			auto isVerified = Verify(signedPayloads.PublicKeys[i], signedPayloads.Payloads[i], signedPayloads.Signatures[i]);
+			EXPECT_EQ(isVerified, result.first[i]) << "signature at " << i;
+		}
+
+		EXPECT_EQ(143, std::count(result.first.cbegin(), result.first.cend(), true));
+		EXPECT_FALSE(result.second);
+		EXPECT_FALSE(shortCircuitResult);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenAllSignaturesAreInvalid) {
+		// Arrange:
+		auto signedPayloads = GenerateSignedPayloads(10);
+		CorruptSignedPayloads(signedPayloads, { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 });
+		auto signatureInputs = ToSignatureInputs(signedPayloads);
+
+		// Act:
+		auto result = VerifyMulti(SecureRandomFill, signatureInputs.data(), signatureInputs.size());
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(10, false), result.first);
+		EXPECT_FALSE(result.second);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiRejectsNonCanonicalSignature) {
+		// Arrange:
+		auto signedPayloads = GenerateSignedPayloads(5);
+		ScalarAddGroupOrder<KeyTraits>(signedPayloads.Signatures[2].data() + Signature_Size / 2);
+		auto signatureInputs = ToSignatureInputs(signedPayloads);
+
+		// Act:
+		auto result = VerifyMulti(SecureRandomFill, signatureInputs.data(), signatureInputs.size());
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>({ true, true, false, true, true }), result.first);
+		EXPECT_FALSE(result.second);
+	}
+
+	namespace {
+		struct TorsionTestVector {
+			std::string PublicKey;
+			std::string Payload;
+			std::string Signature;
+			bool IsVerified;
+			bool IsMultiVerified;
+		};
+
+		std::vector<TorsionTestVector> GetTorsionTestVectors() {
+			// signatures with small order (torsion) components in the public key and / or R part, which
+			// are accepted by Verify if and only if the torsion components cancel out in the cofactorless equation
+			// and are accepted by VerifyMulti unless the public key has small order
+#ifdef SIGNATURE_SCHEME_NIS1
+			return {
+				// public key with torsion component
+				{ "6B0AE55C87EF0A93E1C5FBB97A1F557C9D25003DF04D3BC7F381C727EDE1FBC6", "torsion 6", "3C32B5AA2C0F09F1C70DD8B39F5C6ABADDC210A87D1ACFA49909C769020DE23ED2C20EB940681BB674EB63867AF937FA5FF88FA4DC7B300D2AF03B88DF836802", true, true },
+				{ "6B0AE55C87EF0A93E1C5FBB97A1F557C9D25003DF04D3BC7F381C727EDE1FBC6", "torsion 7", "2653731782616C6FE50EAC0B9323B8005E30D7959E7353C64ACE7212229864BB54726EA7D6E4F05568A2DA66F3DE2B1A1A02312908F85A1432DF656FBB1E4E03", false, true },
+				// R with torsion component
+				{ "1E82A29F0F7F62AA6F33D6967AF79CC82BFD0A3F338F706544CF5A6A1C527ED2", "torsion 8", "9EB597C5967202E50092FC62269CD849851A797F1388160AE3DCBE8CD5C76ACC94F00AF9130306AD37388285399F186CE1BFA6AEF9D39AE0F653ECBF3B5BCA08", false, true },
+				// public key and R with torsion components
+				{ "6B0AE55C87EF0A93E1C5FBB97A1F557C9D25003DF04D3BC7F381C727EDE1FBC6", "torsion 9", "14EC32615A15D5899D61C710178B6431A8266F6AE6FDC186BFCEC1189FC5612B4464603E8EBA8112A65D3EC29A672487D14BB1ADFEBEF1FF604A36267B3B5A02", true, true },
+				// small order public key
+				{ "C7176A703D4DD84FBA3C0B760D10670F2A2053FA2C39CCC64EC7FD7792AC037A", "torsion 17", "6FA2680916F0755085316093E5CB8E7C0B5753875D4428B5F9B5730963EC59DF14A58A06BB922A81ECB3AD21B9FE2A1856F63D1C98F9E91B8EF989D903E4C905", true, false },
+				{ "C7176A703D4DD84FBA3C0B760D10670F2A2053FA2C39CCC64EC7FD7792AC037A", "torsion 18", "E751D35829158D6E6D1B105DA581A5C32CF7BE933345E5BCA3345C4B8621F8C00354D1B8DD3C7551AC0985C7ECB05EF3C715F740C221EB6D5777DF0085F22404", false, false },
+				// small order R
+				{ "6B0AE55C87EF0A93E1C5FBB97A1F557C9D25003DF04D3BC7F381C727EDE1FBC6", "torsion 21", "26E8958FC2B227B045C3F489F2EF98F0D5DFAC05D3C63339B13802886D53FC0544A7EB08F870F81EF6B60EC9DCA89A50B00482CB9C0C6A5F2F0AAAFFABC15C02", true, true },
+				{ "1E82A29F0F7F62AA6F33D6967AF79CC82BFD0A3F338F706544CF5A6A1C527ED2", "torsion 22", "C7176A703D4DD84FBA3C0B760D10670F2A2053FA2C39CCC64EC7FD7792AC037ACAC8112C02F18CF5C87F1E43A93AD377A3331516AECF975BADD1CBB81BDCA40C", false, true }
+			};
+#else
+			return {
+				// public key with torsion component
+				{ "5E097F521DB803CE78D49EA4E55F1B24636A290716CD01EEA8E74C1491392740", "torsion 2", "25C05FC2E8EA6D373A122C34C4FC211FF3CDE4DD81516D657CBF2A6C2C4005FE9952DBB34F71190AA90EDC8647AD663BD54330899C5335C2969DEFED1725090B", true, true },
+				{ "5E097F521DB803CE78D49EA4E55F1B24636A290716CD01EEA8E74C1491392740", "torsion 3", "8C8A796F605A5E44125368AC33E639E9EDF9BE68C92855CAFC46482458A9FE749233B5298E4FD61486D69F706BA1C67DC0269A3841EA08E34CBD362DFCB1830A", false, true },
+				// R with torsion component
+				{ "CC171724C67AD5D0E3438529CB9A703AFA35EE04ECB5A9A6E377AE5BD40A3EAC", "torsion 4", "1A18F9743C6D9F5BD7881DA0E23FB9454D262ADCB9D8C5D964F1DF2EC4719AFA856344D28B39341340542ADB7237BD00C86701819646B008680724042137A00A", false, true },
+				// public key and R with torsion components
+				{ "5E097F521DB803CE78D49EA4E55F1B24636A290716CD01EEA8E74C1491392740", "torsion 5", "B83F54CEA91CAD80035ED9250CB905351E27691165A7384D9D58BF79147C0227CCFF25D401BF67F181F99EF350E13302AE6649BE9C3AFE5780A2206F0194E400", true, true },
+				// small order public key
+				{ "C7176A703D4DD84FBA3C0B760D10670F2A2053FA2C39CCC64EC7FD7792AC037A", "torsion 7", "A08B9FD81F42C894E5A87E727CCC008AD2B968DC80B1167758EC4F4F3E07337724E3469F784E7D5D370A042FAF6E98C287FA3B1D73DEAF9076970C10A9A0D605", true, false },
+				{ "C7176A703D4DD84FBA3C0B760D10670F2A2053FA2C39CCC64EC7FD7792AC037A", "torsion 8", "DF561C341904D78306F601DCB8F61B9391AF3C8C3994C445BD8196855D9573EF4B14952F6D4F92C77FDAFA7DDF7A918F8D7C70FA693FE359E57796E44700840E", false, false },
+				// small order R
+				{ "5E097F521DB803CE78D49EA4E55F1B24636A290716CD01EEA8E74C1491392740", "torsion 11", "26E8958FC2B227B045C3F489F2EF98F0D5DFAC05D3C63339B13802886D53FC057A893DC808D34EE44641FC8024525AF500F0A6572663D00564641ACBB6747E03", true, true },
+				{ "CC171724C67AD5D0E3438529CB9A703AFA35EE04ECB5A9A6E377AE5BD40A3EAC", "torsion 12", "C7176A703D4DD84FBA3C0B760D10670F2A2053FA2C39CCC64EC7FD7792AC037AE64A459529F358F082D375900736C9F27B412C2065E085D86EA62F16A6246F04", false, true }
+			};
+#endif
+		}
+
+		void AppendTorsionTestVectors(
+				SignedPayloads& signedPayloads,
+				std::vector<bool>& expectedVerifyResults,
+				std::vector<bool>& expectedVerifyMultiResults) {
+			for (const auto& testVector : GetTorsionTestVectors()) {
+				signedPayloads.PublicKeys.push_back(utils::ParseByteArray<Key>(testVector.PublicKey));
+				signedPayloads.Payloads.emplace_back(testVector.Payload.cbegin(), testVector.Payload.cend());
+				signedPayloads.Signatures.push_back(utils::ParseByteArray<Signature>(testVector.Signature));
+				expectedVerifyResults.push_back(testVector.IsVerified);
+				expectedVerifyMultiResults.push_back(testVector.IsMultiVerified);
+			}
+		}
+
+		// fills all coefficients with multiples of eight, which annihilate all torsion components even in a cofactorless batch
+		void TorsionAnnihilatingFill(uint8_t* pOut, size_t count) {
+			SecureRandomFill(pOut, count);
+			if (count > 0)
+				pOut[0] &= 0xF8;
+		}
+
+		struct TorsionTestPayloads {
+			SignedPayloads Payloads;
+			std::vector<bool> ExpectedVerifyResults;
+			std::vector<bool> ExpectedVerifyMultiResults;
+		};
+
+		TorsionTestPayloads GenerateTorsionTestPayloads() {
+			// interleave the test vectors with valid signatures
+			TorsionTestPayloads testPayloads;
+			testPayloads.Payloads = GenerateSignedPayloads(10);
+			testPayloads.ExpectedVerifyResults = std::vector<bool>(10, true);
+			testPayloads.ExpectedVerifyMultiResults = std::vector<bool>(10, true);
+			AppendTorsionTestVectors(testPayloads.Payloads, testPayloads.ExpectedVerifyResults, testPayloads.ExpectedVerifyMultiResults);
+
+			auto validSignedPayloads = GenerateSignedPayloads(10);
+			for (auto i = 0u; i < validSignedPayloads.Signatures.size(); ++i) {
+				testPayloads.Payloads.PublicKeys.push_back(validSignedPayloads.PublicKeys[i]);
+				testPayloads.Payloads.Payloads.push_back(validSignedPayloads.Payloads[i]);
+				testPayloads.Payloads.Signatures.push_back(validSignedPayloads.Signatures[i]);
+				testPayloads.ExpectedVerifyResults.push_back(true);
+				testPayloads.ExpectedVerifyMultiResults.push_back(true);
+			}
+
+			return testPayloads;
+		}
+
+		void AssertVerifyMultiResultsForTorsionTestVectors(const RandomFiller& randomFiller) {
+			// Arrange:
+			auto testPayloads = GenerateTorsionTestPayloads();
+			const auto& signedPayloads = testPayloads.Payloads;
+			auto signatureInputs = ToSignatureInputs(signedPayloads);
+
+			// Act:
+			auto result = VerifyMulti(randomFiller, signatureInputs.data(), signatureInputs.size());
+
+			// Assert: all test vectors without small order public keys satisfy the cofactored equation,
+			//         even the ones rejected by (cofactorless) Verify
+			ASSERT_EQ(signatureInputs.size(), result.first.size());
+			for (auto i = 0u; i < signatureInputs.size(); ++i) {
+				auto isVerified = Verify(signedPayloads.PublicKeys[i], signedPayloads.Payloads[i], signedPayloads.Signatures[i]);
+				EXPECT_EQ(testPayloads.ExpectedVerifyResults[i], isVerified) << "signature at " << i;
+				EXPECT_EQ(testPayloads.ExpectedVerifyMultiResults[i], result.first[i]) << "signature at " << i;
+			}
+
+			EXPECT_FALSE(result.second);
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiUsesCofactoredEquationForSignaturesWithTorsionComponents) {
+		AssertVerifyMultiResultsForTorsionTestVectors(SecureRandomFill);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiUsesCofactoredEquationForSignaturesWithTorsionComponentsWhenCoefficientsAreMultiplesOfEight) {
+		AssertVerifyMultiResultsForTorsionTestVectors(TorsionAnnihilatingFill);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiUsesCofactoredEquationForSingleSignaturesWithTorsionComponents) {
+		// Arrange:
+		auto testPayloads = GenerateTorsionTestPayloads();
+		auto signatureInputs = ToSignatureInputs(testPayloads.Payloads);
+
+		// Act + Assert: each signature is verified on its own
+		for (auto i = 0u; i < signatureInputs.size(); ++i) {
+			auto result = VerifyMulti(SecureRandomFill, &signatureInputs[i], 1);
+			EXPECT_EQ(std::vector<bool>({ testPayloads.ExpectedVerifyMultiResults[i] }), result.first) << "signature at " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiRejectsSingleSignatureWithTorsionComponentsWhenPayloadIsModified) {
+		// Arrange:
+		auto testPayloads = GenerateTorsionTestPayloads();
+		auto& payloads = testPayloads.Payloads.Payloads;
+		for (auto i = 10u; i < payloads.size() - 10; ++i)
+			payloads[i][0] ^= 0xFF;
+
+		auto signatureInputs = ToSignatureInputs(testPayloads.Payloads);
+
+		// Act + Assert:
+		for (auto i = 10u; i < signatureInputs.size() - 10; ++i) {
+			auto result = VerifyMulti(SecureRandomFill, &signatureInputs[i], 1);
+			EXPECT_EQ(std::vector<bool>({ false }), result.first) << "signature at " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiShortCircuitSucceedsWhenAllSignaturesWithTorsionComponentsSatisfyCofactoredEquation) {
+		// Arrange: remove test vectors with small order public keys
+		auto testPayloads = GenerateTorsionTestPayloads();
+		auto signatureInputs = ToSignatureInputs(testPayloads.Payloads);
+		std::vector<SignatureInput> filteredSignatureInputs;
+		for (auto i = 0u; i < signatureInputs.size(); ++i) {
+			if (testPayloads.ExpectedVerifyMultiResults[i])
+				filteredSignatureInputs.push_back(signatureInputs[i]);
+		}
+
+		// Act + Assert:
+		EXPECT_TRUE(VerifyMultiShortCircuit(TorsionAnnihilatingFill, filteredSignatureInputs.data(), filteredSignatureInputs.size()));
+	}
+
+	TEST(TEST_CLASS, VerifyMultiShortCircuitFailsWhenAnySignatureHasSmallOrderPublicKey) {
+		// Arrange:
+		auto testPayloads = GenerateTorsionTestPayloads();
+		auto signatureInputs = ToSignatureInputs(testPayloads.Payloads);
+
+		// Act + Assert:
+		EXPECT_FALSE(VerifyMultiShortCircuit(TorsionAnnihilatingFill, signatureInputs.data(), signatureInputs.size()));
+	}
+
+	// endregion
+
 	TEST(TEST_CLASS, AggregateVerify) {
 		// Arrange:
 		auto input = GetBLSTestVectorsInput();
@@ -573,4 +906,44 @@ namespace catapult { namespace crypto {
 
 		EXPECT_TRUE(FastAggregateVerify(p_keys, message, aggregatedSig));
 	}
+
+	// region ProvePossession / VerifyPossession
+
+	TEST(TEST_CLASS, CanVerifyProofOfPossession) {
+		// Arrange:
+		auto keyPair = BLSTraits::GetDefaultKeyPair();
+		BLSSignature proof;
+
+		// Act:
+		ProvePossession(keyPair, proof);
+
+		// Assert:
+		EXPECT_TRUE(VerifyPossession(keyPair.publicKey(), proof));
+	}
+
+	TEST(TEST_CLASS, CannotVerifyProofOfPossessionOfOtherKey) {
+		// Arrange:
+		auto keyPair = BLSTraits::GetDefaultKeyPair();
+		BLSSignature proof;
+		ProvePossession(keyPair, proof);
+
+		// Act + Assert:
+		EXPECT_FALSE(VerifyPossession(BLSTraits::GetAlteredKeyPair().publicKey(), proof));
+	}
+
+	TEST(TEST_CLASS, ProofOfPossessionAndSignatureOfPublicKeyAreNotInterchangeable) {
+		// Arrange: sign the public key, which is the message of the proof
+		auto keyPair = BLSTraits::GetDefaultKeyPair();
+		const auto& publicKey = keyPair.publicKey();
+		BLSSignature proof;
+		ProvePossession(keyPair, proof);
+		auto signature = BLSTraits::SignPayload(keyPair, publicKey);
+
+		// Act + Assert: proofs and signatures use different domain separation tags
+		EXPECT_NE(signature, proof);
+		EXPECT_FALSE(VerifyPossession(publicKey, signature));
+		EXPECT_FALSE(Verify(publicKey, publicKey, proof));
+	}
+
+	// endregion
 }}
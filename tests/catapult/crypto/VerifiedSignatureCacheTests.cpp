@@ -0,0 +1,129 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "catapult/crypto/VerifiedSignatureCache.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace crypto {
+
+#define TEST_CLASS VerifiedSignatureCacheTests
+
+	namespace {
+		struct SignatureData {
+		public:
+			SignatureData()
+					: PublicKey(test::GenerateRandomByteArray<Key>())
+					, Data(test::GenerateRandomVector(100))
+					, Signature(test::GenerateRandomByteArray<catapult::Signature>())
+			{}
+
+		public:
+			SignatureInput toInput() const {
+				return { PublicKey, { { Data.data(), 40 }, { Data.data() + 40, Data.size() - 40 } }, Signature };
+			}
+
+		public:
+			Key PublicKey;
+			std::vector<uint8_t> Data;
+			catapult::Signature Signature;
+		};
+	}
+
+	TEST(TEST_CLASS, CacheIsInitiallyEmpty) {
+		// Act:
+		VerifiedSignatureCache cache(10);
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+	}
+
+	TEST(TEST_CLASS, CanAddSignature) {
+		// Arrange:
+		VerifiedSignatureCache cache(10);
+		SignatureData data;
+
+		// Act:
+		cache.add(data.toInput());
+		cache.add(data.toInput());
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+	}
+
+	TEST(TEST_CLASS, RemoveConsumesKnownSignature) {
+		// Arrange:
+		VerifiedSignatureCache cache(10);
+		SignatureData data;
+		cache.add(data.toInput());
+
+		// Act:
+		auto isFirstRemoved = cache.remove(data.toInput());
+		auto isSecondRemoved = cache.remove(data.toInput());
+
+		// Assert:
+		EXPECT_TRUE(isFirstRemoved);
+		EXPECT_FALSE(isSecondRemoved);
+		EXPECT_EQ(0u, cache.size());
+	}
+
+	TEST(TEST_CLASS, RemoveIgnoresSignatureWithDifferentData) {
+		// Arrange:
+		VerifiedSignatureCache cache(10);
+		SignatureData data;
+		cache.add(data.toInput());
+
+		// Act: modify each component of the signature input
+		auto data1 = data;
+		data1.PublicKey[0] ^= 0xFF;
+		auto data2 = data;
+		data2.Data[0] ^= 0xFF;
+		auto data3 = data;
+		data3.Signature[0] ^= 0xFF;
+
+		auto isRemoved1 = cache.remove(data1.toInput());
+		auto isRemoved2 = cache.remove(data2.toInput());
+		auto isRemoved3 = cache.remove(data3.toInput());
+
+		// Assert:
+		EXPECT_FALSE(isRemoved1);
+		EXPECT_FALSE(isRemoved2);
+		EXPECT_FALSE(isRemoved3);
+		EXPECT_EQ(1u, cache.size());
+	}
+
+	TEST(TEST_CLASS, CanRemoveSignatureFromPreviousGeneration) {
+		// Arrange: fill the first generation and start the second
+		VerifiedSignatureCache cache(3);
+		std::vector<SignatureData> dataVector(4);
+		for (const auto& data : dataVector)
+			cache.add(data.toInput());
+
+		// Act:
+		auto isRemoved = cache.remove(dataVector[0].toInput());
+
+		// Assert:
+		EXPECT_TRUE(isRemoved);
+		EXPECT_EQ(3u, cache.size());
+	}
+
+	TEST(TEST_CLASS, OldestGenerationIsDiscardedWhenNewGenerationIsFull) {
+		// Arrange:
+		VerifiedSignatureCache cache(3);
+		std::vector<SignatureData> dataVector(7);
+
+		// Act:
+		for (const auto& data : dataVector)
+			cache.add(data.toInput());
+
+		// Assert: only the two most recent generations are kept
+		EXPECT_EQ(4u, cache.size());
+		for (auto i = 0u; i < 3; ++i)
+			EXPECT_FALSE(cache.remove(dataVector[i].toInput())) << "data at " << i;
+
+		for (auto i = 3u; i < 7; ++i)
+			EXPECT_TRUE(cache.remove(dataVector[i].toInput())) << "data at " << i;
+	}
+}}
@@ -0,0 +1,201 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "catapult/deltaset/BaseSetDelta.h"
+#include "tests/test/other/TestElement.h"
+#include "tests/TestHarness.h"
+#include <map>
+#include <unordered_map>
+
+namespace catapult { namespace deltaset {
+
+#define TEST_CLASS BaseSetDeltaPrefetchTests
+
+	namespace {
+		using KeyType = std::pair<std::string, unsigned int>;
+		using ElementType = test::MutableTestElement;
+		using MemoryMapType = std::unordered_map<KeyType, ElementType, test::MapKeyHasher>;
+
+		struct LookupCounters {
+			size_t NumFindCalls = 0;
+			std::vector<std::vector<KeyType>> BatchFindKeys;
+		};
+
+		// storage map that records all lookups
+		class StorageMapType : public std::map<KeyType, ElementType> {
+		private:
+			using BaseType = std::map<KeyType, ElementType>;
+
+		public:
+			explicit StorageMapType(LookupCounters& counters) : m_counters(counters)
+			{}
+
+		public:
+			const_iterator find(const KeyType& key) const {
+				++m_counters.NumFindCalls;
+				return BaseType::find(key);
+			}
+
+			std::vector<const_iterator> find(const std::vector<KeyType>& keys) const {
+				m_counters.BatchFindKeys.push_back(keys);
+
+				std::vector<const_iterator> iters;
+				for (const auto& key : keys)
+					iters.push_back(BaseType::find(key));
+
+				return iters;
+			}
+
+		private:
+			LookupCounters& m_counters;
+		};
+
+		using KeyTraits = MapKeyTraits<MemoryMapType>;
+		using ContainerType = ConditionalContainer<KeyTraits, StorageMapType, MemoryMapType>;
+		using SetTraits = MapStorageTraits<ContainerType, test::TestElementToKeyConverter<ElementType>, MemoryMapType>;
+		using DeltaType = BaseSetDelta<MutableTypeTraits<ElementType>, SetTraits>;
+
+		KeyType MakeKey(unsigned int value) {
+			return std::make_pair(std::string("TestElement"), value);
+		}
+
+		std::unique_ptr<ContainerType> CreateContainer(ConditionalContainerMode mode, LookupCounters& counters, size_t count) {
+			auto pContainer = std::make_unique<ContainerType>(mode, counters);
+
+			MemoryMapType added;
+			for (auto i = 0u; i < count; ++i)
+				added.emplace(MakeKey(i), ElementType("TestElement", i));
+
+			pContainer->update(DeltaElements<MemoryMapType>(added, MemoryMapType(), MemoryMapType()));
+
+			counters = LookupCounters();
+			return pContainer;
+		}
+
+		void AssertNoPendingModifications(const DeltaType& delta) {
+			auto deltas = delta.deltas();
+			EXPECT_TRUE(deltas.Added.empty());
+			EXPECT_TRUE(deltas.Removed.empty());
+			EXPECT_TRUE(deltas.Copied.empty());
+		}
+	}
+
+	TEST(TEST_CLASS, PrefetchIsBypassedWhenContainerIsMemoryBased) {
+		// Arrange:
+		LookupCounters counters;
+		auto pContainer = CreateContainer(ConditionalContainerMode::Memory, counters, 5);
+		DeltaType delta(*pContainer);
+
+		// Act:
+		delta.prefetch({ MakeKey(1), MakeKey(3) });
+		const auto* pElement = static_cast<const DeltaType&>(delta).find(MakeKey(3)).get();
+
+		// Assert:
+		EXPECT_TRUE(counters.BatchFindKeys.empty());
+		EXPECT_EQ(0u, counters.NumFindCalls);
+
+		ASSERT_TRUE(!!pElement);
+		EXPECT_EQ(ElementType("TestElement", 3), *pElement);
+		AssertNoPendingModifications(delta);
+	}
+
+	TEST(TEST_CLASS, PrefetchLoadsAllKeysWithSingleBatchLookup) {
+		// Arrange:
+		LookupCounters counters;
+		auto pContainer = CreateContainer(ConditionalContainerMode::Storage, counters, 5);
+		DeltaType delta(*pContainer);
+
+		// Act:
+		delta.prefetch({ MakeKey(1), MakeKey(3), MakeKey(7) });
+
+		// Assert:
+		ASSERT_EQ(1u, counters.BatchFindKeys.size());
+		EXPECT_EQ(std::vector<KeyType>({ MakeKey(1), MakeKey(3), MakeKey(7) }), counters.BatchFindKeys[0]);
+		EXPECT_EQ(0u, counters.NumFindCalls);
+		AssertNoPendingModifications(delta);
+	}
+
+	TEST(TEST_CLASS, PrefetchedElementsAreFoundWithoutStorageLookups) {
+		// Arrange:
+		LookupCounters counters;
+		auto pContainer = CreateContainer(ConditionalContainerMode::Storage, counters, 5);
+		DeltaType delta(*pContainer);
+		delta.prefetch({ MakeKey(1), MakeKey(3) });
+
+		// Act:
+		const auto* pElement1 = static_cast<const DeltaType&>(delta).find(MakeKey(1)).get();
+		const auto* pElement3 = static_cast<const DeltaType&>(delta).find(MakeKey(3)).get();
+		auto contains1 = delta.contains(MakeKey(1));
+
+		// Assert:
+		EXPECT_EQ(0u, counters.NumFindCalls);
+		ASSERT_TRUE(!!pElement1);
+		EXPECT_EQ(ElementType("TestElement", 1), *pElement1);
+		ASSERT_TRUE(!!pElement3);
+		EXPECT_EQ(ElementType("TestElement", 3), *pElement3);
+		EXPECT_TRUE(contains1);
+		AssertNoPendingModifications(delta);
+	}
+
+	TEST(TEST_CLASS, PrefetchSkipsKnownKeys) {
+		// Arrange: add, copy, remove and prefetch one element each
+		LookupCounters counters;
+		auto pContainer = CreateContainer(ConditionalContainerMode::Storage, counters, 5);
+		DeltaType delta(*pContainer);
+		delta.insert(ElementType("TestElement", 9));
+		delta.find(MakeKey(1));
+		delta.remove(MakeKey(2));
+		delta.prefetch({ MakeKey(3) });
+		counters = LookupCounters();
+
+		// Act:
+		delta.prefetch({ MakeKey(9), MakeKey(1), MakeKey(2), MakeKey(3), MakeKey(4) });
+
+		// Assert: only the unknown key was looked up
+		ASSERT_EQ(1u, counters.BatchFindKeys.size());
+		EXPECT_EQ(std::vector<KeyType>({ MakeKey(4) }), counters.BatchFindKeys[0]);
+	}
+
+	TEST(TEST_CLASS, PrefetchedElementsCanBeModifiedAndRemoved) {
+		// Arrange:
+		LookupCounters counters;
+		auto pContainer = CreateContainer(ConditionalContainerMode::Storage, counters, 5);
+		DeltaType delta(*pContainer);
+		delta.prefetch({ MakeKey(1), MakeKey(3) });
+
+		// Act:
+		delta.find(MakeKey(1)).get()->Dummy = 123;
+		auto removeResult = delta.remove(MakeKey(3));
+
+		// Assert:
+		EXPECT_EQ(0u, counters.NumFindCalls);
+		EXPECT_EQ(RemoveResult::Removed, removeResult);
+
+		auto deltas = delta.deltas();
+		EXPECT_TRUE(deltas.Added.empty());
+		ASSERT_EQ(1u, deltas.Copied.size());
+		EXPECT_EQ(123u, deltas.Copied.find(MakeKey(1))->second.Dummy);
+		ASSERT_EQ(1u, deltas.Removed.size());
+		EXPECT_TRUE(deltas.Removed.cend() != deltas.Removed.find(MakeKey(3)));
+	}
+
+	TEST(TEST_CLASS, ResetDiscardsPrefetchedElements) {
+		// Arrange:
+		LookupCounters counters;
+		auto pContainer = CreateContainer(ConditionalContainerMode::Storage, counters, 5);
+		DeltaType delta(*pContainer);
+		delta.prefetch({ MakeKey(1) });
+
+		// Act:
+		delta.reset();
+		const auto* pElement = static_cast<const DeltaType&>(delta).find(MakeKey(1)).get();
+
+		// Assert:
+		EXPECT_EQ(1u, counters.NumFindCalls);
+		ASSERT_TRUE(!!pElement);
+		EXPECT_EQ(ElementType("TestElement", 1), *pElement);
+	}
+}}
@@ -159,6 +159,7 @@ namespace catapult { namespace deltaset {
 		// Assert:
 		EXPECT_TRUE(container.empty());
 		EXPECT_EQ(0u, container.size());
+		EXPECT_EQ(Mode, container.mode());
 	}
 
 	TRAITS_BASED_TEST(CanDefaultConstructContainerIterators) {
@@ -267,6 +268,27 @@ namespace catapult { namespace deltaset {
 		EXPECT_EQ(container.cend(), iter);
 	}
 
+	TRAITS_BASED_TEST(BatchFindReturnsIteratorPerKey) {
+		// Arrange:
+		auto container = TTraits::CreateContainer(Mode);
+
+		typename TTraits::DeltaElementsWrapper wrapper;
+		TTraits::AddElement(wrapper.Added, "alpha", 5);
+		TTraits::AddElement(wrapper.Added, "gamma", 7);
+		container.update(wrapper.deltas());
+
+		// Act:
+		auto iters = container.find({ TTraits::MakeKey("gamma", 7), TTraits::MakeKey("zeta", 5), TTraits::MakeKey("alpha", 5) });
+
+		// Assert:
+		ASSERT_EQ(3u, iters.size());
+		ASSERT_NE(container.cend(), iters[0]);
+		EXPECT_EQ("gamma", TTraits::GetValue(*iters[0]).Name);
+		EXPECT_EQ(container.cend(), iters[1]);
+		ASSERT_NE(container.cend(), iters[2]);
+		EXPECT_EQ("alpha", TTraits::GetValue(*iters[2]).Name);
+	}
+
 	// endregion
 
 	// region set traits based pruning test
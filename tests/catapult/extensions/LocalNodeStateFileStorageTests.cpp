@@ -167,12 +167,15 @@ namespace catapult { namespace extensions {
 			return supplementalData;
 		}
 
-		void PrepareAndSaveCompleteState(const config::CatapultDirectory& directory, cache::CatapultCache& cache) {
+		void PrepareAndSaveCompleteState(
+				const config::CatapultDirectory& directory,
+				cache::CatapultCache& cache,
+				uint32_t maxWorkerThreads = 1) {
 			// Arrange:
 			auto supplementalData = CreateDeterministicSupplementalData();
 			RandomSeedCache(cache);
 
-			LocalNodeStateSerializer serializer(directory);
+			LocalNodeStateSerializer serializer(directory, maxWorkerThreads);
 			serializer.save(cache, supplementalData.State, supplementalData.ChainScore);
 		}
 
@@ -310,12 +313,14 @@ namespace catapult { namespace extensions {
 
 	namespace {
 		template<typename TPrepare>
-		void RunSaveAndLoadCompleteStateTest(TPrepare prepare) {
+		void RunSaveAndLoadCompleteStateTest(TPrepare prepare, uint32_t maxStateFileThreads = 1) {
 			// Arrange: seed and save the cache state with rocks disabled
 			test::TempDirectoryGuard tempDir;
 			auto stateDirectory = config::CatapultDirectory(tempDir.name() + "/zstate");
 			test::MutableBlockchainConfiguration mutableConfig;
 			mutableConfig.Immutable.HarvestingMosaicId = test::Default_Harvesting_Mosaic_Id;
+			mutableConfig.Node.MaxStateFileThreads = maxStateFileThreads;
+			mutableConfig.User.DataDirectory = stateDirectory.str();
 			auto config = mutableConfig.ToConst();
 			const auto& networkConfig = config.Network;
 			auto originalCache = test::CoreSystemCacheFactory::Create(config);
@@ -324,13 +329,10 @@ namespace catapult { namespace extensions {
 			prepare(stateDirectory);
 
 			// Act: save the state
-			PrepareAndSaveCompleteState(stateDirectory, originalCache);
+			PrepareAndSaveCompleteState(stateDirectory, originalCache, maxStateFileThreads);
 
 			// Act: load the state
-			test::LocalNodeTestState loadedState(
-					networkConfig,
-					stateDirectory.str(),
-					test::CoreSystemCacheFactory::Create(config));
+			test::LocalNodeTestState loadedState(config, test::CoreSystemCacheFactory::Create(config));
 			auto pluginManager = test::CreatePluginManager(networkConfig);
 			auto heights = LoadStateFromDirectory(stateDirectory, loadedState.ref(), pluginManager);
 
@@ -358,6 +360,11 @@ namespace catapult { namespace extensions {
 		RunSaveAndLoadCompleteStateTest(PrepareEmptyDirectory);
 	}
 
+	TEST(TEST_CLASS, CanSaveAndLoadCompleteState_MultipleStateFileThreads) {
+		// Act + Assert:
+		RunSaveAndLoadCompleteStateTest(PrepareEmptyDirectory, 4);
+	}
+
 	// endregion
 
 	// region LoadStateFromDirectory / LocalNodeStateSerializer (CatapultCacheDelta)
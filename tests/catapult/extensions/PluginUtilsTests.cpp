@@ -32,6 +32,10 @@ namespace catapult { namespace extensions {
 		test::MutableBlockchainConfiguration config;
 		config.Node.ShouldUseCacheDatabaseStorage = true;
 		config.Node.MaxCacheDatabaseWriteBatchSize = utils::FileSize::FromKilobytes(123);
+		config.Node.CacheDatabaseBlockCacheSize = utils::FileSize::FromMegabytes(64);
+		config.Node.CacheDatabaseBloomFilterBitsPerKey = 12;
+		config.Node.CacheDatabaseCompressionMode = utils::CompressionMode::Zstd;
+		config.Node.ShouldSyncCacheDatabaseWrites = false;
 		config.User.DataDirectory = "foo_bar";
 
 		// Act:
@@ -41,6 +45,10 @@ namespace catapult { namespace extensions {
 		EXPECT_TRUE(storageConfig.PreferCacheDatabase);
 		EXPECT_EQ("foo_bar/statedb", storageConfig.CacheDatabaseDirectory);
 		EXPECT_EQ(utils::FileSize::FromKilobytes(123), storageConfig.MaxCacheDatabaseWriteBatchSize);
+		EXPECT_EQ(utils::FileSize::FromMegabytes(64), storageConfig.CacheDatabaseTuning.BlockCacheSize);
+		EXPECT_EQ(12u, storageConfig.CacheDatabaseTuning.BloomFilterBitsPerKey);
+		EXPECT_EQ(utils::CompressionMode::Zstd, storageConfig.CacheDatabaseTuning.CompressionMode);
+		EXPECT_FALSE(storageConfig.CacheDatabaseTuning.ShouldSyncWrites);
 	}
 
 	TEST(TEST_CLASS, CanCreateStatelessValidator) {
@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/handlers/TransactionHandlers.h"
+#include "catapult/utils/ShortHashSketch.h"
 #include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/PushHandlerTestUtils.h"
 #include "tests/test/plugins/PullHandlerTests.h"
@@ -174,4 +175,182 @@ namespace catapult { namespace handlers {
 	DEFINE_PULL_HANDLER_REQUEST_RESPONSE_TESTS(TEST_CLASS, AssertPullResponseIsSetWhenPacketIsValid)
 
 	// endregion
+
+	// region PullTransactionsSketchHandler
+
+	namespace {
+		constexpr auto Sketch_Packet_Type = ionet::PacketType::Pull_Transactions_Sketch;
+
+		std::vector<utils::ShortHash> ToShortHashes(std::initializer_list<uint32_t> values) {
+			std::vector<utils::ShortHash> shortHashes;
+			for (auto value : values)
+				shortHashes.push_back(utils::ShortHash(value));
+
+			return shortHashes;
+		}
+
+		std::shared_ptr<ionet::Packet> CreateSketchPacket(BlockFeeMultiplier minFeeMultiplier, const utils::ShortHashSketch& sketch) {
+			const auto& cells = sketch.cells();
+			auto cellsSize = static_cast<uint32_t>(cells.size() * sizeof(utils::ShortHashSketchCell));
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(sizeof(BlockFeeMultiplier) + cellsSize);
+			pPacket->Type = Sketch_Packet_Type;
+			reinterpret_cast<BlockFeeMultiplier&>(*pPacket->Data()) = minFeeMultiplier;
+			std::memcpy(pPacket->Data() + sizeof(BlockFeeMultiplier), cells.data(), cellsSize);
+			return pPacket;
+		}
+
+		std::shared_ptr<ionet::Packet> CreateSketchPacket(size_t numCells, const std::vector<utils::ShortHash>& shortHashes) {
+			utils::ShortHashSketch sketch(numCells);
+			for (auto shortHash : shortHashes)
+				sketch.insert(shortHash);
+
+			return CreateSketchPacket(BlockFeeMultiplier(17), sketch);
+		}
+
+		class PullSketchContext {
+		public:
+			explicit PullSketchContext(const std::vector<utils::ShortHash>& localShortHashes) : m_numRetrieverCalls(0) {
+				m_transactions.push_back(mocks::CreateMockTransaction(5));
+				m_transactions.push_back(mocks::CreateMockTransaction(7));
+
+				auto shortHashesSupplier = [localShortHashes]() {
+					return model::ShortHashRange::CopyFixed(
+							reinterpret_cast<const uint8_t*>(localShortHashes.data()),
+							localShortHashes.size());
+				};
+				RegisterPullTransactionsSketchHandler(m_handlers, shortHashesSupplier, [this](auto minFeeMultiplier, const auto& shortHashes) {
+					++m_numRetrieverCalls;
+					m_minFeeMultiplier = minFeeMultiplier;
+					m_knownShortHashes = shortHashes;
+					return m_transactions;
+				});
+			}
+
+		public:
+			const auto& transactions() const {
+				return m_transactions;
+			}
+
+			auto numRetrieverCalls() const {
+				return m_numRetrieverCalls;
+			}
+
+			auto minFeeMultiplier() const {
+				return m_minFeeMultiplier;
+			}
+
+			const auto& knownShortHashes() const {
+				return m_knownShortHashes;
+			}
+
+		public:
+			void process(const ionet::Packet& packet, ionet::ServerPacketHandlerContext& context) {
+				EXPECT_TRUE(m_handlers.process(packet, context));
+			}
+
+		private:
+			ionet::ServerPacketHandlers m_handlers;
+			UnconfirmedTransactions m_transactions;
+			size_t m_numRetrieverCalls;
+			BlockFeeMultiplier m_minFeeMultiplier;
+			utils::ShortHashesSet m_knownShortHashes;
+		};
+
+		auto GetDecodeResult(const ionet::PacketPayload& payload) {
+			return reinterpret_cast<const utils::ShortHashSketchDecodeResult&>(*payload.buffers()[0].pData);
+		}
+
+		void AssertNoSketchResponse(uint32_t dataSize) {
+			// Arrange:
+			PullSketchContext sketchContext(ToShortHashes({ 1, 2, 3 }));
+			auto pPacket = test::CreateRandomPacket(dataSize, Sketch_Packet_Type);
+
+			// Act:
+			ionet::ServerPacketHandlerContext context({}, "");
+			sketchContext.process(*pPacket, context);
+
+			// Assert:
+			EXPECT_FALSE(context.hasResponse());
+			EXPECT_EQ(0u, sketchContext.numRetrieverCalls());
+		}
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketchHandler_DoesNotRespondToPacketWithoutCells) {
+		AssertNoSketchResponse(sizeof(BlockFeeMultiplier));
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketchHandler_DoesNotRespondToPacketWithPartialCell) {
+		AssertNoSketchResponse(sizeof(BlockFeeMultiplier) + 3 * sizeof(utils::ShortHashSketchCell) + 1);
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketchHandler_DoesNotRespondToPacketWithInvalidNumberOfCells) {
+		AssertNoSketchResponse(sizeof(BlockFeeMultiplier) + 4 * sizeof(utils::ShortHashSketchCell));
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketchHandler_RespondsWithFailureWhenSketchCannotBeDecoded) {
+		// Arrange: difference is too large for a three cell sketch
+		PullSketchContext sketchContext(ToShortHashes({ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 }));
+		auto pPacket = CreateSketchPacket(3, ToShortHashes({ 11, 12, 13, 14, 15, 16, 17, 18, 19, 20 }));
+
+		// Act:
+		ionet::ServerPacketHandlerContext context({}, "");
+		sketchContext.process(*pPacket, context);
+
+		// Assert: only the decode result is returned
+		ASSERT_TRUE(context.hasResponse());
+		auto payload = context.response();
+		test::AssertPacketHeader(payload, sizeof(ionet::PacketHeader) + sizeof(utils::ShortHashSketchDecodeResult), Sketch_Packet_Type);
+		EXPECT_EQ(utils::ShortHashSketchDecodeResult::Failure, GetDecodeResult(payload));
+		EXPECT_EQ(0u, sketchContext.numRetrieverCalls());
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketchHandler_RespondsWithSuccessWhenRemoteKnowsAllLocalShortHashes) {
+		// Arrange:
+		PullSketchContext sketchContext(ToShortHashes({ 1, 2, 3 }));
+		auto pPacket = CreateSketchPacket(30, ToShortHashes({ 1, 2, 3, 4, 5 }));
+
+		// Act:
+		ionet::ServerPacketHandlerContext context({}, "");
+		sketchContext.process(*pPacket, context);
+
+		// Assert: only the decode result is returned
+		ASSERT_TRUE(context.hasResponse());
+		auto payload = context.response();
+		test::AssertPacketHeader(payload, sizeof(ionet::PacketHeader) + sizeof(utils::ShortHashSketchDecodeResult), Sketch_Packet_Type);
+		EXPECT_EQ(utils::ShortHashSketchDecodeResult::Success, GetDecodeResult(payload));
+		EXPECT_EQ(0u, sketchContext.numRetrieverCalls());
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketchHandler_RespondsWithSuccessAndTransactionsWhenSketchCanBeDecoded) {
+		// Arrange: 4 and 5 are only known locally
+		PullSketchContext sketchContext(ToShortHashes({ 1, 2, 3, 4, 5 }));
+		auto pPacket = CreateSketchPacket(30, ToShortHashes({ 1, 2, 3, 100 }));
+
+		// Act:
+		ionet::ServerPacketHandlerContext context({}, "");
+		sketchContext.process(*pPacket, context);
+
+		// Assert: the retriever was called with all short hashes known by the remote
+		EXPECT_EQ(1u, sketchContext.numRetrieverCalls());
+		EXPECT_EQ(BlockFeeMultiplier(17), sketchContext.minFeeMultiplier());
+		auto expectedKnownShortHashes = ToShortHashes({ 1, 2, 3 });
+		EXPECT_EQ(utils::ShortHashesSet(expectedKnownShortHashes.cbegin(), expectedKnownShortHashes.cend()), sketchContext.knownShortHashes());
+
+		// - the decode result is followed by the retrieved transactions
+		ASSERT_TRUE(context.hasResponse());
+		auto payload = context.response();
+		const auto& transactions = sketchContext.transactions();
+		auto expectedSize = sizeof(ionet::PacketHeader) + sizeof(utils::ShortHashSketchDecodeResult) + test::TotalSize(transactions);
+		test::AssertPacketHeader(payload, expectedSize, Sketch_Packet_Type);
+		ASSERT_EQ(1u + transactions.size(), payload.buffers().size());
+		EXPECT_EQ(utils::ShortHashSketchDecodeResult::Success, GetDecodeResult(payload));
+
+		auto i = 1u;
+		for (const auto& pExpectedTransaction : transactions) {
+			const auto& transaction = reinterpret_cast<const mocks::MockTransaction&>(*payload.buffers()[i++].pData);
+			EXPECT_EQ(*pExpectedTransaction, transaction);
+		}
+	}
+
+	// endregion
 }}
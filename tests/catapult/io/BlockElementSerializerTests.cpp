@@ -162,6 +162,27 @@ namespace catapult { namespace io {
 		EXPECT_FALSE(!!pBlockElement->OptionalStatement);
 	}
 
+	TEST(TEST_CLASS, CanReadBlockElementAroundExistingBlock) {
+		// Arrange: skip the block data in the stream
+		auto context = PrepareReadTestContext(3, 4);
+		std::vector<uint8_t> metadataBuffer(context.Buffer.cbegin() + context.pBlock->Size, context.Buffer.cend());
+		mocks::MockMemoryStream inputStream(metadataBuffer);
+		auto pBlock = std::shared_ptr<model::Block>(std::move(context.pBlock));
+
+		// Act:
+		auto pBlockElement = ReadBlockElement(pBlock, inputStream);
+
+		// Assert: block is not copied
+		EXPECT_EQ(pBlock.get(), &pBlockElement->Block);
+		EXPECT_EQ(context.Hashes[0], pBlockElement->EntityHash);
+		EXPECT_EQ(context.GenerationHash, pBlockElement->GenerationHash);
+
+		ASSERT_EQ(4u, pBlockElement->SubCacheMerkleRoots.size());
+		EXPECT_EQ(std::vector<Hash256>(&context.Hashes[8], &context.Hashes[12]), pBlockElement->SubCacheMerkleRoots);
+		ASSERT_EQ(3u, pBlockElement->Transactions.size());
+		EXPECT_FALSE(!!pBlockElement->OptionalStatement);
+	}
+
 	// endregion
 
 	// region WriteBlockElement
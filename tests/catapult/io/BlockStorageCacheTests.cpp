@@ -69,6 +69,10 @@ namespace catapult { namespace io {
 				return m_cache.view().loadBlockStatementData(height);
 			}
 
+			std::vector<std::shared_ptr<const model::Block>> loadBlocks(Height height, size_t maxBlocks, size_t maxBytes) const override {
+				return m_cache.view().loadBlocks(height, maxBlocks, maxBytes);
+			}
+
 		private:
 			BlockStorageCache m_cache;
 		};
@@ -484,6 +488,199 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region least recently used cache
+
+	namespace {
+		auto CreateCacheWithMaxSize(uint32_t numBlocks, utils::FileSize maxCacheSize) {
+			return std::make_unique<BlockStorageCache>(
+					mocks::CreateMemoryBlockStorage(numBlocks),
+					mocks::CreateMemoryBlockStorage(0),
+					maxCacheSize);
+		}
+
+		void AssertStatistics(const BlockStorageCache& cache, uint64_t numHits, uint64_t numMisses, uint64_t numEntries) {
+			auto statistics = cache.statistics();
+			EXPECT_EQ(numHits, statistics.NumHits);
+			EXPECT_EQ(numMisses, statistics.NumMisses);
+			EXPECT_EQ(numEntries, statistics.NumEntries);
+		}
+	}
+
+	TEST(TEST_CLASS, MostRecentBlockElementIsCachedWithoutMaxSize) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(Delegation_Chain_Size), mocks::CreateMemoryBlockStorage(0));
+
+		// Act:
+		auto pBlockElement1 = cache.view().loadBlockElement(Height(Delegation_Chain_Size));
+		auto pBlockElement2 = cache.view().loadBlockElement(Height(Delegation_Chain_Size));
+
+		// Assert:
+		EXPECT_EQ(pBlockElement1.get(), pBlockElement2.get());
+		AssertStatistics(cache, 2, 0, 0);
+	}
+
+	TEST(TEST_CLASS, OtherBlockElementsAreNotCachedWithoutMaxSize) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(Delegation_Chain_Size), mocks::CreateMemoryBlockStorage(0));
+
+		// Act:
+		auto pBlockElement1 = cache.view().loadBlockElement(Height(5));
+		auto pBlockElement2 = cache.view().loadBlockElement(Height(5));
+		cache.view().loadBlockStatementData(Height(5));
+
+		// Assert:
+		EXPECT_NE(pBlockElement1.get(), pBlockElement2.get());
+		AssertStatistics(cache, 0, 3, 0);
+		EXPECT_EQ(0u, cache.statistics().Size);
+	}
+
+	TEST(TEST_CLASS, LoadedBlockElementsAreCachedWithMaxSize) {
+		// Arrange:
+		auto pCache = CreateCacheWithMaxSize(Delegation_Chain_Size, utils::FileSize::FromMegabytes(1));
+
+		// Act:
+		auto pBlockElement1 = pCache->view().loadBlockElement(Height(5));
+		auto pBlockElement2 = pCache->view().loadBlockElement(Height(5));
+		auto pBlock = pCache->view().loadBlock(Height(5));
+
+		// Assert:
+		EXPECT_EQ(pBlockElement1.get(), pBlockElement2.get());
+		EXPECT_EQ(&pBlockElement1->Block, pBlock.get());
+		AssertStatistics(*pCache, 2, 1, 1);
+		EXPECT_LT(pBlockElement1->Block.Size, pCache->statistics().Size);
+	}
+
+	TEST(TEST_CLASS, LoadedBlockStatementDataIsCachedWithMaxSize) {
+		// Arrange:
+		auto pCache = CreateCacheWithMaxSize(Delegation_Chain_Size, utils::FileSize::FromMegabytes(1));
+
+		// Act:
+		auto blockStatementData1 = pCache->view().loadBlockStatementData(Height(5));
+		auto blockStatementData2 = pCache->view().loadBlockStatementData(Height(5));
+		pCache->view().loadBlockElement(Height(5));
+
+		// Assert: block element and statement data share an entry
+		EXPECT_EQ(blockStatementData1, blockStatementData2);
+		AssertStatistics(*pCache, 1, 2, 1);
+	}
+
+	TEST(TEST_CLASS, CacheSizeIsBoundedByMaxSize) {
+		// Arrange: determine size of a single entry (all blocks after nemesis have same size)
+		auto pProbeCache = CreateCacheWithMaxSize(Delegation_Chain_Size, utils::FileSize::FromMegabytes(1));
+		pProbeCache->view().loadBlockElement(Height(2));
+		auto entrySize = pProbeCache->statistics().Size;
+
+		// - allow two and a half entries
+		auto maxCacheSize = utils::FileSize::FromBytes(2 * entrySize + entrySize / 2);
+		auto pCache = CreateCacheWithMaxSize(Delegation_Chain_Size, maxCacheSize);
+
+		// Act:
+		for (auto i = 2u; i <= 6; ++i)
+			pCache->view().loadBlockElement(Height(i));
+
+		// Assert:
+		EXPECT_EQ(2u, pCache->statistics().NumEntries);
+		EXPECT_EQ(2 * entrySize, pCache->statistics().Size);
+
+		// - least recently used block elements were evicted
+		pCache->view().loadBlockElement(Height(6));
+		pCache->view().loadBlockElement(Height(2));
+		AssertStatistics(*pCache, 1, 6, 2);
+	}
+
+	TEST(TEST_CLASS, CommitRetainsPreviousMostRecentBlockElement) {
+		// Arrange:
+		auto pCache = CreateCacheWithMaxSize(Delegation_Chain_Size, utils::FileSize::FromMegabytes(1));
+		auto pPreviousBlockElement = pCache->view().loadBlockElement(Height(Delegation_Chain_Size));
+
+		// Act:
+		auto pNewBlock = test::GenerateBlockWithTransactions(5, Height(Delegation_Chain_Size + 1));
+		{
+			auto modifier = pCache->modifier();
+			modifier.saveBlock(test::CreateBlockElementForSaveTests(*pNewBlock));
+			modifier.commit();
+		}
+
+		auto pBlockElement = pCache->view().loadBlockElement(Height(Delegation_Chain_Size));
+
+		// Assert:
+		EXPECT_EQ(pPreviousBlockElement.get(), pBlockElement.get());
+		AssertStatistics(*pCache, 2, 0, 1);
+	}
+
+	TEST(TEST_CLASS, CommitRemovesReplacedBlockElements) {
+		// Arrange:
+		auto pCache = CreateCacheWithMaxSize(12, utils::FileSize::FromMegabytes(1));
+		for (auto i = 7u; i <= 12; ++i)
+			pCache->view().loadBlockElement(Height(i));
+
+		// Act:
+		auto pNewBlock = test::GenerateBlockWithTransactions(5, Height(9));
+		auto newBlockElement = test::CreateBlockElementForSaveTests(*pNewBlock);
+		{
+			auto modifier = pCache->modifier();
+			modifier.dropBlocksAfter(Height(8));
+			modifier.saveBlock(newBlockElement);
+			modifier.commit();
+		}
+
+		// Assert: only block elements at heights 7 and 8 are still cached
+		EXPECT_EQ(2u, pCache->statistics().NumEntries);
+		test::AssertEqual(newBlockElement, *pCache->view().loadBlockElement(Height(9)));
+		EXPECT_THROW(pCache->view().loadBlockElement(Height(10)), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, LoadBlocksServesCachedBlocksFromCache) {
+		// Arrange:
+		auto pCache = CreateCacheWithMaxSize(Delegation_Chain_Size, utils::FileSize::FromMegabytes(1));
+		auto pBlockElement3 = pCache->view().loadBlockElement(Height(3));
+		auto pBlockElement5 = pCache->view().loadBlockElement(Height(5));
+
+		// Act:
+		auto blocks = pCache->view().loadBlocks(Height(3), 4, std::numeric_limits<size_t>::max());
+
+		// Assert: only the uncached blocks were loaded from storage
+		ASSERT_EQ(4u, blocks.size());
+		EXPECT_EQ(&pBlockElement3->Block, blocks[0].get());
+		EXPECT_EQ(Height(4), blocks[1]->Height);
+		EXPECT_EQ(&pBlockElement5->Block, blocks[2].get());
+		EXPECT_EQ(Height(6), blocks[3]->Height);
+		AssertStatistics(*pCache, 2, 4, 2);
+	}
+
+	TEST(TEST_CLASS, LoadBlocksServesCachedChainTipFromCache) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(Delegation_Chain_Size), mocks::CreateMemoryBlockStorage(0));
+		auto pBlockElement = cache.view().loadBlockElement(Height(Delegation_Chain_Size));
+
+		// Act:
+		auto blocks = cache.view().loadBlocks(Height(Delegation_Chain_Size - 2), 5, std::numeric_limits<size_t>::max());
+
+		// Assert:
+		ASSERT_EQ(3u, blocks.size());
+		EXPECT_EQ(Height(Delegation_Chain_Size - 2), blocks[0]->Height);
+		EXPECT_EQ(Height(Delegation_Chain_Size - 1), blocks[1]->Height);
+		EXPECT_EQ(&pBlockElement->Block, blocks[2].get());
+		AssertStatistics(cache, 2, 2, 0);
+	}
+
+	TEST(TEST_CLASS, LoadBlocksIsBoundedByMaxBytesAcrossCachedAndUncachedBlocks) {
+		// Arrange: all blocks after nemesis have same size
+		auto pCache = CreateCacheWithMaxSize(Delegation_Chain_Size, utils::FileSize::FromMegabytes(1));
+		auto pBlockElement3 = pCache->view().loadBlockElement(Height(3));
+		auto blockSize = pBlockElement3->Block.Size;
+
+		// Act: allow two and a half blocks
+		auto blocks = pCache->view().loadBlocks(Height(3), 4, 2 * blockSize + blockSize / 2);
+
+		// Assert:
+		ASSERT_EQ(2u, blocks.size());
+		EXPECT_EQ(&pBlockElement3->Block, blocks[0].get());
+		EXPECT_EQ(Height(4), blocks[1]->Height);
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
@@ -0,0 +1,212 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "catapult/io/BufferCompression.h"
+#include "tests/TestHarness.h"
+#include <limits>
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS BufferCompressionTests
+
+	namespace {
+		std::vector<uint8_t> GenerateRepetitiveBuffer(size_t numRepetitions) {
+			auto pattern = test::GenerateRandomVector(100);
+			std::vector<uint8_t> buffer;
+			for (auto i = 0u; i < numRepetitions; ++i) {
+				buffer.insert(buffer.end(), pattern.cbegin(), pattern.cend());
+				buffer.push_back(static_cast<uint8_t>(i));
+			}
+
+			return buffer;
+		}
+
+		void AssertRoundtrip(const std::vector<uint8_t>& buffer) {
+			// Act:
+			auto compressed = CompressBuffer(buffer);
+			auto decompressed = DecompressBuffer(compressed, buffer.size());
+
+			// Assert:
+			EXPECT_EQ(buffer, decompressed);
+		}
+
+		std::vector<uint8_t> GenerateRandomMixedBuffer(size_t size) {
+			// mix random bytes with copies of previous ranges so that both literals and matches (of varying offsets) are produced
+			std::vector<uint8_t> buffer;
+			while (buffer.size() < size) {
+				auto rangeSize = std::min<size_t>(1 + test::Random() % 300, size - buffer.size());
+				if (buffer.empty() || 0 == test::Random() % 2) {
+					auto randomBytes = test::GenerateRandomVector(rangeSize);
+					buffer.insert(buffer.end(), randomBytes.cbegin(), randomBytes.cend());
+				} else {
+					auto sourceIndex = test::Random() % buffer.size();
+					for (auto i = 0u; i < rangeSize; ++i)
+						buffer.push_back(buffer[sourceIndex + i]);
+				}
+			}
+
+			return buffer;
+		}
+
+		void AssertDecompressionFailsOrProducesExpectedSize(const std::vector<uint8_t>& compressed, size_t decompressedSize) {
+			try {
+				auto decompressed = DecompressBuffer(compressed, decompressedSize);
+				EXPECT_EQ(decompressedSize, decompressed.size());
+			} catch (const catapult_invalid_argument&) {
+				// malformed input is expected to be rejected
+			}
+		}
+	}
+
+	// region roundtrip
+
+	TEST(TEST_CLASS, CanRoundtripEmptyBuffer) {
+		AssertRoundtrip({});
+	}
+
+	TEST(TEST_CLASS, CanRoundtripBufferSmallerThanMinimumMatch) {
+		AssertRoundtrip({ 0x12, 0x34, 0x56 });
+	}
+
+	TEST(TEST_CLASS, CanRoundtripRandomBuffer) {
+		AssertRoundtrip(test::GenerateRandomVector(10'000));
+	}
+
+	TEST(TEST_CLASS, CanRoundtripRepetitiveBuffer) {
+		AssertRoundtrip(GenerateRepetitiveBuffer(100));
+	}
+
+	TEST(TEST_CLASS, CanRoundtripBufferWithOverlappingMatches) {
+		AssertRoundtrip(std::vector<uint8_t>(10'000, 0xA5));
+	}
+
+	TEST(TEST_CLASS, CanRoundtripRandomMixedBuffers) {
+		for (auto i = 0u; i < 100; ++i) {
+			auto buffer = GenerateRandomMixedBuffer(test::Random() % 20'000);
+			AssertRoundtrip(buffer);
+		}
+	}
+
+	TEST(TEST_CLASS, CompressionShrinksRepetitiveBuffer) {
+		// Arrange:
+		auto buffer = GenerateRepetitiveBuffer(100);
+
+		// Act:
+		auto compressed = CompressBuffer(buffer);
+
+		// Assert:
+		EXPECT_GT(buffer.size() / 10, compressed.size());
+	}
+
+	// endregion
+
+	// region malformed input
+
+	TEST(TEST_CLASS, CannotDecompressIntoSmallerBuffer) {
+		// Arrange:
+		auto buffer = GenerateRepetitiveBuffer(10);
+		auto compressed = CompressBuffer(buffer);
+
+		// Act + Assert:
+		EXPECT_THROW(DecompressBuffer(compressed, buffer.size() - 1), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotDecompressIntoLargerBuffer) {
+		// Arrange:
+		auto buffer = GenerateRepetitiveBuffer(10);
+		auto compressed = CompressBuffer(buffer);
+
+		// Act + Assert:
+		EXPECT_THROW(DecompressBuffer(compressed, buffer.size() + 1), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotDecompressTruncatedBuffer) {
+		// Arrange:
+		auto buffer = GenerateRepetitiveBuffer(10);
+		auto compressed = CompressBuffer(buffer);
+		compressed.pop_back();
+
+		// Act + Assert:
+		EXPECT_THROW(DecompressBuffer(compressed, buffer.size()), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotDecompressBufferWithMatchBeforeStart) {
+		// Arrange: 2 literals followed by a match with offset 3
+		std::vector<uint8_t> compressed{ 0x02, 0x11, 0x22, 0x04, 0x03, 0x00 };
+
+		// Act + Assert:
+		EXPECT_THROW(DecompressBuffer(compressed, 6), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotDecompressBufferWithZeroOffsetMatch) {
+		// Arrange: 2 literals followed by a match with offset 0
+		std::vector<uint8_t> compressed{ 0x02, 0x11, 0x22, 0x04, 0x00, 0x00 };
+
+		// Act + Assert:
+		EXPECT_THROW(DecompressBuffer(compressed, 6), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotDecompressIntoHugeBuffer) {
+		// Arrange:
+		auto buffer = GenerateRepetitiveBuffer(10);
+		auto compressed = CompressBuffer(buffer);
+
+		// Act + Assert: the untrusted size is not used to reserve memory
+		EXPECT_THROW(DecompressBuffer(compressed, std::numeric_limits<size_t>::max()), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotDecompressBufferWithHugeMatch) {
+		// Arrange: 4 literals followed by a match with offset 4 and size 2^63
+		std::vector<uint8_t> compressed{ 0x04, 0x11, 0x22, 0x33, 0x44, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x04, 0x00 };
+
+		// Act + Assert:
+		EXPECT_THROW(DecompressBuffer(compressed, 1000), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotDecompressBufferWithMatchExceedingRemainingOutput) {
+		// Arrange: 4 literals followed by a match with offset 4 and size 5, which is one byte more than remains
+		std::vector<uint8_t> compressed{ 0x04, 0x11, 0x22, 0x33, 0x44, 0x05, 0x04, 0x00 };
+
+		// Act + Assert:
+		EXPECT_THROW(DecompressBuffer(compressed, 8), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, DecompressionOfRandomBufferFailsOrProducesExpectedSize) {
+		for (auto i = 0u; i < 1000; ++i) {
+			// Arrange:
+			auto compressed = test::GenerateRandomVector(1 + test::Random() % 100);
+
+			// Act + Assert:
+			AssertDecompressionFailsOrProducesExpectedSize(compressed, test::Random() % 1000);
+		}
+	}
+
+	TEST(TEST_CLASS, DecompressionOfCorruptedBufferFailsOrProducesExpectedSize) {
+		for (auto i = 0u; i < 1000; ++i) {
+			// Arrange: corrupt a few random bytes of a valid compressed buffer
+			auto buffer = GenerateRandomMixedBuffer(1 + test::Random() % 2'000);
+			auto compressed = CompressBuffer(buffer);
+			for (auto j = 0u; j < 1 + test::Random() % 3; ++j)
+				compressed[test::Random() % compressed.size()] = static_cast<uint8_t>(test::Random());
+
+			// Act + Assert:
+			AssertDecompressionFailsOrProducesExpectedSize(compressed, buffer.size());
+		}
+	}
+
+	TEST(TEST_CLASS, CanDecompressBufferWithOverlappingMatch) {
+		// Arrange: 2 literals followed by a match with offset 2 and size 4, then no literals
+		std::vector<uint8_t> compressed{ 0x02, 0x11, 0x22, 0x04, 0x02, 0x00 };
+
+		// Act:
+		auto decompressed = DecompressBuffer(compressed, 6);
+
+		// Assert:
+		EXPECT_EQ(std::vector<uint8_t>({ 0x11, 0x22, 0x11, 0x22, 0x11, 0x22 }), decompressed);
+	}
+
+	// endregion
+}}
@@ -93,6 +93,51 @@ namespace catapult { namespace io {
 		test::AssertEqual(blockElement, *pStorageBlockElement);
 	}
 
+	TEST(TEST_CLASS, PackFileCanBeEnabled) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileBlockStorage storage(tempDir.name(), FileBlockStorageMode::Pack_File);
+
+		// - save a block
+		auto pBlock = test::GenerateBlockWithTransactions(5, Height(1));
+		auto blockElement = test::CreateBlockElementForSaveTests(*pBlock);
+		storage.saveBlock(blockElement);
+
+		// Act:
+		auto pStorageBlockElement = storage.loadBlockElement(Height(1));
+		auto hashes = storage.loadHashesFrom(Height(1), 100);
+
+		// Assert: block is stored in packs
+		EXPECT_TRUE(boost::filesystem::exists(tempDir.name() + "/packs/00000.pack"));
+		EXPECT_FALSE(boost::filesystem::exists(tempDir.name() + "/00000"));
+
+		ASSERT_EQ(1u, hashes.size());
+		EXPECT_EQ(blockElement.EntityHash, *hashes.cbegin());
+		test::AssertEqual(blockElement, *pStorageBlockElement);
+	}
+
+	TEST(TEST_CLASS, GetFileBlockStorageModeReturnsHashIndexWhenPacksAreNotPresent) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileTraits::PrepareStorage(tempDir.name());
+
+		// Act + Assert:
+		EXPECT_EQ(FileBlockStorageMode::Hash_Index, GetFileBlockStorageMode(tempDir.name()));
+	}
+
+	TEST(TEST_CLASS, GetFileBlockStorageModeReturnsPackFileWhenPacksArePresent) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		{
+			FileBlockStorage storage(tempDir.name(), FileBlockStorageMode::Pack_File);
+			auto pBlock = test::GenerateBlockWithTransactions(5, Height(1));
+			storage.saveBlock(test::CreateBlockElementForSaveTests(*pBlock));
+		}
+
+		// Act + Assert:
+		EXPECT_EQ(FileBlockStorageMode::Pack_File, GetFileBlockStorageMode(tempDir.name()));
+	}
+
 	// endregion
 
 	// region folder management
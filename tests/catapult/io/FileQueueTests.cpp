@@ -698,4 +698,208 @@ namespace catapult { namespace io {
 	}
 
 	// endregion
+
+	// region segments
+
+	namespace {
+		constexpr auto Segment0_Filename = "0000000000000000.seg";
+
+		FileQueueWriter CreateSegmentWriter(const boost::filesystem::path& directory, uint64_t maxSegmentSize) {
+			return FileQueueWriter(directory.generic_string(), DefaultTraits::Index_Writer_Filename, { maxSegmentSize, 2 });
+		}
+
+		std::vector<uint8_t> MakeRecords(const std::vector<std::vector<uint8_t>>& buffers) {
+			std::vector<uint8_t> records;
+			for (const auto& buffer : buffers) {
+				auto size = static_cast<uint32_t>(buffer.size());
+				records.insert(records.end(), reinterpret_cast<const uint8_t*>(&size), reinterpret_cast<const uint8_t*>(&size + 1));
+				records.insert(records.end(), buffer.cbegin(), buffer.cend());
+			}
+
+			return records;
+		}
+
+		template<typename TWriter>
+		void WriteAll(TWriter&& writer, const std::vector<std::vector<uint8_t>>& buffers) {
+			for (const auto& buffer : buffers) {
+				writer.write(buffer);
+				writer.flush();
+			}
+		}
+
+		std::vector<std::vector<uint8_t>> ReadAll(FileQueueReader& reader) {
+			std::vector<std::vector<uint8_t>> buffers;
+			while (reader.tryReadNextMessage([&buffers](const auto& buffer) { buffers.push_back(buffer); }))
+			{}
+
+			return buffers;
+		}
+
+		std::vector<std::vector<uint8_t>> GenerateRandomBuffers(size_t count) {
+			std::vector<std::vector<uint8_t>> buffers;
+			for (auto i = 0u; i < count; ++i)
+				buffers.push_back(test::GenerateRandomVector(15 + i % 10));
+
+			return buffers;
+		}
+	}
+
+	TEST(TEST_CLASS, Segments_WriterAppendsMultipleMessagesToSingleSegment) {
+		// Arrange:
+		BasicQueueTestContext<DefaultTraits> context("q");
+		auto writer = CreateSegmentWriter(context.directory(), 1024);
+		auto buffers = GenerateRandomBuffers(3);
+
+		// Act:
+		WriteAll(writer, buffers);
+
+		// Assert:
+		EXPECT_EQ(2u, context.countFiles());
+		EXPECT_TRUE(context.exists(Segment0_Filename));
+
+		EXPECT_EQ(3u, context.readIndexWriterFile());
+		EXPECT_EQ(MakeRecords(buffers), context.readAll(Segment0_Filename));
+	}
+
+	TEST(TEST_CLASS, Segments_WriterBuffersMessageInMemoryUntilFlush) {
+		// Arrange:
+		BasicQueueTestContext<DefaultTraits> context("q");
+		auto writer = CreateSegmentWriter(context.directory(), 1024);
+
+		// Act:
+		writer.write(test::GenerateRandomVector(21));
+
+		// Assert: segment is created on first flush
+		EXPECT_EQ(1u, context.countFiles());
+		EXPECT_EQ(0u, context.readIndexWriterFile());
+	}
+
+	TEST(TEST_CLASS, Segments_WriterStartsNewSegmentWhenSegmentIsFull) {
+		// Arrange:
+		BasicQueueTestContext<DefaultTraits> context("q");
+		auto writer = CreateSegmentWriter(context.directory(), 50);
+		std::vector<std::vector<uint8_t>> buffers{
+			test::GenerateRandomVector(21),
+			test::GenerateRandomVector(80),
+			test::GenerateRandomVector(11)
+		};
+
+		// Act:
+		WriteAll(writer, buffers);
+
+		// Assert: second message exceeds segment size
+		EXPECT_EQ(3u, context.countFiles());
+		EXPECT_TRUE(context.exists(Segment0_Filename));
+		EXPECT_TRUE(context.exists("0000000000000002.seg"));
+
+		EXPECT_EQ(3u, context.readIndexWriterFile());
+		EXPECT_EQ(MakeRecords({ buffers[0], buffers[1] }), context.readAll(Segment0_Filename));
+		EXPECT_EQ(MakeRecords({ buffers[2] }), context.readAll("0000000000000002.seg"));
+	}
+
+	TEST(TEST_CLASS, Segments_WriterDropsUncommittedDataWhenReopened) {
+		// Arrange: write two messages followed by uncommitted data
+		BasicQueueTestContext<DefaultTraits> context("q");
+		auto buffers = GenerateRandomBuffers(3);
+		WriteAll(CreateSegmentWriter(context.directory(), 1024), { buffers[0], buffers[1] });
+		{
+			RawFile segmentFile((context.directory() / Segment0_Filename).generic_string(), OpenMode::Read_Append);
+			segmentFile.seek(segmentFile.size());
+			segmentFile.write(test::GenerateRandomVector(30));
+
+			RawFile(context.directory().generic_string() + "/0000000000000005.seg", OpenMode::Read_Write).write(buffers[2]);
+		}
+
+		// Act:
+		auto writer = CreateSegmentWriter(context.directory(), 1024);
+		WriteAll(writer, { buffers[2] });
+
+		// Assert:
+		EXPECT_EQ(2u, context.countFiles());
+		EXPECT_EQ(3u, context.readIndexWriterFile());
+		EXPECT_EQ(MakeRecords(buffers), context.readAll(Segment0_Filename));
+	}
+
+	TEST(TEST_CLASS, Segments_CanReadMessagesFromMultipleSegments) {
+		// Arrange:
+		BasicQueueTestContext<DefaultTraits> context("q");
+		auto buffers = GenerateRandomBuffers(10);
+		WriteAll(CreateSegmentWriter(context.directory(), 50), buffers);
+		FileQueueReader reader(context.directory().generic_string());
+
+		// Act:
+		auto readBuffers = ReadAll(reader);
+
+		// Assert: only the last segment remains
+		EXPECT_EQ(buffers, readBuffers);
+		EXPECT_EQ(3u, context.countFiles());
+		EXPECT_TRUE(context.exists("0000000000000008.seg"));
+		EXPECT_EQ(10u, context.readIndexReaderFile());
+	}
+
+	TEST(TEST_CLASS, Segments_CanReadMessagesAppendedAfterSegmentWasOpened) {
+		// Arrange:
+		BasicQueueTestContext<DefaultTraits> context("q");
+		auto buffers = GenerateRandomBuffers(5);
+		auto writer = CreateSegmentWriter(context.directory(), 1024);
+		FileQueueReader reader(context.directory().generic_string());
+
+		// Act:
+		WriteAll(writer, { buffers[0], buffers[1] });
+		auto readBuffers1 = ReadAll(reader);
+		WriteAll(writer, { buffers[2], buffers[3], buffers[4] });
+		auto readBuffers2 = ReadAll(reader);
+
+		// Assert:
+		EXPECT_EQ(std::vector<std::vector<uint8_t>>(buffers.cbegin(), buffers.cbegin() + 2), readBuffers1);
+		EXPECT_EQ(std::vector<std::vector<uint8_t>>(buffers.cbegin() + 2, buffers.cend()), readBuffers2);
+	}
+
+	TEST(TEST_CLASS, Segments_CanReadMessagesWrittenWithAndWithoutSegments) {
+		// Arrange:
+		BasicQueueTestContext<DefaultTraits> context("q");
+		auto buffers = GenerateRandomBuffers(6);
+		WriteAll(CreateSegmentWriter(context.directory(), 1024), { buffers[0], buffers[1] });
+		WriteAll(FileQueueWriter(context.directory().generic_string()), { buffers[2], buffers[3] });
+		WriteAll(CreateSegmentWriter(context.directory(), 1024), { buffers[4], buffers[5] });
+		FileQueueReader reader(context.directory().generic_string());
+
+		// Act:
+		auto readBuffers = ReadAll(reader);
+
+		// Assert:
+		EXPECT_EQ(buffers, readBuffers);
+		EXPECT_EQ(6u, context.readIndexReaderFile());
+	}
+
+	TEST(TEST_CLASS, Segments_CanSkipMessages) {
+		// Arrange:
+		BasicQueueTestContext<DefaultTraits> context("q");
+		auto buffers = GenerateRandomBuffers(5);
+		WriteAll(CreateSegmentWriter(context.directory(), 50), buffers);
+		FileQueueReader reader(context.directory().generic_string());
+
+		// Act:
+		reader.skip(3);
+		auto readBuffers = ReadAll(reader);
+
+		// Assert:
+		EXPECT_EQ(std::vector<std::vector<uint8_t>>(buffers.cbegin() + 3, buffers.cend()), readBuffers);
+		EXPECT_EQ(5u, context.readIndexReaderFile());
+	}
+
+	TEST(TEST_CLASS, Segments_CannotReadWhenSegmentDoesNotContainMessage) {
+		// Arrange: writer index claims more messages than stored in segment
+		BasicQueueTestContext<DefaultTraits> context("q");
+		WriteAll(CreateSegmentWriter(context.directory(), 1024), GenerateRandomBuffers(2));
+		IndexFile((context.directory() / DefaultTraits::Index_Writer_Filename).generic_string()).set(4);
+		FileQueueReader reader(context.directory().generic_string());
+		reader.skip(2);
+
+		// Act + Assert:
+		EXPECT_THROW(FileQueueReader(context.directory().generic_string()).tryReadNextMessage(ReadNever), catapult_runtime_error);
+		EXPECT_EQ(2u, context.readIndexReaderFile());
+	}
+
+	// endregion
 }}
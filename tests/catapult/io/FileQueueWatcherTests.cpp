@@ -0,0 +1,143 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "catapult/io/FileQueueWatcher.h"
+#include "catapult/io/FileQueue.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <boost/filesystem.hpp>
+#include <thread>
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS FileQueueWatcherTests
+
+	namespace {
+		constexpr auto Short_Timeout = utils::TimeSpan::FromMilliseconds(50);
+		constexpr auto Long_Timeout = utils::TimeSpan::FromMilliseconds(5000);
+
+		struct WatcherTestContext {
+		public:
+			WatcherTestContext()
+					: QueueDirectory1((boost::filesystem::path(TempDir.name()) / "q1").generic_string())
+					, QueueDirectory2((boost::filesystem::path(TempDir.name()) / "q2").generic_string())
+					, Watcher({ QueueDirectory1, QueueDirectory2 }, "index.dat")
+			{}
+
+		public:
+			test::TempDirectoryGuard TempDir;
+			std::string QueueDirectory1;
+			std::string QueueDirectory2;
+			FileQueueWatcher Watcher;
+		};
+
+		void WriteMessage(const std::string& directory) {
+			FileQueueWriter writer(directory);
+			writer.write(test::GenerateRandomVector(21));
+			writer.flush();
+		}
+	}
+
+	TEST(TEST_CLASS, WatcherCreatesMissingDirectories) {
+		// Act:
+		WatcherTestContext context;
+
+		// Assert:
+		EXPECT_TRUE(boost::filesystem::is_directory(context.QueueDirectory1));
+		EXPECT_TRUE(boost::filesystem::is_directory(context.QueueDirectory2));
+	}
+
+	TEST(TEST_CLASS, WaitTimesOutWhenNothingChanges) {
+		// Arrange:
+		WatcherTestContext context;
+
+		// Act:
+		auto result = context.Watcher.wait(Short_Timeout);
+
+		// Assert:
+		EXPECT_FALSE(result);
+	}
+
+	TEST(TEST_CLASS, WaitIgnoresChangesOfOtherFiles) {
+		// Arrange:
+		WatcherTestContext context;
+		IndexFile(context.QueueDirectory1 + "/index_reader.dat").set(1);
+
+		// Act:
+		auto result = context.Watcher.wait(Short_Timeout);
+
+		// Assert:
+		EXPECT_FALSE(result);
+	}
+
+#ifdef __linux__
+
+	TEST(TEST_CLASS, WaitReturnsWhenMessageIsCommittedToAnyQueue) {
+		// Arrange:
+		for (auto i = 0u; i < 2; ++i) {
+			WatcherTestContext context;
+			WriteMessage(0 == i ? context.QueueDirectory1 : context.QueueDirectory2);
+
+			// Act:
+			auto result = context.Watcher.wait(Long_Timeout);
+
+			// Assert:
+			EXPECT_TRUE(result) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, WaitReturnsWhenMessageIsCommittedDuringWait) {
+		// Arrange:
+		WatcherTestContext context;
+		std::thread writerThread([&context]() {
+			test::Sleep(20);
+			WriteMessage(context.QueueDirectory1);
+		});
+
+		// Act:
+		auto result = context.Watcher.wait(Long_Timeout);
+		writerThread.join();
+
+		// Assert:
+		EXPECT_TRUE(result);
+	}
+
+#endif
+
+	TEST(TEST_CLASS, InterruptWakesUpWait) {
+		// Arrange:
+		WatcherTestContext context;
+		std::thread interruptThread([&context]() {
+			test::Sleep(20);
+			context.Watcher.interrupt();
+		});
+
+		// Act:
+		auto start = std::chrono::steady_clock::now();
+		auto result = context.Watcher.wait(Long_Timeout);
+		auto elapsed = std::chrono::steady_clock::now() - start;
+		interruptThread.join();
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_GT(std::chrono::milliseconds(Long_Timeout.millis()), elapsed);
+	}
+
+	TEST(TEST_CLASS, WaitReturnsImmediatelyAfterInterrupt) {
+		// Arrange:
+		WatcherTestContext context;
+		context.Watcher.interrupt();
+		WriteMessage(context.QueueDirectory1);
+
+		// Act:
+		auto result1 = context.Watcher.wait(Long_Timeout);
+		auto result2 = context.Watcher.wait(Long_Timeout);
+
+		// Assert:
+		EXPECT_FALSE(result1);
+		EXPECT_FALSE(result2);
+	}
+}}
@@ -0,0 +1,217 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "catapult/io/PackFileBlockStorage.h"
+#include "catapult/io/BlockStatementSerializer.h"
+#include "catapult/io/BufferInputStreamAdapter.h"
+#include "catapult/io/FileBlockStorage.h"
+#include "tests/test/core/BlockStorageTests.h"
+#include "tests/test/nodeps/Filesystem.h"
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS PackFileBlockStorageTests
+
+	namespace {
+#ifdef SIGNATURE_SCHEME_NIS1
+		constexpr auto Seed_Directory = "../seed/mijin-test.nis1";
+#else
+		constexpr auto Seed_Directory = "../seed/mijin-test";
+#endif
+
+		struct PackFileTraits {
+			using Guard = test::TempDirectoryGuard;
+			using StorageType = PackFileBlockStorage;
+
+			static std::unique_ptr<StorageType> OpenStorage(const std::string& destination) {
+				return std::make_unique<StorageType>(destination);
+			}
+
+			static std::unique_ptr<StorageType> PrepareStorage(const std::string& destination, Height height = Height()) {
+				// copy the nemesis block from the (file based) seed
+				FileBlockStorage seedStorage(Seed_Directory);
+				auto pNemesisBlockElement = seedStorage.loadBlockElement(Height(1));
+				auto blockStatementPair = seedStorage.loadBlockStatementData(Height(1));
+				if (blockStatementPair.second) {
+					auto pBlockStatement = std::make_shared<model::BlockStatement>();
+					BufferInputStreamAdapter<std::vector<uint8_t>> blockStatementStream(blockStatementPair.first);
+					ReadBlockStatement(blockStatementStream, *pBlockStatement);
+					const_cast<model::BlockElement&>(*pNemesisBlockElement).OptionalStatement = std::move(pBlockStatement);
+				}
+
+				auto pStorage = OpenStorage(destination);
+				pStorage->saveBlock(*pNemesisBlockElement);
+				if (Height() != height)
+					pStorage->dropBlocksAfter(height - Height(1));
+
+				return pStorage;
+			}
+		};
+	}
+
+	// region BlockStorage
+
+	// StorageSeedInitiallyContainsNemesisBlock is excluded because the seed is not stored in pack files
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, SavingBlockWithHeightHigherThanChainHeightAltersChainHeight)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, CanLoadNewlySavedBlock)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, CanOverwriteBlockWithSameData)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, CanOverwriteBlockWithDifferentData)
+
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, LoadHashesFrom_LoadsZeroHashesWhenRequestHeightIsZero)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, LoadHashesFrom_LoadsZeroHashesWhenRequestHeightIsLargerThanLocalHeight)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, LoadHashesFrom_CanLoadSingleHash)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, LoadHashesFrom_CanLoadLastHash)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, LoadHashesFrom_LoadsAtMostMaxHashes)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, LoadHashesFrom_LoadsAreBoundedByLastBlock)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, LoadHashesFrom_LoadsCanCrossIndexFileBoundary)
+
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, CanSaveBlockWithoutStatements)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, CanSaveBlockWithOnlyTransactionStatements)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, CanSaveBlockWithOnlyAddressResolutions)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, CanSaveBlockWithOnlyMosaicResolutions)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, CanSaveBlockWithAllStatements)
+
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, CannotSaveBlockWithHeightLessThanChainHeight)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, CannotSaveBlockAtChainHeight)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, CannotSaveBlockMoreThanOneHeightBeyondChainHeight)
+
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, CanDropBlocksAfterHeight)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, CanDropBlocksAfterHeightAndSaveBlock)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, CanDropAllBlocks)
+
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, LoadBlocks_CanLoadBlocks)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, LoadBlocks_LoadsAreBoundedByChainHeight)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, LoadBlocks_LoadsAreBoundedByMaxBytes)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, LoadBlocks_LoadsAtLeastOneBlock)
+	MAKE_BLOCK_STORAGE_TEST(PackFileTraits, LoadBlocks_CannotLoadAtHeightGreaterThanChainHeight)
+
+	DEFINE_BLOCK_STORAGE_LOAD_TESTS(PackFileTraits, CanLoadAtHeightLessThanChainHeight)
+	DEFINE_BLOCK_STORAGE_LOAD_TESTS(PackFileTraits, CanLoadAtChainHeight)
+	DEFINE_BLOCK_STORAGE_LOAD_TESTS(PackFileTraits, CannotLoadAtHeightGreaterThanChainHeight)
+	DEFINE_BLOCK_STORAGE_LOAD_TESTS(PackFileTraits, CanLoadMultipleSaved)
+
+	DEFINE_PRUNABLE_BLOCK_STORAGE_TESTS(PackFileTraits)
+
+	// endregion
+
+	// region mapped reads
+
+	namespace {
+		auto SaveRandomBlock(PackFileBlockStorage& storage, Height height) {
+			auto pBlock = test::GenerateBlockWithTransactions(5, height);
+			auto element = test::BlockToBlockElement(*pBlock, test::GenerateRandomByteArray<Hash256>());
+			storage.saveBlock(element);
+			return std::make_pair(std::move(pBlock), element);
+		}
+	}
+
+	TEST(TEST_CLASS, LoadedBlocksShareMappedPackData) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = PackFileTraits::PrepareStorage(tempDir.name());
+		SaveRandomBlock(*pStorage, Height(2));
+
+		// Act:
+		auto pBlock = pStorage->loadBlock(Height(2));
+		auto pBlockElement = pStorage->loadBlockElement(Height(2));
+
+		// Assert: both loads point to the same (mapped) memory
+		EXPECT_EQ(pBlock.get(), &pBlockElement->Block);
+	}
+
+	TEST(TEST_CLASS, LoadedBlockRangeSharesMappedPackData) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = PackFileTraits::PrepareStorage(tempDir.name());
+		for (auto height = Height(2); height <= Height(4); height = height + Height(1))
+			SaveRandomBlock(*pStorage, height);
+
+		// Act:
+		auto blocks = pStorage->loadBlocks(Height(2), 3, std::numeric_limits<size_t>::max());
+
+		// Assert: all blocks point into the same (mapped) memory
+		ASSERT_EQ(3u, blocks.size());
+		for (auto i = 0u; i < blocks.size(); ++i)
+			EXPECT_EQ(pStorage->loadBlock(Height(2 + i)).get(), blocks[i].get()) << i;
+	}
+
+	TEST(TEST_CLASS, LoadedBlockIsNotChangedWhenBlockIsOverwritten) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = PackFileTraits::PrepareStorage(tempDir.name());
+		auto originalPair = SaveRandomBlock(*pStorage, Height(2));
+		auto pOriginalBlockElement = pStorage->loadBlockElement(Height(2));
+
+		// Act:
+		pStorage->dropBlocksAfter(Height(1));
+		auto newPair = SaveRandomBlock(*pStorage, Height(2));
+		auto pNewBlockElement = pStorage->loadBlockElement(Height(2));
+
+		// Assert:
+		test::AssertEqual(originalPair.second, *pOriginalBlockElement);
+		test::AssertEqual(newPair.second, *pNewBlockElement);
+	}
+
+	TEST(TEST_CLASS, LoadedBlockIsValidAfterPurge) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = PackFileTraits::PrepareStorage(tempDir.name());
+		auto pair = SaveRandomBlock(*pStorage, Height(2));
+		auto pBlockElement = pStorage->loadBlockElement(Height(2));
+
+		// Act:
+		pStorage->purge();
+
+		// Assert:
+		EXPECT_EQ(Height(0), pStorage->chainHeight());
+		test::AssertEqual(pair.second, *pBlockElement);
+	}
+
+	TEST(TEST_CLASS, CanLoadBlocksSavedAfterPackWasMapped) {
+		// Arrange: map the pack by loading a block
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = PackFileTraits::PrepareStorage(tempDir.name());
+		auto pair1 = SaveRandomBlock(*pStorage, Height(2));
+		auto pBlockElement1 = pStorage->loadBlockElement(Height(2));
+
+		// Act:
+		auto pair2 = SaveRandomBlock(*pStorage, Height(3));
+		auto pBlockElement2 = pStorage->loadBlockElement(Height(3));
+
+		// Assert:
+		test::AssertEqual(pair1.second, *pBlockElement1);
+		test::AssertEqual(pair2.second, *pBlockElement2);
+	}
+
+	// endregion
+
+	// region disk persistence
+
+	TEST(TEST_CLASS, CanReadSavedBlocksAcrossDifferentStorageInstances) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		std::vector<model::BlockElement> elements;
+		std::vector<model::UniqueEntityPtr<model::Block>> blocks;
+		{
+			auto pStorage = PackFileTraits::PrepareStorage(tempDir.name());
+			for (auto height = Height(2); height <= Height(4); height = height + Height(1)) {
+				auto pair = SaveRandomBlock(*pStorage, height);
+				blocks.push_back(std::move(pair.first));
+				elements.push_back(pair.second);
+			}
+		}
+
+		// Act:
+		PackFileBlockStorage storage(tempDir.name());
+
+		// Assert:
+		EXPECT_EQ(Height(4), storage.chainHeight());
+		for (auto i = 0u; i < elements.size(); ++i)
+			test::AssertEqual(elements[i], *storage.loadBlockElement(Height(2 + i)));
+	}
+
+	// endregion
+}}
@@ -397,6 +397,25 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region sync
+
+	WRITING_TRAITS_BASED_TEST(SyncPreservesSizeAndPosition) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		RawFile rawFile(guard.name(), TTraits::Mode);
+		auto inputData = test::GenerateRandomVector(Default_Bytes_Written);
+		rawFile.write(inputData);
+
+		// Act:
+		rawFile.sync();
+
+		// Assert:
+		EXPECT_EQ(inputData.size(), rawFile.size());
+		EXPECT_EQ(inputData.size(), rawFile.position());
+	}
+
+	// endregion
+
 	// region seek
 
 	WRITING_TRAITS_BASED_TEST(OobSeekInWritableFileThrows) {
@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/local/server/FileStateChangeStorage.h"
+#include "catapult/io/BufferCompression.h"
 #include "catapult/subscribers/StateChangeInfo.h"
 #include "catapult/subscribers/SubscriberOperationTypes.h"
 #include "tests/test/cache/CacheTestUtils.h"
@@ -57,6 +58,37 @@ namespace catapult { namespace local {
 		};
 
 		// endregion
+
+		// region MockRepetitiveCacheChangesStorageWriter
+
+		// simulate CacheChangesStorage with large similar entries by writing uint32_t value multiple times in saveAll
+		class MockRepetitiveCacheChangesStorageWriter : public cache::CacheChangesStorage {
+		public:
+			MockRepetitiveCacheChangesStorageWriter(uint32_t value, uint32_t count)
+					: m_value(value)
+					, m_count(count)
+			{}
+
+		public:
+			void saveAll(const cache::CacheChanges&, io::OutputStream& output) const override {
+				for (auto i = 0u; i < m_count; ++i)
+					io::Write32(output, m_value);
+			}
+
+			std::unique_ptr<const cache::MemoryCacheChanges> loadAll(io::InputStream&) const override {
+				CATAPULT_THROW_INVALID_ARGUMENT("loadAll - not supported in mock");
+			}
+
+			void apply(const cache::CacheChanges&, const Height&) const override {
+				CATAPULT_THROW_INVALID_ARGUMENT("apply - not supported in mock");
+			}
+
+		private:
+			uint32_t m_value;
+			uint32_t m_count;
+		};
+
+		// endregion
 	}
 
 	TEST(TEST_CLASS, NotifyScoreChangeWritesToUnderlyingStream) {
@@ -138,4 +170,89 @@ namespace catapult { namespace local {
 			offset += sizeof(uintptr_t);
 		}
 	}
+
+	TEST(TEST_CLASS, NotifyStateChangeWritesCompressedStateChangeToUnderlyingStreamWhenEnabled) {
+		// Arrange: create output stream
+		std::vector<uint8_t> buffer;
+		auto pStream = std::make_unique<mocks::MockMemoryStream>(buffer);
+		const auto& stream = *pStream;
+
+		// - create data
+		auto chainScore = model::ChainScore(test::Random(), test::Random());
+		auto height = test::GenerateRandomValue<Height>();
+		auto stateChangeInfo = subscribers::StateChangeInfo(cache::CacheChanges({}), chainScore, height);
+
+		// - create storage with a single cache changes storage writing repetitive data
+		auto storageSentinel = static_cast<uint32_t>(test::Random());
+		auto pStorage = CreateFileStateChangeStorage(std::move(pStream), [storageSentinel]() {
+			CacheChangesStorages cacheChangesStorages;
+			cacheChangesStorages.emplace_back(std::make_unique<MockRepetitiveCacheChangesStorageWriter>(storageSentinel, 100));
+			return cacheChangesStorages;
+		}, true);
+
+		// Act:
+		pStorage->notifyStateChange(stateChangeInfo);
+
+		// Assert:
+		EXPECT_EQ(1u, stream.numFlushes());
+		ASSERT_LE(1u + 2 * sizeof(uint32_t), buffer.size());
+
+		auto expectedOperationType = subscribers::StateChangeOperationType::Compressed_State_Change;
+		EXPECT_EQ(expectedOperationType, static_cast<subscribers::StateChangeOperationType>(buffer[0]));
+
+		auto* pUint32Values = reinterpret_cast<const uint32_t*>(buffer.data() + 1);
+		auto expectedStateChangeSize = 3 * sizeof(uint64_t) + 100 * sizeof(uint32_t);
+		EXPECT_EQ(expectedStateChangeSize, pUint32Values[0]);
+		ASSERT_EQ(1u + 2 * sizeof(uint32_t) + pUint32Values[1], buffer.size());
+		EXPECT_GT(expectedStateChangeSize, pUint32Values[1]);
+
+		// - check that decompressed state change has the uncompressed layout
+		auto stateChange = io::DecompressBuffer(
+				{ buffer.data() + 1 + 2 * sizeof(uint32_t), pUint32Values[1] },
+				expectedStateChangeSize);
+
+		auto* pUint64Values = reinterpret_cast<const uint64_t*>(stateChange.data());
+		EXPECT_EQ(chainScore.toArray()[0], pUint64Values[0]);
+		EXPECT_EQ(chainScore.toArray()[1], pUint64Values[1]);
+		EXPECT_EQ(height, Height(pUint64Values[2]));
+
+		for (auto offset = 3 * sizeof(uint64_t); offset < stateChange.size(); offset += sizeof(uint32_t))
+			EXPECT_EQ(storageSentinel, reinterpret_cast<const uint32_t&>(stateChange[offset])) << offset;
+	}
+
+	TEST(TEST_CLASS, NotifyStateChangeWritesUncompressedStateChangeToUnderlyingStreamWhenCompressionDoesNotShrinkIt) {
+		// Arrange: create output stream
+		std::vector<uint8_t> buffer;
+		auto pStream = std::make_unique<mocks::MockMemoryStream>(buffer);
+		const auto& stream = *pStream;
+
+		// - create data
+		auto chainScore = model::ChainScore(test::Random(), test::Random());
+		auto height = test::GenerateRandomValue<Height>();
+		auto stateChangeInfo = subscribers::StateChangeInfo(cache::CacheChanges({}), chainScore, height);
+
+		// - create storage with a single cache changes storage writing non-repetitive data
+		auto storageSentinel = static_cast<uint32_t>(test::Random());
+		auto pStorage = CreateFileStateChangeStorage(std::move(pStream), [storageSentinel]() {
+			CacheChangesStorages cacheChangesStorages;
+			cacheChangesStorages.emplace_back(std::make_unique<MockCacheChangesStorageWriter>(storageSentinel));
+			return cacheChangesStorages;
+		}, true);
+
+		// Act:
+		pStorage->notifyStateChange(stateChangeInfo);
+
+		// Assert:
+		EXPECT_EQ(1u, stream.numFlushes());
+		ASSERT_EQ(1u + 3 * sizeof(uint64_t) + sizeof(uint32_t) + sizeof(uintptr_t), buffer.size());
+
+		auto expectedOperationType = subscribers::StateChangeOperationType::State_Change;
+		EXPECT_EQ(expectedOperationType, static_cast<subscribers::StateChangeOperationType>(buffer[0]));
+
+		auto* pUint64Values = reinterpret_cast<const uint64_t*>(buffer.data() + 1);
+		EXPECT_EQ(chainScore.toArray()[0], pUint64Values[0]);
+		EXPECT_EQ(chainScore.toArray()[1], pUint64Values[1]);
+		EXPECT_EQ(height, Height(pUint64Values[2]));
+		EXPECT_EQ(storageSentinel, reinterpret_cast<const uint32_t&>(buffer[1 + 3 * sizeof(uint64_t)]));
+	}
 }}
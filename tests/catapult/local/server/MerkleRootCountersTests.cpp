@@ -0,0 +1,82 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "catapult/local/server/MerkleRootCounters.h"
+#include "catapult/cache/CatapultCacheBuilder.h"
+#include "catapult/utils/DiagnosticCounter.h"
+#include "tests/test/cache/SimpleCache.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace local {
+
+#define TEST_CLASS MerkleRootCountersTests
+
+	namespace {
+		using Counters = std::vector<utils::DiagnosticCounter>;
+
+		template<size_t CacheId>
+		void AddSubCacheWithId(cache::CatapultCacheBuilder& builder) {
+			builder.add<test::SimpleCacheStorageTraits>(std::make_unique<test::SimpleCacheT<CacheId>>(test::SimpleCacheViewMode::Merkle_Root));
+		}
+
+		cache::CatapultCache CreateSimpleCatapultCache() {
+			cache::CatapultCacheBuilder builder;
+			AddSubCacheWithId<2>(builder);
+			AddSubCacheWithId<4>(builder);
+			return builder.build();
+		}
+
+		std::vector<std::string> GetCounterNames(const Counters& counters) {
+			std::vector<std::string> names;
+			for (const auto& counter : counters)
+				names.push_back(counter.id().name());
+
+			return names;
+		}
+	}
+
+	TEST(TEST_CLASS, CanAddMerkleRootCounters) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCache();
+
+		// Act:
+		Counters counters;
+		AddMerkleRootCounters(counters, cache);
+
+		// Assert: one counter per registered sub cache and one total counter
+		std::vector<std::string> expectedNames{ "MR SIMPLE AC", "MR SIMPLE AE", "MR TOTAL" };
+		EXPECT_EQ(expectedNames, GetCounterNames(counters));
+	}
+
+	TEST(TEST_CLASS, MerkleRootCounterNamesAreUniqueWhenSubCacheNamesCollide) {
+		// Arrange: both sub caches have the same name
+		cache::CatapultCacheBuilder builder;
+		builder.add<test::SimpleCacheStorageTraits>(std::make_unique<test::SimpleCacheT<27>>(test::SimpleCacheViewMode::Merkle_Root));
+		AddSubCacheWithId<2>(builder);
+		auto cache = builder.build();
+
+		// Act:
+		Counters counters;
+		AddMerkleRootCounters(counters, cache);
+
+		// Assert: counters are ordered by sub cache id
+		std::vector<std::string> expectedNames{ "MR SIMPLE AC", "MR SIMPLE BB", "MR TOTAL" };
+		EXPECT_EQ(expectedNames, GetCounterNames(counters));
+	}
+
+	TEST(TEST_CLASS, MerkleRootCountersAreInitiallyZero) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCache();
+
+		// Act:
+		Counters counters;
+		AddMerkleRootCounters(counters, cache);
+
+		// Assert:
+		for (const auto& counter : counters)
+			EXPECT_EQ(0u, counter.value()) << counter.id().name();
+	}
+}}
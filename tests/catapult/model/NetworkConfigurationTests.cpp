@@ -95,6 +95,7 @@ namespace catapult { namespace model {
 
 							{ "enableDbrbSharding", "false" },
 							{ "dbrbShardSize", "6" },
+							{ "enableDbrbAggregateCertificates", "false" },
 						}
 					},
 					{
@@ -151,7 +152,8 @@ namespace catapult { namespace model {
 					"enableHarvesterExpiration",
 					"enableRemovingDbrbProcessOnShutdown",
 					"enableDbrbSharding",
-					"dbrbShardSize"
+					"dbrbShardSize",
+					"enableDbrbAggregateCertificates"
 				}.count(name);
 			}
 
@@ -204,6 +206,7 @@ namespace catapult { namespace model {
 
 				EXPECT_EQ(false, config.EnableDbrbSharding);
 				EXPECT_EQ(0, config.DbrbShardSize);
+				EXPECT_EQ(false, config.EnableDbrbAggregateCertificates);
 
 				EXPECT_TRUE(config.Plugins.empty());
 			}
@@ -257,6 +260,7 @@ namespace catapult { namespace model {
 
 				EXPECT_EQ(false, config.EnableDbrbSharding);
 				EXPECT_EQ(6, config.DbrbShardSize);
+				EXPECT_EQ(false, config.EnableDbrbAggregateCertificates);
 
 				EXPECT_EQ(2u, config.Plugins.size());
 				const auto& pluginAlphaBag = config.Plugins.find("alpha")->second;
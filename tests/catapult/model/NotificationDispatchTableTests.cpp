@@ -0,0 +1,108 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "catapult/model/NotificationDispatchTable.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS NotificationDispatchTableTests
+
+	namespace {
+		NotificationType MakeType(FacilityCode facility, uint16_t code, NotificationChannel channel = NotificationChannel::All) {
+			return MakeNotificationType(channel, facility, code);
+		}
+
+		void AssertFound(const NotificationDispatchTable<std::string>& table, NotificationType type, const std::string& expectedValue) {
+			const auto* pValue = table.find(type);
+			ASSERT_TRUE(!!pValue) << utils::to_underlying_type(type);
+			EXPECT_EQ(expectedValue, *pValue) << utils::to_underlying_type(type);
+		}
+
+		void AssertNotFound(const NotificationDispatchTable<std::string>& table, NotificationType type) {
+			EXPECT_FALSE(!!table.find(type)) << utils::to_underlying_type(type);
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateEmptyTable) {
+		// Act:
+		NotificationDispatchTable<std::string> table({});
+
+		// Assert:
+		EXPECT_EQ(0u, table.size());
+		AssertNotFound(table, MakeType(FacilityCode::Core, 1));
+		AssertNotFound(table, MakeType(FacilityCode::Core, 0));
+	}
+
+	TEST(TEST_CLASS, CanFindAllRegisteredTypes) {
+		// Arrange:
+		std::map<NotificationType, std::string> values{
+			{ MakeType(FacilityCode::Core, 1), "core 1" },
+			{ MakeType(FacilityCode::Core, 7), "core 7" },
+			{ MakeType(FacilityCode::Transfer, 3), "transfer 3" },
+			{ MakeType(FacilityCode::Mosaic, 0), "mosaic 0" },
+			{ MakeType(FacilityCode::Mosaic, 0xFFFF), "mosaic max" }
+		};
+
+		// Act:
+		NotificationDispatchTable<std::string> table(std::move(values));
+
+		// Assert:
+		EXPECT_EQ(5u, table.size());
+		AssertFound(table, MakeType(FacilityCode::Core, 1), "core 1");
+		AssertFound(table, MakeType(FacilityCode::Core, 7), "core 7");
+		AssertFound(table, MakeType(FacilityCode::Transfer, 3), "transfer 3");
+		AssertFound(table, MakeType(FacilityCode::Mosaic, 0), "mosaic 0");
+		AssertFound(table, MakeType(FacilityCode::Mosaic, 0xFFFF), "mosaic max");
+	}
+
+	TEST(TEST_CLASS, CannotFindUnregisteredTypes) {
+		// Arrange:
+		NotificationDispatchTable<std::string> table({
+			{ MakeType(FacilityCode::Core, 3), "core 3" },
+			{ MakeType(FacilityCode::Core, 7), "core 7" }
+		});
+
+		// Act + Assert: codes below, between and above the registered codes as well as other facilities
+		for (auto code : std::initializer_list<uint16_t>{ 0, 2, 4, 6, 8, 0xFFFF })
+			AssertNotFound(table, MakeType(FacilityCode::Core, code));
+
+		AssertNotFound(table, MakeType(FacilityCode::Transfer, 3));
+		AssertNotFound(table, MakeType(FacilityCode::Aggregate, 7));
+	}
+
+	TEST(TEST_CLASS, LookupRespectsChannel) {
+		// Arrange: register types that only differ by channel
+		NotificationDispatchTable<std::string> table({
+			{ MakeType(FacilityCode::Core, 3, NotificationChannel::Validator), "core 3 validator" },
+			{ MakeType(FacilityCode::Core, 3, NotificationChannel::All), "core 3 all" },
+			{ MakeType(FacilityCode::Core, 4, NotificationChannel::Observer), "core 4 observer" }
+		});
+
+		// Act + Assert:
+		EXPECT_EQ(3u, table.size());
+		AssertFound(table, MakeType(FacilityCode::Core, 3, NotificationChannel::Validator), "core 3 validator");
+		AssertFound(table, MakeType(FacilityCode::Core, 3, NotificationChannel::All), "core 3 all");
+		AssertFound(table, MakeType(FacilityCode::Core, 4, NotificationChannel::Observer), "core 4 observer");
+
+		AssertNotFound(table, MakeType(FacilityCode::Core, 3, NotificationChannel::Observer));
+		AssertNotFound(table, MakeType(FacilityCode::Core, 4, NotificationChannel::All));
+	}
+
+	TEST(TEST_CLASS, CanStoreMoveOnlyValues) {
+		// Arrange:
+		std::map<NotificationType, std::unique_ptr<int>> values;
+		values.emplace(MakeType(FacilityCode::Core, 1), std::make_unique<int>(11));
+		values.emplace(MakeType(FacilityCode::Core, 2), std::make_unique<int>(22));
+
+		// Act:
+		NotificationDispatchTable<std::unique_ptr<int>> table(std::move(values));
+
+		// Assert:
+		EXPECT_EQ(11, **table.find(MakeType(FacilityCode::Core, 1)));
+		EXPECT_EQ(22, **table.find(MakeType(FacilityCode::Core, 2)));
+	}
+}}
@@ -70,11 +70,15 @@ namespace catapult { namespace plugins {
 		storageConfig.PreferCacheDatabase = true;
 		storageConfig.CacheDatabaseDirectory = "abc";
 		storageConfig.MaxCacheDatabaseWriteBatchSize = utils::FileSize::FromKilobytes(23);
+		storageConfig.CacheDatabaseTuning.BloomFilterBitsPerKey = 9;
+		storageConfig.CacheDatabaseTuning.ShouldSyncWrites = false;
 
 		auto assertCacheConfiguration = [](const auto& cacheConfig, const auto& expectedDirectory) {
 			EXPECT_TRUE(cacheConfig.ShouldUseCacheDatabase);
 			EXPECT_EQ(expectedDirectory, cacheConfig.CacheDatabaseDirectory);
 			EXPECT_EQ(utils::FileSize::FromKilobytes(23), cacheConfig.MaxCacheDatabaseWriteBatchSize);
+			EXPECT_EQ(9u, cacheConfig.CacheDatabaseTuning.BloomFilterBitsPerKey);
+			EXPECT_FALSE(cacheConfig.CacheDatabaseTuning.ShouldSyncWrites);
 			EXPECT_FALSE(cacheConfig.ShouldStorePatriciaTrees);
 		};
 
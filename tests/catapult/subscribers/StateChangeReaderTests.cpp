@@ -20,6 +20,7 @@
 
 #include "catapult/subscribers/StateChangeReader.h"
 #include "catapult/subscribers/SubscriberOperationTypes.h"
+#include "catapult/io/BufferCompression.h"
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
 #include "tests/test/other/mocks/MockStateChangeSubscriber.h"
@@ -37,6 +38,17 @@ namespace catapult { namespace subscribers {
 			return buffer;
 		}
 
+		std::vector<uint8_t> CreateCompressedSerializedDataBuffer(const std::vector<uint64_t>& values) {
+			auto compressedValues = io::CompressBuffer({ reinterpret_cast<const uint8_t*>(values.data()), values.size() * sizeof(uint64_t) });
+
+			std::vector<uint8_t> buffer(1 + 2 * sizeof(uint32_t) + compressedValues.size());
+			buffer[0] = utils::to_underlying_type(StateChangeOperationType::Compressed_State_Change);
+			reinterpret_cast<uint32_t&>(buffer[1]) = static_cast<uint32_t>(values.size() * sizeof(uint64_t));
+			reinterpret_cast<uint32_t&>(buffer[1 + sizeof(uint32_t)]) = static_cast<uint32_t>(compressedValues.size());
+			std::memcpy(&buffer[1 + 2 * sizeof(uint32_t)], compressedValues.data(), compressedValues.size());
+			return buffer;
+		}
+
 		// region MockCacheChangesStorageReader / ReadValueAt
 
 		// simulate CacheChangesStorage by reading single uint32_t value in loadAll and inserting it into Added container (as sentinel)
@@ -134,6 +146,49 @@ namespace catapult { namespace subscribers {
 		EXPECT_EQ(values[3] >> 32, ReadValueAt<1>(capturedStateChangeInfo));
 	}
 
+	TEST(TEST_CLASS, CanReadSingleCompressedStateChange) {
+		// Arrange:
+		auto values = test::GenerateRandomDataVector<uint64_t>(4);
+		auto buffer = CreateCompressedSerializedDataBuffer(values);
+
+		// - simulate two cache changes storages
+		mocks::MockMemoryStream stream(buffer);
+		CacheChangesStorages cacheChangesStorages;
+		cacheChangesStorages.emplace_back(std::make_unique<MockCacheChangesStorageReader>());
+		cacheChangesStorages.emplace_back(std::make_unique<MockCacheChangesStorageReader>());
+		mocks::MockStateChangeSubscriber subscriber;
+
+		// Act:
+		ReadNextStateChange(stream, cacheChangesStorages, subscriber);
+
+		// Assert:
+		EXPECT_EQ(0u, subscriber.numScoreChanges());
+		ASSERT_EQ(1u, subscriber.numStateChanges());
+		EXPECT_TRUE(stream.eof());
+
+		const auto& capturedStateChangeInfo = subscriber.lastStateChangeInfo();
+		EXPECT_EQ(model::ChainScore(values[0], values[1]), capturedStateChangeInfo.ScoreDelta);
+		EXPECT_EQ(Height(values[2]), capturedStateChangeInfo.Height);
+
+		// - each cache changes storage extracted single uint32_t value
+		EXPECT_EQ(values[3] & 0xFFFF'FFFF, ReadValueAt<0>(capturedStateChangeInfo));
+		EXPECT_EQ(values[3] >> 32, ReadValueAt<1>(capturedStateChangeInfo));
+	}
+
+	TEST(TEST_CLASS, CannotReadSingleCompressedStateChangeWithTrailingBytes) {
+		// Arrange: only a single cache changes storage consumes data
+		auto values = test::GenerateRandomDataVector<uint64_t>(4);
+		auto buffer = CreateCompressedSerializedDataBuffer(values);
+
+		mocks::MockMemoryStream stream(buffer);
+		CacheChangesStorages cacheChangesStorages;
+		cacheChangesStorages.emplace_back(std::make_unique<MockCacheChangesStorageReader>());
+		mocks::MockStateChangeSubscriber subscriber;
+
+		// Act + Assert:
+		EXPECT_THROW(ReadNextStateChange(stream, cacheChangesStorages, subscriber), catapult_invalid_argument);
+	}
+
 	TEST(TEST_CLASS, CannotReadSingleUnknownOperationType) {
 		// Arrange:
 		auto values = test::GenerateRandomDataVector<uint64_t>(2);
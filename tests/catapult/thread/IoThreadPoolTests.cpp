@@ -22,6 +22,10 @@
 #include "catapult/ionet/IoTypes.h"
 #include "tests/test/core/WaitFunctions.h"
 #include "tests/TestHarness.h"
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
 
 namespace catapult { namespace thread {
 
@@ -301,4 +305,173 @@ namespace catapult { namespace thread {
 		EXPECT_EQ(Num_Default_Threads, pPool->numWorkerThreads());
 		EXPECT_EQ(2 * Num_Default_Threads, work.numHandlerCalls());
 	}
+
+	// region io contexts
+
+	namespace {
+		constexpr uint32_t Num_Sharded_Threads = 4;
+
+		auto CreateShardedIoThreadPool(bool shouldPinThreads = false) {
+			IoThreadPoolOptions options;
+			options.Mode = IoThreadPoolMode::Sharded;
+			options.ShouldPinThreads = shouldPinThreads;
+			return CreateIoThreadPool(Num_Sharded_Threads, "sharded", options);
+		}
+	}
+
+	TEST(TEST_CLASS, SharedPoolReturnsSameIoContextForAllAffinityKeys) {
+		// Arrange:
+		auto pPool = CreateDefaultIoThreadPool();
+		auto* pIoContext = &pPool->ioContext();
+
+		// Act + Assert:
+		for (auto i = 0u; i < 2 * Num_Default_Threads; ++i) {
+			EXPECT_EQ(pIoContext, &pPool->ioContext()) << i;
+			EXPECT_EQ(pIoContext, &pPool->ioContext(i)) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, ShardedPoolReturnsDistinctIoContextForEachWorkerThread) {
+		// Arrange:
+		auto pPool = CreateShardedIoThreadPool();
+
+		// Act:
+		std::set<boost::asio::io_context*> ioContexts;
+		for (auto i = 0u; i < Num_Sharded_Threads; ++i)
+			ioContexts.insert(&pPool->ioContext(i));
+
+		// Assert: affinity keys wrap around
+		EXPECT_EQ(Num_Sharded_Threads, ioContexts.size());
+		for (auto i = 0u; i < Num_Sharded_Threads; ++i)
+			EXPECT_EQ(&pPool->ioContext(i), &pPool->ioContext(Num_Sharded_Threads + i)) << i;
+	}
+
+	TEST(TEST_CLASS, ShardedPoolReturnsIoContextsRoundRobin) {
+		// Arrange:
+		auto pPool = CreateShardedIoThreadPool();
+
+		// Act:
+		std::vector<boost::asio::io_context*> ioContexts;
+		for (auto i = 0u; i < 2 * Num_Sharded_Threads; ++i)
+			ioContexts.push_back(&pPool->ioContext());
+
+		// Assert:
+		EXPECT_EQ(Num_Sharded_Threads, std::set<boost::asio::io_context*>(ioContexts.cbegin(), ioContexts.cend()).size());
+		for (auto i = 0u; i < Num_Sharded_Threads; ++i)
+			EXPECT_EQ(ioContexts[i], ioContexts[Num_Sharded_Threads + i]) << i;
+	}
+
+	TEST(TEST_CLASS, ShardedPoolCanBeStartedAndJoined) {
+		// Arrange:
+		auto pPool = CreateShardedIoThreadPool();
+
+		// Act:
+		pPool->start();
+		auto numWorkerThreadsAfterStart = pPool->numWorkerThreads();
+		pPool->join();
+
+		// Assert:
+		EXPECT_EQ(Num_Sharded_Threads, numWorkerThreadsAfterStart);
+		EXPECT_EQ(0u, pPool->numWorkerThreads());
+	}
+
+	TEST(TEST_CLASS, ShardedPoolWithPinnedThreadsCanBeStartedAndJoined) {
+		// Arrange: pinning failures are only logged, so the pool always starts
+		auto pPool = CreateShardedIoThreadPool(true);
+
+		// Act:
+		pPool->start();
+		auto numWorkerThreadsAfterStart = pPool->numWorkerThreads();
+		pPool->join();
+
+		// Assert:
+		EXPECT_EQ(Num_Sharded_Threads, numWorkerThreadsAfterStart);
+		EXPECT_EQ(0u, pPool->numWorkerThreads());
+	}
+
+	TEST(TEST_CLASS, ShardedPoolExecutesHandlersWithSameAffinityKeyOnSameThread) {
+		// Arrange:
+		auto pPool = CreateShardedIoThreadPool();
+		pPool->start();
+
+		// Act: post multiple handlers for each affinity key
+		std::mutex mutex;
+		std::map<size_t, std::set<std::thread::id>> affinityKeyThreadIds;
+		for (auto i = 0u; i < 10 * Num_Sharded_Threads; ++i) {
+			auto affinityKey = i % Num_Sharded_Threads;
+			pPool->post(affinityKey, [&mutex, &affinityKeyThreadIds, affinityKey]() {
+				std::lock_guard<std::mutex> guard(mutex);
+				affinityKeyThreadIds[affinityKey].insert(std::this_thread::get_id());
+			});
+		}
+
+		pPool->join();
+
+		// Assert: each affinity key was served by a single distinct thread
+		std::set<std::thread::id> allThreadIds;
+		for (const auto& pair : affinityKeyThreadIds) {
+			EXPECT_EQ(1u, pair.second.size()) << pair.first;
+			allThreadIds.insert(pair.second.cbegin(), pair.second.cend());
+		}
+
+		EXPECT_EQ(Num_Sharded_Threads, affinityKeyThreadIds.size());
+		EXPECT_EQ(Num_Sharded_Threads, allThreadIds.size());
+	}
+
+	// endregion
+
+	// region diagnostics
+
+	TEST(TEST_CLASS, DiagnosticsAreInitiallyZero) {
+		// Act:
+		auto pPool = CreateDefaultIoThreadPool();
+		auto diagnostics = pPool->diagnostics();
+
+		// Assert:
+		EXPECT_EQ(0u, diagnostics.QueueDepth);
+		EXPECT_EQ(0u, diagnostics.NumExecutedHandlers);
+		EXPECT_EQ(0u, diagnostics.TotalQueueLatencyMicros);
+		EXPECT_EQ(0u, diagnostics.MaxQueueLatencyMicros);
+	}
+
+	namespace {
+		void AssertDiagnosticsTrackPostedHandlers(IoThreadPool& pool) {
+			// Arrange: post handlers before starting the pool so that they are queued
+			std::atomic<uint32_t> numHandlerCalls(0);
+			for (auto i = 0u; i < 20; ++i)
+				pool.post(i, [&numHandlerCalls]() { ++numHandlerCalls; });
+
+			auto diagnosticsBeforeStart = pool.diagnostics();
+			test::Sleep(5);
+
+			// Act:
+			pool.start();
+			pool.join();
+			auto diagnostics = pool.diagnostics();
+
+			// Assert:
+			EXPECT_EQ(20u, diagnosticsBeforeStart.QueueDepth);
+			EXPECT_EQ(0u, diagnosticsBeforeStart.NumExecutedHandlers);
+
+			EXPECT_EQ(20u, numHandlerCalls);
+			EXPECT_EQ(0u, diagnostics.QueueDepth);
+			EXPECT_EQ(20u, diagnostics.NumExecutedHandlers);
+			EXPECT_LE(diagnostics.MaxQueueLatencyMicros, diagnostics.TotalQueueLatencyMicros);
+			EXPECT_LE(5'000u, diagnostics.MaxQueueLatencyMicros);
+		}
+	}
+
+	TEST(TEST_CLASS, DiagnosticsTrackPostedHandlers_Shared) {
+		// Assert:
+		auto pPool = CreateDefaultIoThreadPool();
+		AssertDiagnosticsTrackPostedHandlers(*pPool);
+	}
+
+	TEST(TEST_CLASS, DiagnosticsTrackPostedHandlers_Sharded) {
+		// Assert:
+		auto pPool = CreateShardedIoThreadPool();
+		AssertDiagnosticsTrackPostedHandlers(*pPool);
+	}
+
+	// endregion
 }}
@@ -22,6 +22,8 @@
 #include "catapult/utils/MemoryUtils.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
 #include <mutex>
+#include <set>
+#include <thread>
 
 namespace catapult { namespace thread {
 
@@ -230,6 +232,50 @@ namespace catapult { namespace thread {
 		});
 	}
 
+	namespace {
+		IoThreadPoolOptions CreateShardedPoolOptions() {
+			IoThreadPoolOptions options;
+			options.Mode = IoThreadPoolMode::Sharded;
+			return options;
+		}
+
+		size_t CountDistinctIoContexts(IoThreadPool& pool) {
+			std::set<boost::asio::io_context*> ioContexts;
+			for (auto i = 0u; i < 2 * pool.numWorkerThreads(); ++i)
+				ioContexts.insert(&pool.ioContext(i));
+
+			return ioContexts.size();
+		}
+	}
+
+	TEST(TEST_CLASS, CanAddSingleIsolatedPoolWithCustomOptions) {
+		// Arrange:
+		MultiServicePool pool("foo", 3);
+
+		// Act:
+		auto pPool = pool.pushIsolatedPool("pool", 2, CreateShardedPoolOptions());
+
+		// Assert:
+		EXPECT_EQ(3u + 2, pool.numWorkerThreads());
+		EXPECT_EQ(1u, pool.numServices());
+
+		EXPECT_EQ(2u, pPool->numWorkerThreads());
+		EXPECT_EQ(2u, CountDistinctIoContexts(*pPool));
+	}
+
+	TEST(TEST_CLASS, IsolatedPoolsInheritPrimaryPoolOptionsByDefault) {
+		// Arrange:
+		MultiServicePool pool("foo", 3, MultiServicePool::IsolatedPoolMode::Enabled, CreateShardedPoolOptions());
+
+		// Act:
+		auto pDefaultPool = pool.pushIsolatedPool("default", 2);
+		auto pSharedPool = pool.pushIsolatedPool("shared", 2, IoThreadPoolOptions());
+
+		// Assert:
+		EXPECT_EQ(2u, CountDistinctIoContexts(*pDefaultPool));
+		EXPECT_EQ(1u, CountDistinctIoContexts(*pSharedPool));
+	}
+
 	namespace {
 		template<typename TCreatePool>
 		void AssertCanAddSingleMergedPool(TCreatePool createIsolatedPool) {
@@ -267,6 +313,68 @@ namespace catapult { namespace thread {
 
 	// endregion
 
+	// region diagnostics
+
+	TEST(TEST_CLASS, DiagnosticsCombinePrimaryAndIsolatedPools) {
+		// Arrange:
+		ShutdownIds shutdownIds;
+		MultiServicePool pool("foo", 3);
+		auto pIsolatedPool1 = pool.pushIsolatedPool("alpha", 1);
+		auto pIsolatedPool2 = pool.pushIsolatedPool("beta", 2, CreateShardedPoolOptions());
+
+		// Act: post handlers to the primary pool (via a service group) and to both isolated pools
+		std::atomic<uint32_t> numHandlerCalls(0);
+		auto handler = [&numHandlerCalls]() { ++numHandlerCalls; };
+		auto pServiceGroup = pool.pushServiceGroup("zeta");
+		pServiceGroup->pushService([handler](const auto& pPool, auto id, auto& ids) {
+			pPool->post(0, handler);
+			return CreateFooService(pPool, id, ids);
+		}, 7, shutdownIds);
+
+		for (auto i = 0u; i < 2; ++i)
+			pIsolatedPool1->post(i, handler);
+
+		for (auto i = 0u; i < 4; ++i)
+			pIsolatedPool2->post(i, handler);
+
+		WAIT_FOR_VALUE(7u, numHandlerCalls);
+		auto diagnostics = pool.diagnostics();
+
+		// Assert:
+		EXPECT_EQ(0u, diagnostics.QueueDepth);
+		EXPECT_EQ(7u, diagnostics.NumExecutedHandlers);
+		EXPECT_LE(diagnostics.MaxQueueLatencyMicros, diagnostics.TotalQueueLatencyMicros);
+	}
+
+	TEST(TEST_CLASS, DiagnosticsCanBeRetrievedConcurrentlyWithIsolatedPoolCreationAndShutdown) {
+		// Arrange:
+		MultiServicePool pool("foo", 2);
+		std::atomic_bool isDone(false);
+		std::atomic<uint32_t> numDiagnosticsCalls(0);
+		std::thread diagnosticsThread([&pool, &isDone, &numDiagnosticsCalls]() {
+			while (!isDone) {
+				pool.diagnostics();
+				++numDiagnosticsCalls;
+			}
+		});
+
+		// Act: create and destroy isolated pools while diagnostics are being retrieved
+		WAIT_FOR_EXPR(0u != numDiagnosticsCalls);
+		for (auto i = 0u; i < 20; ++i)
+			pool.pushIsolatedPool("alpha" + std::to_string(i), 1);
+
+		pool.shutdown();
+		isDone = true;
+		diagnosticsThread.join();
+
+		// Assert:
+		auto diagnostics = pool.diagnostics();
+		EXPECT_EQ(0u, diagnostics.QueueDepth);
+		EXPECT_EQ(0u, diagnostics.NumExecutedHandlers);
+	}
+
+	// endregion
+
 	// region pushServiceGroup / pushIsolatedPool
 
 	TEST(TEST_CLASS, CanAddMultipleServices) {
@@ -328,6 +328,165 @@ namespace catapult { namespace thread {
 
 	// endregion
 
+	// region ParallelForDynamic
+
+	CONTAINER_TEST(CanProcessItemsDynamically_ZeroItems) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+		auto items = typename TTraits::ContainerType();
+
+		// Act:
+		std::atomic<size_t> counter(0);
+		ParallelForDynamic(context.pPool->ioContext(), items, context.NumThreads, [&counter](auto, auto) {
+			++counter;
+			return true;
+		}).get();
+
+		// Assert: the item callback was not called
+		EXPECT_EQ(0u, counter);
+	}
+
+	CONTAINER_TEST(CanProcessItemsDynamically_OneItem) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+		auto items = typename TTraits::ContainerType{ 7 };
+
+		// Act:
+		std::atomic<size_t> sum(0);
+		std::vector<uint8_t> indexFlags(1, 0);
+		ParallelForDynamic(context.pPool->ioContext(), items, context.NumThreads, CreateItemAggregate(sum, indexFlags)).get();
+
+		// Assert: the callback was only called once (since there is only one item)
+		EXPECT_EQ(7u, sum);
+		EXPECT_EQ(std::vector<uint8_t>(1, 1), indexFlags);
+	}
+
+	CONTAINER_TEST(CanProcessItemsDynamically) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context(1);
+
+		// Act:
+		std::atomic<size_t> sum(0);
+		std::vector<uint8_t> indexFlags(context.NumItems, 0);
+		ParallelForDynamic(context.pPool->ioContext(), context.Items, context.NumThreads, CreateItemAggregate(sum, indexFlags)).get();
+
+		// Assert:
+		EXPECT_EQ(context.ItemsSum, sum);
+		EXPECT_EQ(std::vector<uint8_t>(context.NumItems, 1), indexFlags);
+	}
+
+	CONTAINER_TEST(CanProcessItemsDynamicallyWithCostEstimator) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context(1);
+
+		// Act: use item values as costs
+		std::atomic<size_t> sum(0);
+		std::vector<uint8_t> indexFlags(context.NumItems, 0);
+		ParallelForDynamic(context.pPool->ioContext(), context.Items, context.NumThreads, [](auto value) {
+			return value;
+		}, CreateItemAggregate(sum, indexFlags)).get();
+
+		// Assert:
+		EXPECT_EQ(context.ItemsSum, sum);
+		EXPECT_EQ(std::vector<uint8_t>(context.NumItems, 1), indexFlags);
+	}
+
+	CONTAINER_TEST(CorrectIndexesAreAssociatedWithItemsDynamically) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+
+		// Act: capture all values by their index
+		std::vector<uint32_t> capturedValues(context.NumItems, 0);
+		ParallelForDynamic(context.pPool->ioContext(), context.Items, context.NumThreads, [](auto value) {
+			return 0 == value % 3 ? 100u : 1u;
+		}, [&capturedValues](auto value, auto index) {
+			// Sanity: fail if any index is too large
+			EXPECT_GT(capturedValues.size(), index) << "unexpected index " << index;
+			if (capturedValues.size() <= index)
+				return false;
+
+			capturedValues[index] = value;
+			return true;
+		}).get();
+
+		// Assert: values start at 1
+		for (auto i = 0u; i < capturedValues.size(); ++i)
+			EXPECT_EQ(i + 1, capturedValues[i]) << "i " << i;
+	}
+
+	CONTAINER_TEST(CanModifyItemsDynamically) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+
+		// Act:
+		ParallelForDynamic(context.pPool->ioContext(), context.Items, context.NumThreads, [](auto& value, auto) {
+			value = value * value + 1;
+			return true;
+		}).get();
+
+		// Assert: all values should have been modified
+		auto i = 1u;
+		for (auto value : context.Items) {
+			EXPECT_EQ(i * i + 1u, value) << "item at " << i;
+			++i;
+		}
+	}
+
+	TEST(TEST_CLASS, CanShortCircuitDynamicItemProcessing) {
+		// Arrange:
+		BasicTestContext<std::vector<ItemType>> context;
+
+		// Act:
+		std::atomic<size_t> counter(0);
+		ParallelForDynamic(context.pPool->ioContext(), context.Items, context.NumThreads, [&counter](auto, auto) {
+			++counter;
+			return false;
+		}).get();
+
+		// Assert: every worker stopped after processing (at most) one item
+		EXPECT_LE(1u, counter);
+		EXPECT_GE(context.NumThreads, counter);
+	}
+
+	TEST(TEST_CLASS, DynamicItemProcessingPropagatesException) {
+		// Arrange:
+		BasicTestContext<std::vector<ItemType>> context;
+
+		// Act + Assert:
+		auto future = ParallelForDynamic(context.pPool->ioContext(), context.Items, context.NumThreads, [](auto value, auto) {
+			if (7 == value)
+				CATAPULT_THROW_RUNTIME_ERROR("seven is not allowed");
+
+			return true;
+		});
+		EXPECT_THROW(future.get(), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, ExpensiveItemDoesNotStallDynamicProcessingOfOtherItems) {
+		// Arrange: make the first item much more expensive than all other items
+		BasicTestContext<std::vector<ItemType>> context;
+		auto numItems = context.NumItems;
+
+		// Act: block the first item until all other items have been processed
+		//      (this would deadlock if the first item shared its batch with other items)
+		std::atomic<size_t> numOtherItemsProcessed(0);
+		ParallelForDynamic(context.pPool->ioContext(), context.Items, context.NumThreads, [numItems](auto value) {
+			return 1 == value ? numItems * 100 : 1u;
+		}, [&numOtherItemsProcessed, numItems](auto value, auto) {
+			if (1 == value)
+				WAIT_FOR_VALUE_EXPR(numItems - 1, numOtherItemsProcessed.load());
+			else
+				++numOtherItemsProcessed;
+
+			return true;
+		}).get();
+
+		// Assert:
+		EXPECT_EQ(numItems - 1, numOtherItemsProcessed);
+	}
+
+	// endregion
+
 	// region ParallelFor[Partition] distributed
 
 	namespace {
@@ -342,13 +501,14 @@ namespace catapult { namespace thread {
 		using MultiThreadedState = test::BasicMultiThreadedState<ParallelForTraits>;
 
 		struct DistributeParallelForTraits {
+			template<typename TExecutor>
 			static void ParallelFor(
-					boost::asio::io_context& ioContext,
+					TExecutor& executor,
 					const std::vector<ItemType>& items,
 					size_t numThreads,
 					MultiThreadedState& state) {
 				std::atomic<size_t> numItemsProcessed(0);
-				thread::ParallelFor(ioContext, items, numThreads, [&state, &numItemsProcessed, numThreads](auto value, auto) {
+				thread::ParallelFor(executor, items, numThreads, [&state, &numItemsProcessed, numThreads](auto value, auto) {
 					// - process the value
 					state.process(value);
 
@@ -361,13 +521,14 @@ namespace catapult { namespace thread {
 		};
 
 		struct DistributeParallelForPartitionTraits {
+			template<typename TExecutor>
 			static void ParallelFor(
-					boost::asio::io_context& ioContext,
+					TExecutor& executor,
 					const std::vector<ItemType>& items,
 					size_t numThreads,
 					MultiThreadedState& state) {
 				std::atomic<size_t> numItemsProcessed(0);
-				ParallelForPartition(ioContext, items, numThreads, [&state, &numItemsProcessed, numThreads](
+				ParallelForPartition(executor, items, numThreads, [&state, &numItemsProcessed, numThreads](
 						auto itBegin,
 						auto itEnd,
 						auto,
@@ -384,8 +545,28 @@ namespace catapult { namespace thread {
 			}
 		};
 
-		template<typename TParallelFunc>
-		void AssertCanDistributeWorkEvenly(size_t multiplier, size_t divisor, TParallelFunc parallelFunc) {
+		struct DistributeParallelForDynamicTraits {
+			template<typename TExecutor>
+			static void ParallelFor(
+					TExecutor& executor,
+					const std::vector<ItemType>& items,
+					size_t numThreads,
+					MultiThreadedState& state) {
+				std::atomic<size_t> numItemsProcessed(0);
+				ParallelForDynamic(executor, items, numThreads, [&state, &numItemsProcessed, numThreads](auto value, auto) {
+					// - process the value
+					state.process(value);
+
+					// - wait for all threads to spawn before continuing
+					++numItemsProcessed;
+					WAIT_FOR_EXPR(numItemsProcessed >= numThreads);
+					return true;
+				}).get();
+			}
+		};
+
+		template<typename TTraits>
+		void AssertCanDistributeWorkEvenly(size_t multiplier, size_t divisor) {
 			// Arrange:
 			auto pPool = test::CreateStartedIoThreadPool();
 			auto numThreads = pPool->numWorkerThreads();
@@ -397,7 +578,7 @@ namespace catapult { namespace thread {
 
 			// Act:
 			MultiThreadedState state;
-			parallelFunc(pPool->ioContext(), items, numThreads, state);
+			TTraits::ParallelFor(pPool->ioContext(), items, numThreads, state);
 
 			// Assert: all items were processed once
 			EXPECT_EQ(numItems, state.counter());
@@ -423,12 +604,81 @@ namespace catapult { namespace thread {
 
 	DISTRIBUTE_TEST(CanDistributeWorkEvenlyWhenItemsAreMultipleOfThreads) {
 		// Assert:
-		AssertCanDistributeWorkEvenly(20, 1, TTraits::ParallelFor);
+		AssertCanDistributeWorkEvenly<TTraits>(20, 1);
 	}
 
 	DISTRIBUTE_TEST(CanDistributeWorkEvenlyWhenItemsAreNotMultipleOfThreads) {
 		// Assert:
-		AssertCanDistributeWorkEvenly(81, 4, TTraits::ParallelFor);
+		AssertCanDistributeWorkEvenly<TTraits>(81, 4);
+	}
+
+	TEST(TEST_CLASS, CanDistributeWorkAcrossAllThreadsDynamically) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		auto numThreads = pPool->numWorkerThreads();
+		auto numItems = numThreads * 20;
+		auto items = CreateIncrementingValues(numItems);
+
+		// Act:
+		MultiThreadedState state;
+		DistributeParallelForDynamicTraits::ParallelFor(pPool->ioContext(), items, numThreads, state);
+
+		// Assert: all items were processed once
+		EXPECT_EQ(numItems, state.counter());
+		EXPECT_EQ(numItems, state.numUniqueItems());
+
+		// - all execution threads were used (but chunks are claimed on demand, so work is not necessarily split evenly)
+		EXPECT_EQ(numThreads, state.threadCounters().size());
+		EXPECT_EQ(numThreads, state.sortedAndReducedThreadIds().size());
+	}
+
+	// endregion
+
+	// region sharded pool
+
+	namespace {
+		template<typename TTraits>
+		void AssertCanDistributeWorkAcrossAllShards() {
+			// Arrange:
+			IoThreadPoolOptions options;
+			options.Mode = IoThreadPoolMode::Sharded;
+			auto pPool = CreateIoThreadPool(test::GetNumDefaultPoolThreads(), "sharded", options);
+			pPool->start();
+
+			auto numThreads = pPool->numWorkerThreads();
+			auto numItems = numThreads * 20;
+			auto items = CreateIncrementingValues(numItems);
+
+			// Act: each worker waits for all other workers, so this only completes when work is posted to every shard
+			MultiThreadedState state;
+			TTraits::ParallelFor(*pPool, items, numThreads, state);
+
+			// Assert: all items were processed once
+			EXPECT_EQ(numItems, state.counter());
+			EXPECT_EQ(numItems, state.numUniqueItems());
+
+			// - all execution threads were used
+			EXPECT_EQ(numThreads, state.threadCounters().size());
+			EXPECT_EQ(numThreads, state.sortedAndReducedThreadIds().size());
+
+			// - work was posted through the pool
+			EXPECT_EQ(numThreads, pPool->diagnostics().NumExecutedHandlers);
+		}
+	}
+
+	TEST(TEST_CLASS, CanDistributeWorkAcrossAllShards) {
+		// Assert:
+		AssertCanDistributeWorkAcrossAllShards<DistributeParallelForTraits>();
+	}
+
+	TEST(TEST_CLASS, CanDistributeWorkAcrossAllShards_Partition) {
+		// Assert:
+		AssertCanDistributeWorkAcrossAllShards<DistributeParallelForPartitionTraits>();
+	}
+
+	TEST(TEST_CLASS, CanDistributeWorkAcrossAllShards_Dynamic) {
+		// Assert:
+		AssertCanDistributeWorkAcrossAllShards<DistributeParallelForDynamicTraits>();
 	}
 
 	// endregion
@@ -0,0 +1,40 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "catapult/utils/CompressionMode.h"
+#include "tests/test/nodeps/ConfigurationTestUtils.h"
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS CompressionModeTests
+
+	// region parsing
+
+	TEST(TEST_CLASS, CanParseValidCompressionModeValue) {
+		// Arrange:
+		auto assertSuccessfulParse = [](const auto& input, const auto& expectedParsedValue) {
+			test::AssertParse(input, expectedParsedValue, [](const auto& str, auto& parsedValue) {
+				return TryParseValue(str, parsedValue);
+			});
+		};
+
+		// Assert:
+		assertSuccessfulParse("default", CompressionMode::Default);
+		assertSuccessfulParse("none", CompressionMode::None);
+		assertSuccessfulParse("snappy", CompressionMode::Snappy);
+		assertSuccessfulParse("lz4", CompressionMode::Lz4);
+		assertSuccessfulParse("zstd", CompressionMode::Zstd);
+	}
+
+	TEST(TEST_CLASS, CannotParseInvalidCompressionModeValue) {
+		// Assert:
+		test::AssertEnumParseFailure("zlib", CompressionMode::Default, [](const auto& str, auto& parsedValue) {
+			return TryParseValue(str, parsedValue);
+		});
+	}
+
+	// endregion
+}}
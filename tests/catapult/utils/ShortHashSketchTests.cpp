@@ -0,0 +1,184 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "catapult/utils/ShortHashSketch.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS ShortHashSketchTests
+
+	namespace {
+		std::vector<ShortHash> GenerateUniqueShortHashes(size_t count) {
+			ShortHashesSet shortHashes;
+			while (shortHashes.size() < count)
+				shortHashes.insert(test::GenerateRandomValue<ShortHash>());
+
+			return std::vector<ShortHash>(shortHashes.cbegin(), shortHashes.cend());
+		}
+
+		ShortHashSketch CreateSketch(size_t numCells, const std::vector<ShortHash>& shortHashes) {
+			ShortHashSketch sketch(numCells);
+			for (auto shortHash : shortHashes)
+				sketch.insert(shortHash);
+
+			return sketch;
+		}
+
+		ShortHashesSet ToSet(const std::vector<ShortHash>& shortHashes) {
+			return ShortHashesSet(shortHashes.cbegin(), shortHashes.cend());
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateSketchWithMultipleOfHashFunctionsCells) {
+		// Act:
+		ShortHashSketch sketch(30);
+
+		// Assert:
+		EXPECT_EQ(30u, sketch.size());
+		EXPECT_EQ(30u, sketch.cells().size());
+	}
+
+	TEST(TEST_CLASS, SketchSizeIsRoundedUpToMultipleOfHashFunctions) {
+		for (auto numCells : { 0u, 1u, 2u, 3u, 31u, 32u, 33u }) {
+			// Act:
+			ShortHashSketch sketch(numCells);
+
+			// Assert:
+			auto expectedSize = std::max<size_t>(3, (numCells + 2) / 3 * 3);
+			EXPECT_EQ(expectedSize, sketch.size()) << numCells;
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateSketchAroundValidCells) {
+		// Act:
+		ShortHashSketch sketch(std::vector<ShortHashSketchCell>(12));
+
+		// Assert:
+		EXPECT_EQ(12u, sketch.size());
+	}
+
+	TEST(TEST_CLASS, CannotCreateSketchAroundInvalidCells) {
+		for (auto numCells : { 0u, 1u, 2u, 13u })
+			EXPECT_THROW(ShortHashSketch(std::vector<ShortHashSketchCell>(numCells)), catapult_invalid_argument) << numCells;
+	}
+
+	// endregion
+
+	// region insert / subtract
+
+	TEST(TEST_CLASS, InsertUpdatesOneCellPerHashFunction) {
+		// Arrange:
+		ShortHashSketch sketch(30);
+
+		// Act:
+		sketch.insert(ShortHash(0x12345678));
+
+		// Assert:
+		for (auto i = 0u; i < ShortHashSketch::Num_Hash_Functions; ++i) {
+			auto numUpdatedCells = std::count_if(sketch.cells().cbegin() + i * 10, sketch.cells().cbegin() + (i + 1) * 10, [](const auto& cell) {
+				return 1 == cell.Count && ShortHash(0x12345678) == cell.KeySum;
+			});
+			EXPECT_EQ(1, numUpdatedCells) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, SubtractingSketchOfSameSetYieldsEmptySketch) {
+		// Arrange:
+		auto shortHashes = GenerateUniqueShortHashes(100);
+		auto sketch = CreateSketch(30, shortHashes);
+
+		// Act:
+		sketch.subtract(CreateSketch(30, shortHashes));
+
+		// Assert:
+		for (const auto& cell : sketch.cells()) {
+			EXPECT_EQ(0, cell.Count);
+			EXPECT_EQ(ShortHash(0), cell.KeySum);
+			EXPECT_EQ(0u, cell.CheckSum);
+		}
+	}
+
+	TEST(TEST_CLASS, CannotSubtractSketchWithDifferentSize) {
+		// Arrange:
+		ShortHashSketch sketch(30);
+
+		// Act + Assert:
+		EXPECT_THROW(sketch.subtract(ShortHashSketch(33)), catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region tryDecode
+
+	TEST(TEST_CLASS, CanDecodeEmptySketch) {
+		// Arrange:
+		ShortHashSketch sketch(30);
+
+		// Act:
+		ShortHashesSet positiveShortHashes;
+		ShortHashesSet negativeShortHashes;
+		auto result = sketch.tryDecode(positiveShortHashes, negativeShortHashes);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_TRUE(positiveShortHashes.empty());
+		EXPECT_TRUE(negativeShortHashes.empty());
+	}
+
+	TEST(TEST_CLASS, CanDecodeSymmetricDifferenceOfLargeSets) {
+		// Arrange: 1000 shared short hashes, 10 only in first set and 15 only in second set
+		auto shortHashes = GenerateUniqueShortHashes(1025);
+		std::vector<ShortHash> shortHashes1(shortHashes.cbegin(), shortHashes.cbegin() + 1010);
+		std::vector<ShortHash> shortHashes2(shortHashes.cbegin(), shortHashes.cbegin() + 1000);
+		shortHashes2.insert(shortHashes2.end(), shortHashes.cbegin() + 1010, shortHashes.cend());
+
+		auto sketch = CreateSketch(90, shortHashes1);
+		sketch.subtract(CreateSketch(90, shortHashes2));
+
+		// Act:
+		ShortHashesSet positiveShortHashes;
+		ShortHashesSet negativeShortHashes;
+		auto result = sketch.tryDecode(positiveShortHashes, negativeShortHashes);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(ToSet({ shortHashes.cbegin() + 1000, shortHashes.cbegin() + 1010 }), positiveShortHashes);
+		EXPECT_EQ(ToSet({ shortHashes.cbegin() + 1010, shortHashes.cend() }), negativeShortHashes);
+	}
+
+	TEST(TEST_CLASS, CannotDecodeSketchWithDifferenceLargerThanCapacity) {
+		// Arrange: difference of 100 short hashes cannot be decoded from 30 cells
+		auto sketch = CreateSketch(30, GenerateUniqueShortHashes(100));
+
+		// Act:
+		ShortHashesSet positiveShortHashes;
+		ShortHashesSet negativeShortHashes;
+		auto result = sketch.tryDecode(positiveShortHashes, negativeShortHashes);
+
+		// Assert:
+		EXPECT_FALSE(result);
+	}
+
+	TEST(TEST_CLASS, DecodeDoesNotModifySketch) {
+		// Arrange:
+		auto sketch = CreateSketch(30, GenerateUniqueShortHashes(5));
+		auto originalCells = sketch.cells();
+
+		// Act:
+		ShortHashesSet positiveShortHashes;
+		ShortHashesSet negativeShortHashes;
+		sketch.tryDecode(positiveShortHashes, negativeShortHashes);
+
+		// Assert:
+		ASSERT_EQ(originalCells.size(), sketch.size());
+		EXPECT_EQ_MEMORY(originalCells.data(), sketch.cells().data(), originalCells.size() * sizeof(ShortHashSketchCell));
+	}
+
+	// endregion
+}}
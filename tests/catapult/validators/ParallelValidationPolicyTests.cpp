@@ -562,17 +562,15 @@ namespace catapult { namespace validators {
 			ValidateMany<TTraits>(states, numValidators, numEntities);
 
 			// Assert: each validator was called numEntities times (with a unique entity)
-			auto minWorkPerThread = numEntities / Num_Default_Threads;
 			for (auto i = 0u; i < numValidators; ++i) {
 				const auto& state = *states[i];
 				EXPECT_EQ(numEntities, state.counter()) << "validator " << i;
 				EXPECT_EQ(numEntities, state.numUniqueItems()) << "validator " << i;
 
-				// - the work was distributed evenly across threads
-				//   (a thread can do more than the min amount of work if the number of entities is not divisible by
-				//    the number of threads)
+				// - the work was distributed across all threads
+				//   (entities are claimed on demand, so threads that finish early can do more than an equal share of work)
 				for (auto counter : state.threadCounters())
-					EXPECT_LE(minWorkPerThread, counter) << "validator " << i;
+					EXPECT_LE(1u, counter) << "validator " << i;
 
 				EXPECT_EQ(Num_Default_Threads, state.threadCounters().size());
 				EXPECT_EQ(Num_Default_Threads, state.sortedAndReducedThreadIds().size());
@@ -140,6 +140,7 @@ namespace catapult { namespace test {
 	struct BlockStorageTests {
 	private:
 		using StorageContext = StorageContextT<TTraits>;
+		using BlockStorageBlocks = std::vector<std::shared_ptr<const model::Block>>;
 
 	private:
 		static auto PrepareStorageWithBlocks(size_t numBlocks) {
@@ -454,6 +455,80 @@ namespace catapult { namespace test {
 
 		// endregion
 
+		// region loadBlocks
+
+	private:
+		static void AssertLoadedBlocks(const io::BlockStorage& storage, Height startHeight, const BlockStorageBlocks& blocks) {
+			auto height = startHeight;
+			for (const auto& pBlock : blocks) {
+				auto message = "block at " + std::to_string(height.unwrap());
+				EXPECT_EQ(*storage.loadBlock(height), *pBlock) << message;
+				height = height + Height(1);
+			}
+		}
+
+	public:
+		static void AssertLoadBlocks_CanLoadBlocks() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+
+			// Act:
+			auto blocks = pStorage->loadBlocks(Height(3), 5, std::numeric_limits<size_t>::max());
+
+			// Assert:
+			ASSERT_EQ(5u, blocks.size());
+			AssertLoadedBlocks(*pStorage, Height(3), blocks);
+		}
+
+		static void AssertLoadBlocks_LoadsAreBoundedByChainHeight() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+
+			// Act:
+			auto blocks = pStorage->loadBlocks(Height(8), 5, std::numeric_limits<size_t>::max());
+
+			// Assert:
+			ASSERT_EQ(3u, blocks.size());
+			AssertLoadedBlocks(*pStorage, Height(8), blocks);
+		}
+
+		static void AssertLoadBlocks_LoadsAreBoundedByMaxBytes() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+			auto maxBytes = 0u;
+			for (auto height : { Height(3), Height(4), Height(5) })
+				maxBytes += pStorage->loadBlock(height)->Size;
+
+			// Act: the third block does not fit
+			auto blocks = pStorage->loadBlocks(Height(3), 5, maxBytes - 1);
+
+			// Assert:
+			ASSERT_EQ(2u, blocks.size());
+			AssertLoadedBlocks(*pStorage, Height(3), blocks);
+		}
+
+		static void AssertLoadBlocks_LoadsAtLeastOneBlock() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+
+			// Act:
+			auto blocks = pStorage->loadBlocks(Height(3), 5, 0);
+
+			// Assert:
+			ASSERT_EQ(1u, blocks.size());
+			AssertLoadedBlocks(*pStorage, Height(3), blocks);
+		}
+
+		static void AssertLoadBlocks_CannotLoadAtHeightGreaterThanChainHeight() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+
+			// Act + Assert:
+			EXPECT_THROW(pStorage->loadBlocks(Height(11), 5, std::numeric_limits<size_t>::max()), catapult_invalid_argument);
+		}
+
+		// endregion
+
 		// region loadBlockElement - nemesis
 
 		static void AssertStorageSeedInitiallyContainsNemesisBlock() {
@@ -624,6 +699,12 @@ namespace catapult { namespace test {
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanDropBlocksAfterHeightAndSaveBlock) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanDropAllBlocks) \
 	\
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlocks_CanLoadBlocks) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlocks_LoadsAreBoundedByChainHeight) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlocks_LoadsAreBoundedByMaxBytes) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlocks_LoadsAtLeastOneBlock) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlocks_CannotLoadAtHeightGreaterThanChainHeight) \
+	\
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, StorageSeedInitiallyContainsNemesisBlock) \
 	\
 	DEFINE_BLOCK_STORAGE_LOAD_TESTS(TRAITS_NAME, CanLoadAtHeightLessThanChainHeight) \
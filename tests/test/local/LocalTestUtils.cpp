@@ -184,6 +184,7 @@ namespace catapult { namespace test {
 
 			config.MaxBlocksPerSyncAttempt = 4 * 100;
 			config.MaxChainBytesPerSyncAttempt = utils::FileSize::FromKilobytes(8 * 512);
+			config.BlockStorageCacheMaxSize = utils::FileSize::FromKilobytes(8 * 512);
 
 			config.ShortLivedCacheMaxSize = 10;
 
@@ -205,6 +206,8 @@ namespace catapult { namespace test {
 			config.IncomingSecurityModes = ionet::ConnectionSecurityMode::None;
 
 			config.MaxCacheDatabaseWriteBatchSize = utils::FileSize::FromMegabytes(5);
+			config.CacheDatabaseBloomFilterBitsPerKey = 10;
+			config.ShouldSyncCacheDatabaseWrites = true;
 			config.MaxTrackedNodes = 5'000;
 
 			config.Local.Host = "127.0.0.1";
@@ -0,0 +1,141 @@
+/**
+*** Copyright 2024 ProximaX Limited. All rights reserved.
+*** Use of this source code is governed by the Apache 2.0
+*** license that can be found in the LICENSE file.
+**/
+
+#include "tools/ToolMain.h"
+#include "catapult/io/BlockStatementSerializer.h"
+#include "catapult/io/BufferInputStreamAdapter.h"
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/io/PackFileBlockStorage.h"
+#include "catapult/utils/Logging.h"
+#include <boost/filesystem.hpp>
+
+namespace catapult { namespace tools { namespace packblocks {
+
+	namespace {
+		constexpr uint64_t Progress_Interval = 10'000;
+
+		std::shared_ptr<const model::BlockElement> LoadBlockElementWithStatement(const io::BlockStorage& storage, Height height) {
+			auto pBlockElement = storage.loadBlockElement(height);
+			auto blockStatementPair = storage.loadBlockStatementData(height);
+			if (blockStatementPair.second) {
+				auto pBlockStatement = std::make_shared<model::BlockStatement>();
+				io::BufferInputStreamAdapter<std::vector<uint8_t>> blockStatementStream(blockStatementPair.first);
+				io::ReadBlockStatement(blockStatementStream, *pBlockStatement);
+				const_cast<model::BlockElement&>(*pBlockElement).OptionalStatement = std::move(pBlockStatement);
+			}
+
+			return pBlockElement;
+		}
+
+		bool IsBlockDirectory(const boost::filesystem::path& path) {
+			auto name = path.filename().generic_string();
+			return boost::filesystem::is_directory(path)
+					&& 5 == name.size()
+					&& std::all_of(name.cbegin(), name.cend(), [](auto ch) { return ch >= '0' && ch <= '9'; });
+		}
+
+		class PackBlocksTool : public Tool {
+		public:
+			std::string name() const override {
+				return "Pack Blocks Tool";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder, OptionsPositional&) override {
+				optionsBuilder("data-directory,d",
+						OptionsValue<std::string>(m_dataDirectory)->default_value("../data"),
+						"path to the data directory of a stopped node");
+
+				optionsBuilder("remove-files,r",
+						OptionsSwitch(m_removeFiles),
+						"remove block files after successful conversion");
+			}
+
+			int run(const Options&) override {
+				if (io::FileBlockStorageMode::Pack_File == io::GetFileBlockStorageMode(m_dataDirectory)) {
+					CATAPULT_LOG(warning) << "blocks in " << m_dataDirectory << " are already stored in pack files";
+					return 0;
+				}
+
+				auto dataDirectory = boost::filesystem::path(m_dataDirectory);
+				auto packsTempDirectory = dataDirectory / "packs.tmp";
+				auto packsDirectory = dataDirectory / "packs";
+				boost::filesystem::remove_all(packsTempDirectory);
+				boost::filesystem::remove_all(packsDirectory);
+
+				io::FileBlockStorage sourceStorage(m_dataDirectory);
+				auto chainHeight = sourceStorage.chainHeight();
+				CATAPULT_LOG(info) << "converting " << chainHeight << " blocks in " << m_dataDirectory;
+
+				{
+					io::PackFileBlockStorage destinationStorage(packsTempDirectory.generic_string());
+					for (auto height = Height(1); height <= chainHeight; height = height + Height(1)) {
+						auto pBlockElement = LoadBlockElementWithStatement(sourceStorage, height);
+						destinationStorage.saveBlock(*pBlockElement);
+
+						if (0 == height.unwrap() % Progress_Interval)
+							CATAPULT_LOG(info) << "converted " << height << " / " << chainHeight << " blocks";
+					}
+
+					if (!verify(sourceStorage, destinationStorage))
+						return 1;
+				}
+
+				// packs only become visible to the node after all blocks have been converted and verified
+				boost::filesystem::rename(packsTempDirectory, packsDirectory);
+				CATAPULT_LOG(info) << "blocks are stored in " << packsDirectory.generic_string();
+
+				if (m_removeFiles)
+					removeBlockFiles(dataDirectory);
+
+				return 0;
+			}
+
+		private:
+			bool verify(const io::BlockStorage& sourceStorage, const io::BlockStorage& destinationStorage) {
+				auto chainHeight = sourceStorage.chainHeight();
+				if (chainHeight != destinationStorage.chainHeight()) {
+					CATAPULT_LOG(error)
+							<< "converted chain height " << destinationStorage.chainHeight()
+							<< " does not match chain height " << chainHeight;
+					return false;
+				}
+
+				for (auto height = Height(1); height <= chainHeight; height = height + Height(Progress_Interval)) {
+					auto sourceHashes = sourceStorage.loadHashesFrom(height, Progress_Interval);
+					auto destinationHashes = destinationStorage.loadHashesFrom(height, Progress_Interval);
+					auto areEqual = sourceHashes.size() == destinationHashes.size()
+							&& std::equal(sourceHashes.cbegin(), sourceHashes.cend(), destinationHashes.cbegin());
+					if (!areEqual) {
+						CATAPULT_LOG(error) << "converted hashes starting at height " << height << " do not match";
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			void removeBlockFiles(const boost::filesystem::path& dataDirectory) {
+				size_t numRemovedFiles = 0;
+				for (boost::filesystem::directory_iterator iter(dataDirectory); boost::filesystem::directory_iterator() != iter; ++iter) {
+					if (IsBlockDirectory(iter->path()))
+						numRemovedFiles += boost::filesystem::remove_all(iter->path());
+				}
+
+				numRemovedFiles += boost::filesystem::remove(dataDirectory / "index.dat");
+				CATAPULT_LOG(info) << "removed " << numRemovedFiles << " block files";
+			}
+
+		private:
+			std::string m_dataDirectory;
+			bool m_removeFiles;
+		};
+	}
+}}}
+
+int main(int argc, const char** argv) {
+	catapult::tools::packblocks::PackBlocksTool tool;
+	return catapult::tools::ToolMain(argc, argv, tool);
+}